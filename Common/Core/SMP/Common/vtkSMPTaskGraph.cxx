@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "SMP/Common/vtkSMPTaskGraph.h"
+
+#include <cassert> // For assert
+#include <utility> // For std::move
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGraph::TaskId vtkSMPTaskGraph::AddTask(
+  std::function<void()> task, const TaskId* dependencies, std::size_t numberOfDependencies)
+{
+  LaunchFunctionType launch;
+  TaskId id;
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    id = this->Tasks.size();
+    this->Tasks.emplace_back();
+    Task& newTask = this->Tasks.back();
+    newTask.Function = std::move(task);
+    for (std::size_t i = 0; i < numberOfDependencies; ++i)
+    {
+      assert(dependencies[i] < id && "A task can only depend on previously added tasks.");
+      Task& dependency = this->Tasks[dependencies[i]];
+      if (!dependency.Finished)
+      {
+        dependency.Successors.push_back(id);
+        ++newTask.NumberOfPendingDependencies;
+      }
+    }
+    ++this->NumberOfUnfinishedTasks;
+
+    if (newTask.NumberOfPendingDependencies == 0)
+    {
+      if (this->Launch)
+      {
+        launch = this->Launch;
+      }
+      else
+      {
+        this->ReadyTasks.push_back(id);
+      }
+    }
+  }
+  // Launching outside of the lock lets backends run the task right away.
+  if (launch)
+  {
+    launch(id);
+  }
+  return id;
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkSMPTaskGraph::TaskId> vtkSMPTaskGraph::Start(LaunchFunctionType launch)
+{
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  this->Launch = std::move(launch);
+  std::vector<TaskId> ready;
+  ready.swap(this->ReadyTasks);
+  return ready;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGraph::Execute(TaskId id, std::vector<TaskId>& ready)
+{
+  Task* task;
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    task = &this->Tasks[id];
+  }
+
+  task->Function();
+
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  task->Finished = true;
+  // Release the resources captured by the task as soon as possible.
+  task->Function = nullptr;
+  for (TaskId successorId : task->Successors)
+  {
+    if (--this->Tasks[successorId].NumberOfPendingDependencies == 0)
+    {
+      ready.push_back(successorId);
+    }
+  }
+  task->Successors.clear();
+  task->Successors.shrink_to_fit();
+  --this->NumberOfUnfinishedTasks;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGraph::Stop()
+{
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  this->Launch = nullptr;
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPTaskGraph::GetNumberOfTasks() const
+{
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  return this->Tasks.size();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGraph::ExecuteSerial()
+{
+  std::deque<TaskId> queue;
+  std::vector<TaskId> roots = this->Start([&queue](TaskId id) { queue.push_back(id); });
+  queue.insert(queue.end(), roots.begin(), roots.end());
+
+  std::vector<TaskId> ready;
+  while (!queue.empty())
+  {
+    const TaskId id = queue.front();
+    queue.pop_front();
+    this->Execute(id, ready);
+    queue.insert(queue.end(), ready.begin(), ready.end());
+    ready.clear();
+  }
+  this->Stop();
+}
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
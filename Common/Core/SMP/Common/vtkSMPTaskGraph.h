@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkSMPTaskGraph_h
+#define vtkSMPTaskGraph_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <atomic>     // For std::atomic
+#include <cstddef>    // For std::size_t
+#include <deque>      // For std::deque
+#include <functional> // For std::function
+#include <mutex>      // For std::mutex
+#include <vector>     // For std::vector
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * @brief Dependency graph of the tasks of a vtkSMPTaskGroup.
+ *
+ * The graph only keeps track of the tasks and of their dependencies, the
+ * backends decide where and when the tasks run. A backend executes a graph
+ * by calling Start() with a function used to launch each task as soon as it
+ * is ready, launches the returned tasks, and runs Execute() for every
+ * launched task. Execute() returns the tasks made ready by the completion of
+ * the executed one, which the backend then launches too. The graph is done
+ * when IsDone() returns true, after which the backend calls Stop().
+ *
+ * Tasks may be added while the graph is executing, from within a running
+ * task. They are then launched right away if their dependencies are already
+ * complete.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPTaskGraph
+{
+public:
+  using TaskId = std::size_t;
+  using LaunchFunctionType = std::function<void(TaskId)>;
+
+  vtkSMPTaskGraph() = default;
+  ~vtkSMPTaskGraph() = default;
+  vtkSMPTaskGraph(const vtkSMPTaskGraph&) = delete;
+  vtkSMPTaskGraph& operator=(const vtkSMPTaskGraph&) = delete;
+
+  /**
+   * Add a task running after the given dependencies, which must be tasks
+   * previously added to this graph. Thread safe.
+   */
+  TaskId AddTask(
+    std::function<void()> task, const TaskId* dependencies, std::size_t numberOfDependencies);
+
+  /**
+   * Begin the execution of the graph. launch is used for every task getting
+   * ready from now on, until Stop() is called. Returns the tasks that are
+   * already ready and that the caller must launch.
+   */
+  std::vector<TaskId> Start(LaunchFunctionType launch);
+
+  /**
+   * Run a launched task and append to ready the tasks that were waiting only
+   * for it. The caller is responsible for launching them.
+   */
+  void Execute(TaskId id, std::vector<TaskId>& ready);
+
+  /**
+   * End the execution of the graph.
+   */
+  void Stop();
+
+  /**
+   * Return true when every task added to the graph has completed.
+   */
+  bool IsDone() const { return this->NumberOfUnfinishedTasks.load() == 0; }
+
+  /**
+   * Return the number of tasks added to the graph since its creation.
+   */
+  std::size_t GetNumberOfTasks() const;
+
+  /**
+   * Execute the graph on the calling thread, running ready tasks in the
+   * order in which they were added.
+   */
+  void ExecuteSerial();
+
+private:
+  struct Task
+  {
+    std::function<void()> Function;
+    std::vector<TaskId> Successors;
+    std::size_t NumberOfPendingDependencies = 0;
+    bool Finished = false;
+  };
+
+  mutable std::mutex Mutex;
+  std::deque<Task> Tasks; // std::deque keeps references valid when growing
+  std::vector<TaskId> ReadyTasks;
+  LaunchFunctionType Launch;
+  std::atomic<std::size_t> NumberOfUnfinishedTasks{ 0 };
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPTaskGraph.h */
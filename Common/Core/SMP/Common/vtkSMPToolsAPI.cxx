@@ -6,7 +6,7 @@
 #include "vtkSetGet.h" // For vtkWarningMacro
 
 #include <algorithm> // For std::toupper
-#include <cstdlib>   // For std::getenv
+#include <cstdlib>   // For std::getenv, std::atoi
 #include <iostream>  // For std::cerr
 #include <string>    // For std::string
 
@@ -48,6 +48,13 @@ vtkSMPToolsAPI::vtkSMPToolsAPI()
 
   // Set max thread number from env
   this->RefreshNumberOfThread();
+
+  // Set STDThread work stealing from env
+  const char* vtkSMPWorkStealing = std::getenv("VTK_SMP_STDTHREAD_WORK_STEALING");
+  if (vtkSMPWorkStealing && this->STDThreadBackend)
+  {
+    this->STDThreadBackend->SetWorkStealing(std::atoi(vtkSMPWorkStealing) != 0);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -233,6 +240,43 @@ bool vtkSMPToolsAPI::GetNestedParallelism()
   return false;
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetWorkStealing(bool workStealing)
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      this->SequentialBackend->SetWorkStealing(workStealing);
+      break;
+    case BackendType::STDThread:
+      this->STDThreadBackend->SetWorkStealing(workStealing);
+      break;
+    case BackendType::TBB:
+      this->TBBBackend->SetWorkStealing(workStealing);
+      break;
+    case BackendType::OpenMP:
+      this->OpenMPBackend->SetWorkStealing(workStealing);
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPToolsAPI::GetWorkStealing()
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      return this->SequentialBackend->GetWorkStealing();
+    case BackendType::STDThread:
+      return this->STDThreadBackend->GetWorkStealing();
+    case BackendType::TBB:
+      return this->TBBBackend->GetWorkStealing();
+    case BackendType::OpenMP:
+      return this->OpenMPBackend->GetWorkStealing();
+  }
+  return false;
+}
+
 //------------------------------------------------------------------------------
 bool vtkSMPToolsAPI::IsParallelScope()
 {
@@ -271,6 +315,26 @@ bool vtkSMPToolsAPI::GetSingleThread()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::ExecuteTaskGraph(vtkSMPTaskGraph& graph)
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      this->SequentialBackend->ExecuteTaskGraph(graph);
+      break;
+    case BackendType::STDThread:
+      this->STDThreadBackend->ExecuteTaskGraph(graph);
+      break;
+    case BackendType::TBB:
+      this->TBBBackend->ExecuteTaskGraph(graph);
+      break;
+    case BackendType::OpenMP:
+      this->OpenMPBackend->ExecuteTaskGraph(graph);
+      break;
+  }
+}
+
 //------------------------------------------------------------------------------
 // Must NOT be initialized. Default initialization to zero is necessary.
 unsigned int vtkSMPToolsAPIInitializeCount;
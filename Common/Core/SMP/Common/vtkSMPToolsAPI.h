@@ -65,12 +65,21 @@ public:
   //--------------------------------------------------------------------------------
   bool GetNestedParallelism();
 
+  //--------------------------------------------------------------------------------
+  void SetWorkStealing(bool workStealing);
+
+  //--------------------------------------------------------------------------------
+  bool GetWorkStealing();
+
   //--------------------------------------------------------------------------------
   bool IsParallelScope();
 
   //--------------------------------------------------------------------------------
   bool GetSingleThread();
 
+  //--------------------------------------------------------------------------------
+  void ExecuteTaskGraph(vtkSMPTaskGraph& graph);
+
   //--------------------------------------------------------------------------------
   int GetInternalDesiredNumberOfThread() { return this->DesiredNumberOfThread; }
 
@@ -219,6 +228,75 @@ public:
     }
   }
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+  T TransformReduce(InputIt begin, InputIt end, T init, ReduceOp& reduce, TransformOp& transform)
+  {
+    T result = init;
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        result = this->SequentialBackend->TransformReduce(begin, end, init, reduce, transform);
+        break;
+      case BackendType::STDThread:
+        result = this->STDThreadBackend->TransformReduce(begin, end, init, reduce, transform);
+        break;
+      case BackendType::TBB:
+        result = this->TBBBackend->TransformReduce(begin, end, init, reduce, transform);
+        break;
+      case BackendType::OpenMP:
+        result = this->OpenMPBackend->TransformReduce(begin, end, init, reduce, transform);
+        break;
+    }
+    return result;
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, BinaryOp& op)
+  {
+    OutputIt result = outBegin;
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        result = this->SequentialBackend->InclusiveScan(begin, end, outBegin, op);
+        break;
+      case BackendType::STDThread:
+        result = this->STDThreadBackend->InclusiveScan(begin, end, outBegin, op);
+        break;
+      case BackendType::TBB:
+        result = this->TBBBackend->InclusiveScan(begin, end, outBegin, op);
+        break;
+      case BackendType::OpenMP:
+        result = this->OpenMPBackend->InclusiveScan(begin, end, outBegin, op);
+        break;
+    }
+    return result;
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp& op)
+  {
+    OutputIt result = outBegin;
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        result = this->SequentialBackend->ExclusiveScan(begin, end, outBegin, init, op);
+        break;
+      case BackendType::STDThread:
+        result = this->STDThreadBackend->ExclusiveScan(begin, end, outBegin, init, op);
+        break;
+      case BackendType::TBB:
+        result = this->TBBBackend->ExclusiveScan(begin, end, outBegin, init, op);
+        break;
+      case BackendType::OpenMP:
+        result = this->OpenMPBackend->ExclusiveScan(begin, end, outBegin, init, op);
+        break;
+    }
+    return result;
+  }
+
   // disable copying
   vtkSMPToolsAPI(vtkSMPToolsAPI const&) = delete;
   void operator=(vtkSMPToolsAPI const&) = delete;
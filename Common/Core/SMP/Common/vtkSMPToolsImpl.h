@@ -24,6 +24,8 @@ namespace detail
 namespace smp
 {
 VTK_ABI_NAMESPACE_BEGIN
+class vtkSMPTaskGraph;
+
 enum class BackendType
 {
   Sequential = VTK_SMP_BACKEND_SEQUENTIAL,
@@ -61,6 +63,12 @@ public:
   //--------------------------------------------------------------------------------
   bool GetNestedParallelism() { return this->NestedActivated; }
 
+  //--------------------------------------------------------------------------------
+  void SetWorkStealing(bool workStealing) { this->WorkStealingActivated = workStealing; }
+
+  //--------------------------------------------------------------------------------
+  bool GetWorkStealing() { return this->WorkStealingActivated; }
+
   //--------------------------------------------------------------------------------
   bool IsParallelScope() { return this->IsParallel; }
 
@@ -92,6 +100,21 @@ public:
   template <typename RandomAccessIterator, typename Compare>
   void Sort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp);
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+  T TransformReduce(InputIt begin, InputIt end, T init, ReduceOp reduce, TransformOp transform);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  void ExecuteTaskGraph(vtkSMPTaskGraph& graph);
+
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl()
     : NestedActivated(true)
@@ -102,6 +125,7 @@ public:
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl(const vtkSMPToolsImpl& other)
     : NestedActivated(other.NestedActivated)
+    , WorkStealingActivated(other.WorkStealingActivated)
     , IsParallel(other.IsParallel.load())
   {
   }
@@ -110,11 +134,13 @@ public:
   void operator=(const vtkSMPToolsImpl& other)
   {
     this->NestedActivated = other.NestedActivated;
+    this->WorkStealingActivated = other.WorkStealingActivated;
     this->IsParallel = other.IsParallel.load();
   }
 
 private:
   bool NestedActivated = false;
+  bool WorkStealingActivated = false;
   std::atomic<bool> IsParallel{ false };
 };
 
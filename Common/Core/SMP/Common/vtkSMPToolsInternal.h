@@ -4,7 +4,10 @@
 #ifndef vtkSMPToolsInternal_h
 #define vtkSMPToolsInternal_h
 
-#include <iterator> // For std::advance
+#include <algorithm> // For std::min
+#include <iterator>  // For std::advance
+#include <utility>   // For std::forward
+#include <vector>    // For std::vector
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -90,6 +93,276 @@ public:
   T operator()(T vtkNotUsed(inValue)) { return Value; }
 };
 
+//--------------------------------------------------------------------------------
+// Reduction and scan helpers.
+//
+// The threaded backends implement TransformReduce, InclusiveScan and
+// ExclusiveScan with a two pass block algorithm: the input range is split
+// into a small number of contiguous blocks, each block is reduced in
+// parallel, the block sums are combined serially in block order, and (for
+// the scans) a second parallel pass writes the output of each block starting
+// from its carry. Since the blocks are combined in order, the binary
+// operation only needs to be associative, not commutative, and the result
+// does not depend on how the blocks were scheduled.
+struct IdentityFunctor
+{
+  template <typename T>
+  T&& operator()(T&& value) const
+  {
+    return std::forward<T>(value);
+  }
+};
+
+// Below this many elements per block the second pass costs more than it saves.
+constexpr vtkIdType ScanMinimumBlockSize = 1024;
+
+inline vtkIdType GetNumberOfScanBlocks(vtkIdType size, int numberOfThreads)
+{
+  const vtkIdType maxBlocks = static_cast<vtkIdType>(numberOfThreads > 0 ? numberOfThreads : 1) * 4;
+  const vtkIdType numBlocks = (std::min)(maxBlocks, size / ScanMinimumBlockSize);
+  return numBlocks > 1 ? numBlocks : 1;
+}
+
+template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+T TransformReduceSerial(
+  InputIt begin, vtkIdType size, T init, ReduceOp& reduce, TransformOp& transform)
+{
+  T acc = init;
+  for (vtkIdType i = 0; i < size; ++i, ++begin)
+  {
+    acc = reduce(acc, transform(*begin));
+  }
+  return acc;
+}
+
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt ExclusiveScanSerial(InputIt begin, vtkIdType size, OutputIt out, T init, BinaryOp& op)
+{
+  T acc = init;
+  for (vtkIdType i = 0; i < size; ++i, ++begin, ++out)
+  {
+    // Read before writing, so that the scan can be done in place.
+    T next = op(acc, *begin);
+    *out = acc;
+    acc = next;
+  }
+  return out;
+}
+
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt InclusiveScanSerial(InputIt begin, vtkIdType size, OutputIt out, BinaryOp& op)
+{
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  if (size <= 0)
+  {
+    return out;
+  }
+  ValueType acc = *begin;
+  *out = acc;
+  for (vtkIdType i = 1; i < size; ++i)
+  {
+    acc = op(acc, *(++begin));
+    *(++out) = acc;
+  }
+  return ++out;
+}
+
+template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+class TransformReduceBlockCall
+{
+  InputIt In;
+  vtkIdType Size;
+  vtkIdType BlockSize;
+  std::vector<T>& BlockSums;
+  ReduceOp& Reduce;
+  TransformOp& Transform;
+
+public:
+  TransformReduceBlockCall(InputIt _in, vtkIdType _size, vtkIdType _blockSize,
+    std::vector<T>& _blockSums, ReduceOp& _reduce, TransformOp& _transform)
+    : In(_in)
+    , Size(_size)
+    , BlockSize(_blockSize)
+    , BlockSums(_blockSums)
+    , Reduce(_reduce)
+    , Transform(_transform)
+  {
+  }
+
+  void Execute(vtkIdType beginBlock, vtkIdType endBlock)
+  {
+    for (vtkIdType block = beginBlock; block < endBlock; ++block)
+    {
+      const vtkIdType first = block * this->BlockSize;
+      const vtkIdType last = (std::min)(first + this->BlockSize, this->Size);
+      InputIt itIn(this->In);
+      std::advance(itIn, first);
+      T acc = this->Transform(*itIn);
+      ++itIn;
+      for (vtkIdType i = first + 1; i < last; ++i, ++itIn)
+      {
+        acc = this->Reduce(acc, this->Transform(*itIn));
+      }
+      this->BlockSums[block] = acc;
+    }
+  }
+};
+
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp, bool Inclusive>
+class ScanBlockCall
+{
+  InputIt In;
+  OutputIt Out;
+  vtkIdType Size;
+  vtkIdType BlockSize;
+  const std::vector<T>& Carries;
+  BinaryOp& Op;
+
+public:
+  ScanBlockCall(InputIt _in, OutputIt _out, vtkIdType _size, vtkIdType _blockSize,
+    const std::vector<T>& _carries, BinaryOp& _op)
+    : In(_in)
+    , Out(_out)
+    , Size(_size)
+    , BlockSize(_blockSize)
+    , Carries(_carries)
+    , Op(_op)
+  {
+  }
+
+  void Execute(vtkIdType beginBlock, vtkIdType endBlock)
+  {
+    for (vtkIdType block = beginBlock; block < endBlock; ++block)
+    {
+      const vtkIdType first = block * this->BlockSize;
+      const vtkIdType last = (std::min)(first + this->BlockSize, this->Size);
+      InputIt itIn(this->In);
+      OutputIt itOut(this->Out);
+      std::advance(itIn, first);
+      std::advance(itOut, first);
+      if (Inclusive && block == 0)
+      {
+        // The first block of an inclusive scan has no carry.
+        InclusiveScanSerial(itIn, last - first, itOut, this->Op);
+      }
+      else if (Inclusive)
+      {
+        T acc = this->Carries[block];
+        for (vtkIdType i = first; i < last; ++i, ++itIn, ++itOut)
+        {
+          acc = this->Op(acc, *itIn);
+          *itOut = acc;
+        }
+      }
+      else
+      {
+        ExclusiveScanSerial(itIn, last - first, itOut, this->Carries[block], this->Op);
+      }
+    }
+  }
+};
+
+template <typename Backend, typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+T TransformReduceBlocks(
+  Backend& backend, InputIt begin, InputIt end, T init, ReduceOp& reduce, TransformOp& transform)
+{
+  const vtkIdType size = std::distance(begin, end);
+  const vtkIdType numBlocks = GetNumberOfScanBlocks(size, backend.GetEstimatedNumberOfThreads());
+  if (numBlocks == 1)
+  {
+    return TransformReduceSerial(begin, size, init, reduce, transform);
+  }
+
+  const vtkIdType blockSize = (size + numBlocks - 1) / numBlocks;
+  std::vector<T> blockSums(static_cast<std::size_t>(numBlocks), init);
+  TransformReduceBlockCall<InputIt, T, ReduceOp, TransformOp> exec(
+    begin, size, blockSize, blockSums, reduce, transform);
+  backend.For(0, numBlocks, 1, exec);
+
+  T acc = init;
+  for (const auto& blockSum : blockSums)
+  {
+    acc = reduce(acc, blockSum);
+  }
+  return acc;
+}
+
+template <typename Backend, typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt InclusiveScanBlocks(
+  Backend& backend, InputIt begin, InputIt end, OutputIt outBegin, BinaryOp& op)
+{
+  using ValueType = typename std::iterator_traits<InputIt>::value_type;
+  const vtkIdType size = std::distance(begin, end);
+  const vtkIdType numBlocks = GetNumberOfScanBlocks(size, backend.GetEstimatedNumberOfThreads());
+  if (numBlocks == 1)
+  {
+    return InclusiveScanSerial(begin, size, outBegin, op);
+  }
+
+  // Pass 1: reduce each block.
+  const vtkIdType blockSize = (size + numBlocks - 1) / numBlocks;
+  std::vector<ValueType> carries(static_cast<std::size_t>(numBlocks), *begin);
+  IdentityFunctor identity;
+  TransformReduceBlockCall<InputIt, ValueType, BinaryOp, IdentityFunctor> reduceExec(
+    begin, size, blockSize, carries, op, identity);
+  backend.For(0, numBlocks, 1, reduceExec);
+
+  // Turn the block sums into carries: carries[b] holds the reduction of all
+  // the blocks before b.
+  ValueType acc = carries[0];
+  for (vtkIdType block = 1; block < numBlocks; ++block)
+  {
+    ValueType blockSum = carries[block];
+    carries[block] = acc;
+    acc = op(acc, blockSum);
+  }
+
+  // Pass 2: scan each block starting from its carry.
+  ScanBlockCall<InputIt, OutputIt, ValueType, BinaryOp, true> scanExec(
+    begin, outBegin, size, blockSize, carries, op);
+  backend.For(0, numBlocks, 1, scanExec);
+
+  std::advance(outBegin, size);
+  return outBegin;
+}
+
+template <typename Backend, typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt ExclusiveScanBlocks(
+  Backend& backend, InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp& op)
+{
+  const vtkIdType size = std::distance(begin, end);
+  const vtkIdType numBlocks = GetNumberOfScanBlocks(size, backend.GetEstimatedNumberOfThreads());
+  if (numBlocks == 1)
+  {
+    return ExclusiveScanSerial(begin, size, outBegin, init, op);
+  }
+
+  // Pass 1: reduce each block.
+  const vtkIdType blockSize = (size + numBlocks - 1) / numBlocks;
+  std::vector<T> carries(static_cast<std::size_t>(numBlocks), init);
+  IdentityFunctor identity;
+  TransformReduceBlockCall<InputIt, T, BinaryOp, IdentityFunctor> reduceExec(
+    begin, size, blockSize, carries, op, identity);
+  backend.For(0, numBlocks, 1, reduceExec);
+
+  // Turn the block sums into carries, starting from init.
+  T acc = init;
+  for (auto& carry : carries)
+  {
+    T blockSum = carry;
+    carry = acc;
+    acc = op(acc, blockSum);
+  }
+
+  // Pass 2: scan each block starting from its carry.
+  ScanBlockCall<InputIt, OutputIt, T, BinaryOp, false> scanExec(
+    begin, outBegin, size, blockSize, carries, op);
+  backend.For(0, numBlocks, 1, scanExec);
+
+  std::advance(outBegin, size);
+  return outBegin;
+}
+
 VTK_ABI_NAMESPACE_END
 
 } // namespace smp
@@ -4,9 +4,12 @@
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/OpenMP/vtkSMPToolsImpl.txx"
 
+#include "SMP/Common/vtkSMPTaskGraph.h"
+
 #include <cstdlib> // For std::getenv()
 #include <omp.h>
-#include <stack> // For std::stack
+#include <stack>  // For std::stack
+#include <vector> // For std::vector
 
 namespace vtk
 {
@@ -126,6 +129,47 @@ void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
   threadIdStack->pop();
 }
 
+//------------------------------------------------------------------------------
+static void vtkSMPToolsImplLaunchTaskOpenMP(vtkSMPTaskGraph* graph, vtkSMPTaskGraph::TaskId id)
+{
+#pragma omp task firstprivate(graph, id)
+  {
+    std::vector<vtkSMPTaskGraph::TaskId> ready;
+    graph->Execute(id, ready);
+    for (vtkSMPTaskGraph::TaskId readyId : ready)
+    {
+      vtkSMPToolsImplLaunchTaskOpenMP(graph, readyId);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExecuteTaskGraph(vtkSMPTaskGraph& graph)
+{
+  vtkSMPTaskGraph* graphPtr = &graph;
+  std::vector<vtkSMPTaskGraph::TaskId> roots = graph.Start(
+    [graphPtr](vtkSMPTaskGraph::TaskId id) { vtkSMPToolsImplLaunchTaskOpenMP(graphPtr, id); });
+  if (graph.IsDone())
+  {
+    graph.Stop();
+    return;
+  }
+
+  omp_set_nested(this->NestedActivated);
+
+  // The implicit barrier at the end of the parallel region waits for all the
+  // tasks, including the ones launched by other tasks.
+#pragma omp parallel num_threads(GetNumberOfThreadsOpenMP())
+#pragma omp single
+  for (vtkSMPTaskGraph::TaskId id : roots)
+  {
+    vtkSMPToolsImplLaunchTaskOpenMP(graphPtr, id);
+  }
+
+  graph.Stop();
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
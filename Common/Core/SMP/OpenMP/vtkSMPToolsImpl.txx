@@ -143,6 +143,33 @@ void vtkSMPToolsImpl<BackendType::OpenMP>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+T vtkSMPToolsImpl<BackendType::OpenMP>::TransformReduce(
+  InputIt begin, InputIt end, T init, ReduceOp reduce, TransformOp transform)
+{
+  return TransformReduceBlocks(*this, begin, end, init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::OpenMP>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, BinaryOp op)
+{
+  return InclusiveScanBlocks(*this, begin, end, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::OpenMP>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp op)
+{
+  return ExclusiveScanBlocks(*this, begin, end, outBegin, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::OpenMP>::Initialize(int);
@@ -159,6 +186,10 @@ int vtkSMPToolsImpl<BackendType::OpenMP>::GetEstimatedDefaultNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::OpenMP>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExecuteTaskGraph(vtkSMPTaskGraph& graph);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -4,8 +4,13 @@
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/STDThread/vtkSMPToolsImpl.txx"
 
-#include <cstdlib> // For std::getenv()
-#include <thread>  // For std::thread::hardware_concurrency()
+#include "SMP/Common/vtkSMPTaskGraph.h"
+
+#include <condition_variable> // For std::condition_variable
+#include <cstdlib>            // For std::getenv()
+#include <deque>              // For std::deque
+#include <mutex>              // For std::mutex
+#include <thread>             // For std::thread::hardware_concurrency()
 
 namespace vtk
 {
@@ -74,6 +79,67 @@ bool vtkSMPToolsImpl<BackendType::STDThread>::IsParallelScope()
   return vtkSMPThreadPool::GetInstance().IsParallelScope();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExecuteTaskGraph(vtkSMPTaskGraph& graph)
+{
+  vtkSMPThreadPool& pool = vtkSMPThreadPool::GetInstance();
+  if (!this->NestedActivated && pool.IsParallelScope())
+  {
+    graph.ExecuteSerial();
+    return;
+  }
+
+  // Ready tasks are shared by all the workers, so that a task never waits
+  // behind a long task while a thread is idle.
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<vtkSMPTaskGraph::TaskId> queue;
+  std::vector<vtkSMPTaskGraph::TaskId> roots =
+    graph.Start([&mutex, &condition, &queue](vtkSMPTaskGraph::TaskId id) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(id);
+      }
+      condition.notify_one();
+    });
+  if (graph.IsDone())
+  {
+    graph.Stop();
+    return;
+  }
+  queue.insert(queue.end(), roots.begin(), roots.end());
+
+  auto proxy = pool.AllocateThreads(GetNumberOfThreadsSTDThread());
+  const std::size_t numberOfWorkers = proxy.GetThreads().size();
+  for (std::size_t worker = 0; worker < numberOfWorkers; ++worker)
+  {
+    proxy.DoJob([&graph, &mutex, &condition, &queue] {
+      std::vector<vtkSMPTaskGraph::TaskId> ready;
+      std::unique_lock<std::mutex> lock(mutex);
+      for (;;)
+      {
+        condition.wait(lock, [&graph, &queue] { return !queue.empty() || graph.IsDone(); });
+        if (queue.empty())
+        {
+          break;
+        }
+        const vtkSMPTaskGraph::TaskId id = queue.front();
+        queue.pop_front();
+        lock.unlock();
+        graph.Execute(id, ready);
+        lock.lock();
+        queue.insert(queue.end(), ready.begin(), ready.end());
+        ready.clear();
+        // Wake up the workers for the new tasks, or to leave once the graph is done.
+        condition.notify_all();
+      }
+    });
+  }
+  proxy.Join();
+  graph.Stop();
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
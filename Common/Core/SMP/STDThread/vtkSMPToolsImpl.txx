@@ -8,9 +8,10 @@
 #include <functional> // For std::bind
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
-#include "SMP/Common/vtkSMPToolsInternal.h" // For common vtk smp class
-#include "SMP/STDThread/vtkSMPThreadPool.h" // For vtkSMPThreadPool
-#include "vtkCommonCoreModule.h"            // For export macro
+#include "SMP/Common/vtkSMPToolsInternal.h"           // For common vtk smp class
+#include "SMP/STDThread/vtkSMPThreadPool.h"           // For vtkSMPThreadPool
+#include "SMP/STDThread/vtkSMPWorkStealingScheduler.h" // For vtkSMPWorkStealingScheduler
+#include "vtkCommonCoreModule.h"                      // For export macro
 
 namespace vtk
 {
@@ -44,16 +45,48 @@ void vtkSMPToolsImpl<BackendType::STDThread>::For(
 
     if (grain <= 0)
     {
-      vtkIdType estimateGrain = (last - first) / (threadNumber * 4);
+      // Work stealing can recover from an unbalanced split, so it can afford more, smaller
+      // chunks than static scheduling.
+      const vtkIdType chunksPerThread = this->WorkStealingActivated ? 16 : 4;
+      vtkIdType estimateGrain = (last - first) / (threadNumber * chunksPerThread);
       grain = (estimateGrain > 0) ? estimateGrain : 1;
     }
 
     auto proxy = vtkSMPThreadPool::GetInstance().AllocateThreads(threadNumber);
 
-    for (vtkIdType from = first; from < last; from += grain)
+    if (this->WorkStealingActivated)
     {
-      const auto to = (std::min)(from + grain, last);
-      proxy.DoJob([&fi, from, to] { fi.Execute(from, to); });
+      if ((n - 1) / grain >= vtkSMPWorkStealingScheduler::MaximumNumberOfChunks)
+      {
+        grain = (n - 1) / (vtkSMPWorkStealingScheduler::MaximumNumberOfChunks - 1) + 1;
+      }
+      const vtkIdType numberOfChunks = (n - 1) / grain + 1;
+
+      // One worker job per proxy thread, each worker then pulls chunks from the scheduler.
+      const std::size_t numberOfWorkers = static_cast<std::size_t>(
+        (std::min)(static_cast<vtkIdType>(proxy.GetThreads().size()), numberOfChunks));
+      vtkSMPWorkStealingScheduler scheduler(numberOfChunks, numberOfWorkers);
+
+      for (std::size_t worker = 0; worker < numberOfWorkers; ++worker)
+      {
+        proxy.DoJob([&fi, &scheduler, worker, first, last, grain] {
+          vtkIdType chunk;
+          while (scheduler.GetNextChunk(worker, chunk))
+          {
+            const vtkIdType from = first + chunk * grain;
+            const vtkIdType to = (std::min)(from + grain, last);
+            fi.Execute(from, to);
+          }
+        });
+      }
+    }
+    else
+    {
+      for (vtkIdType from = first; from < last; from += grain)
+      {
+        const auto to = (std::min)(from + grain, last);
+        proxy.DoJob([&fi, from, to] { fi.Execute(from, to); });
+      }
     }
 
     proxy.Join();
@@ -115,6 +148,33 @@ void vtkSMPToolsImpl<BackendType::STDThread>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+T vtkSMPToolsImpl<BackendType::STDThread>::TransformReduce(
+  InputIt begin, InputIt end, T init, ReduceOp reduce, TransformOp transform)
+{
+  return TransformReduceBlocks(*this, begin, end, init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::STDThread>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, BinaryOp op)
+{
+  return InclusiveScanBlocks(*this, begin, end, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::STDThread>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp op)
+{
+  return ExclusiveScanBlocks(*this, begin, end, outBegin, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int);
@@ -131,6 +191,10 @@ int vtkSMPToolsImpl<BackendType::STDThread>::GetEstimatedDefaultNumberOfThreads(
 template <>
 bool vtkSMPToolsImpl<BackendType::STDThread>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExecuteTaskGraph(vtkSMPTaskGraph& graph);
+
 //--------------------------------------------------------------------------------
 template <>
 bool vtkSMPToolsImpl<BackendType::STDThread>::IsParallelScope();
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "SMP/STDThread/vtkSMPWorkStealingScheduler.h"
+
+#include <cassert>
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace
+{
+// A range [begin, end) of chunk indices is packed as begin << 32 | end
+inline std::uint64_t PackRange(std::uint64_t begin, std::uint64_t end)
+{
+  return (begin << 32) | end;
+}
+
+inline std::uint64_t RangeBegin(std::uint64_t range)
+{
+  return range >> 32;
+}
+
+inline std::uint64_t RangeEnd(std::uint64_t range)
+{
+  return range & 0xffffffff;
+}
+}
+
+struct vtkSMPWorkStealingScheduler::WorkerRange
+{
+  std::atomic<std::uint64_t> Range{ 0 };
+  // Keep each range on its own cache line to avoid false sharing between workers
+  char Padding[64 - sizeof(std::atomic<std::uint64_t>)];
+};
+
+vtkSMPWorkStealingScheduler::vtkSMPWorkStealingScheduler(
+  vtkIdType numberOfChunks, std::size_t numberOfWorkers)
+  : Ranges{ new WorkerRange[numberOfWorkers > 0 ? numberOfWorkers : 1] }
+  , NumberOfWorkers{ numberOfWorkers > 0 ? numberOfWorkers : 1 }
+{
+  assert(numberOfChunks >= 0 && numberOfChunks <= MaximumNumberOfChunks &&
+    "Invalid number of chunks");
+
+  // Give each worker an equal contiguous share, the first workers get one more chunk if
+  // the chunks can not be evenly split.
+  const auto chunks = static_cast<std::uint64_t>(numberOfChunks);
+  const std::uint64_t share = chunks / this->NumberOfWorkers;
+  const std::uint64_t remainder = chunks % this->NumberOfWorkers;
+  std::uint64_t begin = 0;
+  for (std::size_t worker = 0; worker < this->NumberOfWorkers; ++worker)
+  {
+    const std::uint64_t end = begin + share + (worker < remainder ? 1 : 0);
+    this->Ranges[worker].Range.store(PackRange(begin, end), std::memory_order_relaxed);
+    begin = end;
+  }
+}
+
+vtkSMPWorkStealingScheduler::~vtkSMPWorkStealingScheduler() = default;
+
+bool vtkSMPWorkStealingScheduler::GetNextChunk(std::size_t worker, vtkIdType& chunk)
+{
+  assert(worker < this->NumberOfWorkers && "Invalid worker");
+  auto& range = this->Ranges[worker].Range;
+
+  std::uint64_t current = range.load(std::memory_order_acquire);
+  while (true)
+  {
+    const std::uint64_t begin = RangeBegin(current);
+    const std::uint64_t end = RangeEnd(current);
+    if (begin < end)
+    {
+      // Pop from the front, on failure current is reloaded and we try again
+      if (range.compare_exchange_weak(current, PackRange(begin + 1, end),
+            std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        chunk = static_cast<vtkIdType>(begin);
+        return true;
+      }
+    }
+    else
+    {
+      if (!this->Steal(worker))
+      {
+        return false;
+      }
+      current = range.load(std::memory_order_acquire);
+    }
+  }
+}
+
+bool vtkSMPWorkStealingScheduler::Steal(std::size_t thief)
+{
+  // Visit the other workers in round robin order starting after the thief, so that thieves
+  // spread over different victims.
+  for (std::size_t i = 1; i < this->NumberOfWorkers; ++i)
+  {
+    auto& victimRange = this->Ranges[(thief + i) % this->NumberOfWorkers].Range;
+    std::uint64_t current = victimRange.load(std::memory_order_acquire);
+    while (RangeBegin(current) < RangeEnd(current))
+    {
+      const std::uint64_t begin = RangeBegin(current);
+      const std::uint64_t end = RangeEnd(current);
+      // Take the back half, rounded up so that a single remaining chunk can be stolen too
+      const std::uint64_t split = end - (end - begin + 1) / 2;
+      if (victimRange.compare_exchange_weak(current, PackRange(begin, split),
+            std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        // The thief range is empty, so nobody else can modify it: a plain store is enough
+        this->Ranges[thief].Range.store(PackRange(split, end), std::memory_order_release);
+        this->NumberOfSteals.fetch_add(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+std::size_t vtkSMPWorkStealingScheduler::GetNumberOfSteals() const noexcept
+{
+  return this->NumberOfSteals.load(std::memory_order_relaxed);
+}
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
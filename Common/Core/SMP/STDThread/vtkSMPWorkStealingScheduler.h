@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME vtkSMPWorkStealingScheduler - Work stealing chunk scheduler for the STDThread backend
+//
+// .SECTION Description
+// vtkSMPWorkStealingScheduler distributes the chunks of a For() range among a fixed number of
+// workers. Each worker starts with an equal contiguous share of the chunks and consumes it from
+// the front. When a worker runs out of chunks, it steals the back half of the remaining chunks
+// of another worker. This balances loops whose iterations have very uneven costs while keeping
+// consecutive chunks on the same thread most of the time.
+
+#ifndef vtkSMPWorkStealingScheduler_h
+#define vtkSMPWorkStealingScheduler_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For std::uint64_t
+#include <memory>  // For std::unique_ptr
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * @brief Lock free work stealing scheduler used by the STDThread backend.
+ *
+ * The range of each worker is stored as a pair of 32 bits chunk indices packed in a single
+ * atomic, so that both the owner (popping from the front) and the thieves (stealing from the
+ * back) update it with a single compare and exchange.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPWorkStealingScheduler
+{
+public:
+  /**
+   * Maximum number of chunks that can be scheduled. Callers must increase the grain when the
+   * range would be split into more chunks.
+   */
+  static constexpr vtkIdType MaximumNumberOfChunks = 0xffffffff;
+
+  /**
+   * Split numberOfChunks chunks among numberOfWorkers workers.
+   */
+  vtkSMPWorkStealingScheduler(vtkIdType numberOfChunks, std::size_t numberOfWorkers);
+  ~vtkSMPWorkStealingScheduler();
+  vtkSMPWorkStealingScheduler(const vtkSMPWorkStealingScheduler&) = delete;
+  vtkSMPWorkStealingScheduler& operator=(const vtkSMPWorkStealingScheduler&) = delete;
+
+  /**
+   * Get the next chunk to process for the given worker, stealing from the other workers if
+   * needed. Returns false when all the chunks have been handed out.
+   * A given worker must only be used by one thread at a time.
+   */
+  bool GetNextChunk(std::size_t worker, vtkIdType& chunk);
+
+  /**
+   * Get the number of successful steals, mainly for diagnostics.
+   */
+  std::size_t GetNumberOfSteals() const noexcept;
+
+private:
+  bool Steal(std::size_t thief);
+
+  struct WorkerRange;
+
+  std::unique_ptr<WorkerRange[]> Ranges;
+  std::size_t NumberOfWorkers;
+  std::atomic<std::size_t> NumberOfSteals{ 0 };
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPWorkStealingScheduler.h */
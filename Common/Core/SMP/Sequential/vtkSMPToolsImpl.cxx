@@ -4,6 +4,8 @@
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/Sequential/vtkSMPToolsImpl.txx"
 
+#include "SMP/Common/vtkSMPTaskGraph.h"
+
 namespace vtk
 {
 namespace detail
@@ -39,6 +41,13 @@ bool vtkSMPToolsImpl<BackendType::Sequential>::GetSingleThread()
   return true;
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExecuteTaskGraph(vtkSMPTaskGraph& graph)
+{
+  graph.ExecuteSerial();
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -93,6 +93,33 @@ void vtkSMPToolsImpl<BackendType::Sequential>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+T vtkSMPToolsImpl<BackendType::Sequential>::TransformReduce(
+  InputIt begin, InputIt end, T init, ReduceOp reduce, TransformOp transform)
+{
+  return TransformReduceSerial(begin, std::distance(begin, end), init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::Sequential>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, BinaryOp op)
+{
+  return InclusiveScanSerial(begin, std::distance(begin, end), outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::Sequential>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp op)
+{
+  return ExclusiveScanSerial(begin, std::distance(begin, end), outBegin, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::Sequential>::Initialize(int);
@@ -105,6 +132,10 @@ int vtkSMPToolsImpl<BackendType::Sequential>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::Sequential>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExecuteTaskGraph(vtkSMPTaskGraph& graph);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -4,9 +4,13 @@
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/TBB/vtkSMPToolsImpl.txx"
 
-#include <cstdlib> // For std::getenv()
-#include <mutex>   // For std::mutex
-#include <stack>   // For std::stack
+#include "SMP/Common/vtkSMPTaskGraph.h"
+
+#include <cstdlib>    // For std::getenv()
+#include <functional> // For std::function
+#include <mutex>      // For std::mutex
+#include <stack>      // For std::stack
+#include <vector>     // For std::vector
 
 #ifdef _MSC_VER
 #pragma push_macro("__TBB_NO_IMPLICIT_LINKAGE")
@@ -14,6 +18,7 @@
 #endif
 
 #include <tbb/task_arena.h> // For tbb:task_arena
+#include <tbb/task_group.h> // For tbb:task_group
 
 #ifdef _MSC_VER
 #pragma pop_macro("__TBB_NO_IMPLICIT_LINKAGE")
@@ -150,6 +155,53 @@ void vtkSMPToolsImplForTBB(vtkIdType first, vtkIdType last, vtkIdType grain,
   threadIdStackLock->unlock();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::TBB>::ExecuteTaskGraph(vtkSMPTaskGraph& graph)
+{
+  if (!this->NestedActivated && this->IsParallel)
+  {
+    graph.ExecuteSerial();
+    return;
+  }
+
+  bool fromParallelCode = this->IsParallel.exchange(true);
+
+  auto execute = [&graph] {
+    tbb::task_group group;
+    std::function<void(vtkSMPTaskGraph::TaskId)> launch;
+    launch = [&graph, &group, &launch](vtkSMPTaskGraph::TaskId id) {
+      group.run([&graph, &launch, id] {
+        std::vector<vtkSMPTaskGraph::TaskId> ready;
+        graph.Execute(id, ready);
+        for (vtkSMPTaskGraph::TaskId readyId : ready)
+        {
+          launch(readyId);
+        }
+      });
+    };
+    for (vtkSMPTaskGraph::TaskId id : graph.Start(launch))
+    {
+      launch(id);
+    }
+    group.wait();
+    graph.Stop();
+  };
+
+  if (taskArena->is_active())
+  {
+    taskArena->execute(execute);
+  }
+  else
+  {
+    execute();
+  }
+
+  // Same as in For(): this->IsParallel &= fromParallelCode.
+  bool trueFlag = true;
+  this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -194,6 +194,33 @@ void vtkSMPToolsImpl<BackendType::TBB>::Sort(
   tbb::parallel_sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+T vtkSMPToolsImpl<BackendType::TBB>::TransformReduce(
+  InputIt begin, InputIt end, T init, ReduceOp reduce, TransformOp transform)
+{
+  return TransformReduceBlocks(*this, begin, end, init, reduce, transform);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::TBB>::InclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, BinaryOp op)
+{
+  return InclusiveScanBlocks(*this, begin, end, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+OutputIt vtkSMPToolsImpl<BackendType::TBB>::ExclusiveScan(
+  InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp op)
+{
+  return ExclusiveScanBlocks(*this, begin, end, outBegin, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::TBB>::Initialize(int);
@@ -210,6 +237,10 @@ int vtkSMPToolsImpl<BackendType::TBB>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::TBB>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::TBB>::ExecuteTaskGraph(vtkSMPTaskGraph& graph);
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -72,6 +72,47 @@ int TestAffineArray(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     iArr++;
   }
 
+  // The range is given by the backend
+  double range[2];
+  affine->GetRange(range, 0);
+  if (range[0] != 9 || range[1] != 7 * 99 + 9)
+  {
+    res = EXIT_FAILURE;
+    std::cout << "range failed with vtkAffineArray" << std::endl;
+  }
+
+  vtkNew<vtkAffineArray<double>> decreasing;
+  decreasing->SetBackend(std::make_shared<vtkAffineImplicitBackend<double>>(-0.5, 10.0));
+  decreasing->SetNumberOfComponents(3);
+  decreasing->SetNumberOfTuples(10);
+  for (int comp = 0; comp < 3; comp++)
+  {
+    decreasing->GetRange(range, comp);
+    if (range[0] != -0.5 * (27 + comp) + 10.0 || range[1] != -0.5 * comp + 10.0)
+    {
+      res = EXIT_FAILURE;
+      std::cout << "multi-component range failed with vtkAffineArray" << std::endl;
+    }
+  }
+
+  // Ghosts are skipped with a scan of the values
+  unsigned char ghosts[10] = { 1, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+  decreasing->GetRange(range, 0, ghosts, 1);
+  if (range[0] != -0.5 * 24 + 10.0 || range[1] != -0.5 * 3 + 10.0)
+  {
+    res = EXIT_FAILURE;
+    std::cout << "range with ghosts failed with vtkAffineArray" << std::endl;
+  }
+
+  // Changing the backend invalidates the cached range
+  decreasing->SetBackend(std::make_shared<vtkAffineImplicitBackend<double>>(1.0, 0.0));
+  decreasing->GetRange(range, 0);
+  if (range[0] != 0.0 || range[1] != 27.0)
+  {
+    res = EXIT_FAILURE;
+    std::cout << "range was not updated with the backend of vtkAffineArray" << std::endl;
+  }
+
 #ifdef VTK_DISPATCH_AFFINE_ARRAYS
   std::cout << "vtkAffineArray: performing dispatch tests" << std::endl;
   vtkNew<vtkIntArray> destination;
@@ -11,6 +11,7 @@
 #endif // VTK_DISPATCH_CONSTANT_ARRAYS
 
 #include <cstdlib>
+#include <limits>
 #include <memory>
 
 #ifdef VTK_DISPATCH_CONSTANT_ARRAYS
@@ -70,6 +71,35 @@ int TestConstantArray(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     }
   }
 
+  // The range is given by the backend
+  double range[2];
+  identity->GetRange(range, 0);
+  if (range[0] != 1 || range[1] != 1)
+  {
+    res = EXIT_FAILURE;
+    std::cout << "range failed with vtkConstantArray" << std::endl;
+  }
+
+  // Non-finite constants fall back to a scan of the values
+  vtkNew<vtkConstantArray<double>> infinite;
+  infinite->SetBackend(std::make_shared<vtkConstantImplicitBackend<double>>(
+    std::numeric_limits<double>::infinity()));
+  infinite->SetNumberOfTuples(10);
+  infinite->SetNumberOfComponents(1);
+  infinite->GetRange(range, 0);
+  if (range[0] != std::numeric_limits<double>::infinity() ||
+    range[1] != std::numeric_limits<double>::infinity())
+  {
+    res = EXIT_FAILURE;
+    std::cout << "range failed with infinite vtkConstantArray" << std::endl;
+  }
+  infinite->GetFiniteRange(range, 0);
+  if (range[0] <= range[1])
+  {
+    res = EXIT_FAILURE;
+    std::cout << "finite range failed with infinite vtkConstantArray" << std::endl;
+  }
+
 #ifdef VTK_DISPATCH_CONSTANT_ARRAYS
   std::cout << "vtkConstantArray: performing dispatch tests" << std::endl;
   vtkNew<vtkIntArray> destination;
@@ -1,8 +1,12 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
 #include "vtkIntArray.h"
+#include "vtkMath.h"
 #include "vtkMathUtilities.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
 
 // Define this to run benchmarking tests on some vtkDataArray methods:
 #undef BENCHMARK
@@ -10,7 +14,6 @@
 
 #ifdef BENCHMARK
 #include "vtkIdList.h"
-#include "vtkNew.h"
 #include "vtkTimerLog.h"
 
 #include <iostream>
@@ -210,6 +213,67 @@ int TestDataArray(int, char*[])
   }
   cout << endl;
   farray->Delete();
+
+  // Exercise the contiguous range kernels with a number of tuples that is not
+  // a multiple of their lane count and non finite values on every component.
+  const vtkIdType numTuples = 1003;
+  vtkNew<vtkFloatArray> aosArray;
+  aosArray->SetNumberOfComponents(3);
+  aosArray->SetNumberOfTuples(numTuples);
+  vtkNew<vtkSOADataArrayTemplate<float>> soaArray;
+  soaArray->SetNumberOfComponents(3);
+  soaArray->SetNumberOfTuples(numTuples);
+  for (vtkIdType t = 0; t < numTuples; ++t)
+  {
+    for (int c = 0; c < 3; ++c)
+    {
+      const float value = static_cast<float>((t * 37 + c * 11) % 1000 - 500 + c);
+      aosArray->SetTypedComponent(t, c, value);
+      soaArray->SetTypedComponent(t, c, value);
+    }
+  }
+  const float nonFinite[3] = { static_cast<float>(vtkMath::Nan()),
+    static_cast<float>(vtkMath::Inf()), static_cast<float>(vtkMath::NegInf()) };
+  for (int c = 0; c < 3; ++c)
+  {
+    aosArray->SetTypedComponent(17 + c, c, nonFinite[c]);
+    aosArray->SetTypedComponent(numTuples - 1, c, nonFinite[(c + 1) % 3]);
+    soaArray->SetTypedComponent(17 + c, c, nonFinite[c]);
+    soaArray->SetTypedComponent(numTuples - 1, c, nonFinite[(c + 1) % 3]);
+  }
+  vtkDataArray* contiguousArrays[2] = { aosArray, soaArray };
+  for (vtkDataArray* contiguous : contiguousArrays)
+  {
+    for (int c = 0; c < 3; ++c)
+    {
+      double expected[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+      double expectedFinite[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+      for (vtkIdType t = 0; t < numTuples; ++t)
+      {
+        const double value = contiguous->GetComponent(t, c);
+        vtkMathUtilities::UpdateRange(expected[0], expected[1], value);
+        if (!vtkMath::IsInf(value))
+        {
+          vtkMathUtilities::UpdateRange(expectedFinite[0], expectedFinite[1], value);
+        }
+      }
+      contiguous->GetRange(range, c);
+      if (range[0] != expected[0] || range[1] != expected[1])
+      {
+        cerr << contiguous->GetClassName() << " component " << c << " range (" << range[0] << "-"
+             << range[1] << ") expected (" << expected[0] << "-" << expected[1] << ")" << endl;
+        return 1;
+      }
+      contiguous->GetFiniteRange(range, c);
+      if (range[0] != expectedFinite[0] || range[1] != expectedFinite[1])
+      {
+        cerr << contiguous->GetClassName() << " component " << c << " finite range (" << range[0]
+             << "-" << range[1] << ") expected (" << expectedFinite[0] << "-" << expectedFinite[1]
+             << ")" << endl;
+        return 1;
+      }
+    }
+  }
   return 0;
 }
 
@@ -3,6 +3,7 @@
 #include "vtkImplicitArrayTraits.h"
 
 #include "vtkSetGet.h" // for the vtkNotUsed
+#include "vtkType.h"   // for vtkIdType
 
 #include <cstdlib>
 #include <iostream>
@@ -49,6 +50,11 @@ struct CanGetMemorySize
   unsigned long getMemorySize() const { return 1ul; }
 };
 
+struct CanGetValueRange
+{
+  bool getValueRange(double*, int, vtkIdType, bool) const { return false; }
+};
+
 }
 
 int TestImplicitArrayTraits(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
@@ -358,5 +364,18 @@ int TestImplicitArrayTraits(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     result = EXIT_FAILURE;
   }
 
+  //--------------------------------------------------------------------------------
+  if (!vtk::detail::can_get_value_range_trait<::CanGetValueRange>::value)
+  {
+    std::cout << "Failed get value range check on CanGetValueRange" << std::endl;
+    result = EXIT_FAILURE;
+  }
+
+  if (vtk::detail::can_get_value_range_trait<::HasNothing>::value)
+  {
+    std::cout << "Failed get value range check on HasNothing" << std::endl;
+    result = EXIT_FAILURE;
+  }
+
   return result;
 }
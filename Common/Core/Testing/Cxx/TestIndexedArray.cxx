@@ -7,6 +7,7 @@
 #include "vtkIntArray.h"
 #include "vtkVTK_DISPATCH_IMPLICIT_ARRAYS.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <numeric>
 #include <random>
@@ -56,6 +57,34 @@ int TestIndexedArray(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     iArr++;
   }
 
+  // The range only accounts for the referenced values
+  double indexedRange[2];
+  indexed->GetRange(indexedRange, 0);
+  const auto minmax = std::minmax_element(handles->begin(), handles->end());
+  if (indexedRange[0] != *minmax.first || indexedRange[1] != *minmax.second)
+  {
+    res = EXIT_FAILURE;
+    std::cerr << "range failed with vtkIndexedArray" << std::endl;
+  }
+
+  // When all values are referenced, the range of the base array is used
+  vtkNew<vtkIdList> reversed;
+  reversed->SetNumberOfIds(1000);
+  for (vtkIdType idx = 0; idx < 1000; idx++)
+  {
+    reversed->SetId(idx, 999 - idx);
+  }
+  vtkNew<vtkIndexedArray<int>> permuted;
+  permuted->SetBackend(std::make_shared<vtkIndexedImplicitBackend<int>>(reversed, baseArray));
+  permuted->SetNumberOfComponents(1);
+  permuted->SetNumberOfTuples(1000);
+  permuted->GetRange(indexedRange, 0);
+  if (indexedRange[0] != 0 || indexedRange[1] != 999)
+  {
+    res = EXIT_FAILURE;
+    std::cerr << "range failed with permuted vtkIndexedArray" << std::endl;
+  }
+
   // Test memory size measurement for a large array
   vtkNew<vtkIdList> largeHandles;
   largeHandles->SetNumberOfIds(1024 * 3);
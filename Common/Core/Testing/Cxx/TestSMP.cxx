@@ -4,14 +4,20 @@
 #include "vtkNew.h"
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTaskGroup.h"
 #include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalArena.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <deque>
 #include <functional>
 #include <numeric>
 #include <set>
+#include <string>
 #include <vector>
 
 static const int Target = 10000;
@@ -166,6 +172,42 @@ public:
   void Reduce() {}
 };
 
+class ArenaFunctor
+{
+public:
+  vtkSMPThreadLocalArena Scratch{ 1024 };
+  vtkSMPThreadLocal<vtkIdType> Errors;
+  vtkIdType* Output;
+
+  void Initialize() { this->Errors.Local() = 0; }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkSMPThreadLocalArena::Arena& arena = this->Scratch.Local();
+    vtkSMPThreadLocalArena::Scope scope(arena);
+    // Larger than a block so that the arena has to reserve more memory.
+    vtkIdType* ids = arena.Allocate<vtkIdType>(static_cast<std::size_t>(end - begin));
+    double* alignedValue = arena.Allocate<double>(1);
+    std::vector<vtkIdType, vtkSMPThreadLocalArena::Allocator<vtkIdType>> values(
+      (vtkSMPThreadLocalArena::Allocator<vtkIdType>(arena)));
+    if (reinterpret_cast<std::uintptr_t>(alignedValue) % alignof(double) != 0)
+    {
+      ++this->Errors.Local();
+    }
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      ids[i - begin] = i;
+      values.push_back(2 * i);
+    }
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      this->Output[i] = ids[i - begin] + values[i - begin];
+    }
+  }
+
+  void Reduce() {}
+};
+
 // For sorting comparison
 bool myComp(double a, double b)
 {
@@ -286,6 +328,39 @@ int doTestSMP()
     }
   }
 
+  // Test work stealing scheduling, with and without nested parallelism. Iterations have very
+  // uneven costs so that threads finishing early steal work from the others.
+  const bool wasWorkStealing = vtkSMPTools::GetWorkStealing();
+  vtkSMPTools::SetWorkStealing(true);
+  for (const bool nested : { false, true })
+  {
+    std::vector<int> visits(Target, 0);
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ nested }, [&]() {
+      vtkSMPTools::For(0, Target, 7, [&](vtkIdType start, vtkIdType end) {
+        for (vtkIdType i = start; i < end; ++i)
+        {
+          const int cost = i < Target / 10 ? 20 : 1;
+          vtkSMPThreadLocal<int> nestedCounter(0);
+          vtkSMPTools::For(0, cost, [&](vtkIdType nestedStart, vtkIdType nestedEnd) {
+            nestedCounter.Local() += static_cast<int>(nestedEnd - nestedStart);
+          });
+          int count = 0;
+          for (const auto& el : nestedCounter)
+          {
+            count += el;
+          }
+          visits[i] += count == cost ? 1 : 2;
+        }
+      });
+    });
+    if (std::count(visits.begin(), visits.end(), 1) != Target)
+    {
+      cerr << "Error: work stealing For did not visit each index once!" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  vtkSMPTools::SetWorkStealing(wasWorkStealing);
+
   /* This Test is faulty, see: https://gitlab.kitware.com/vtk/vtk/-/issues/19338
   // Test GetSingleThread
   if (std::string(vtkSMPTools::GetBackend()) != "Sequential")
@@ -480,6 +555,177 @@ int doTestSMP()
       return EXIT_FAILURE;
     }
   }
+
+  // Test reduce and transform reduce. The range is large enough to be split
+  // into several blocks by the threaded backends.
+  const vtkIdType scanSize = 100003;
+  std::vector<vtkIdType> scanInput(scanSize);
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    scanInput[i] = i % 7;
+  }
+  const vtkIdType expectedSum = std::accumulate(scanInput.begin(), scanInput.end(), vtkIdType(5));
+  if (vtkSMPTools::Reduce(scanInput.begin(), scanInput.end(), vtkIdType(5)) != expectedSum)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::Reduce!" << endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType numZeros = vtkSMPTools::TransformReduce(scanInput.begin(), scanInput.end(),
+    vtkIdType(0), std::plus<vtkIdType>(), [](vtkIdType v) { return v == 0 ? 1 : 0; });
+  if (numZeros != (scanSize + 6) / 7)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::TransformReduce!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // String concatenation is associative but not commutative: the blocks must
+  // be combined in order.
+  std::vector<std::string> words(3000);
+  std::string expectedConcat;
+  for (std::size_t i = 0; i < words.size(); ++i)
+  {
+    words[i] = std::string(1, static_cast<char>('a' + i % 26));
+    expectedConcat += words[i];
+  }
+  if (vtkSMPTools::Reduce(words.begin(), words.end(), std::string()) != expectedConcat)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::Reduce with a non commutative operation!"
+         << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test inclusive and exclusive scans, out of place and in place.
+  std::vector<vtkIdType> inclusive(scanSize);
+  std::vector<vtkIdType> exclusive(scanSize);
+  auto inclusiveEnd =
+    vtkSMPTools::InclusiveScan(scanInput.begin(), scanInput.end(), inclusive.begin());
+  auto exclusiveEnd =
+    vtkSMPTools::ExclusiveScan(scanInput.begin(), scanInput.end(), exclusive.begin(), vtkIdType(5));
+  if (inclusiveEnd != inclusive.end() || exclusiveEnd != exclusive.end())
+  {
+    cerr << "Error: Invalid returned iterator for vtkSMPTools scans!" << endl;
+    return EXIT_FAILURE;
+  }
+  vtkIdType runningSum = 0;
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    if (exclusive[i] != runningSum + 5)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::ExclusiveScan!" << endl;
+      return EXIT_FAILURE;
+    }
+    runningSum += scanInput[i];
+    if (inclusive[i] != runningSum)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::InclusiveScan!" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Counts to offsets, in place, with the total stored in the extra last value.
+  std::vector<vtkIdType> offsets(scanInput);
+  offsets.push_back(0);
+  vtkSMPTools::ExclusiveScan(offsets.begin(), offsets.end(), offsets.begin(), vtkIdType(0));
+  if (offsets.back() != expectedSum - 5 || offsets[scanSize - 1] != exclusive[scanSize - 1] - 5)
+  {
+    cerr << "Error: Invalid output for in place vtkSMPTools::ExclusiveScan!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<vtkIdType> maxScan(scanInput);
+  vtkSMPTools::InclusiveScan(maxScan.begin(), maxScan.end(), maxScan.begin(),
+    [](vtkIdType a, vtkIdType b) { return std::max(a, b); });
+  if (maxScan[0] != 0 || maxScan[5] != 5 || maxScan[scanSize - 1] != 6)
+  {
+    cerr << "Error: Invalid output for in place vtkSMPTools::InclusiveScan!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Empty ranges
+  std::vector<vtkIdType> empty;
+  if (vtkSMPTools::Reduce(empty.begin(), empty.end(), vtkIdType(3)) != 3 ||
+    vtkSMPTools::InclusiveScan(empty.begin(), empty.end(), empty.begin()) != empty.end())
+  {
+    cerr << "Error: Invalid output for vtkSMPTools reduce and scan on an empty range!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Task groups honor dependencies, and running tasks can spawn new ones
+  std::atomic<int> step(0);
+  std::vector<int> order(6, -1);
+  std::vector<vtkIdType> taskSums(2, 0);
+  vtkSMPTaskGroup group;
+  auto taskA = group.Spawn([&] { order[0] = step++; });
+  auto taskB = group.Spawn([&] { order[1] = step++; }, { taskA });
+  auto taskC = group.Spawn(
+    [&] {
+      order[2] = step++;
+      // Tasks may use vtkSMPTools
+      ARangeFunctor sumFunctor;
+      vtkSMPTools::For(0, Target, sumFunctor);
+      taskSums[0] = std::accumulate(sumFunctor.Counter.begin(), sumFunctor.Counter.end(), 0);
+    },
+    { taskA });
+  group.Spawn(
+    [&] {
+      order[3] = step++;
+      group.Spawn([&] { order[5] = step++; }, { taskB });
+    },
+    { taskB, taskC });
+  group.Spawn([&] { order[4] = step++; });
+  group.Wait();
+  if (group.GetNumberOfTasks() != 6 || step != 6 || taskSums[0] != Target ||
+    std::find(order.begin(), order.end(), -1) != order.end() || order[1] < order[0] ||
+    order[2] < order[0] || order[3] < order[1] || order[3] < order[2] || order[5] < order[3])
+  {
+    cerr << "Error: Invalid execution of vtkSMPTaskGroup!" << endl;
+    return EXIT_FAILURE;
+  }
+  // The group can be reused, with dependencies on completed tasks
+  group.Spawn([&] { taskSums[1] = step.load(); }, { taskA, taskC });
+  group.Wait();
+  if (taskSums[1] != 6)
+  {
+    cerr << "Error: Invalid execution of a reused vtkSMPTaskGroup!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Thread local arenas reuse their memory from one chunk to the next
+  ArenaFunctor arenaFunctor;
+  std::vector<vtkIdType> arenaOutput(Target);
+  arenaFunctor.Output = arenaOutput.data();
+  vtkSMPTools::For(0, Target, 500, arenaFunctor);
+  for (vtkIdType i = 0; i < Target; ++i)
+  {
+    if (arenaOutput[i] != 3 * i)
+    {
+      cerr << "Error: Invalid output for vtkSMPThreadLocalArena!" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  for (const vtkIdType& errors : arenaFunctor.Errors)
+  {
+    if (errors != 0)
+    {
+      cerr << "Error: Misaligned allocation from vtkSMPThreadLocalArena!" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  // A chunk needs a few kilobytes, so an arena that reuses its blocks stays
+  // small whatever the number of chunks it processed.
+  const std::size_t arenaCapacity = arenaFunctor.Scratch.GetCapacity();
+  if (arenaCapacity == 0 || arenaCapacity > arenaFunctor.Scratch.size() * 64 * 1024)
+  {
+    cerr << "Error: vtkSMPThreadLocalArena does not reuse its memory!" << endl;
+    return EXIT_FAILURE;
+  }
+  arenaFunctor.Scratch.Release();
+  if (arenaFunctor.Scratch.GetCapacity() != 0)
+  {
+    cerr << "Error: vtkSMPThreadLocalArena::Release did not free the memory!" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
 
@@ -40,9 +40,11 @@ VTK_ABI_NAMESPACE_END
 } // namespace detail
 } // namespace vtk
 
+VTK_ABI_NAMESPACE_BEGIN
+class vtkMemoryMappedFile;
+
 // The export macro below makes no sense, but is necessary for older compilers
 // when we export instantiations of this class from vtkCommonCore.
-VTK_ABI_NAMESPACE_BEGIN
 template <class ValueTypeT>
 class VTKCOMMONCORE_EXPORT vtkAOSDataArrayTemplate
   : public vtkGenericDataArray<vtkAOSDataArrayTemplate<ValueTypeT>, ValueTypeT>
@@ -202,6 +204,26 @@ public:
    **/
   void SetArrayFreeFunction(void (*callback)(void*)) override;
 
+  /**
+   * Use @a numberOfValues values stored in the region mapped by @a file,
+   * starting @a offset bytes into it, as the memory of the array without
+   * copying them. The array keeps a reference to @a file, so the region stays
+   * mapped as long as the array uses it. The values must be in the byte order
+   * of the host. Returns false, leaving the array unchanged, if the values do
+   * not fit in the region or are not aligned for ValueType.
+   *
+   * The array may only be modified if @a file was mapped COPY_ON_WRITE. Growing
+   * the array copies its values to memory owned by the array.
+   */
+  bool SetMemoryMappedArray(
+    vtkMemoryMappedFile* file, vtkTypeInt64 offset, vtkIdType numberOfValues);
+
+  /**
+   * Return the mapped file whose memory the array uses, nullptr if the array
+   * does not use a mapped file (see SetMemoryMappedArray()).
+   */
+  vtkMemoryMappedFile* GetMemoryMappedFile();
+
   // Overridden for optimized implementations:
   void SetTuple(vtkIdType tupleIdx, const float* tuple) override;
   void SetTuple(vtkIdType tupleIdx, const double* tuple) override;
@@ -327,7 +349,10 @@ VTK_ABI_NAMESPACE_END
   T* WritePointer(vtkIdType id, vtkIdType number);                                                 \
   T* GetPointer(vtkIdType id);                                                                     \
   void SetArray(VTK_ZEROCOPY T* array, vtkIdType size, int save);                                  \
-  void SetArray(VTK_ZEROCOPY T* array, vtkIdType size, int save, int deleteMethod)
+  void SetArray(VTK_ZEROCOPY T* array, vtkIdType size, int save, int deleteMethod);                \
+  bool SetMemoryMappedArray(                                                                       \
+    vtkMemoryMappedFile* file, vtkTypeInt64 offset, vtkIdType numberOfValues);                     \
+  vtkMemoryMappedFile* GetMemoryMappedFile()
 
 #define vtkCreateReadOnlyWrappedArrayInterface(T)                                                  \
   int GetDataType() const override;                                                                \
@@ -12,6 +12,9 @@
 #include "vtkAOSDataArrayTemplate.h"
 
 #include "vtkArrayIteratorTemplate.h"
+#include "vtkMemoryMappedFile.h"
+
+#include <cstdint> // for std::uintptr_t
 
 //-----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -114,6 +117,38 @@ void vtkAOSDataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(v
   this->Buffer->SetFreeFunction(false, callback);
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+bool vtkAOSDataArrayTemplate<ValueTypeT>::SetMemoryMappedArray(
+  vtkMemoryMappedFile* file, vtkTypeInt64 offset, vtkIdType numberOfValues)
+{
+  if (!file || !file->IsMapped() || offset < 0 || numberOfValues < 0 ||
+    offset + numberOfValues * static_cast<vtkTypeInt64>(sizeof(ValueType)) > file->GetLength())
+  {
+    vtkErrorMacro("The values do not fit in the mapped region.");
+    return false;
+  }
+  char* address = static_cast<char*>(file->GetData()) + offset;
+  if (reinterpret_cast<std::uintptr_t>(address) % alignof(ValueType) != 0)
+  {
+    vtkErrorMacro("The mapped values are not aligned for " << this->GetDataTypeAsString() << ".");
+    return false;
+  }
+
+  this->Buffer->SetBuffer(reinterpret_cast<ValueType*>(address), numberOfValues, file);
+  this->Size = numberOfValues;
+  this->MaxId = this->Size - 1;
+  this->DataChanged();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+vtkMemoryMappedFile* vtkAOSDataArrayTemplate<ValueTypeT>::GetMemoryMappedFile()
+{
+  return vtkMemoryMappedFile::SafeDownCast(this->Buffer->GetBufferOwner());
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const float* tuple)
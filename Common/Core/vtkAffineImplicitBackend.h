@@ -5,6 +5,7 @@
 #define vtkAffineImplicitBackend_h
 
 #include "vtkCommonCoreModule.h"
+#include "vtkType.h" // For vtkIdType
 
 /**
  * \struct vtkAffineImplicitBackend
@@ -50,6 +51,16 @@ struct VTKCOMMONCORE_EXPORT vtkAffineImplicitBackend final
    */
   ValueType operator()(int index) const;
 
+  /**
+   * The values of each component are monotonic with the index, so their range is given by the
+   * first and last tuples.
+   *
+   * \return false when one of these values is NaN, or not finite and only finite values are
+   * requested
+   */
+  bool getValueRange(
+    double* ranges, int numberOfComponents, vtkIdType numberOfTuples, bool finite) const;
+
   /**
    * The slope of the affine function on the indices
    */
@@ -6,6 +6,9 @@
 
 #include "vtkAffineImplicitBackend.h"
 
+#include <algorithm>
+#include <cmath>
+
 /**
  * \struct vtkAffineImplicitBackend
  * \brief A utility structure serving as a backend for affine (as a function of the index) implicit
@@ -43,6 +46,26 @@ ValueType vtkAffineImplicitBackend<ValueType>::operator()(int index) const
 {
   return this->Slope * static_cast<ValueType>(index) + this->Intercept;
 }
+
+template <typename ValueType>
+bool vtkAffineImplicitBackend<ValueType>::getValueRange(
+  double* ranges, int numberOfComponents, vtkIdType numberOfTuples, bool finite) const
+{
+  const vtkIdType lastTuple = (numberOfTuples - 1) * numberOfComponents;
+  for (int comp = 0; comp < numberOfComponents; ++comp)
+  {
+    const double first = static_cast<double>((*this)(comp));
+    const double last = static_cast<double>((*this)(static_cast<int>(lastTuple + comp)));
+    if (std::isnan(first) || std::isnan(last) ||
+      (finite && (std::isinf(first) || std::isinf(last))))
+    {
+      return false;
+    }
+    ranges[2 * comp] = std::min(first, last);
+    ranges[2 * comp + 1] = std::max(first, last);
+  }
+  return true;
+}
 VTK_ABI_NAMESPACE_END
 
 #endif // vtkAffineImplicitBackend_txx
@@ -42,6 +42,19 @@ public:
    */
   void SetBuffer(ScalarType* array, vtkIdType size);
 
+  /**
+   * Set a memory buffer whose lifetime is managed by @a owner, such as a
+   * vtkMemoryMappedFile. The vtkBuffer keeps a reference to @a owner instead of
+   * freeing @a array, and releases it when the buffer is replaced or
+   * deleted. Reallocate() copies the values to memory owned by the vtkBuffer.
+   */
+  void SetBuffer(ScalarType* array, vtkIdType size, vtkObject* owner);
+
+  /**
+   * Return the object managing the lifetime of the buffer, if any.
+   */
+  vtkObject* GetBufferOwner() const { return this->BufferOwner; }
+
   /**
    * Set the malloc function to be used when allocating space inside this object.
    **/
@@ -80,6 +93,7 @@ protected:
   vtkBuffer()
     : Pointer(nullptr)
     , Size(0)
+    , BufferOwner(nullptr)
   {
     this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
     this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
@@ -93,6 +107,7 @@ protected:
   vtkMallocingFunction MallocFunction;
   vtkReallocingFunction ReallocFunction;
   vtkFreeingFunction DeleteFunction;
+  vtkObject* BufferOwner;
 
 private:
   vtkBuffer(const vtkBuffer&) = delete;
@@ -122,10 +137,32 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
     {
       this->DeleteFunction(this->Pointer);
     }
+    if (this->BufferOwner)
+    {
+      this->BufferOwner->UnRegister(this);
+      this->BufferOwner = nullptr;
+    }
     this->Pointer = array;
   }
   this->Size = size;
 }
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+void vtkBuffer<ScalarT>::SetBuffer(
+  typename vtkBuffer<ScalarT>::ScalarType* array, vtkIdType size, vtkObject* owner)
+{
+  if (owner)
+  {
+    // Register first in case the current buffer already belongs to owner.
+    owner->Register(this);
+  }
+  this->SetBuffer(nullptr, 0);
+  this->Pointer = array;
+  this->Size = size;
+  this->DeleteFunction = nullptr;
+  this->BufferOwner = owner;
+}
 //------------------------------------------------------------------------------
 template <typename ScalarT>
 void vtkBuffer<ScalarT>::SetMallocFunction(vtkMallocingFunction mallocFunction)
@@ -9,6 +9,8 @@
 #include "vtkSetGet.h"   // for vtkNotUsed
 #include "vtkType.h"     // For vtkExternTemplateMacro
 
+#include <cmath> // For std::isnan
+
 /**
  * \struct vtkConstantImplicitBackend
  * \brief A utility structure serving as a backend for constant implicit arrays
@@ -51,6 +53,27 @@ struct VTKCOMMONCORE_EXPORT vtkConstantImplicitBackend final
    */
   ValueType operator()(int vtkNotUsed(index)) const { return this->Value; }
 
+  /**
+   * The range of a constant array is the constant itself, for all components.
+   *
+   * \return false when the constant is NaN, or not finite and only finite values are requested
+   */
+  bool getValueRange(double* ranges, int numberOfComponents, vtkIdType vtkNotUsed(numberOfTuples),
+    bool finite) const
+  {
+    const double value = static_cast<double>(this->Value);
+    if (std::isnan(value) || (finite && std::isinf(value)))
+    {
+      return false;
+    }
+    for (int comp = 0; comp < numberOfComponents; ++comp)
+    {
+      ranges[2 * comp] = value;
+      ranges[2 * comp + 1] = value;
+    }
+    return true;
+  }
+
   /**
    * The constant value stored in the backend
    */
@@ -135,6 +135,15 @@
  * function through the `GetActualMemorySize` function. If the backend does not define it,
  * `GetActualMemorySize` always returns 1.
  *
+ * Backends that know the range of their values without iterating over them can also define
+ * `bool getValueRange(double* ranges, int numberOfComponents, vtkIdType numberOfTuples,
+ * bool finite) const`, filling the minimum and maximum of each component in `ranges` (of size
+ * `2 * numberOfComponents`) and returning false when they cannot provide it, e.g. because some
+ * values are NaN. `finite` requests the range of the finite values only. `GetRange` and
+ * `GetFiniteRange` then use it instead of a full scan of the values when no ghost array is
+ * given. As for other arrays, the resulting range is cached in the information of the array
+ * until the next call to `Modified`.
+ *
  * @sa
  * vtkGenericDataArray vtkImplicitArrayTraits vtkDataArray
  */
@@ -318,6 +327,19 @@ protected:
   vtkImplicitArray();
   ~vtkImplicitArray() override;
 
+  ///@{
+  /**
+   * Use the range provided by the backend, if any, when no ghost array is given. Fall back to
+   * the superclass implementation otherwise.
+   */
+  using GenericDataArrayType::ComputeScalarRange;
+  bool ComputeScalarRange(
+    double* ranges, const unsigned char* ghosts, unsigned char ghostsToSkip = 0xff) override;
+  using GenericDataArrayType::ComputeFiniteScalarRange;
+  bool ComputeFiniteScalarRange(
+    double* ranges, const unsigned char* ghosts, unsigned char ghostsToSkip = 0xff) override;
+  ///@}
+
   ///@{
   /**
    * No allocation necessary
@@ -488,6 +510,30 @@ private:
   }
   ///@}
 
+  ///@{
+  /**
+   * Static call to get the value range for compatible backends
+   */
+  template <typename U>
+  typename std::enable_if<vtk::detail::implicit_array_traits<U>::can_get_value_range, bool>::type
+  GetValueRangeImpl(double* ranges, bool finite) const
+  {
+    const vtkIdType numberOfTuples = this->GetNumberOfTuples();
+    return this->Backend && numberOfTuples > 0 &&
+      this->Backend->getValueRange(ranges, this->NumberOfComponents, numberOfTuples, finite);
+  }
+
+  /**
+   * Static call to get the value range for incompatible backends, which always need a full scan
+   */
+  template <typename U>
+  typename std::enable_if<!vtk::detail::implicit_array_traits<U>::can_get_value_range, bool>::type
+  GetValueRangeImpl(double* vtkNotUsed(ranges), bool vtkNotUsed(finite)) const
+  {
+    return false;
+  }
+  ///@}
+
   friend class vtkGenericDataArray<vtkImplicitArray<BackendT>, ValueTypeT>;
 };
 
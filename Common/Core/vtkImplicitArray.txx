@@ -72,6 +72,30 @@ void* vtkImplicitArray<BackendT>::GetVoidPointer(vtkIdType idx)
   return this->Internals->Cache->GetVoidPointer(idx);
 }
 
+//-----------------------------------------------------------------------------
+template <class BackendT>
+bool vtkImplicitArray<BackendT>::ComputeScalarRange(
+  double* ranges, const unsigned char* ghosts, unsigned char ghostsToSkip)
+{
+  if (!ghosts && this->GetValueRangeImpl<BackendT>(ranges, false))
+  {
+    return true;
+  }
+  return this->Superclass::ComputeScalarRange(ranges, ghosts, ghostsToSkip);
+}
+
+//-----------------------------------------------------------------------------
+template <class BackendT>
+bool vtkImplicitArray<BackendT>::ComputeFiniteScalarRange(
+  double* ranges, const unsigned char* ghosts, unsigned char ghostsToSkip)
+{
+  if (!ghosts && this->GetValueRangeImpl<BackendT>(ranges, true))
+  {
+    return true;
+  }
+  return this->Superclass::ComputeFiniteScalarRange(ranges, ghosts, ghostsToSkip);
+}
+
 //-----------------------------------------------------------------------------
 template <class BackendT>
 void vtkImplicitArray<BackendT>::Squeeze()
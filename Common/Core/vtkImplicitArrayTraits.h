@@ -364,6 +364,36 @@ struct can_get_memory_size_trait<const T> : public can_get_memory_size_trait<T>
 };
 ///@}
 
+///@{
+/**
+ * \struct can_get_value_range_trait
+ * \brief used to check whether the template type has a method named getValueRange
+ */
+template <typename, typename = void>
+struct can_get_value_range_trait : std::false_type
+{
+};
+
+template <typename T>
+struct can_get_value_range_trait<T,
+  void_t<decltype(&std::remove_reference<T>::type::getValueRange)>>
+  : public can_get_value_range_trait<decltype(&std::remove_reference<T>::type::getValueRange)>
+{
+  using type = T;
+  static constexpr bool value = true;
+};
+
+template <typename T>
+struct can_get_value_range_trait<T*> : public can_get_value_range_trait<T>
+{
+};
+
+template <typename T>
+struct can_get_value_range_trait<const T> : public can_get_value_range_trait<T>
+{
+};
+///@}
+
 /**
  * \struct implicit_array_traits
  * \brief A composite trait for handling all the different capabilities a "backend" to an
@@ -382,6 +412,7 @@ struct implicit_array_traits
   static constexpr bool can_direct_read_tuple = can_map_tuple_trait<T>::value;
   static constexpr bool can_direct_read_component = can_map_component_trait<T>::value;
   static constexpr bool can_get_memory_size = can_get_memory_size_trait<T>::value;
+  static constexpr bool can_get_value_range = can_get_value_range_trait<T>::value;
 };
 
 VTK_ABI_NAMESPACE_END
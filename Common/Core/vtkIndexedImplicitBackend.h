@@ -43,6 +43,7 @@
  */
 
 #include "vtkCommonCoreModule.h"
+#include "vtkType.h" // For vtkIdType
 
 #include <memory>
 
@@ -76,6 +77,14 @@ public:
    */
   unsigned long getMemorySize() const;
 
+  /**
+   * Compute the range of the values referenced by the indexes, reading each of them once. When
+   * all the values of the base array are referenced, its own cached range is used instead.
+   * Only single component arrays are supported.
+   */
+  bool getValueRange(
+    double* ranges, int numberOfComponents, vtkIdType numberOfTuples, bool finite) const;
+
 private:
   struct Internals;
   std::unique_ptr<Internals> Internal;
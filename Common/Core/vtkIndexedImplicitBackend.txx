@@ -7,8 +7,12 @@
 #include "vtkIdList.h"
 #include "vtkImplicitArray.h"
 #include "vtkTypeList.h"
+#include "vtkTypeTraits.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <vector>
 
 namespace vtkIndexedImplicitBackendDetail
 {
@@ -142,6 +146,7 @@ struct vtkIndexedImplicitBackend<ValueType>::Internals
     newHandles->SetNumberOfTuples(indexes->GetNumberOfIds());
     this->Handles = this->TypeCacheArray<vtkIdType>(newHandles);
     this->Array = this->TypeCacheArray<ValueType>(array);
+    this->BaseArray = array;
   }
 
   Internals(vtkDataArray* indexes, vtkDataArray* array)
@@ -159,6 +164,7 @@ struct vtkIndexedImplicitBackend<ValueType>::Internals
     }
     this->Handles = this->TypeCacheArray<vtkIdType>(indexes);
     this->Array = this->TypeCacheArray<ValueType>(array);
+    this->BaseArray = array;
   }
 
   template <typename VT>
@@ -183,6 +189,7 @@ struct vtkIndexedImplicitBackend<ValueType>::Internals
   vtkSmartPointer<vtkImplicitArray<
     vtkIndexedImplicitBackendDetail::TypedCacheWrapper<InternalArrayList, vtkIdType>>>
     Handles;
+  vtkSmartPointer<vtkDataArray> BaseArray;
 };
 
 //-----------------------------------------------------------------------
@@ -218,4 +225,74 @@ unsigned long vtkIndexedImplicitBackend<ValueType>::getMemorySize() const
   return this->Internal->Array->GetActualMemorySize() +
     this->Internal->Handles->GetActualMemorySize();
 }
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+bool vtkIndexedImplicitBackend<ValueType>::getValueRange(
+  double* ranges, int numberOfComponents, vtkIdType numberOfTuples, bool finite) const
+{
+  vtkDataArray* base = this->Internal->BaseArray;
+  if (numberOfComponents != 1 || !base || !this->Internal->Handles)
+  {
+    return false;
+  }
+
+  // Only the distinct values referenced by the indexes contribute to the range
+  const vtkIdType numberOfBaseValues = base->GetNumberOfValues();
+  const vtkIdType numberOfIndexes =
+    std::min(numberOfTuples, this->Internal->Handles->GetNumberOfValues());
+  std::vector<bool> used(numberOfBaseValues, false);
+  vtkIdType numberOfUsed = 0;
+  for (vtkIdType idx = 0; idx < numberOfIndexes; ++idx)
+  {
+    const vtkIdType handle = this->Internal->Handles->GetValue(idx);
+    if (handle >= 0 && handle < numberOfBaseValues && !used[handle])
+    {
+      used[handle] = true;
+      ++numberOfUsed;
+    }
+  }
+
+  ranges[0] = vtkTypeTraits<double>::Max();
+  ranges[1] = vtkTypeTraits<double>::Min();
+  if (numberOfUsed == numberOfBaseValues)
+  {
+    for (int comp = 0; comp < base->GetNumberOfComponents(); ++comp)
+    {
+      double range[2];
+      if (finite)
+      {
+        base->GetFiniteRange(range, comp);
+      }
+      else
+      {
+        base->GetRange(range, comp);
+      }
+      if (range[0] <= range[1])
+      {
+        // Values are converted to ValueType when accessed through the backend
+        ranges[0] = std::min(ranges[0], static_cast<double>(static_cast<ValueType>(range[0])));
+        ranges[1] = std::max(ranges[1], static_cast<double>(static_cast<ValueType>(range[1])));
+      }
+    }
+  }
+  else
+  {
+    for (vtkIdType handle = 0; handle < numberOfBaseValues; ++handle)
+    {
+      if (!used[handle])
+      {
+        continue;
+      }
+      const double value = static_cast<double>(this->Internal->Array->GetValue(handle));
+      if (std::isnan(value) || (finite && std::isinf(value)))
+      {
+        continue;
+      }
+      ranges[0] = std::min(ranges[0], value);
+      ranges[1] = std::max(ranges[1], value);
+    }
+  }
+  return ranges[0] <= ranges[1];
+}
 VTK_ABI_NAMESPACE_END
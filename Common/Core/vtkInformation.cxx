@@ -23,8 +23,10 @@
 #include "vtkInformationUnsignedLongKey.h"
 #include "vtkInformationVariantKey.h"
 #include "vtkInformationVariantVectorKey.h"
+#include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
+#include "vtkTimeStamp.h"
 #include "vtkVariant.h"
 
 #include <algorithm>
@@ -87,6 +89,7 @@ void vtkInformation::PrintKeys(ostream& os, vtkIndent indent)
 void vtkInformation::Modified()
 {
   this->Superclass::Modified();
+  this->NotifyOwners();
 }
 
 //------------------------------------------------------------------------------
@@ -95,9 +98,121 @@ void vtkInformation::Modified()
 void vtkInformation::Modified(vtkInformationKey* key)
 {
   this->MTime.Modified();
+  this->NotifyOwners();
   this->InvokeEvent(vtkCommand::ModifiedEvent, key);
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkInformation::GetMTime()
+{
+  vtkMTimeType mtime = this->Superclass::GetMTime();
+
+  vtkInformationInternals* internal = this->Internal;
+  const vtkMTimeType version = internal->NestedVersion.load();
+  if (internal->NestedMTimeVersion.load() == version)
+  {
+    const vtkMTimeType cachedToken = internal->NestedMTimeToken.load();
+    if (cachedToken == 0 || vtkTimeStamp::IsModificationTokenValid(cachedToken))
+    {
+      return std::max(mtime, internal->NestedMTime.load());
+    }
+  }
+
+  vtkMTimeType nestedMTime = 0;
+  vtkMTimeType token = 0;
+  typedef vtkInformationInternals::MapType MapType;
+  for (MapType::const_iterator i = internal->Map.begin(); i != internal->Map.end(); ++i)
+  {
+    if (vtkInformation* info = vtkInformation::SafeDownCast(i->second))
+    {
+      nestedMTime = std::max(nestedMTime, info->GetMTime());
+    }
+    else if (vtkInformationVector* infoVec = vtkInformationVector::SafeDownCast(i->second))
+    {
+      // Taken before visiting the vector, so that a modification made
+      // meanwhile invalidates the result.
+      if (token == 0)
+      {
+        token = vtkTimeStamp::GetModificationToken();
+      }
+      for (int j = 0; j < infoVec->GetNumberOfInformationObjects(); ++j)
+      {
+        if (vtkInformation* info = infoVec->GetInformationObject(j))
+        {
+          nestedMTime = std::max(nestedMTime, info->GetMTime());
+        }
+      }
+    }
+  }
+
+  // As in vtkFieldData::GetMTime(), the aggregated time only grows as long as
+  // the nested values are unchanged, so keeping the maximum of concurrent
+  // results and storing the version last keeps the cache valid.
+  vtkMTimeType cached = internal->NestedMTime.load();
+  while (cached < nestedMTime && !internal->NestedMTime.compare_exchange_weak(cached, nestedMTime))
+  {
+  }
+  internal->NestedMTimeToken = token;
+  internal->NestedMTimeVersion = version;
+
+  return std::max(mtime, nestedMTime);
+}
+
+//------------------------------------------------------------------------------
+void vtkInformation::AddOwnerTo(vtkObjectBase* value)
+{
+  if (vtkInformation* info = vtkInformation::SafeDownCast(value))
+  {
+    std::vector<vtkWeakPointer<vtkInformation>>& owners = info->Internal->Owners;
+    owners.erase(std::remove(owners.begin(), owners.end(), nullptr), owners.end());
+    owners.emplace_back(this);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkInformation::RemoveOwnerFrom(vtkObjectBase* value)
+{
+  if (vtkInformation* info = vtkInformation::SafeDownCast(value))
+  {
+    std::vector<vtkWeakPointer<vtkInformation>>& owners = info->Internal->Owners;
+    auto owner = std::find(owners.begin(), owners.end(), this);
+    if (owner != owners.end())
+    {
+      owners.erase(owner);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkInformation::InvalidateNestedMTime(bool reset)
+{
+  vtkInformationInternals* internal = this->Internal;
+  if (reset)
+  {
+    internal->NestedMTime = 0;
+  }
+  // The owners need no notification when the cache was already invalid: they
+  // were notified then, and validating their cache validates this one. This
+  // also stops the notification on objects holding themselves.
+  const vtkMTimeType version = internal->NestedVersion++;
+  if (internal->NestedMTimeVersion.load() == version)
+  {
+    this->NotifyOwners();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkInformation::NotifyOwners()
+{
+  for (vtkInformation* owner : this->Internal->Owners)
+  {
+    if (owner)
+    {
+      owner->InvalidateNestedMTime(false);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // Return the number of keys as a result of iteration.
 int vtkInformation::GetNumberOfKeys()
@@ -122,6 +237,9 @@ void vtkInformation::SetAsObjectBase(vtkInformationKey* key, vtkObjectBase* newv
   {
     return;
   }
+  // Whether the values aggregated by GetMTime() change.
+  bool nestedChanged =
+    vtkInformation::SafeDownCast(newvalue) || vtkInformationVector::SafeDownCast(newvalue);
   typedef vtkInformationInternals::MapType MapType;
   MapType::iterator i = this->Internal->Map.find(key);
   if (i != this->Internal->Map.end())
@@ -136,6 +254,9 @@ void vtkInformation::SetAsObjectBase(vtkInformationKey* key, vtkObjectBase* newv
     {
       this->Internal->Map.erase(i);
     }
+    nestedChanged = nestedChanged || vtkInformation::SafeDownCast(oldvalue) ||
+      vtkInformationVector::SafeDownCast(oldvalue);
+    this->RemoveOwnerFrom(oldvalue);
     oldvalue->UnRegister(nullptr);
   }
   else if (newvalue)
@@ -144,6 +265,11 @@ void vtkInformation::SetAsObjectBase(vtkInformationKey* key, vtkObjectBase* newv
     this->Internal->Map.insert(entry);
     newvalue->Register(nullptr);
   }
+  this->AddOwnerTo(newvalue);
+  if (nestedChanged)
+  {
+    this->InvalidateNestedMTime(true);
+  }
   this->Modified(key);
 }
 
@@ -186,17 +312,22 @@ void vtkInformation::Clear()
 //------------------------------------------------------------------------------
 void vtkInformation::Copy(vtkInformation* from, vtkTypeBool deep)
 {
+  typedef vtkInformationInternals::MapType MapType;
   vtkInformationInternals* oldInternal = this->Internal;
   this->Internal = new vtkInformationInternals;
+  this->Internal->Owners.swap(oldInternal->Owners);
   if (from)
   {
-    typedef vtkInformationInternals::MapType MapType;
     for (MapType::const_iterator i = from->Internal->Map.begin(); i != from->Internal->Map.end();
          ++i)
     {
       this->CopyEntry(from, i->first, deep);
     }
   }
+  for (MapType::const_iterator i = oldInternal->Map.begin(); i != oldInternal->Map.end(); ++i)
+  {
+    this->RemoveOwnerFrom(i->second);
+  }
   delete oldInternal;
 }
 
@@ -71,6 +71,17 @@ public:
    */
   void Modified(vtkInformationKey* key);
 
+  /**
+   * Get the modification time of this object and of the vtkInformation
+   * objects it holds as values, directly or in vtkInformationVector values.
+   * The time aggregated from the nested objects is cached: they notify the
+   * objects holding them when they are modified. vtkInformationVector values
+   * do not notify changes of their content, so that when there are some the
+   * cache is only kept until any object is modified (see
+   * vtkTimeStamp::GetModificationToken()).
+   */
+  vtkMTimeType GetMTime() override;
+
   /**
    * Clear all information entries.
    */
@@ -451,6 +462,19 @@ private:
   vtkInformation(const vtkInformation&) = delete;
   void operator=(const vtkInformation&) = delete;
   vtkInformationRequestKey* Request;
+
+  // Register or unregister this object as an owner of the given value when it
+  // is a vtkInformation.
+  void AddOwnerTo(vtkObjectBase* value);
+  void RemoveOwnerFrom(vtkObjectBase* value);
+
+  // Invalidate the modification time aggregated from the nested values, and
+  // the ones of the owners if it was valid. With reset, also forget the
+  // cached time since it may decrease when the nested values change.
+  void InvalidateNestedMTime(bool reset);
+
+  // Invalidate the modification time aggregated by the owners.
+  void NotifyOwners();
 };
 
 VTK_ABI_NAMESPACE_END
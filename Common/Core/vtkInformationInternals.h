@@ -14,8 +14,11 @@
 
 #include "vtkInformationKey.h"
 #include "vtkObjectBase.h"
+#include "vtkWeakPointer.h"
 
+#include <atomic>
 #include <cstdint>
+#include <vector>
 #define VTK_INFORMATION_USE_HASH_MAP
 #ifdef VTK_INFORMATION_USE_HASH_MAP
 #include <unordered_map>
@@ -25,6 +28,8 @@
 
 //----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
+class vtkInformation;
+
 class vtkInformationInternals
 {
 public:
@@ -44,6 +49,21 @@ public:
 #endif
   MapType Map;
 
+  // Modification time aggregated from the nested vtkInformation values, see
+  // vtkInformation::GetMTime(). NestedVersion is incremented when it becomes
+  // invalid and NestedMTimeVersion is the version it was computed for.
+  std::atomic<vtkMTimeType> NestedMTime{ 0 };
+  std::atomic<vtkMTimeType> NestedVersion{ 0 };
+  std::atomic<vtkMTimeType> NestedMTimeVersion{ VTK_MTIME_MAX };
+
+  // Modification token also validating NestedMTime when it was computed from
+  // vtkInformationVector values, which do not notify their changes, 0 if not.
+  std::atomic<vtkMTimeType> NestedMTimeToken{ 0 };
+
+  // The vtkInformation objects holding this one as a value, notified when it
+  // is modified. Kept when the map is replaced by vtkInformation::Copy().
+  std::vector<vtkWeakPointer<vtkInformation>> Owners;
+
 #ifdef VTK_INFORMATION_USE_HASH_MAP
   vtkInformationInternals()
     : Map(33)
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMemoryMappedFile.h"
+
+#include "vtkObjectFactory.h"
+
+#include <limits>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#include <vtksys/Encoding.hxx>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkMemoryMappedFile);
+
+//------------------------------------------------------------------------------
+vtkMemoryMappedFile::vtkMemoryMappedFile() = default;
+
+//------------------------------------------------------------------------------
+vtkMemoryMappedFile::~vtkMemoryMappedFile()
+{
+  this->Unmap();
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryMappedFile::Map(
+  const char* fileName, vtkTypeInt64 offset, vtkTypeInt64 length, int mode)
+{
+  this->Unmap();
+  if (!fileName || offset < 0 || (mode != READ_ONLY && mode != COPY_ON_WRITE))
+  {
+    vtkErrorMacro("Invalid arguments.");
+    return false;
+  }
+
+#ifdef _WIN32
+  HANDLE file = CreateFileW(vtksys::Encoding::ToWindowsExtendedPath(fileName).c_str(),
+    GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    vtkErrorMacro("Cannot open " << fileName);
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize))
+  {
+    CloseHandle(file);
+    vtkErrorMacro("Cannot get the size of " << fileName);
+    return false;
+  }
+  const vtkTypeInt64 size = static_cast<vtkTypeInt64>(fileSize.QuadPart);
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+  const vtkTypeInt64 granularity = static_cast<vtkTypeInt64>(systemInfo.dwAllocationGranularity);
+#else
+  int file = open(fileName, O_RDONLY);
+  if (file < 0)
+  {
+    vtkErrorMacro("Cannot open " << fileName);
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(file, &fileStat) != 0)
+  {
+    close(file);
+    vtkErrorMacro("Cannot get the size of " << fileName);
+    return false;
+  }
+  const vtkTypeInt64 size = static_cast<vtkTypeInt64>(fileStat.st_size);
+  const vtkTypeInt64 granularity = static_cast<vtkTypeInt64>(sysconf(_SC_PAGESIZE));
+#endif
+
+  if (length < 0)
+  {
+    length = size - offset;
+  }
+  if (length <= 0 || offset + length > size ||
+    static_cast<vtkTypeUInt64>(length + granularity) > std::numeric_limits<size_t>::max())
+  {
+#ifdef _WIN32
+    CloseHandle(file);
+#else
+    close(file);
+#endif
+    vtkErrorMacro("Region [" << offset << ", " << offset + length << ") is empty or outside of "
+                             << fileName << " (" << size << " bytes).");
+    return false;
+  }
+
+  const vtkTypeInt64 mappingOffset = (offset / granularity) * granularity;
+  const size_t mappingLength = static_cast<size_t>(length + offset - mappingOffset);
+  void* address = nullptr;
+
+#ifdef _WIN32
+  HANDLE mapping = CreateFileMappingW(
+    file, nullptr, mode == READ_ONLY ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, nullptr);
+  if (mapping)
+  {
+    address = MapViewOfFile(mapping, mode == READ_ONLY ? FILE_MAP_READ : FILE_MAP_COPY,
+      static_cast<DWORD>(static_cast<vtkTypeUInt64>(mappingOffset) >> 32),
+      static_cast<DWORD>(static_cast<vtkTypeUInt64>(mappingOffset) & 0xffffffff), mappingLength);
+    // The view keeps the mapping and the file alive.
+    CloseHandle(mapping);
+  }
+  CloseHandle(file);
+#else
+  address = mmap(nullptr, mappingLength, mode == READ_ONLY ? PROT_READ : PROT_READ | PROT_WRITE,
+    mode == READ_ONLY ? MAP_SHARED : MAP_PRIVATE, file, static_cast<off_t>(mappingOffset));
+  if (address == MAP_FAILED)
+  {
+    address = nullptr;
+  }
+  // The mapping keeps a reference to the file.
+  close(file);
+#endif
+
+  if (!address)
+  {
+    vtkErrorMacro("Cannot map " << length << " bytes of " << fileName << " at offset " << offset);
+    return false;
+  }
+
+  this->FileName = fileName;
+  this->MappingAddress = address;
+  this->MappingLength = mappingLength;
+  this->Data = static_cast<char*>(address) + (offset - mappingOffset);
+  this->Offset = offset;
+  this->Length = length;
+  this->Mode = mode;
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryMappedFile::Unmap()
+{
+  if (!this->MappingAddress)
+  {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(this->MappingAddress);
+#else
+  munmap(this->MappingAddress, this->MappingLength);
+#endif
+  this->MappingAddress = nullptr;
+  this->MappingLength = 0;
+  this->Data = nullptr;
+  this->Offset = 0;
+  this->Length = 0;
+  this->FileName.clear();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryMappedFile::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << this->FileName << "\n";
+  os << indent << "Mode: " << (this->Mode == READ_ONLY ? "READ_ONLY" : "COPY_ON_WRITE") << "\n";
+  os << indent << "Offset: " << this->Offset << "\n";
+  os << indent << "Length: " << this->Length << "\n";
+  os << indent << "Mapped: " << (this->IsMapped() ? "true" : "false") << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkMemoryMappedFile
+ * @brief   A region of a file mapped in memory.
+ *
+ * vtkMemoryMappedFile maps a region of a file in the address space of the
+ * process so that its content can be used in place, the operating system
+ * paging it in on demand. Arrays can then share the memory of the mapping
+ * without copying it (see vtkAOSDataArrayTemplate::SetMemoryMappedArray()).
+ * They keep a reference to the vtkMemoryMappedFile and the region is unmapped
+ * when the last of them releases it.
+ *
+ * In READ_ONLY mode the pages are shared with the page cache of the file and
+ * writing to them is an access violation. In COPY_ON_WRITE mode they are
+ * shared as well until they are written to, at which point the process gets
+ * a private copy of the modified pages; the file itself is never modified.
+ *
+ * The file must not be truncated while it is mapped.
+ *
+ * @sa
+ * vtkAOSDataArrayTemplate vtkBuffer
+ */
+
+#ifndef vtkMemoryMappedFile_h
+#define vtkMemoryMappedFile_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <string> // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkMemoryMappedFile : public vtkObject
+{
+public:
+  static vtkMemoryMappedFile* New();
+  vtkTypeMacro(vtkMemoryMappedFile, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum MappingModes
+  {
+    READ_ONLY = 0,
+    COPY_ON_WRITE = 1
+  };
+
+  /**
+   * Map @a length bytes of @a fileName starting at byte @a offset. A negative
+   * length maps everything up to the end of the file. Any previous mapping is
+   * released first. Returns false, leaving the object unmapped, if the file
+   * cannot be opened, if the region lies outside of the file or is empty, or
+   * if the mapping fails.
+   */
+  bool Map(const char* fileName, vtkTypeInt64 offset = 0, vtkTypeInt64 length = -1,
+    int mode = COPY_ON_WRITE);
+
+  /**
+   * Release the mapping. Must not be called while arrays still use it.
+   */
+  void Unmap();
+
+  /**
+   * Return true when a region is mapped.
+   */
+  bool IsMapped() const { return this->Data != nullptr; }
+
+  /**
+   * Return the address of the first byte of the mapped region, nullptr when
+   * nothing is mapped.
+   */
+  void* GetData() const { return this->Data; }
+
+  ///@{
+  /**
+   * Return the position in the file and the size in bytes of the mapped
+   * region.
+   */
+  vtkTypeInt64 GetOffset() const { return this->Offset; }
+  vtkTypeInt64 GetLength() const { return this->Length; }
+  ///@}
+
+  /**
+   * Return the mode of the current mapping.
+   */
+  int GetMode() const { return this->Mode; }
+
+  /**
+   * Return the name of the mapped file.
+   */
+  const std::string& GetFileName() const { return this->FileName; }
+
+protected:
+  vtkMemoryMappedFile();
+  ~vtkMemoryMappedFile() override;
+
+private:
+  vtkMemoryMappedFile(const vtkMemoryMappedFile&) = delete;
+  void operator=(const vtkMemoryMappedFile&) = delete;
+
+  std::string FileName;
+  void* Data = nullptr;
+  vtkTypeInt64 Offset = 0;
+  vtkTypeInt64 Length = 0;
+  int Mode = READ_ONLY;
+
+  // The mapping starts at an offset aligned on the granularity of the system,
+  // which may be before the requested region.
+  void* MappingAddress = nullptr;
+  size_t MappingLength = 0;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -91,11 +91,13 @@ if (VTK_SMP_ENABLE_STDTHREAD)
   list(APPEND vtk_smp_sources
     "${vtk_smp_implementation_dir}/vtkSMPToolsImpl.cxx"
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalBackend.cxx"
-    "${vtk_smp_implementation_dir}/vtkSMPThreadPool.cxx")
+    "${vtk_smp_implementation_dir}/vtkSMPThreadPool.cxx"
+    "${vtk_smp_implementation_dir}/vtkSMPWorkStealingScheduler.cxx")
   list(APPEND vtk_smp_nowrap_headers
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalImpl.h"
     "${vtk_smp_implementation_dir}/vtkSMPThreadLocalBackend.h"
-    "${vtk_smp_implementation_dir}/vtkSMPThreadPool.h")
+    "${vtk_smp_implementation_dir}/vtkSMPThreadPool.h"
+    "${vtk_smp_implementation_dir}/vtkSMPWorkStealingScheduler.h")
   list(APPEND vtk_smp_templates
     "${vtk_smp_implementation_dir}/vtkSMPToolsImpl.txx")
 endif()
@@ -127,8 +129,10 @@ endif()
 
 set(vtk_smp_common_dir SMP/Common)
 list(APPEND vtk_smp_sources
+  "${vtk_smp_common_dir}/vtkSMPTaskGraph.cxx"
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.cxx")
 list(APPEND vtk_smp_nowrap_headers
+  "${vtk_smp_common_dir}/vtkSMPTaskGraph.h"
   "${vtk_smp_common_dir}/vtkSMPThreadLocalAPI.h"
   "${vtk_smp_common_dir}/vtkSMPThreadLocalImplAbstract.h"
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.h"
@@ -136,8 +140,11 @@ list(APPEND vtk_smp_nowrap_headers
   "${vtk_smp_common_dir}/vtkSMPToolsInternal.h")
 
 list(APPEND vtk_smp_sources
+  vtkSMPTaskGroup.cxx
   vtkSMPTools.cxx)
 list(APPEND vtk_smp_headers
+  vtkSMPTaskGroup.h
   vtkSMPTools.h
   vtkSMPThreadLocal.h
+  vtkSMPThreadLocalArena.h
   vtkSMPThreadLocalObject.h)
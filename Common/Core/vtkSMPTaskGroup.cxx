@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSMPTaskGroup.h"
+
+#include "SMP/Common/vtkSMPTaskGraph.h"
+#include "SMP/Common/vtkSMPToolsAPI.h"
+
+#include <utility> // For std::move
+
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::vtkSMPTaskGroup()
+  : Graph(new vtk::detail::smp::vtkSMPTaskGraph)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::~vtkSMPTaskGroup()
+{
+  this->Wait();
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGroup::TaskId vtkSMPTaskGroup::SpawnTask(
+  std::function<void()> task, const TaskId* dependencies, std::size_t numberOfDependencies)
+{
+  return this->Graph->AddTask(std::move(task), dependencies, numberOfDependencies);
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGroup::Wait()
+{
+  if (this->Graph->IsDone())
+  {
+    return;
+  }
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.ExecuteTaskGraph(*this->Graph);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPTaskGroup::GetNumberOfTasks() const
+{
+  return this->Graph->GetNumberOfTasks();
+}
+
+VTK_ABI_NAMESPACE_END
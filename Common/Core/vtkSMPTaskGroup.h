@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMPTaskGroup
+ * @brief   A group of dependent tasks executed by the vtkSMPTools backend.
+ *
+ * vtkSMPTaskGroup lets an algorithm express its work as a graph of tasks
+ * instead of a sequence of vtkSMPTools::For() separated by barriers.
+ * Independent stages, such as point merging, attribute interpolation and
+ * cell building, can then overlap. Each task is a callable taking no
+ * argument. Spawn() adds a task to the group, optionally after a list of
+ * tasks of the same group it depends on, and returns its identifier. Wait()
+ * executes the tasks with the active vtkSMPTools backend and returns when
+ * all of them are done:
+ *
+ * @code
+ * vtkSMPTaskGroup group;
+ * auto points = group.Spawn([&] { MergePoints(); });
+ * auto cells = group.Spawn([&] { BuildCells(); });
+ * group.Spawn([&] { InterpolateAttributes(); }, { points });
+ * group.Spawn([&] { BuildLinks(); }, { points, cells });
+ * group.Wait();
+ * @endcode
+ *
+ * Tasks are mapped to tbb::task_group with the TBB backend, to OpenMP tasks
+ * with the OpenMP backend and to the thread pool with the STDThread backend.
+ * The Sequential backend runs them in the order in which they were spawned,
+ * dependencies permitting. Tasks may themselves call vtkSMPTools functions,
+ * which then follow the nested parallelism setting of vtkSMPTools.
+ *
+ * Tasks spawned from outside of the group start at the latest when Wait()
+ * is called. A running task may spawn further tasks in its own group, they
+ * are executed before Wait() returns. Calling Wait() from a task of the same
+ * group is not supported.
+ *
+ * @sa
+ * vtkSMPTools
+ */
+
+#ifndef vtkSMPTaskGroup_h
+#define vtkSMPTaskGroup_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <cstddef>          // For std::size_t
+#include <functional>       // For std::function
+#include <initializer_list> // For std::initializer_list
+#include <memory>           // For std::unique_ptr
+#include <utility>          // For std::forward
+#include <vector>           // For std::vector
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+class vtkSMPTaskGraph;
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkSMPTaskGroup
+{
+public:
+  /**
+   * Identifier of a task in its group.
+   */
+  using TaskId = std::size_t;
+
+  vtkSMPTaskGroup();
+
+  /**
+   * Executes the remaining tasks before destroying the group.
+   */
+  ~vtkSMPTaskGroup();
+
+  ///@{
+  /**
+   * Add a task to the group. The task starts once all the given dependencies
+   * have completed. Dependencies must be identifiers returned by this group.
+   * Thread safe.
+   */
+  template <typename Functor>
+  TaskId Spawn(Functor&& task)
+  {
+    return this->SpawnTask(std::function<void()>(std::forward<Functor>(task)), nullptr, 0);
+  }
+  template <typename Functor>
+  TaskId Spawn(Functor&& task, std::initializer_list<TaskId> dependencies)
+  {
+    return this->SpawnTask(std::function<void()>(std::forward<Functor>(task)),
+      dependencies.begin(), dependencies.size());
+  }
+  template <typename Functor>
+  TaskId Spawn(Functor&& task, const std::vector<TaskId>& dependencies)
+  {
+    return this->SpawnTask(std::function<void()>(std::forward<Functor>(task)),
+      dependencies.data(), dependencies.size());
+  }
+  ///@}
+
+  /**
+   * Execute the tasks of the group and wait for all of them, including the
+   * ones they spawn, to complete. The group can be reused afterwards, new
+   * tasks may depend on the completed ones.
+   */
+  void Wait();
+
+  /**
+   * Return the number of tasks spawned in the group so far.
+   */
+  std::size_t GetNumberOfTasks() const;
+
+private:
+  TaskId SpawnTask(
+    std::function<void()> task, const TaskId* dependencies, std::size_t numberOfDependencies);
+
+  std::unique_ptr<vtk::detail::smp::vtkSMPTaskGraph> Graph;
+
+  vtkSMPTaskGroup(const vtkSMPTaskGroup&) = delete;
+  void operator=(const vtkSMPTaskGroup&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkSMPTaskGroup.h
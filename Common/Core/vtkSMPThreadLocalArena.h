@@ -0,0 +1,385 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMPThreadLocalArena
+ * @brief   Thread local bump-pointer scratch memory.
+ *
+ * vtkSMPThreadLocalArena provides each thread with an arena from which
+ * temporary memory can be carved without going through the system allocator.
+ * An arena reserves memory in large blocks and hands it out by bumping a
+ * pointer; individual allocations are never freed. Instead the arena is
+ * rewound, either completely with Reset() or to a previously recorded
+ * position using a Scope, and the reserved blocks are reused for the
+ * following allocations. The blocks are only returned to the system when
+ * Release() is called or when the vtkSMPThreadLocalArena is destroyed.
+ *
+ * The typical use is to make the vtkSMPThreadLocalArena a member of a functor
+ * and to open a Scope at the beginning of each chunk so that everything
+ * allocated while processing the chunk is reclaimed at its end:
+ *
+ * @code
+ * struct AFunctor
+ * {
+ *   vtkSMPThreadLocalArena Scratch;
+ *
+ *   void operator()(vtkIdType begin, vtkIdType end)
+ *   {
+ *     vtkSMPThreadLocalArena::Arena& arena = this->Scratch.Local();
+ *     vtkSMPThreadLocalArena::Scope scope(arena);
+ *     vtkIdType* ids = arena.Allocate<vtkIdType>(end - begin);
+ *     ...
+ *   }
+ * };
+ * @endcode
+ *
+ * Using a Scope instead of Reset() keeps the memory of an enclosing chunk
+ * intact when a backend executes another chunk of the same loop on the same
+ * thread (for example while waiting for a nested parallel section).
+ *
+ * Only trivially destructible types should be placed in an arena since no
+ * destructor is ever run. Allocator can be used to back standard containers
+ * with an arena; deallocation is a no-op and the memory is reclaimed when the
+ * arena is rewound, so such a container must not outlive its scope.
+ *
+ * @sa
+ * vtkSMPThreadLocal vtkSMPTools
+ */
+
+#ifndef vtkSMPThreadLocalArena_h
+#define vtkSMPThreadLocalArena_h
+
+#include "vtkABINamespace.h"
+#include "vtkSMPThreadLocal.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkSMPThreadLocalArena
+{
+public:
+  /**
+   * Default size in bytes of the blocks reserved by an arena.
+   */
+  static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+  /**
+   * A position in an arena, as returned by Arena::GetMarker().
+   */
+  struct Marker
+  {
+    std::size_t Block;
+    std::size_t Offset;
+  };
+
+  /**
+   * Bump-pointer allocator owned by a single thread.
+   *
+   * Copying an arena only copies its configuration: the copy starts empty.
+   * Moving an arena transfers its blocks.
+   */
+  class Arena
+  {
+  public:
+    explicit Arena(std::size_t blockSize = DefaultBlockSize)
+      : BlockSize(blockSize > 0 ? blockSize : 1)
+    {
+    }
+
+    Arena(const Arena& other)
+      : BlockSize(other.BlockSize)
+    {
+    }
+
+    Arena& operator=(const Arena& other)
+    {
+      if (this != &other)
+      {
+        this->Release();
+        this->BlockSize = other.BlockSize;
+      }
+      return *this;
+    }
+
+    Arena(Arena&& other) noexcept
+      : Blocks(std::move(other.Blocks))
+      , CurrentBlock(other.CurrentBlock)
+      , Offset(other.Offset)
+      , BlockSize(other.BlockSize)
+    {
+      other.Blocks.clear();
+      other.CurrentBlock = 0;
+      other.Offset = 0;
+    }
+
+    Arena& operator=(Arena&& other) noexcept
+    {
+      if (this != &other)
+      {
+        this->Blocks = std::move(other.Blocks);
+        this->CurrentBlock = other.CurrentBlock;
+        this->Offset = other.Offset;
+        this->BlockSize = other.BlockSize;
+        other.Blocks.clear();
+        other.CurrentBlock = 0;
+        other.Offset = 0;
+      }
+      return *this;
+    }
+
+    ~Arena() = default;
+
+    /**
+     * Return size bytes of uninitialized memory aligned on alignment, which
+     * must be a power of two. A new block is reserved only when the request
+     * does not fit in the blocks already owned by the arena.
+     */
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+      assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+      if (size == 0)
+      {
+        size = 1;
+      }
+      for (;;)
+      {
+        while (this->CurrentBlock < this->Blocks.size())
+        {
+          Block& block = this->Blocks[this->CurrentBlock];
+          const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block.Data.get());
+          const std::uintptr_t aligned =
+            (base + this->Offset + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+          const std::size_t end = static_cast<std::size_t>(aligned - base) + size;
+          if (end <= block.Size)
+          {
+            this->Offset = end;
+            return reinterpret_cast<void*>(aligned);
+          }
+          // Does not fit, continue with the next block reserved by a previous pass.
+          ++this->CurrentBlock;
+          this->Offset = 0;
+        }
+        const std::size_t blockSize =
+          size + alignment > this->BlockSize ? size + alignment : this->BlockSize;
+        Block block;
+        block.Data.reset(new unsigned char[blockSize]);
+        block.Size = blockSize;
+        this->Blocks.push_back(std::move(block));
+      }
+    }
+
+    /**
+     * Return uninitialized storage for count objects of type T.
+     */
+    template <typename T>
+    T* Allocate(std::size_t count)
+    {
+      static_assert(std::is_trivially_destructible<T>::value,
+        "vtkSMPThreadLocalArena never runs destructors of the objects it holds.");
+      return static_cast<T*>(this->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * Return the current position of the arena. Everything allocated after
+     * this call is reclaimed by Rewind(marker).
+     */
+    Marker GetMarker() const { return Marker{ this->CurrentBlock, this->Offset }; }
+
+    /**
+     * Move the arena back to a position returned by GetMarker(). The memory
+     * is kept for subsequent allocations.
+     */
+    void Rewind(const Marker& marker)
+    {
+      assert(marker.Block < this->CurrentBlock ||
+        (marker.Block == this->CurrentBlock && marker.Offset <= this->Offset));
+      this->CurrentBlock = marker.Block;
+      this->Offset = marker.Offset;
+    }
+
+    /**
+     * Reclaim every allocation. The memory is kept for subsequent allocations.
+     */
+    void Reset()
+    {
+      this->CurrentBlock = 0;
+      this->Offset = 0;
+    }
+
+    /**
+     * Reclaim every allocation and give the memory back to the system.
+     */
+    void Release()
+    {
+      this->Blocks.clear();
+      this->Blocks.shrink_to_fit();
+      this->Reset();
+    }
+
+    /**
+     * Return the number of bytes reserved by the arena.
+     */
+    std::size_t GetCapacity() const
+    {
+      std::size_t capacity = 0;
+      for (const Block& block : this->Blocks)
+      {
+        capacity += block.Size;
+      }
+      return capacity;
+    }
+
+    std::size_t GetBlockSize() const { return this->BlockSize; }
+
+  private:
+    struct Block
+    {
+      std::unique_ptr<unsigned char[]> Data;
+      std::size_t Size = 0;
+    };
+
+    std::vector<Block> Blocks;
+    std::size_t CurrentBlock = 0;
+    std::size_t Offset = 0;
+    std::size_t BlockSize;
+  };
+
+  /**
+   * Records the position of an arena on construction and rewinds the arena
+   * to it on destruction.
+   */
+  class Scope
+  {
+  public:
+    explicit Scope(Arena& arena)
+      : ScopedArena(arena)
+      , Mark(arena.GetMarker())
+    {
+    }
+
+    ~Scope() { this->ScopedArena.Rewind(this->Mark); }
+
+  private:
+    Arena& ScopedArena;
+    Marker Mark;
+
+    Scope(const Scope&) = delete;
+    void operator=(const Scope&) = delete;
+  };
+
+  /**
+   * Standard allocator drawing its memory from an arena.
+   */
+  template <typename T>
+  class Allocator
+  {
+  public:
+    using value_type = T;
+
+    explicit Allocator(Arena& arena) noexcept
+      : Owner(&arena)
+    {
+    }
+
+    template <typename U>
+    Allocator(const Allocator<U>& other) noexcept
+      : Owner(other.GetArena())
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+      return static_cast<T*>(this->Owner->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    Arena* GetArena() const noexcept { return this->Owner; }
+
+    template <typename U>
+    bool operator==(const Allocator<U>& other) const noexcept
+    {
+      return this->Owner == other.GetArena();
+    }
+
+    template <typename U>
+    bool operator!=(const Allocator<U>& other) const noexcept
+    {
+      return this->Owner != other.GetArena();
+    }
+
+  private:
+    Arena* Owner;
+  };
+
+  /**
+   * Create the thread local arenas. blockSize is the minimum size in bytes of
+   * the blocks each arena reserves.
+   */
+  explicit vtkSMPThreadLocalArena(std::size_t blockSize = DefaultBlockSize)
+    : Arenas(Arena(blockSize))
+  {
+  }
+
+  /**
+   * Return the arena of the calling thread, creating it on first use.
+   */
+  Arena& Local() { return this->Arenas.Local(); }
+
+  /**
+   * Rewind all the thread arenas, keeping their memory. Not thread safe.
+   */
+  void Reset()
+  {
+    for (Arena& arena : this->Arenas)
+    {
+      arena.Reset();
+    }
+  }
+
+  /**
+   * Give the memory of all the thread arenas back to the system. Not thread
+   * safe.
+   */
+  void Release()
+  {
+    for (Arena& arena : this->Arenas)
+    {
+      arena.Release();
+    }
+  }
+
+  /**
+   * Return the number of bytes reserved by all the thread arenas. Not thread
+   * safe.
+   */
+  std::size_t GetCapacity()
+  {
+    std::size_t capacity = 0;
+    for (Arena& arena : this->Arenas)
+    {
+      capacity += arena.GetCapacity();
+    }
+    return capacity;
+  }
+
+  /**
+   * Return the number of thread arenas that have been created.
+   */
+  std::size_t size() { return this->Arenas.size(); }
+
+private:
+  vtkSMPThreadLocal<Arena> Arenas;
+
+  vtkSMPThreadLocalArena(const vtkSMPThreadLocalArena&) = delete;
+  void operator=(const vtkSMPThreadLocalArena&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkSMPThreadLocalArena.h
@@ -55,6 +55,20 @@ bool vtkSMPTools::GetNestedParallelism()
   return SMPToolsAPI.GetNestedParallelism();
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetWorkStealing(bool workStealing)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.SetWorkStealing(workStealing);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetWorkStealing()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetWorkStealing();
+}
+
 //------------------------------------------------------------------------------
 bool vtkSMPTools::IsParallelScope()
 {
@@ -6,6 +6,9 @@
  *
  * vtkSMPTools provides a set of utility functions that can
  * be used to parallelize parts of VTK code using multiple threads.
+ * Besides the parallel For(), parallel versions of common algorithms
+ * (Transform, Fill, Sort, Reduce, TransformReduce, InclusiveScan and
+ * ExclusiveScan) are provided.
  * There are several back-end implementations of parallel functionality
  * (currently Sequential, TBB, OpenMP and STDThread) that actual execution is
  * delegated to.
@@ -24,7 +27,8 @@
 #include "SMP/Common/vtkSMPToolsAPI.h"
 #include "vtkSMPThreadLocal.h" // For Initialized
 
-#include <functional>  // For std::function
+#include <functional>  // For std::function, std::plus
+#include <iterator>    // For std::iterator_traits
 #include <type_traits> // For std:::enable_if
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -437,6 +441,30 @@ public:
    */
   static bool GetNestedParallelism();
 
+  /**
+   * /!\ This method is not thread safe.
+   * If true, the For() loops of the STDThread backend use work stealing
+   * scheduling: each thread starts with an equal contiguous share of the chunks
+   * of the range and, once done with it, steals half of the remaining chunks of
+   * another thread. This balances loops whose iterations have very uneven costs.
+   * When false, chunks are statically assigned to threads ahead of time.
+   * The grain keeps its meaning (the size of a chunk) in both modes.
+   *
+   * The other backends are not affected: TBB always balances work by stealing and
+   * OpenMP follows its runtime schedule (OMP_SCHEDULE).
+   *
+   * VTK_SMP_STDTHREAD_WORK_STEALING env variable (0 or 1) can also be used to set
+   * the default for the STDThread backend.
+   *
+   * Default to false.
+   */
+  static void SetWorkStealing(bool workStealing);
+
+  /**
+   * Get true if work stealing scheduling is enabled.
+   */
+  static bool GetWorkStealing();
+
   /**
    * Return true if it is called from a parallel scope.
    */
@@ -623,6 +651,109 @@ public:
     auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
     SMPToolsAPI.Sort(begin, end, comp);
   }
+
+  ///@{
+  /**
+   * A convenience method for reducing data. It is a drop in replacement for
+   * std::reduce(), it combines the values of the input range and init with the
+   * given binary operation (std::plus by default). The operation must be associative;
+   * it does not need to be commutative: partial results are always combined in
+   * the order of the input, so the result does not depend on the number of threads
+   * used. Note that, as with std::reduce(), init is combined only once.
+   *
+   * Usage example with vtkDataArray:
+   * \code
+   * const auto range = vtk::DataArrayValueRange<1>(array);
+   * const double sum = vtkSMPTools::Reduce(range.cbegin(), range.cend(), 0.0);
+   * \endcode
+   */
+  template <typename InputIt, typename T>
+  static T Reduce(InputIt begin, InputIt end, T init)
+  {
+    return vtkSMPTools::Reduce(begin, end, init, std::plus<T>());
+  }
+
+  template <typename InputIt, typename T, typename BinaryOp>
+  static T Reduce(InputIt begin, InputIt end, T init, BinaryOp reduce)
+  {
+    return vtkSMPTools::TransformReduce(
+      begin, end, init, reduce, vtk::detail::smp::IdentityFunctor());
+  }
+  ///@}
+
+  /**
+   * A convenience method for transforming then reducing data. It is a drop in
+   * replacement for std::transform_reduce(), it applies the unary transform to
+   * each value of the input range and combines the results with init using the
+   * binary reduce operation. The same requirements as Reduce() apply.
+   *
+   * Usage example computing the number of selected values:
+   * \code
+   * const vtkIdType numSelected = vtkSMPTools::TransformReduce(mask.cbegin(), mask.cend(),
+   *   vtkIdType(0), std::plus<vtkIdType>(), [](unsigned char m) { return m ? 1 : 0; });
+   * \endcode
+   */
+  template <typename InputIt, typename T, typename ReduceOp, typename TransformOp>
+  static T TransformReduce(
+    InputIt begin, InputIt end, T init, ReduceOp reduce, TransformOp transform)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.TransformReduce(begin, end, init, reduce, transform);
+  }
+
+  ///@{
+  /**
+   * A convenience method for computing an inclusive prefix sum. It is a drop in
+   * replacement for std::inclusive_scan(): the i-th output value is the
+   * combination (std::plus by default) of the input values 0 to i. The output
+   * range may be the input range, in which case the scan is done in place.
+   * Returns the iterator past the last output element.
+   */
+  template <typename InputIt, typename OutputIt>
+  static OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt outBegin)
+  {
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    return vtkSMPTools::InclusiveScan(begin, end, outBegin, std::plus<ValueType>());
+  }
+
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  static OutputIt InclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.InclusiveScan(begin, end, outBegin, op);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * A convenience method for computing an exclusive prefix sum. It is a drop in
+   * replacement for std::exclusive_scan(): the i-th output value is the
+   * combination (std::plus by default) of init and the input values 0 to i-1.
+   * The output range may be the input range, in which case the scan is done in
+   * place. Returns the iterator past the last output element.
+   *
+   * This is typically used to turn per-element counts into offsets. Scanning an
+   * array of n+1 values whose last value is zero leaves the total count in the
+   * last value:
+   * \code
+   * // counts holds numCells counts followed by a 0
+   * vtkSMPTools::ExclusiveScan(counts.begin(), counts.end(), counts.begin(), vtkIdType(0));
+   * const vtkIdType total = counts.back();
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt, typename T>
+  static OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, T init)
+  {
+    return vtkSMPTools::ExclusiveScan(begin, end, outBegin, init, std::plus<T>());
+  }
+
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static OutputIt ExclusiveScan(InputIt begin, InputIt end, OutputIt outBegin, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.ExclusiveScan(begin, end, outBegin, init, op);
+  }
+  ///@}
 };
 
 VTK_ABI_NAMESPACE_END
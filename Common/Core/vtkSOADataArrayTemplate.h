@@ -185,6 +185,13 @@ public:
    */
   ValueType* GetComponentArrayPointer(int comp);
 
+  /**
+   * Return true when the values are stored in one buffer per component, which
+   * is the case unless GetVoidPointer() converted the array to an AoS buffer.
+   * GetComponentArrayPointer() is only valid in that case.
+   */
+  bool HasSOAStorage() const { return this->StorageType == StorageTypeEnum::SOA; }
+
   /**
    * Use of this method is discouraged, it creates a deep copy of the data into
    * a contiguous AoS-ordered buffer and prints a warning.
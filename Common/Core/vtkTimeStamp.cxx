@@ -6,6 +6,51 @@
 #include "vtkWindows.h"
 
 #include <atomic>
+#include <cstdint>
+
+namespace
+{
+// Here because of a static destruction error? You're not the first. After
+// discussion of the tradeoffs, the cost of adding a Schwarz counter on this
+// static to ensure it gets destructed is unlikely to be worth the cost over
+// just leaking it.
+//
+// Solutions and their tradeoffs:
+//
+//  - Schwarz counter: each VTK class now has a static initializer function
+//    that increments an integer. This cannot be inlined or optimized away.
+//    Adds latency to ParaView startup.
+//  - Separate library for this static. This adds another library to VTK
+//    which are already legion. It could not be folded into a kit because
+//    that would bring you back to the same problem you have today.
+//  - Leak a heap allocation for it. It's 24 bytes, leaked exactly once, and
+//    is easily suppressed in Valgrind.
+//
+// The last solution has been decided to have the smallest downside of these.
+//
+// Good luck!
+#if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
+std::atomic<uint64_t> GlobalTimeStamp(0U);
+
+// The value of GlobalTimeStamp when the last modification token was taken.
+// The block of time stamps ending there, if any, is closed: the thread owning
+// it reserves a new block at its next modification.
+std::atomic<uint64_t> ClosedTimeStamp(0U);
+
+// Number of time stamps reserved at once by a thread.
+constexpr uint64_t TimeStampBlockSize = 64;
+
+// The time stamps reserved by the current thread, (Next, End].
+struct TimeStampBlock
+{
+  uint64_t Next;
+  uint64_t End;
+};
+VTK_THREAD_LOCAL TimeStampBlock ThreadTimeStampBlock = { 0, 0 };
+#else
+std::atomic<uint32_t> GlobalTimeStamp(0U);
+#endif
+}
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -18,30 +63,51 @@ vtkTimeStamp* vtkTimeStamp::New()
 //------------------------------------------------------------------------------
 void vtkTimeStamp::Modified()
 {
-  // Here because of a static destruction error? You're not the first. After
-  // discussion of the tradeoffs, the cost of adding a Schwarz counter on this
-  // static to ensure it gets destructed is unlikely to be worth the cost over
-  // just leaking it.
-  //
-  // Solutions and their tradeoffs:
-  //
-  //  - Schwarz counter: each VTK class now has a static initializer function
-  //    that increments an integer. This cannot be inlined or optimized away.
-  //    Adds latency to ParaView startup.
-  //  - Separate library for this static. This adds another library to VTK
-  //    which are already legion. It could not be folded into a kit because
-  //    that would bring you back to the same problem you have today.
-  //  - Leak a heap allocation for it. It's 24 bytes, leaked exactly once, and
-  //    is easily suppressed in Valgrind.
-  //
-  // The last solution has been decided to have the smallest downside of these.
-  //
-  // Good luck!
 #if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
-  static std::atomic<uint64_t> GlobalTimeStamp(0U);
+  // Threads reserve time stamps by blocks so that consecutive modifications on
+  // a thread only read the shared counter instead of incrementing it. A block
+  // is only used while it is the last one reserved by any thread: a thread
+  // seeing a modification made in another thread, e.g. through a lock or the
+  // end of a vtkSMPTools::For, also sees the block it came from and reserves a
+  // newer one. Time stamps then keep increasing along any chain of events
+  // ordered across threads, which is what the pipeline relies on. Blocks are
+  // only used with 64 bit time stamps since the unused stamps of a block are
+  // lost. A block closed by GetModificationToken() is not used either, so
+  // that the next modification changes the shared counter.
+  TimeStampBlock& block = ThreadTimeStampBlock;
+  if (block.Next == block.End || GlobalTimeStamp.load(std::memory_order_relaxed) != block.End ||
+    ClosedTimeStamp.load(std::memory_order_relaxed) == block.End)
+  {
+    block.Next = GlobalTimeStamp.fetch_add(TimeStampBlockSize);
+    block.End = block.Next + TimeStampBlockSize;
+  }
+  this->ModifiedTime = (vtkMTimeType)++block.Next;
 #else
-  static std::atomic<uint32_t> GlobalTimeStamp(0U);
-#endif
   this->ModifiedTime = (vtkMTimeType)++GlobalTimeStamp;
+#endif
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkTimeStamp::GetModificationToken()
+{
+#if defined(VTK_USE_64BIT_TIMESTAMPS) || (VTK_SIZEOF_VOID_P == 8)
+  // Close the last reserved block. The closed value only grows, so that a
+  // token taken concurrently by another thread never reopens a block.
+  const uint64_t token = GlobalTimeStamp.load();
+  uint64_t closed = ClosedTimeStamp.load();
+  while (closed < token && !ClosedTimeStamp.compare_exchange_weak(closed, token))
+  {
+  }
+  return (vtkMTimeType)token;
+#else
+  // Every modification increments the shared counter.
+  return (vtkMTimeType)GlobalTimeStamp.load();
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool vtkTimeStamp::IsModificationTokenValid(vtkMTimeType token)
+{
+  return (vtkMTimeType)GlobalTimeStamp.load() == token;
 }
 VTK_ABI_NAMESPACE_END
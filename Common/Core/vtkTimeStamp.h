@@ -5,7 +5,10 @@
  * @brief   record modification and/or execution time
  *
  * vtkTimeStamp records a unique time when the method Modified() is
- * executed. This time is guaranteed to be monotonically increasing.
+ * executed. This time is guaranteed to be monotonically increasing along
+ * any sequence of modifications, including modifications made in different
+ * threads and ordered by a synchronization. Concurrent modifications in
+ * different threads get unique times in an unspecified order.
  * Classes use this object to record modified and/or execution time.
  * There is built in support for the binary < and > comparison
  * operators between two vtkTimeStamp objects.
@@ -37,6 +40,23 @@ public:
    */
   void Modified();
 
+  ///@{
+  /**
+   * Support for caches of values derived from the modification times of
+   * objects that do not notify their changes, such as the vtkInformation
+   * objects vtkInformation::GetMTime() finds in vtkInformationVector values.
+   * GetModificationToken() returns a token that IsModificationTokenValid()
+   * accepts until any time stamp is modified in any thread. A value computed
+   * after taking a token is therefore up to date as long as the token is
+   * valid. Checking a token only reads the shared counter, but taking one
+   * makes the next Modified() reserve a new block of time stamps, so caches
+   * should rather be invalidated by the objects they depend on when these
+   * can notify them.
+   */
+  static vtkMTimeType GetModificationToken();
+  static bool IsModificationTokenValid(vtkMTimeType token);
+  ///@}
+
   /**
    * Return this object's Modified time.
    */
@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks the queries of vtkBVHCellLocator against vtkStaticCellLocator and
+// against brute force on a closed triangulated sphere.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntersectionCounter.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSelectEnclosedPoints.h"
+#include "vtkStaticCellLocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+const int NumberOfRings = 48;
+const int NumberOfSectors = 96;
+
+// A closed unit sphere made of triangles, with one point at each pole.
+void MakeSphere(vtkPolyData* sphere)
+{
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0.0, 0.0, 1.0);
+  for (int ring = 1; ring < NumberOfRings; ++ring)
+  {
+    const double theta = vtkMath::Pi() * ring / NumberOfRings;
+    for (int sector = 0; sector < NumberOfSectors; ++sector)
+    {
+      const double phi = 2.0 * vtkMath::Pi() * sector / NumberOfSectors;
+      points->InsertNextPoint(
+        std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+    }
+  }
+  const vtkIdType southPole = points->InsertNextPoint(0.0, 0.0, -1.0);
+
+  vtkNew<vtkCellArray> triangles;
+  for (int sector = 0; sector < NumberOfSectors; ++sector)
+  {
+    const vtkIdType next = (sector + 1) % NumberOfSectors;
+    const vtkIdType first[3] = { 0, 1 + sector, 1 + next };
+    triangles->InsertNextCell(3, first);
+    for (int ring = 1; ring < NumberOfRings - 1; ++ring)
+    {
+      const vtkIdType p0 = 1 + (ring - 1) * NumberOfSectors;
+      const vtkIdType p1 = p0 + NumberOfSectors;
+      const vtkIdType lower[3] = { p0 + sector, p1 + sector, p1 + next };
+      const vtkIdType upper[3] = { p0 + sector, p1 + next, p0 + next };
+      triangles->InsertNextCell(3, lower);
+      triangles->InsertNextCell(3, upper);
+    }
+    const vtkIdType p0 = 1 + (NumberOfRings - 2) * NumberOfSectors;
+    const vtkIdType last[3] = { p0 + sector, southPole, p0 + next };
+    triangles->InsertNextCell(3, last);
+  }
+  sphere->SetPoints(points);
+  sphere->SetPolys(triangles);
+}
+
+void RandomPoint(vtkMinimalStandardRandomSequence* random, double range, double x[3])
+{
+  for (int c = 0; c < 3; ++c)
+  {
+    x[c] = random->GetNextRangeValue(-range, range);
+  }
+}
+
+bool TestIntersectWithLine(vtkPolyData* sphere, vtkBVHCellLocator* bvh, vtkStaticCellLocator* ref)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(3);
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkIdList> cellIds;
+  vtkNew<vtkIdList> refCellIds;
+  for (int i = 0; i < 2000; ++i)
+  {
+    double p1[3], p2[3];
+    RandomPoint(random, 1.5, p1);
+    RandomPoint(random, 1.5, p2);
+
+    // The closest intersection.
+    double t, x[3], pcoords[3], refT, refX[3];
+    int subId;
+    vtkIdType cellId, refCellId;
+    const int hit = bvh->IntersectWithLine(p1, p2, 0.0, t, x, pcoords, subId, cellId, cell);
+    const int refHit =
+      ref->IntersectWithLine(p1, p2, 0.0, refT, refX, pcoords, subId, refCellId, cell);
+    if (hit != refHit ||
+      (hit && (std::abs(t - refT) > 1e-10 || vtkMath::Distance2BetweenPoints(x, refX) > 1e-20)))
+    {
+      std::cerr << "IntersectWithLine differs from vtkStaticCellLocator for line " << i << "."
+                << std::endl;
+      return false;
+    }
+
+    // All the intersections, sorted along the line.
+    bvh->IntersectWithLine(p1, p2, 0.0, points, cellIds, cell);
+    ref->IntersectWithLine(p1, p2, 0.0, nullptr, refCellIds, cell);
+    bool same = cellIds->GetNumberOfIds() == refCellIds->GetNumberOfIds() &&
+      points->GetNumberOfPoints() == cellIds->GetNumberOfIds();
+    for (vtkIdType j = 0; same && j < cellIds->GetNumberOfIds(); ++j)
+    {
+      same = refCellIds->IsId(cellIds->GetId(j)) >= 0;
+    }
+    for (vtkIdType j = 1; same && j < points->GetNumberOfPoints(); ++j)
+    {
+      same = vtkMath::Distance2BetweenPoints(p1, points->GetPoint(j - 1)) <=
+        vtkMath::Distance2BetweenPoints(p1, points->GetPoint(j));
+    }
+    if (!same)
+    {
+      std::cerr << "IntersectWithLine does not find all the intersections of line " << i << "."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestClosestPointAndBounds(vtkPolyData* sphere, vtkBVHCellLocator* bvh,
+  vtkStaticCellLocator* ref)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(5);
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkIdList> cellIds;
+  for (int i = 0; i < 1000; ++i)
+  {
+    double x[3], closestPoint[3], refClosestPoint[3], dist2, refDist2;
+    int subId;
+    vtkIdType cellId, refCellId;
+    RandomPoint(random, 2.0, x);
+    bvh->FindClosestPoint(x, closestPoint, cell, cellId, subId, dist2);
+    ref->FindClosestPoint(x, refClosestPoint, cell, refCellId, subId, refDist2);
+    if (cellId < 0 || std::abs(dist2 - refDist2) > 1e-12)
+    {
+      std::cerr << "FindClosestPoint differs from vtkStaticCellLocator for point " << i << "."
+                << std::endl;
+      return false;
+    }
+
+    // Boxes around the point, compared to the cells whose bounds overlap them.
+    double bounds[6];
+    for (int c = 0; c < 3; ++c)
+    {
+      bounds[2 * c] = x[c] - 0.2;
+      bounds[2 * c + 1] = x[c] + 0.2;
+    }
+    bvh->FindCellsWithinBounds(bounds, cellIds);
+    const vtkBoundingBox box(bounds);
+    vtkIdType count = 0;
+    for (vtkIdType cellId2 = 0; cellId2 < sphere->GetNumberOfCells(); ++cellId2)
+    {
+      if (box.Intersects(vtkBoundingBox(sphere->GetCell(cellId2)->GetBounds())))
+      {
+        ++count;
+        if (cellIds->IsId(cellId2) < 0)
+        {
+          count = -1;
+          break;
+        }
+      }
+    }
+    if (count != cellIds->GetNumberOfIds())
+    {
+      std::cerr << "FindCellsWithinBounds misses cells around point " << i << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestInsideSurface(vtkPolyData* sphere, vtkBVHCellLocator* bvh)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(11);
+  vtkMath::RandomSeed(11);
+  vtkNew<vtkIdList> cellIds;
+  vtkNew<vtkGenericCell> cell;
+  vtkIntersectionCounter counter(1e-6, sphere->GetLength());
+  double bounds[6];
+  sphere->GetBounds(bounds);
+  for (int i = 0; i < 500; ++i)
+  {
+    // Stay away from the surface, which lies between the radii 0.998 and 1.
+    double x[3];
+    RandomPoint(random, 1.0, x);
+    const double radius = vtkMath::Norm(x);
+    if (radius > 0.95 && radius < 1.05)
+    {
+      continue;
+    }
+    const int inside = vtkSelectEnclosedPoints::IsInsideSurface(
+      x, sphere, bounds, sphere->GetLength(), 1e-6, bvh, cellIds, cell, counter);
+    if (inside != (radius < 1.0 ? 1 : 0))
+    {
+      std::cerr << "IsInsideSurface is wrong for point " << i << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// The leaves of the tree built with the current number of threads.
+std::vector<double> GetLeaves(vtkPolyData* sphere)
+{
+  vtkNew<vtkBVHCellLocator> bvh;
+  bvh->SetDataSet(sphere);
+  bvh->BuildLocator();
+  vtkNew<vtkPolyData> leaves;
+  bvh->GenerateRepresentation(-1, leaves);
+  std::vector<double> result(3 * leaves->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < leaves->GetNumberOfPoints(); ++i)
+  {
+    leaves->GetPoint(i, &result[3 * i]);
+  }
+  return result;
+}
+}
+
+int TestBVHCellLocator(int, char*[])
+{
+  vtkNew<vtkPolyData> sphere;
+  MakeSphere(sphere);
+
+  vtkNew<vtkBVHCellLocator> bvh;
+  bvh->SetDataSet(sphere);
+  bvh->BuildLocator();
+  vtkNew<vtkStaticCellLocator> ref;
+  ref->SetDataSet(sphere);
+  ref->BuildLocator();
+  if (bvh->GetNumberOfNodes() < 2 || bvh->GetDepth() < 1)
+  {
+    std::cerr << "The tree has not been built." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  bool success = TestIntersectWithLine(sphere, bvh, ref);
+  success &= TestClosestPointAndBounds(sphere, bvh, ref);
+  success &= TestInsideSurface(sphere, bvh);
+
+  std::vector<double> serialLeaves;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1, vtkSMPTools::GetBackend(), false },
+    [&]() { serialLeaves = GetLeaves(sphere); });
+  if (serialLeaves.empty() || serialLeaves != GetLeaves(sphere))
+  {
+    std::cerr << "The tree depends on the number of threads." << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -605,6 +605,170 @@ void TestIsHomogeneous(vtkSmartPointer<vtkCellArray> cellArray)
   TEST_ASSERT(cellArray->IsHomogeneous() == 0);
 }
 
+// Whether a visited cell array state gives access to an offsets array.
+struct HasOffsetsArray
+{
+  template <typename CellStateT>
+  bool operator()(CellStateT& state) const
+  {
+    return state.GetOffsets() != nullptr;
+  }
+};
+
+void TestFixedSizeStorage(vtkSmartPointer<vtkCellArray> cellArray)
+{
+  vtkLogScopeFunction(INFO);
+
+  TEST_ASSERT(!cellArray->IsStorageFixedSize());
+  TEST_ASSERT(!cellArray->ConvertToFixedSizeStorage());
+
+  auto validate = [&](const vtkIdType cellId, const std::initializer_list<vtkIdType>& ref) {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    cellArray->GetCellAtId(cellId, npts, pts);
+    TEST_ASSERT(ref.size() == static_cast<std::size_t>(npts));
+    TEST_ASSERT(std::equal(ref.begin(), ref.end(), pts));
+    TEST_ASSERT(cellArray->GetCellSize(cellId) == npts);
+  };
+
+  // Cells of 3 points, without offsets.
+  vtkSmartPointer<vtkDataArray> conn;
+  if (cellArray->IsStorage64Bit())
+  {
+    conn = vtkSmartPointer<vtkCellArray::ArrayType64>::New();
+  }
+  else
+  {
+    conn = vtkSmartPointer<vtkCellArray::ArrayType32>::New();
+  }
+  for (int i = 0; i < 12; ++i)
+  {
+    conn->InsertNextTuple1(i);
+  }
+  // SetData() with a cell size still generates explicit offsets.
+  TEST_ASSERT(cellArray->SetData(3, conn));
+  TEST_ASSERT(!cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->IsValid() && cellArray->GetNumberOfCells() == 4);
+  TEST_ASSERT(cellArray->GetOffsetsArray()->IsA(conn->GetClassName()));
+  TEST_ASSERT(cellArray->GetOffsetsArray()->GetNumberOfValues() == 5);
+  TEST_ASSERT(cellArray->ConvertToFixedSizeStorage());
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+
+  TEST_ASSERT(cellArray->SetFixedSizeData(3, conn));
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 4);
+  TEST_ASSERT(cellArray->GetNumberOfOffsets() == 5);
+  TEST_ASSERT(cellArray->GetOffset(4) == 12);
+  TEST_ASSERT(cellArray->IsHomogeneous() == 3);
+  TEST_ASSERT(cellArray->GetMaxCellSize() == 3);
+  validate(0, { 0, 1, 2 });
+  validate(3, { 9, 10, 11 });
+
+  // Cells of the same size keep the offsets implicit.
+  TEST_ASSERT(cellArray->InsertNextCell({ 12, 13, 14 }) == 4);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  validate(4, { 12, 13, 14 });
+  cellArray->ReverseCellAtId(4);
+  validate(4, { 14, 13, 12 });
+
+  // Copies keep the storage.
+  vtkNew<vtkCellArray> copy;
+  copy->ShallowCopy(cellArray);
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == 5);
+  TEST_ASSERT(copy->GetConnectivityArray() == cellArray->GetConnectivityArray());
+  copy->DeepCopy(cellArray);
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == 5);
+  TEST_ASSERT(copy->IsStorage64Bit() == cellArray->IsStorage64Bit());
+
+  // Appending fixed size cells to explicit offsets generates them.
+  vtkNew<vtkCellArray> appended;
+  appended->InsertNextCell({ 0, 1 });
+  appended->Append(cellArray, 100);
+  TEST_ASSERT(!appended->IsStorageFixedSize() && appended->IsValid());
+  TEST_ASSERT(appended->GetNumberOfCells() == 6 && appended->GetOffset(6) == 17);
+  vtkIdType npts;
+  const vtkIdType* pts;
+  appended->GetCellAtId(5, npts, pts);
+  TEST_ASSERT(npts == 3 && pts[0] == 114 && pts[2] == 112);
+
+  // Another cell size, or asking for the offsets, generates them.
+  TEST_ASSERT(cellArray->InsertNextCell({ 15, 16 }) == 5);
+  TEST_ASSERT(!cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->IsHomogeneous() == -1);
+  TEST_ASSERT(cellArray->GetOffset(5) == 15 && cellArray->GetOffset(6) == 17);
+  validate(4, { 14, 13, 12 });
+  validate(5, { 15, 16 });
+  TEST_ASSERT(!cellArray->ConvertToFixedSizeStorage());
+
+  // The offsets array of fixed size storage is implicit and reading it, or
+  // visiting a const cell array, keeps the storage.
+  vtkDataArray* implicitOffsets = copy->GetOffsetsArray();
+  TEST_ASSERT(implicitOffsets->GetNumberOfValues() == 6);
+  TEST_ASSERT(implicitOffsets->GetComponent(5, 0) == 15);
+  TEST_ASSERT(!implicitOffsets->HasStandardMemoryLayout());
+  TEST_ASSERT(copy->IsStorageFixedSize());
+  copy->InsertNextCell({ 0, 1, 2 });
+  TEST_ASSERT(copy->GetOffsetsArray() == implicitOffsets);
+  TEST_ASSERT(implicitOffsets->GetNumberOfValues() == 7);
+  const vtkCellArray* constCopy = copy;
+  TEST_ASSERT(constCopy->Visit(HasOffsetsArray{}) == false);
+  TEST_ASSERT(copy->IsStorageFixedSize() && copy->GetNumberOfCells() == 6);
+
+  // Writable offsets go back to explicit offsets.
+  vtkDataArray* explicitOffsets = copy->IsStorage64Bit()
+    ? static_cast<vtkDataArray*>(copy->GetOffsetsArray64())
+    : static_cast<vtkDataArray*>(copy->GetOffsetsArray32());
+  TEST_ASSERT(!copy->IsStorageFixedSize() && copy->IsValid());
+  TEST_ASSERT(explicitOffsets->GetNumberOfValues() == 7);
+  TEST_ASSERT(explicitOffsets->GetComponent(6, 0) == 18);
+  TEST_ASSERT(copy->GetOffsetsArray() == explicitOffsets);
+  TEST_ASSERT(constCopy->Visit(HasOffsetsArray{}) == true);
+
+  // Back to fixed size storage, which uses less memory.
+  cellArray->Initialize();
+  FillCellArray(cellArray);
+  for (int i = 0; i < 1000; ++i)
+  {
+    cellArray->InsertNextCell({ i, i + 1, i + 2, i + 3 });
+  }
+  TEST_ASSERT(!cellArray->ConvertToFixedSizeStorage());
+  cellArray->Initialize();
+  for (int i = 0; i < 1000; ++i)
+  {
+    cellArray->InsertNextCell({ i, i + 1, i + 2, i + 3 });
+  }
+  cellArray->Squeeze();
+  const unsigned long explicitSize = cellArray->GetActualMemorySize();
+  TEST_ASSERT(cellArray->ConvertToFixedSizeStorage());
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->GetActualMemorySize() < explicitSize);
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 1000);
+  validate(999, { 999, 1000, 1001, 1002 });
+  auto iter = vtk::TakeSmartPointer(cellArray->NewIterator());
+  vtkIdType cellId = 0;
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell(), ++cellId)
+  {
+    iter->GetCurrentCell(npts, pts);
+    TEST_ASSERT(npts == 4 && pts[0] == cellId && pts[3] == cellId + 3);
+  }
+  TEST_ASSERT(cellId == 1000);
+
+  // Conversions between 32- and 64-bit storage keep it.
+  TEST_ASSERT(cellArray->IsStorage64Bit() ? cellArray->ConvertTo32BitStorage()
+                                          : cellArray->ConvertTo64BitStorage());
+  TEST_ASSERT(cellArray->IsStorageFixedSize() && cellArray->GetNumberOfCells() == 1000);
+  validate(999, { 999, 1000, 1001, 1002 });
+
+  // Reset keeps it, Initialize goes back to explicit offsets.
+  cellArray->Reset();
+  TEST_ASSERT(cellArray->IsStorageFixedSize() && cellArray->GetNumberOfCells() == 0);
+  cellArray->Initialize();
+  TEST_ASSERT(!cellArray->IsStorageFixedSize() && cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfOffsets() == 1);
+}
+
 void TestTraversalSizePointer(vtkSmartPointer<vtkCellArray> cellArray)
 {
   vtkLogScopeFunction(INFO);
@@ -1375,6 +1539,7 @@ void RunTests(bool use64BitStorage)
   TestGetOffsetsArray(NewCellArray(use64BitStorage));
   TestGetConnectivityArray(NewCellArray(use64BitStorage));
   TestIsHomogeneous(NewCellArray(use64BitStorage));
+  TestFixedSizeStorage(NewCellArray(use64BitStorage));
   TestTraversalSizePointer(NewCellArray(use64BitStorage));
   TestTraversalIdList(NewCellArray(use64BitStorage));
   TestGetCellAtId(NewCellArray(use64BitStorage));
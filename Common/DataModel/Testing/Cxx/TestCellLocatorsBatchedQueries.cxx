@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that the batched queries of the cell locators return the same
+// results as the corresponding single queries.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkCellLocator.h"
+#include "vtkCellTreeLocator.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+
+namespace
+{
+const int Resolution = 12;
+
+// A grid of Resolution^3 voxels covering [0, 1]^3.
+void MakeGrid(vtkImageData* grid)
+{
+  grid->SetDimensions(Resolution + 1, Resolution + 1, Resolution + 1);
+  grid->SetSpacing(1.0 / Resolution, 1.0 / Resolution, 1.0 / Resolution);
+}
+
+bool Near(const double* a, const double* b, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    if (std::abs(a[i] - b[i]) > 1e-10)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestLocator(vtkDataSet* grid, vtkAbstractCellLocator* locator, bool closestPoints)
+{
+  locator->SetDataSet(grid);
+  locator->BuildLocator();
+
+  // Points and lines partly outside of the grid.
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(42);
+  const vtkIdType numQueries = 2000;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkPoints> ends;
+  points->SetNumberOfPoints(numQueries);
+  ends->SetNumberOfPoints(numQueries);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    double x[3], y[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(-0.1, 1.1);
+      y[c] = random->GetNextRangeValue(-0.1, 1.1);
+    }
+    points->SetPoint(i, x);
+    ends->SetPoint(i, y);
+  }
+
+  vtkNew<vtkIdTypeArray> cellIds;
+  vtkNew<vtkDoubleArray> pcoords;
+  vtkNew<vtkDoubleArray> weights;
+  locator->FindCells(points, 0.0, cellIds, pcoords, weights);
+  if (cellIds->GetNumberOfTuples() != numQueries || pcoords->GetNumberOfComponents() != 3 ||
+    weights->GetNumberOfComponents() != grid->GetMaxCellSize())
+  {
+    std::cerr << locator->GetClassName() << ": wrong FindCells output size." << std::endl;
+    return false;
+  }
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    double x[3], pc[3], w[8];
+    int subId;
+    points->GetPoint(i, x);
+    const vtkIdType cellId = locator->FindCell(x, 0.0, cell, subId, pc, w);
+    const vtkIdType batchedCellId = cellIds->GetValue(i);
+    if (cellId >= 0 && batchedCellId >= 0 && cellId != batchedCellId)
+    {
+      // A point on a face is inside of both cells sharing it.
+      double closestPoint[3], dist2;
+      grid->GetCell(batchedCellId, cell);
+      if (cell->EvaluatePosition(x, closestPoint, subId, pc, dist2, w) == 1)
+      {
+        continue;
+      }
+    }
+    if (cellId != batchedCellId ||
+      (cellId >= 0 &&
+        (!Near(pc, pcoords->GetPointer(3 * i), 3) || !Near(w, weights->GetPointer(8 * i), 8))))
+    {
+      std::cerr << locator->GetClassName() << ": FindCells differs from FindCell for point " << i
+                << "." << std::endl;
+      return false;
+    }
+  }
+
+  vtkNew<vtkDoubleArray> t;
+  vtkNew<vtkDoubleArray> x;
+  locator->IntersectWithLines(points, ends, 0.0, cellIds, t, x, pcoords);
+  vtkIdType numHits = 0;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    double p1[3], p2[3], lineT = 0.0, lineX[3], pc[3];
+    int subId;
+    vtkIdType cellId = -1;
+    points->GetPoint(i, p1);
+    ends->GetPoint(i, p2);
+    if (!locator->IntersectWithLine(p1, p2, 0.0, lineT, lineX, pc, subId, cellId, cell))
+    {
+      cellId = -1;
+    }
+    if (cellId != cellIds->GetValue(i) ||
+      (cellId >= 0 && (lineT != t->GetValue(i) || !Near(lineX, x->GetPointer(3 * i), 3))))
+    {
+      std::cerr << locator->GetClassName() << ": IntersectWithLines differs from "
+                << "IntersectWithLine for line " << i << "." << std::endl;
+      return false;
+    }
+    numHits += cellId >= 0 ? 1 : 0;
+  }
+  if (numHits == 0)
+  {
+    std::cerr << locator->GetClassName() << ": no line intersects the grid." << std::endl;
+    return false;
+  }
+
+  if (closestPoints)
+  {
+    vtkNew<vtkDoubleArray> dist2;
+    locator->FindClosestPoints(points, cellIds, x, dist2);
+    for (vtkIdType i = 0; i < numQueries; ++i)
+    {
+      double p[3], closestPoint[3], pDist2;
+      int subId;
+      vtkIdType cellId;
+      points->GetPoint(i, p);
+      locator->FindClosestPoint(p, closestPoint, cell, cellId, subId, pDist2);
+      // Several cells may share the closest point, compare the distances.
+      if (cellIds->GetValue(i) < 0 || std::abs(pDist2 - dist2->GetValue(i)) > 1e-10 ||
+        !Near(closestPoint, x->GetPointer(3 * i), 3))
+      {
+        std::cerr << locator->GetClassName() << ": FindClosestPoints differs from "
+                  << "FindClosestPoint for point " << i << "." << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+}
+
+int TestCellLocatorsBatchedQueries(int, char*[])
+{
+  vtkNew<vtkImageData> grid;
+  MakeGrid(grid);
+
+  vtkNew<vtkStaticCellLocator> staticLocator;
+  vtkNew<vtkCellLocator> cellLocator;
+  vtkNew<vtkCellTreeLocator> cellTreeLocator;
+  vtkNew<vtkBVHCellLocator> bvhLocator;
+  bool success = TestLocator(grid, staticLocator, true);
+  success &= TestLocator(grid, cellLocator, true);
+  success &= TestLocator(grid, cellTreeLocator, false);
+  success &= TestLocator(grid, bvhLocator, true);
+
+  // An empty data set finds nothing.
+  vtkNew<vtkUnstructuredGrid> empty;
+  vtkNew<vtkPoints> emptyPoints;
+  empty->SetPoints(emptyPoints);
+  vtkNew<vtkStaticCellLocator> emptyLocator;
+  emptyLocator->SetDataSet(empty);
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0.5, 0.5, 0.5);
+  vtkNew<vtkIdTypeArray> cellIds;
+  emptyLocator->FindCells(points, 0.0, cellIds);
+  if (cellIds->GetNumberOfTuples() != 1 || cellIds->GetValue(0) != -1)
+  {
+    std::cerr << "FindCells found a cell in an empty data set." << std::endl;
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,319 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that the modification times cached by vtkFieldData, vtkDataSet and
+// vtkInformation follow the modifications of their parts, that modification
+// tokens are invalidated by modifications in any thread, and that time stamps
+// taken in other threads are ordered before the ones taken after synchronizing
+// with them.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkInformation.h"
+#include "vtkInformationInformationKey.h"
+#include "vtkInformationInformationVectorKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkTimeStamp.h"
+
+#include <vector>
+
+namespace
+{
+bool TestFieldData()
+{
+  vtkNew<vtkFieldData> fd;
+  vtkNew<vtkIntArray> a;
+  a->SetName("a");
+  vtkNew<vtkDoubleArray> b;
+  b->SetName("b");
+  fd->AddArray(a);
+  fd->AddArray(b);
+
+  vtkMTimeType mtime = fd->GetMTime();
+  if (fd->GetMTime() != mtime)
+  {
+    vtkLog(ERROR, "Modification time changed without modification.");
+    return false;
+  }
+
+  a->Modified();
+  if (fd->GetMTime() != a->GetMTime() || a->GetMTime() <= mtime)
+  {
+    vtkLog(ERROR, "Modifying an array did not update the field data.");
+    return false;
+  }
+
+  // Modifying an array outside of the field data invalidates the cache but
+  // does not change the time.
+  mtime = fd->GetMTime();
+  vtkNew<vtkIntArray> other;
+  other->Modified();
+  if (fd->GetMTime() != mtime)
+  {
+    vtkLog(ERROR, "Modifying another array changed the field data.");
+    return false;
+  }
+
+  // Arrays added after caching are accounted for.
+  vtkNew<vtkIntArray> c;
+  c->SetName("c");
+  c->Modified();
+  fd->AddArray(c);
+  if (fd->GetMTime() < c->GetMTime())
+  {
+    vtkLog(ERROR, "Adding an array did not update the field data.");
+    return false;
+  }
+
+  // An array shared with another field data notifies both of them.
+  vtkNew<vtkPolyData> pd;
+  pd->GetPointData()->ShallowCopy(fd);
+  mtime = pd->GetMTime();
+  b->Modified();
+  if (fd->GetMTime() != b->GetMTime() || pd->GetMTime() != b->GetMTime() ||
+    b->GetMTime() <= mtime)
+  {
+    vtkLog(ERROR, "Modifying a shared array did not update all field data.");
+    return false;
+  }
+
+  fd->RemoveArray("b");
+  b->Modified();
+  if (fd->GetMTime() >= b->GetMTime())
+  {
+    vtkLog(ERROR, "Removed array still accounted for.");
+    return false;
+  }
+
+  // Arrays modified in other threads notify the field data too.
+  const int numArrays = 16;
+  std::vector<vtkNew<vtkIntArray>> arrays(numArrays);
+  for (auto& array : arrays)
+  {
+    fd->AddArray(array);
+  }
+  mtime = fd->GetMTime();
+  vtkSMPTools::For(0, numArrays, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      arrays[i]->Modified();
+    }
+  });
+  for (auto& array : arrays)
+  {
+    if (fd->GetMTime() < array->GetMTime() || array->GetMTime() <= mtime)
+    {
+      vtkLog(ERROR, "Modifying an array in another thread did not update the field data.");
+      return false;
+    }
+  }
+  return true;
+}
+
+struct TestKeys
+{
+  static vtkInformationInformationKey* NESTED();
+  static vtkInformationInformationVectorKey* NESTED_VECTOR();
+  static vtkInformationIntegerKey* VALUE();
+};
+vtkInformationKeyMacro(TestKeys, NESTED, Information);
+vtkInformationKeyMacro(TestKeys, NESTED_VECTOR, InformationVector);
+vtkInformationKeyMacro(TestKeys, VALUE, Integer);
+
+// The cached modification time of an information object follows the objects
+// nested in it, at any depth, and in information vectors.
+bool TestInformation()
+{
+  vtkNew<vtkInformation> info;
+  vtkNew<vtkInformation> child;
+  vtkNew<vtkInformation> grandChild;
+  child->Set(TestKeys::NESTED(), grandChild);
+  info->Set(TestKeys::NESTED(), child);
+  info->Set(TestKeys::VALUE(), 1);
+
+  vtkMTimeType mtime = info->GetMTime();
+  if (info->GetMTime() != mtime)
+  {
+    vtkLog(ERROR, "Information modification time changed without modification.");
+    return false;
+  }
+
+  // Setting unrelated keys elsewhere does not change the time.
+  vtkNew<vtkInformation> other;
+  other->Set(TestKeys::VALUE(), 1);
+  if (info->GetMTime() != mtime)
+  {
+    vtkLog(ERROR, "Modifying another information changed the time.");
+    return false;
+  }
+
+  for (vtkInformation* nested : { static_cast<vtkInformation*>(child),
+         static_cast<vtkInformation*>(grandChild) })
+  {
+    nested->Set(TestKeys::VALUE(), nested->Get(TestKeys::VALUE()) + 1);
+    if (info->GetMTime() != nested->GetMTime())
+    {
+      vtkLog(ERROR, "Modifying a nested information did not update its owner.");
+      return false;
+    }
+  }
+
+  // Information objects shared by several owners notify all of them.
+  vtkNew<vtkInformation> copy;
+  copy->Copy(info);
+  grandChild->Modified();
+  if (info->GetMTime() != grandChild->GetMTime() || copy->GetMTime() != grandChild->GetMTime())
+  {
+    vtkLog(ERROR, "Modifying a shared information did not update all owners.");
+    return false;
+  }
+
+  info->Remove(TestKeys::NESTED());
+  mtime = info->GetMTime();
+  grandChild->Modified();
+  if (info->GetMTime() != mtime)
+  {
+    vtkLog(ERROR, "Removed information still accounted for.");
+    return false;
+  }
+
+  // Information vectors do not notify their changes, the modification tokens
+  // take over.
+  vtkNew<vtkInformationVector> infoVec;
+  infoVec->Append(child);
+  info->Set(TestKeys::NESTED_VECTOR(), infoVec);
+  info->GetMTime();
+  grandChild->Modified();
+  if (info->GetMTime() != grandChild->GetMTime())
+  {
+    vtkLog(ERROR, "Modifying an information in a vector did not update its owner.");
+    return false;
+  }
+  return true;
+}
+
+// A token stays valid until a time stamp is modified, in any thread, even
+// when the thread modifying it had reserved its block of time stamps before
+// the token was taken.
+bool TestModificationToken()
+{
+  const vtkIdType n = 1000;
+  std::vector<vtkTimeStamp> stamps(n);
+  for (int pass = 0; pass < 3; ++pass)
+  {
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        stamps[i].Modified();
+      }
+    });
+    const vtkMTimeType token = vtkTimeStamp::GetModificationToken();
+    if (!vtkTimeStamp::IsModificationTokenValid(token) ||
+      vtkTimeStamp::GetModificationToken() != token)
+    {
+      vtkLog(ERROR, "Token invalidated without modification.");
+      return false;
+    }
+    stamps[pass].Modified();
+    if (vtkTimeStamp::IsModificationTokenValid(token))
+    {
+      vtkLog(ERROR, "Token still valid after a modification.");
+      return false;
+    }
+    const vtkMTimeType otherToken = vtkTimeStamp::GetModificationToken();
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        stamps[i].Modified();
+      }
+    });
+    if (vtkTimeStamp::IsModificationTokenValid(otherToken))
+    {
+      vtkLog(ERROR, "Token still valid after modifications in other threads.");
+      return false;
+    }
+  }
+  return true;
+}
+
+// The cached modification time of a dataset follows its arrays and points.
+bool TestDataSet()
+{
+  vtkNew<vtkPolyData> pd;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(1);
+  pd->SetPoints(points);
+  vtkNew<vtkIntArray> a;
+  a->SetName("a");
+  a->SetNumberOfTuples(1);
+  pd->GetPointData()->AddArray(a);
+  vtkNew<vtkDoubleArray> b;
+  b->SetName("b");
+  pd->GetCellData()->AddArray(b);
+
+  const vtkMTimeType mtime = pd->GetMTime();
+  if (pd->GetMTime() != mtime)
+  {
+    vtkLog(ERROR, "Dataset modification time changed without modification.");
+    return false;
+  }
+  for (vtkObject* child : { static_cast<vtkObject*>(a), static_cast<vtkObject*>(b),
+         static_cast<vtkObject*>(points->GetData()),
+         static_cast<vtkObject*>(pd->GetFieldData()) })
+  {
+    child->Modified();
+    if (pd->GetMTime() != child->GetMTime())
+    {
+      vtkLog(ERROR, "Modifying a " << child->GetClassName() << " did not update the dataset.");
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestTimeStampOrdering()
+{
+  const vtkIdType n = 100000;
+  std::vector<vtkTimeStamp> stamps(n);
+  for (int pass = 0; pass < 3; ++pass)
+  {
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        stamps[i].Modified();
+      }
+    });
+    // The end of the loop orders the stamps taken by the workers before the
+    // ones of this thread.
+    vtkTimeStamp after;
+    after.Modified();
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      if (stamps[i] > after)
+      {
+        vtkLog(ERROR, "Time stamp " << i << " taken in a worker is newer than a later one.");
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestFieldDataMTime(int, char*[])
+{
+  bool success = TestFieldData();
+  success &= TestModificationToken();
+  success &= TestInformation();
+  success &= TestDataSet();
+  success &= TestTimeStampOrdering();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
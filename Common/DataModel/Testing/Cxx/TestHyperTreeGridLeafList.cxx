@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that vtkHyperTreeGridLeafList enumerates the same leaves, with the
+// same levels, origins and sizes, as a traversal with geometry cursors.
+
+#include "vtkBitArray.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridLeafList.h"
+#include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
+#include "vtkHyperTreeGridPreConfiguredSource.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+struct Leaf
+{
+  vtkIdType GlobalIndex;
+  unsigned int Level;
+  double Origin[3];
+  double Size[3];
+};
+
+void CollectLeaves(vtkHyperTreeGridNonOrientedGeometryCursor* cursor, std::vector<Leaf>& leaves)
+{
+  if (cursor->IsMasked())
+  {
+    return;
+  }
+  if (cursor->IsLeaf())
+  {
+    Leaf leaf;
+    leaf.GlobalIndex = cursor->GetGlobalNodeIndex();
+    leaf.Level = cursor->GetLevel();
+    std::copy(cursor->GetOrigin(), cursor->GetOrigin() + 3, leaf.Origin);
+    std::copy(cursor->GetSize(), cursor->GetSize() + 3, leaf.Size);
+    leaves.push_back(leaf);
+    return;
+  }
+  for (unsigned int ichild = 0; ichild < cursor->GetNumberOfChildren(); ++ichild)
+  {
+    cursor->ToChild(ichild);
+    CollectLeaves(cursor, leaves);
+    cursor->ToParent();
+  }
+}
+
+bool CheckLeafList(vtkHyperTreeGrid* htg, const char* name)
+{
+  vtkNew<vtkHyperTreeGridLeafList> list;
+  list->Build(htg);
+
+  vtkIdType numTrees = 0;
+  vtkIdType treeIndex;
+  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
+  htg->InitializeTreeIterator(it);
+  vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
+  while (it.GetNextTree(treeIndex))
+  {
+    if (numTrees >= list->GetNumberOfTrees() || list->GetTreeIndex(numTrees) != treeIndex)
+    {
+      std::cerr << name << ": wrong tree at position " << numTrees << "." << std::endl;
+      return false;
+    }
+    htg->InitializeNonOrientedGeometryCursor(cursor, treeIndex);
+    std::vector<Leaf> leaves;
+    CollectLeaves(cursor, leaves);
+    const vtkIdType begin = list->GetTreeBegin(numTrees);
+    if (list->GetTreeEnd(numTrees) - begin != static_cast<vtkIdType>(leaves.size()))
+    {
+      std::cerr << name << ": wrong number of leaves in tree " << treeIndex << "." << std::endl;
+      return false;
+    }
+    for (size_t i = 0; i < leaves.size(); ++i)
+    {
+      const vtkIdType leaf = begin + static_cast<vtkIdType>(i);
+      double size[3];
+      list->GetSize(numTrees, list->GetLevel(leaf), size);
+      const double* origin = list->GetOrigin(leaf);
+      bool same = list->GetGlobalIndex(leaf) == leaves[i].GlobalIndex &&
+        list->GetLevel(leaf) == leaves[i].Level;
+      for (int c = 0; c < 3; ++c)
+      {
+        same &= origin[c] == leaves[i].Origin[c] && size[c] == leaves[i].Size[c];
+      }
+      if (!same)
+      {
+        std::cerr << name << ": leaf " << i << " of tree " << treeIndex
+                  << " differs from the cursor." << std::endl;
+        return false;
+      }
+    }
+    ++numTrees;
+  }
+  if (numTrees != list->GetNumberOfTrees() ||
+    list->GetTreeEnd(numTrees - 1) != list->GetNumberOfLeaves())
+  {
+    std::cerr << name << ": wrong number of trees or leaves." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestHyperTreeGridLeafList(int, char*[])
+{
+  bool success = true;
+  vtkNew<vtkHyperTreeGridPreConfiguredSource> source;
+  for (int mode = vtkHyperTreeGridPreConfiguredSource::UNBALANCED_3DEPTH_2BRANCH_2X3;
+       mode <= vtkHyperTreeGridPreConfiguredSource::BALANCED_2DEPTH_3BRANCH_3X3X2; ++mode)
+  {
+    source->SetHTGMode(static_cast<vtkHyperTreeGridPreConfiguredSource::HTGType>(mode));
+    source->Update();
+    vtkHyperTreeGrid* htg = source->GetHyperTreeGridOutput();
+    success &= CheckLeafList(htg, "preconfigured grid");
+
+    // Mask every third cell, leaves and coarse cells: the subtrees of the
+    // masked coarse cells are skipped.
+    vtkNew<vtkHyperTreeGrid> masked;
+    masked->ShallowCopy(htg);
+    vtkNew<vtkBitArray> mask;
+    mask->SetNumberOfTuples(masked->GetNumberOfCells());
+    for (vtkIdType cellId = 0; cellId < masked->GetNumberOfCells(); ++cellId)
+    {
+      mask->SetValue(cellId, cellId % 3 == 1);
+    }
+    masked->SetMask(mask);
+    success &= CheckLeafList(masked, "masked grid");
+
+    // Cells at the depth limit are leaves.
+    masked->SetMask(nullptr);
+    masked->SetDepthLimiter(1);
+    success &= CheckLeafList(masked, "depth limited grid");
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that the batched queries of the point locators return the same
+// neighbors as the corresponding single queries.
+
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointLocator.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
+
+#include <cmath>
+#include <initializer_list>
+
+namespace
+{
+bool CompareNeighbors(vtkAbstractPointLocator* locator, vtkPoints* queries, bool radius,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  const char* name = radius ? "FindPointsWithinRadius" : "FindClosestNPoints";
+  const vtkIdType numQueries = queries->GetNumberOfPoints();
+  if (offsets->GetNumberOfValues() != numQueries + 1 || offsets->GetValue(0) != 0 ||
+    ids->GetNumberOfValues() != offsets->GetValue(numQueries) ||
+    dist2->GetNumberOfValues() != ids->GetNumberOfValues())
+  {
+    std::cerr << locator->GetClassName() << ": wrong " << name << " output size." << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkIdList> result;
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    double x[3];
+    queries->GetPoint(i, x);
+    if (radius)
+    {
+      locator->FindPointsWithinRadius(0.1, x, result);
+    }
+    else
+    {
+      locator->FindClosestNPoints(10, x, result);
+    }
+    const vtkIdType offset = offsets->GetValue(i);
+    bool same = offsets->GetValue(i + 1) - offset == result->GetNumberOfIds();
+    for (vtkIdType j = 0; same && j < result->GetNumberOfIds(); ++j)
+    {
+      const vtkIdType id = ids->GetValue(offset + j);
+      same = id == result->GetId(j) &&
+        std::abs(dist2->GetValue(offset + j) -
+          vtkMath::Distance2BetweenPoints(x, locator->GetDataSet()->GetPoint(id))) < 1e-12;
+    }
+    if (!same)
+    {
+      std::cerr << locator->GetClassName() << ": batched " << name
+                << " differs from the single query for point " << i << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestLocator(vtkPolyData* cloud, vtkPoints* queries, vtkAbstractPointLocator* locator)
+{
+  locator->SetDataSet(cloud);
+  locator->BuildLocator();
+
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> ids;
+  vtkNew<vtkDoubleArray> dist2;
+  bool success = true;
+  // The points of the data set itself, then arbitrary points.
+  for (vtkPoints* points : { cloud->GetPoints(), queries })
+  {
+    locator->FindClosestNPoints(10, points, offsets, ids, dist2);
+    success &= CompareNeighbors(locator, points, false, offsets, ids, dist2);
+    locator->FindPointsWithinRadius(0.1, points, offsets, ids, dist2);
+    success &= CompareNeighbors(locator, points, true, offsets, ids, dist2);
+  }
+  return success;
+}
+}
+
+int TestPointLocatorsBatchedQueries(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(7);
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkPoints> queries;
+  for (int i = 0; i < 5000; ++i)
+  {
+    double x[3], y[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(0.0, 1.0);
+      y[c] = random->GetNextRangeValue(-0.1, 1.1);
+    }
+    points->InsertNextPoint(x);
+    queries->InsertNextPoint(y);
+  }
+  vtkNew<vtkPolyData> cloud;
+  cloud->SetPoints(points);
+
+  vtkNew<vtkStaticPointLocator> staticLocator;
+  vtkNew<vtkPointLocator> pointLocator;
+  bool success = TestLocator(cloud, queries, staticLocator);
+  success &= TestLocator(cloud, queries, pointLocator);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
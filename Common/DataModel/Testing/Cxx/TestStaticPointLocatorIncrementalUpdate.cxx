@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that the incremental updates of vtkStaticPointLocator give the same
+// queries as a locator built from scratch on a deforming point cloud.
+
+#include "vtkIdList.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 20000;
+
+// Move the points by a small random displacement, staying within the bounds.
+void MovePoints(vtkPoints* points, vtkMinimalStandardRandomSequence* random, double step)
+{
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    points->GetPoint(ptId, x);
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = std::min(std::max(x[c] + random->GetNextRangeValue(-step, step), 0.0), 1.0);
+    }
+    points->SetPoint(ptId, x);
+  }
+  points->Modified();
+}
+
+bool CheckBuckets(vtkStaticPointLocator* locator)
+{
+  vtkNew<vtkIdList> ids;
+  vtkIdType count = 0;
+  for (vtkIdType bucket = 0; bucket < locator->GetNumberOfBuckets(); ++bucket)
+  {
+    locator->GetBucketIds(bucket, ids);
+    count += ids->GetNumberOfIds();
+    if (!std::is_sorted(ids->begin(), ids->end()))
+    {
+      std::cerr << "The points of bucket " << bucket << " are not sorted." << std::endl;
+      return false;
+    }
+  }
+  if (count != NumberOfPoints)
+  {
+    std::cerr << "The buckets contain " << count << " points." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Compare the queries of the updated locator and of a new one.
+bool CompareQueries(vtkPolyData* cloud, vtkStaticPointLocator* locator)
+{
+  vtkNew<vtkStaticPointLocator> reference;
+  reference->SetDataSet(cloud);
+  reference->BuildLocator();
+
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(7);
+  vtkNew<vtkIdList> ids;
+  vtkNew<vtkIdList> refIds;
+  for (int i = 0; i < 1000; ++i)
+  {
+    double x[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(-0.1, 1.1);
+    }
+    locator->FindClosestNPoints(5, x, ids);
+    reference->FindClosestNPoints(5, x, refIds);
+    bool same = locator->FindClosestPoint(x) == reference->FindClosestPoint(x) &&
+      ids->GetNumberOfIds() == refIds->GetNumberOfIds() &&
+      std::equal(ids->begin(), ids->end(), refIds->begin());
+
+    locator->FindPointsWithinRadius(0.05, x, ids);
+    reference->FindPointsWithinRadius(0.05, x, refIds);
+    std::sort(ids->begin(), ids->end());
+    std::sort(refIds->begin(), refIds->end());
+    same &= ids->GetNumberOfIds() == refIds->GetNumberOfIds() &&
+      std::equal(ids->begin(), ids->end(), refIds->begin());
+    if (!same)
+    {
+      std::cerr << "The updated locator differs from a new locator for query " << i << "."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestStaticPointLocatorIncrementalUpdate(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(NumberOfPoints);
+  for (vtkIdType ptId = 0; ptId < NumberOfPoints; ++ptId)
+  {
+    double x[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(0.0, 1.0);
+    }
+    points->SetPoint(ptId, x);
+  }
+  // Make sure that the bounds of the cloud are the unit cube.
+  points->SetPoint(0, 0.0, 0.0, 0.0);
+  points->SetPoint(1, 1.0, 1.0, 1.0);
+  vtkNew<vtkPolyData> cloud;
+  cloud->SetPoints(points);
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(cloud);
+  locator->IncrementalUpdateOn();
+  locator->BuildLocator();
+  bool success = true;
+  if (locator->GetNumberOfMovedPoints() != NumberOfPoints)
+  {
+    std::cerr << "All the points should be placed by the first build." << std::endl;
+    success = false;
+  }
+
+  // A few time steps with small displacements: some points change bucket.
+  for (int step = 0; step < 3; ++step)
+  {
+    MovePoints(points, random, 0.01);
+    locator->BuildLocator();
+    const vtkIdType moved = locator->GetNumberOfMovedPoints();
+    if (moved <= 0 || moved >= NumberOfPoints)
+    {
+      std::cerr << "Unexpected number of moved points: " << moved << "." << std::endl;
+      success = false;
+    }
+    success &= CheckBuckets(locator);
+    success &= CompareQueries(cloud, locator);
+  }
+
+  // Points modified without moving.
+  points->Modified();
+  locator->BuildLocator();
+  if (locator->GetNumberOfMovedPoints() != 0)
+  {
+    std::cerr << "No point should have moved." << std::endl;
+    success = false;
+  }
+
+  // A point leaving the bounds requires a full build.
+  points->SetPoint(2, 1.5, 0.5, 0.5);
+  points->Modified();
+  locator->BuildLocator();
+  if (locator->GetNumberOfMovedPoints() != NumberOfPoints)
+  {
+    std::cerr << "A point outside the locator bounds should trigger a full build." << std::endl;
+    success = false;
+  }
+  success &= CheckBuckets(locator);
+  success &= CompareQueries(cloud, locator);
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
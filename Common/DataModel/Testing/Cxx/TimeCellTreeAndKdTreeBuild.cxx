@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Times the construction of vtkCellTreeLocator and vtkKdTree against the
+// number of threads, and checks that the trees do not depend on it.
+
+#include "vtkCellTreeLocator.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkKdTree.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+
+#include <vector>
+
+namespace
+{
+const int Resolution = 40;
+
+// A grid of Resolution^3 voxels covering [0, 1]^3.
+void MakeGrid(vtkImageData* grid)
+{
+  grid->SetDimensions(Resolution + 1, Resolution + 1, Resolution + 1);
+  grid->SetSpacing(1.0 / Resolution, 1.0 / Resolution, 1.0 / Resolution);
+}
+
+// What identifies a built tree: the leaf boxes of the cell tree, the region
+// of each cell and of each point for the k-d trees.
+struct Trees
+{
+  std::vector<double> CellTreeLeaves;
+  std::vector<int> CellRegions;
+  std::vector<vtkIdType> PointRegions;
+};
+
+void BuildTrees(vtkImageData* grid, Trees& trees, vtkTimerLog* timer, double times[3])
+{
+  vtkNew<vtkCellTreeLocator> cellTree;
+  cellTree->SetDataSet(grid);
+  timer->StartTimer();
+  cellTree->BuildLocator();
+  timer->StopTimer();
+  times[0] = timer->GetElapsedTime();
+  vtkNew<vtkPolyData> leaves;
+  cellTree->GenerateRepresentation(-1, leaves);
+  trees.CellTreeLeaves.resize(3 * leaves->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < leaves->GetNumberOfPoints(); ++i)
+  {
+    leaves->GetPoint(i, &trees.CellTreeLeaves[3 * i]);
+  }
+
+  vtkNew<vtkKdTree> cellKdTree;
+  cellKdTree->SetDataSet(grid);
+  timer->StartTimer();
+  cellKdTree->BuildLocator();
+  timer->StopTimer();
+  times[1] = timer->GetElapsedTime();
+  int* cellRegions = cellKdTree->AllGetRegionContainingCell();
+  trees.CellRegions.assign(cellRegions, cellRegions + grid->GetNumberOfCells());
+
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(grid->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+  {
+    points->SetPoint(i, grid->GetPoint(i));
+  }
+  vtkNew<vtkKdTree> pointKdTree;
+  timer->StartTimer();
+  pointKdTree->BuildLocatorFromPoints(points);
+  timer->StopTimer();
+  times[2] = timer->GetElapsedTime();
+  trees.PointRegions.assign(grid->GetNumberOfPoints(), -1);
+  for (int region = 0; region < pointKdTree->GetNumberOfRegions(); ++region)
+  {
+    vtkIdTypeArray* ids = pointKdTree->GetPointsInRegion(region);
+    for (vtkIdType i = 0; ids && i < ids->GetNumberOfValues(); ++i)
+    {
+      trees.PointRegions[ids->GetValue(i)] = region;
+    }
+  }
+}
+}
+
+int TimeCellTreeAndKdTreeBuild(int, char*[])
+{
+  vtkNew<vtkImageData> grid;
+  MakeGrid(grid);
+  vtkNew<vtkTimerLog> timer;
+
+  cout << "\nBuild times for " << grid->GetNumberOfCells() << " cells, "
+       << grid->GetNumberOfPoints() << " points (" << vtkSMPTools::GetBackend() << " backend)\n";
+  cout << "threads\tvtkCellTreeLocator\tvtkKdTree (cells)\tvtkKdTree (points)\n";
+
+  Trees serial;
+  bool success = true;
+  const int maxThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+  {
+    Trees trees;
+    double times[3];
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ numThreads, vtkSMPTools::GetBackend(), false },
+      [&]() { BuildTrees(grid, trees, timer, times); });
+    cout << numThreads << "\t" << times[0] << "\t" << times[1] << "\t" << times[2] << "\n";
+
+    if (numThreads == 1)
+    {
+      serial = trees;
+    }
+    else if (trees.CellTreeLeaves != serial.CellTreeLeaves ||
+      trees.CellRegions != serial.CellRegions || trees.PointRegions != serial.PointRegions)
+    {
+      std::cerr << "The trees built with " << numThreads
+                << " threads differ from the ones built with one thread." << std::endl;
+      success = false;
+    }
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -5,11 +5,35 @@
 // .SECTION Description
 // this program tests vtkUnstructuredGrid
 
+#include "vtkCellArray.h"
+#include "vtkCellLinks.h"
+#include "vtkCellType.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
+#include "vtkPoints.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <vector>
+
+namespace
+{
+// The cells of each point listed by a vtkCellLinks.
+std::vector<std::vector<vtkIdType>> GetLinks(vtkUnstructuredGrid* ug, bool sequential)
+{
+  vtkNew<vtkCellLinks> links;
+  links->SetSequentialProcessing(sequential);
+  links->SetDataSet(ug);
+  links->BuildLinks();
+  std::vector<std::vector<vtkIdType>> result(ug->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < ug->GetNumberOfPoints(); ++ptId)
+  {
+    result[ptId].assign(links->GetCells(ptId), links->GetCells(ptId) + links->GetNcells(ptId));
+  }
+  return result;
+}
+}
+
 int otherUnstructuredGrid(int, char*[])
 {
   int retVal = EXIT_SUCCESS;
@@ -33,5 +57,66 @@ int otherUnstructuredGrid(int, char*[])
     retVal = EXIT_FAILURE;
   }
 
+  // A strip of tetrahedra sharing their points, then a few other cells.
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i < 1000; ++i)
+  {
+    points->InsertNextPoint(i, i % 2, i % 3);
+  }
+  ug->SetPoints(points);
+  ug->Allocate(1000);
+  for (vtkIdType i = 0; i < 997; ++i)
+  {
+    const vtkIdType tetra[4] = { i, i + 1, i + 2, i + 3 };
+    ug->InsertNextCell(VTK_TETRA, 4, tetra);
+  }
+  if (ug->GetNumberOfCellsOfType(VTK_TETRA) != 997 || !ug->IsHomogeneous() ||
+    ug->GetDistinctCellTypesArray()->GetNumberOfValues() != 1)
+  {
+    vtkLog(ERROR, "Wrong cell type counts for a grid of tetrahedra");
+    retVal = EXIT_FAILURE;
+  }
+
+  // The counts follow the insertions.
+  const vtkIdType triangle[3] = { 0, 1, 2 };
+  ug->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  ug->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  const vtkIdType vertex[1] = { 5 };
+  ug->InsertNextCell(VTK_VERTEX, 1, vertex);
+  vtkUnsignedCharArray* types = ug->GetDistinctCellTypesArray();
+  if (ug->GetNumberOfCellsOfType(VTK_TETRA) != 997 ||
+    ug->GetNumberOfCellsOfType(VTK_TRIANGLE) != 2 || ug->GetNumberOfCellsOfType(VTK_VERTEX) != 1 ||
+    ug->GetNumberOfCellsOfType(VTK_POLYHEDRON) != 0 || ug->IsHomogeneous() ||
+    types->GetNumberOfValues() != 3 || types->GetValue(0) != VTK_VERTEX ||
+    types->GetValue(1) != VTK_TRIANGLE || types->GetValue(2) != VTK_TETRA)
+  {
+    vtkLog(ERROR, "The cell type counts are not updated on insertion");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Parallel and serial links are the same.
+  if (GetLinks(ug, false) != GetLinks(ug, true))
+  {
+    vtkLog(ERROR, "vtkCellLinks built in parallel differ from the serial ones");
+    retVal = EXIT_FAILURE;
+  }
+
+  // The counts are recomputed for new cells.
+  vtkNew<vtkCellArray> cells;
+  cells->InsertNextCell(3, triangle);
+  ug->SetCells(VTK_TRIANGLE, cells);
+  if (ug->GetNumberOfCellsOfType(VTK_TETRA) != 0 || ug->GetNumberOfCellsOfType(VTK_TRIANGLE) != 1)
+  {
+    vtkLog(ERROR, "The cell type counts are not updated by SetCells");
+    retVal = EXIT_FAILURE;
+  }
+  ug->Reset();
+  if (ug->GetNumberOfCellsOfType(VTK_TRIANGLE) != 0 ||
+    ug->GetDistinctCellTypesArray()->GetNumberOfValues() != 0)
+  {
+    vtkLog(ERROR, "The cell type counts are not updated by Reset");
+    retVal = EXIT_FAILURE;
+  }
+
   return retVal;
 }
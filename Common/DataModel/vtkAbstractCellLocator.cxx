@@ -3,9 +3,11 @@
 
 #include "vtkAbstractCellLocator.h"
 
+#include "vtkBoundingBox.h"
 #include "vtkCellArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -13,9 +15,54 @@
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Data reused by a thread across the queries of a batch.
+struct BatchedQueryData
+{
+  vtkSmartPointer<vtkGenericCell> Cell;
+  // Last cell found by FindCells(), tried first for the next point.
+  vtkSmartPointer<vtkGenericCell> LastCell;
+  vtkBoundingBox LastBounds;
+  vtkIdType LastCellId = -1;
+  std::vector<double> Weights;
+
+  void Initialize(int maxCellSize)
+  {
+    if (!this->Cell)
+    {
+      this->Cell = vtkSmartPointer<vtkGenericCell>::New();
+      this->LastCell = vtkSmartPointer<vtkGenericCell>::New();
+      this->Weights.resize(static_cast<size_t>(maxCellSize));
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Resize an output array of a batched query and return a pointer to its values.
+template <typename ArrayT>
+typename ArrayT::ValueType* PrepareBatchedOutput(
+  ArrayT* array, int numberOfComponents, vtkIdType numberOfTuples)
+{
+  if (!array)
+  {
+    return nullptr;
+  }
+  array->SetNumberOfComponents(numberOfComponents);
+  array->SetNumberOfTuples(numberOfTuples);
+  return array->GetPointer(0);
+}
+}
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkAbstractCellLocator::vtkAbstractCellLocator()
@@ -258,6 +305,242 @@ vtkIdType vtkAbstractCellLocator::FindCell(
   return returnVal;
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindCells(vtkPoints* points, double tol2, vtkIdTypeArray* cellIds,
+  vtkDoubleArray* pcoords, vtkDoubleArray* weights)
+{
+  if (!points || !cellIds)
+  {
+    vtkErrorMacro("Points and cell ids must be provided.");
+    return;
+  }
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  const int maxCellSize = this->DataSet ? std::max(this->DataSet->GetMaxCellSize(), 1) : 1;
+  vtkIdType* outCellIds = ::PrepareBatchedOutput(cellIds, 1, numPts);
+  double* outPCoords = ::PrepareBatchedOutput(pcoords, 3, numPts);
+  double* outWeights = ::PrepareBatchedOutput(weights, maxCellSize, numPts);
+  if (!this->DataSet || this->DataSet->GetNumberOfCells() < 1)
+  {
+    std::fill_n(outCellIds, numPts, -1);
+    if (outPCoords)
+    {
+      std::fill_n(outPCoords, 3 * numPts, 0.0);
+    }
+    if (outWeights)
+    {
+      std::fill_n(outWeights, maxCellSize * numPts, 0.0);
+    }
+    return;
+  }
+
+  this->BuildLocator();
+  // Initialize the cells of the data set before using it from several threads.
+  vtkNew<vtkGenericCell> cell;
+  this->DataSet->GetCell(0, cell);
+
+  vtkSMPThreadLocal<BatchedQueryData> localData;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    BatchedQueryData& data = localData.Local();
+    data.Initialize(maxCellSize);
+    double x[3], closestPoint[3], pc[3], dist2;
+    int subId;
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      double* ptPCoords = outPCoords ? outPCoords + 3 * ptId : pc;
+      double* ptWeights = outWeights ? outWeights + maxCellSize * ptId : data.Weights.data();
+
+      // Try the last cell found first
+      bool inLastCell = false;
+      if (data.LastCellId >= 0 && data.LastBounds.ContainsPoint(x))
+      {
+        inLastCell = data.LastCell->EvaluatePosition(
+                       x, closestPoint, subId, ptPCoords, dist2, ptWeights) == 1 &&
+          dist2 <= tol2;
+      }
+      vtkIdType cellId = data.LastCellId;
+      if (!inLastCell)
+      {
+        cellId = this->FindCellBatched(x, tol2, data.Cell, subId, ptPCoords, ptWeights);
+        if (cellId >= 0)
+        {
+          std::swap(data.Cell, data.LastCell);
+          data.LastCellId = cellId;
+          data.LastBounds.SetBounds(data.LastCell->GetBounds());
+        }
+      }
+
+      outCellIds[ptId] = cellId;
+      if (cellId >= 0)
+      {
+        std::fill(ptWeights + data.LastCell->GetNumberOfPoints(), ptWeights + maxCellSize, 0.0);
+      }
+      else
+      {
+        std::fill_n(ptPCoords, 3, 0.0);
+        std::fill_n(ptWeights, maxCellSize, 0.0);
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindClosestPoints(vtkPoints* points, vtkIdTypeArray* cellIds,
+  vtkDoubleArray* closestPoints, vtkDoubleArray* dist2)
+{
+  if (!points || !cellIds)
+  {
+    vtkErrorMacro("Points and cell ids must be provided.");
+    return;
+  }
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  vtkIdType* outCellIds = ::PrepareBatchedOutput(cellIds, 1, numPts);
+  double* outClosestPoints = ::PrepareBatchedOutput(closestPoints, 3, numPts);
+  double* outDist2 = ::PrepareBatchedOutput(dist2, 1, numPts);
+  if (!this->DataSet || this->DataSet->GetNumberOfCells() < 1)
+  {
+    std::fill_n(outCellIds, numPts, -1);
+    if (outClosestPoints)
+    {
+      std::fill_n(outClosestPoints, 3 * numPts, 0.0);
+    }
+    if (outDist2)
+    {
+      std::fill_n(outDist2, numPts, VTK_DOUBLE_MAX);
+    }
+    return;
+  }
+
+  this->BuildLocator();
+  // Initialize the cells of the data set before using it from several threads.
+  vtkNew<vtkGenericCell> cell;
+  this->DataSet->GetCell(0, cell);
+
+  vtkSMPThreadLocal<BatchedQueryData> localData;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    BatchedQueryData& data = localData.Local();
+    data.Initialize(1);
+    double x[3], closestPoint[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      double* ptClosestPoint = outClosestPoints ? outClosestPoints + 3 * ptId : closestPoint;
+      vtkIdType cellId = -1;
+      int subId = 0;
+      double ptDist2 = VTK_DOUBLE_MAX;
+      this->FindClosestPointBatched(x, ptClosestPoint, data.Cell, cellId, subId, ptDist2);
+      outCellIds[ptId] = cellId;
+      if (outDist2)
+      {
+        outDist2[ptId] = ptDist2;
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::IntersectWithLines(vtkPoints* p1, vtkPoints* p2, double tol,
+  vtkIdTypeArray* cellIds, vtkDoubleArray* t, vtkDoubleArray* x, vtkDoubleArray* pcoords)
+{
+  if (!p1 || !p2 || !cellIds)
+  {
+    vtkErrorMacro("Line end points and cell ids must be provided.");
+    return;
+  }
+  if (p1->GetNumberOfPoints() != p2->GetNumberOfPoints())
+  {
+    vtkErrorMacro("The line end points differ in number.");
+    return;
+  }
+
+  const vtkIdType numLines = p1->GetNumberOfPoints();
+  vtkIdType* outCellIds = ::PrepareBatchedOutput(cellIds, 1, numLines);
+  double* outT = ::PrepareBatchedOutput(t, 1, numLines);
+  double* outX = ::PrepareBatchedOutput(x, 3, numLines);
+  double* outPCoords = ::PrepareBatchedOutput(pcoords, 3, numLines);
+  if (!this->DataSet || this->DataSet->GetNumberOfCells() < 1)
+  {
+    std::fill_n(outCellIds, numLines, -1);
+    if (outT)
+    {
+      std::fill_n(outT, numLines, 0.0);
+    }
+    if (outX)
+    {
+      std::fill_n(outX, 3 * numLines, 0.0);
+    }
+    if (outPCoords)
+    {
+      std::fill_n(outPCoords, 3 * numLines, 0.0);
+    }
+    return;
+  }
+
+  this->BuildLocator();
+  // Initialize the cells of the data set before using it from several threads.
+  vtkNew<vtkGenericCell> cell;
+  this->DataSet->GetCell(0, cell);
+
+  vtkSMPThreadLocal<BatchedQueryData> localData;
+  vtkSMPTools::For(0, numLines, [&](vtkIdType begin, vtkIdType end) {
+    BatchedQueryData& data = localData.Local();
+    data.Initialize(1);
+    this->IntersectWithLinesBatched(
+      p1, p2, begin, end, tol, outCellIds, outT, outX, outPCoords, data.Cell);
+  });
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkAbstractCellLocator::FindCellBatched(
+  double x[3], double tol2, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  return this->FindCell(x, tol2, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindClosestPointBatched(const double x[3], double closestPoint[3],
+  vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2)
+{
+  this->FindClosestPoint(x, closestPoint, cell, cellId, subId, dist2);
+}
+
+//------------------------------------------------------------------------------
+int vtkAbstractCellLocator::IntersectWithLineBatched(const double p1[3], const double p2[3],
+  double tol, double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+  vtkGenericCell* cell)
+{
+  return this->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell);
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::IntersectWithLinesBatched(vtkPoints* p1, vtkPoints* p2,
+  vtkIdType begin, vtkIdType end, double tol, vtkIdType* cellIds, double* t, double* x,
+  double* pcoords, vtkGenericCell* cell)
+{
+  double a0[3], a1[3], lineT, lineX[3], pc[3];
+  int subId;
+  for (vtkIdType lineId = begin; lineId < end; ++lineId)
+  {
+    p1->GetPoint(lineId, a0);
+    p2->GetPoint(lineId, a1);
+    double* ptX = x ? x + 3 * lineId : lineX;
+    double* ptPCoords = pcoords ? pcoords + 3 * lineId : pc;
+    vtkIdType cellId = -1;
+    if (!this->IntersectWithLineBatched(a0, a1, tol, lineT, ptX, ptPCoords, subId, cellId, cell))
+    {
+      cellId = -1;
+      lineT = 0.0;
+      std::fill_n(ptX, 3, 0.0);
+      std::fill_n(ptPCoords, 3, 0.0);
+    }
+    cellIds[lineId] = cellId;
+    if (t)
+    {
+      t[lineId] = lineT;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkAbstractCellLocator::InsideCellBounds(double x[3], vtkIdType cell_ID)
 {
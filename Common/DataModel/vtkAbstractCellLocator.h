@@ -20,6 +20,7 @@
  *
  * @sa
  * vtkLocator vtkCellLocator vtkStaticCellLocator vtkCellTreeLocator vtkModifiedBSPTree vtkOBBTree
+ * vtkBVHCellLocator
  */
 
 #ifndef vtkAbstractCellLocator_h
@@ -34,8 +35,10 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
+class vtkDoubleArray;
 class vtkGenericCell;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractCellLocator : public vtkLocator
@@ -287,6 +290,43 @@ public:
     double pcoords[3], double* weights);
   ///@}
 
+  ///@{
+  /**
+   * Batched versions of FindCell(), FindClosestPoint() and IntersectWithLine().
+   * The queries are run in parallel with vtkSMPTools and their results are
+   * stored in one array per quantity, indexed like the queries. Output arrays
+   * are resized as needed and the ones passed as nullptr are not filled. The
+   * locator is built once before the queries are run, and each thread reuses
+   * its own vtkGenericCell and weights, so these methods avoid the setup cost
+   * that the single queries pay on every call.
+   *
+   * FindCells() stores the id of the cell containing each point (or -1) in
+   * cellIds, the parametric coordinates of the point in this cell in pcoords
+   * (3 components) and its interpolation weights in weights. weights has as
+   * many components as the largest cell of the data set, the components past
+   * the number of points of the cell found being set to 0. Each thread first
+   * evaluates the last cell it found, so spatially coherent queries are faster.
+   *
+   * FindClosestPoints() stores the id of the cell closest to each point in
+   * cellIds, the closest point on this cell in closestPoints (3 components)
+   * and the squared distance to it in dist2.
+   *
+   * IntersectWithLines() intersects each line segment (p1[i], p2[i]) with the
+   * data set and stores the id of the intersected cell (or -1) in cellIds, the
+   * parametric coordinate of the intersection along the line in t, the
+   * intersection point in x (3 components) and its parametric coordinates in
+   * the cell in pcoords.
+   *
+   * THESE FUNCTIONS ARE THREAD SAFE.
+   */
+  void FindCells(vtkPoints* points, double tol2, vtkIdTypeArray* cellIds,
+    vtkDoubleArray* pcoords = nullptr, vtkDoubleArray* weights = nullptr);
+  void FindClosestPoints(vtkPoints* points, vtkIdTypeArray* cellIds,
+    vtkDoubleArray* closestPoints = nullptr, vtkDoubleArray* dist2 = nullptr);
+  void IntersectWithLines(vtkPoints* p1, vtkPoints* p2, double tol, vtkIdTypeArray* cellIds,
+    vtkDoubleArray* t = nullptr, vtkDoubleArray* x = nullptr, vtkDoubleArray* pcoords = nullptr);
+  ///@}
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * Some locators cache cell bounds and this function can make use
@@ -317,6 +357,37 @@ protected:
   virtual void FreeCellBounds();
   ///@}
 
+  ///@{
+  /**
+   * Single queries run by the batched queries (FindCells(), FindClosestPoints()
+   * and IntersectWithLines()) once the locator is built. The default
+   * implementations call FindCell(), FindClosestPoint() and
+   * IntersectWithLine(). Subclasses override them to query their search
+   * structure directly, without the checks done by the single queries.
+   * These methods must be thread safe.
+   */
+  virtual vtkIdType FindCellBatched(double x[3], double tol2, vtkGenericCell* cell, int& subId,
+    double pcoords[3], double* weights);
+  virtual void FindClosestPointBatched(const double x[3], double closestPoint[3],
+    vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2);
+  virtual int IntersectWithLineBatched(const double p1[3], const double p2[3], double tol,
+    double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+    vtkGenericCell* cell);
+  ///@}
+
+  /**
+   * Intersect the lines [begin, end) of IntersectWithLines() once the locator
+   * is built, storing the results at the index of each line in the output
+   * pointers. The pointers passed as nullptr are not filled. Lines that do not
+   * intersect the data set get a cell id of -1 and null values. The default
+   * implementation calls IntersectWithLineBatched() for each line, subclasses
+   * override it to intersect several lines at once. This method must be
+   * thread safe.
+   */
+  virtual void IntersectWithLinesBatched(vtkPoints* p1, vtkPoints* p2, vtkIdType begin,
+    vtkIdType end, double tol, vtkIdType* cellIds, double* t, double* x, double* pcoords,
+    vtkGenericCell* cell);
+
   /**
    * To be called in `FindCell(double[3])`. If need be, the internal `Weights` array size is
    * updated to be able to host all points of the largest cell of the input data set.
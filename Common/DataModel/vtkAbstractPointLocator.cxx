@@ -3,7 +3,132 @@
 #include "vtkAbstractPointLocator.h"
 
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkPoints.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Run the queries of a batch. The queries are processed by chunks of
+// consecutive entries of order. Each chunk gathers the neighbors of its
+// queries, which are copied in the output arrays once the number of
+// neighbors of every query is known.
+template <typename QueryT>
+void RunBatchedQuery(vtkDataSet* dataSet, vtkPoints* queries, const vtkIdType* order,
+  const QueryT& query, vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  struct Chunk
+  {
+    std::vector<vtkIdType> Ids;
+    std::vector<double> Dist2;
+  };
+  const vtkIdType chunkSize = 1024;
+  const vtkIdType numQueries = queries->GetNumberOfPoints();
+  const vtkIdType numChunks = (numQueries + chunkSize - 1) / chunkSize;
+  std::vector<Chunk> chunks(static_cast<size_t>(numChunks));
+
+  offsets->SetNumberOfComponents(1);
+  offsets->SetNumberOfValues(numQueries + 1);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  offsetsPtr[0] = 0;
+
+  vtkSMPThreadLocalObject<vtkIdList> localResult;
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+    vtkIdList* result = localResult.Local();
+    double x[3], y[3];
+    for (vtkIdType chunkId = beginChunk; chunkId < endChunk; ++chunkId)
+    {
+      Chunk& chunk = chunks[chunkId];
+      const vtkIdType end = std::min((chunkId + 1) * chunkSize, numQueries);
+      for (vtkIdType i = chunkId * chunkSize; i < end; ++i)
+      {
+        const vtkIdType queryId = order[i];
+        queries->GetPoint(queryId, x);
+        query(x, result);
+        const vtkIdType numIds = result->GetNumberOfIds();
+        const vtkIdType* resultIds = result->GetPointer(0);
+        // Store the count, offsets are computed once all counts are known
+        offsetsPtr[queryId + 1] = numIds;
+        chunk.Ids.insert(chunk.Ids.end(), resultIds, resultIds + numIds);
+        if (dist2)
+        {
+          for (vtkIdType j = 0; j < numIds; ++j)
+          {
+            dataSet->GetPoint(resultIds[j], y);
+            chunk.Dist2.push_back(vtkMath::Distance2BetweenPoints(x, y));
+          }
+        }
+      }
+    }
+  });
+
+  std::partial_sum(offsetsPtr, offsetsPtr + numQueries + 1, offsetsPtr);
+  ids->SetNumberOfComponents(1);
+  ids->SetNumberOfValues(offsetsPtr[numQueries]);
+  vtkIdType* idsPtr = ids->GetPointer(0);
+  double* dist2Ptr = nullptr;
+  if (dist2)
+  {
+    dist2->SetNumberOfComponents(1);
+    dist2->SetNumberOfValues(offsetsPtr[numQueries]);
+    dist2Ptr = dist2->GetPointer(0);
+  }
+
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+    for (vtkIdType chunkId = beginChunk; chunkId < endChunk; ++chunkId)
+    {
+      Chunk& chunk = chunks[chunkId];
+      const vtkIdType end = std::min((chunkId + 1) * chunkSize, numQueries);
+      size_t position = 0;
+      for (vtkIdType i = chunkId * chunkSize; i < end; ++i)
+      {
+        const vtkIdType queryId = order[i];
+        const vtkIdType numIds = offsetsPtr[queryId + 1] - offsetsPtr[queryId];
+        std::copy_n(chunk.Ids.begin() + position, numIds, idsPtr + offsetsPtr[queryId]);
+        if (dist2Ptr)
+        {
+          std::copy_n(chunk.Dist2.begin() + position, numIds, dist2Ptr + offsetsPtr[queryId]);
+        }
+        position += static_cast<size_t>(numIds);
+      }
+      // Release the memory of the chunk as soon as possible
+      std::vector<vtkIdType>().swap(chunk.Ids);
+      std::vector<double>().swap(chunk.Dist2);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+struct ClosestNPointsQuery
+{
+  vtkAbstractPointLocator* Locator;
+  int N;
+  void operator()(const double x[3], vtkIdList* result) const
+  {
+    this->Locator->FindClosestNPoints(this->N, x, result);
+  }
+};
+
+//------------------------------------------------------------------------------
+struct PointsWithinRadiusQuery
+{
+  vtkAbstractPointLocator* Locator;
+  double R;
+  void operator()(const double x[3], vtkIdList* result) const
+  {
+    this->Locator->FindPointsWithinRadius(this->R, x, result);
+  }
+};
+}
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -53,6 +178,44 @@ void vtkAbstractPointLocator::FindPointsWithinRadius(
   this->FindPointsWithinRadius(R, p, result);
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindClosestNPoints(int N, vtkPoints* queries,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!queries || !offsets || !ids)
+  {
+    vtkErrorMacro("Queries, offsets and ids must be provided.");
+    return;
+  }
+  this->BuildLocator();
+  std::vector<vtkIdType> order(static_cast<size_t>(queries->GetNumberOfPoints()));
+  this->ComputeQueryOrder(queries, order.data());
+  ClosestNPointsQuery query{ this, N };
+  ::RunBatchedQuery(this->DataSet, queries, order.data(), query, offsets, ids, dist2);
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindPointsWithinRadius(double R, vtkPoints* queries,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!queries || !offsets || !ids)
+  {
+    vtkErrorMacro("Queries, offsets and ids must be provided.");
+    return;
+  }
+  this->BuildLocator();
+  std::vector<vtkIdType> order(static_cast<size_t>(queries->GetNumberOfPoints()));
+  this->ComputeQueryOrder(queries, order.data());
+  PointsWithinRadiusQuery query{ this, R };
+  ::RunBatchedQuery(this->DataSet, queries, order.data(), query, offsets, ids, dist2);
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractPointLocator::ComputeQueryOrder(vtkPoints* queries, vtkIdType* order)
+{
+  std::iota(order, order + queries->GetNumberOfPoints(), 0);
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractPointLocator::GetBounds(double* bnds)
 {
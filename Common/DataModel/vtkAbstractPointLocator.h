@@ -22,7 +22,10 @@
 #include "vtkLocator.h"
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkDoubleArray;
 class vtkIdList;
+class vtkIdTypeArray;
+class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractPointLocator : public vtkLocator
 {
@@ -78,6 +81,25 @@ public:
   void FindPointsWithinRadius(double R, double x, double y, double z, vtkIdList* result);
   ///@}
 
+  ///@{
+  /**
+   * Batched versions of FindClosestNPoints() and FindPointsWithinRadius(),
+   * finding the neighbors of all the points of queries in parallel with
+   * vtkSMPTools. The neighbors are returned as compressed sparse rows: the
+   * neighbors of query i are ids[offsets[i]] to ids[offsets[i + 1] - 1],
+   * ordered as by the single query, and dist2 (if not nullptr) holds their
+   * squared distances to query i. offsets has one more value than there are
+   * queries. The queries are processed in the order given by
+   * ComputeQueryOrder(), so that close queries visit the search structure
+   * one after the other. These methods are thread safe if BuildLocator() is
+   * directly or indirectly called from a single thread first.
+   */
+  void FindClosestNPoints(int N, vtkPoints* queries, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  void FindPointsWithinRadius(double R, vtkPoints* queries, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  ///@}
+
   ///@{
   /**
    * Provide an accessor to the bounds. Valid after the locator is built.
@@ -98,6 +120,14 @@ protected:
   vtkAbstractPointLocator();
   ~vtkAbstractPointLocator() override;
 
+  /**
+   * Fill order with the indices of the queries, in the order in which the
+   * batched queries process them. The default implementation keeps the order
+   * of the queries. Subclasses reorder them so that queries close to each
+   * other are processed one after the other.
+   */
+  virtual void ComputeQueryOrder(vtkPoints* queries, vtkIdType* order);
+
   double Bounds[6];          // bounds of points
   vtkIdType NumberOfBuckets; // total size of locator
 
@@ -0,0 +1,1336 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBVHCellLocator.h"
+
+#include "vtkCellArray.h"
+#include "vtkDataSet.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBVHCellLocator);
+VTK_ABI_NAMESPACE_END
+
+namespace
+{
+VTK_ABI_NAMESPACE_BEGIN
+// Number of lines traversing the tree together in IntersectWithLinesBatched().
+constexpr int PacketSize = 8;
+
+//------------------------------------------------------------------------------
+// Conversions of bounds to single precision, rounded outwards so that the
+// boxes of the tree contain the cells.
+float RoundDown(double value)
+{
+  float result = static_cast<float>(value);
+  return result > value ? std::nextafter(result, -std::numeric_limits<float>::max()) : result;
+}
+
+float RoundUp(double value)
+{
+  float result = static_cast<float>(value);
+  return result < value ? std::nextafter(result, std::numeric_limits<float>::max()) : result;
+}
+
+//------------------------------------------------------------------------------
+// An axis aligned box in single precision, used to build the tree.
+struct Box
+{
+  float Min[3];
+  float Max[3];
+
+  Box() { this->Reset(); }
+
+  void Reset()
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      this->Min[i] = std::numeric_limits<float>::max();
+      this->Max[i] = -std::numeric_limits<float>::max();
+    }
+  }
+
+  bool IsEmpty() const { return this->Min[0] > this->Max[0]; }
+
+  void Add(const float min[3], const float max[3])
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      this->Min[i] = std::min(this->Min[i], min[i]);
+      this->Max[i] = std::max(this->Max[i], max[i]);
+    }
+  }
+
+  void Add(const Box& other) { this->Add(other.Min, other.Max); }
+
+  // Half of the surface area, the factor does not matter for the heuristic.
+  float HalfArea() const
+  {
+    if (this->IsEmpty())
+    {
+      return 0.0f;
+    }
+    const float dx = this->Max[0] - this->Min[0];
+    const float dy = this->Max[1] - this->Min[1];
+    const float dz = this->Max[2] - this->Min[2];
+    return dx * dy + dy * dz + dz * dx;
+  }
+};
+
+//------------------------------------------------------------------------------
+// A node of the tree. The children of a node are stored next to each other,
+// at Offset and Offset + 1 in the nodes of the tree. A leaf has a non-zero
+// Count: its cells are the Count ones starting at Offset in the cell ids of
+// the tree.
+struct Node
+{
+  float Min[3];
+  float Max[3];
+  vtkTypeUInt32 Offset;
+  vtkTypeUInt32 Count;
+
+  bool IsLeaf() const { return this->Count > 0; }
+};
+static_assert(sizeof(Node) == 32, "The nodes of vtkBVHCellLocator should be 32 bytes.");
+
+//------------------------------------------------------------------------------
+// Cells binned by the position of their centroid along one axis.
+struct Bin
+{
+  Box Bounds;
+  Box Centroids;
+  vtkIdType Count = 0;
+
+  void Add(const Bin& other)
+  {
+    this->Bounds.Add(other.Bounds);
+    this->Centroids.Add(other.Centroids);
+    this->Count += other.Count;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Cells [Begin, End) of the cell ids, to store in the node NodeId.
+struct Range
+{
+  vtkTypeUInt32 NodeId;
+  vtkIdType Begin;
+  vtkIdType End;
+  Box Bounds;
+  Box Centroids;
+  int Level;
+
+  vtkIdType Size() const { return this->End - this->Begin; }
+};
+
+//------------------------------------------------------------------------------
+// Build a tree with the surface area heuristic. Boxes holds the bounds of the
+// cells in single precision, (xmin, ymin, zmin, xmax, ymax, zmax) per cell.
+class TreeBuilder
+{
+public:
+  TreeBuilder(const std::vector<float>& boxes, std::vector<vtkTypeUInt32>& cellIds,
+    int numberOfBins, vtkIdType leafSize)
+    : Boxes(boxes)
+    , CellIds(cellIds)
+    , NumberOfBins(numberOfBins)
+    , LeafSize(leafSize)
+  {
+  }
+
+  void Build(const Range& root, std::vector<Node>& nodes, int& depth);
+
+private:
+  int GetBin(const Range& range, const float scale[3], vtkTypeUInt32 cellId, int axis) const
+  {
+    const float* box = &this->Boxes[6 * static_cast<size_t>(cellId)];
+    const float centroid = 0.5f * (box[axis] + box[axis + 3]);
+    const int bin = static_cast<int>((centroid - range.Centroids.Min[axis]) * scale[axis]);
+    return std::min(std::max(bin, 0), this->NumberOfBins - 1);
+  }
+
+  void GetScales(const Range& range, float scale[3]) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const float extent = range.Centroids.Max[axis] - range.Centroids.Min[axis];
+      scale[axis] = extent > 0.0f ? this->NumberOfBins / extent : 0.0f;
+    }
+  }
+
+  void BinCells(const Range& range, vtkIdType begin, vtkIdType end, std::vector<Bin>& bins) const;
+  void BinCellsInParallel(const Range& range, std::vector<Bin>& bins) const;
+  void Split(const Range& range, const std::vector<Bin>& bins, Range& left, Range& right);
+  void BuildSubtree(const Range& subtree, std::vector<Node>& nodes, int& depth);
+
+  static void AddChildren(std::vector<Node>& nodes, Range& parent, Range& left, Range& right);
+
+  const std::vector<float>& Boxes;
+  std::vector<vtkTypeUInt32>& CellIds;
+  int NumberOfBins;
+  vtkIdType LeafSize;
+};
+
+//------------------------------------------------------------------------------
+void TreeBuilder::BinCells(
+  const Range& range, vtkIdType begin, vtkIdType end, std::vector<Bin>& bins) const
+{
+  float scale[3];
+  this->GetScales(range, scale);
+  for (vtkIdType i = begin; i < end; ++i)
+  {
+    const vtkTypeUInt32 cellId = this->CellIds[i];
+    const float* box = &this->Boxes[6 * static_cast<size_t>(cellId)];
+    float centroid[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      centroid[axis] = 0.5f * (box[axis] + box[axis + 3]);
+    }
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      Bin& bin = bins[axis * this->NumberOfBins + this->GetBin(range, scale, cellId, axis)];
+      bin.Bounds.Add(box, box + 3);
+      bin.Centroids.Add(centroid, centroid);
+      ++bin.Count;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Bins only hold minima, maxima and counts: merging the bins of the threads
+// gives the same bins as the serial binning.
+void TreeBuilder::BinCellsInParallel(const Range& range, std::vector<Bin>& bins) const
+{
+  vtkSMPThreadLocal<std::vector<Bin>> localBins(std::vector<Bin>(bins.size()));
+  vtkSMPTools::For(range.Begin, range.End,
+    [&](vtkIdType begin, vtkIdType end) { this->BinCells(range, begin, end, localBins.Local()); });
+  for (const std::vector<Bin>& threadBins : localBins)
+  {
+    for (size_t i = 0; i < bins.size(); ++i)
+    {
+      bins[i].Add(threadBins[i]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void TreeBuilder::Split(const Range& range, const std::vector<Bin>& bins, Range& left, Range& right)
+{
+  const int numberOfBins = this->NumberOfBins;
+
+  // Evaluate the surface area heuristic between each pair of consecutive bins.
+  float bestCost = std::numeric_limits<float>::max();
+  int bestAxis = -1;
+  int bestSplit = -1;
+  std::vector<float> rightCosts(numberOfBins);
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    if (range.Centroids.Max[axis] <= range.Centroids.Min[axis])
+    {
+      continue;
+    }
+    const Bin* axisBins = &bins[axis * numberOfBins];
+    Box box;
+    vtkIdType count = 0;
+    for (int i = numberOfBins - 1; i > 0; --i)
+    {
+      box.Add(axisBins[i].Bounds);
+      count += axisBins[i].Count;
+      rightCosts[i - 1] = box.HalfArea() * count;
+    }
+    box.Reset();
+    count = 0;
+    for (int i = 0; i < numberOfBins - 1; ++i)
+    {
+      box.Add(axisBins[i].Bounds);
+      count += axisBins[i].Count;
+      const float cost = box.HalfArea() * count + rightCosts[i];
+      if (count > 0 && count < range.Size() && cost < bestCost)
+      {
+        bestCost = cost;
+        bestAxis = axis;
+        bestSplit = i;
+      }
+    }
+  }
+
+  vtkIdType middle;
+  left.Bounds.Reset();
+  left.Centroids.Reset();
+  right.Bounds.Reset();
+  right.Centroids.Reset();
+  if (bestAxis >= 0)
+  {
+    float scale[3];
+    this->GetScales(range, scale);
+    auto first = this->CellIds.begin() + range.Begin;
+    auto last = this->CellIds.begin() + range.End;
+    middle = range.Begin +
+      (std::partition(first, last,
+         [&](vtkTypeUInt32 cellId) {
+           return this->GetBin(range, scale, cellId, bestAxis) <= bestSplit;
+         }) -
+        first);
+    const Bin* axisBins = &bins[bestAxis * numberOfBins];
+    for (int i = 0; i < numberOfBins; ++i)
+    {
+      Range& child = i <= bestSplit ? left : right;
+      child.Bounds.Add(axisBins[i].Bounds);
+      child.Centroids.Add(axisBins[i].Centroids);
+    }
+  }
+  else
+  {
+    // All the centroids are at the same position, split the cells in halves.
+    middle = range.Begin + range.Size() / 2;
+    for (vtkIdType i = range.Begin; i < range.End; ++i)
+    {
+      const float* box = &this->Boxes[6 * static_cast<size_t>(this->CellIds[i])];
+      Range& child = i < middle ? left : right;
+      child.Bounds.Add(box, box + 3);
+    }
+    left.Centroids = range.Centroids;
+    right.Centroids = range.Centroids;
+  }
+
+  left.Begin = range.Begin;
+  left.End = middle;
+  left.Level = range.Level + 1;
+  right.Begin = middle;
+  right.End = range.End;
+  right.Level = range.Level + 1;
+}
+
+//------------------------------------------------------------------------------
+void TreeBuilder::AddChildren(std::vector<Node>& nodes, Range& parent, Range& left, Range& right)
+{
+  const vtkTypeUInt32 offset = static_cast<vtkTypeUInt32>(nodes.size());
+  nodes[parent.NodeId].Offset = offset;
+  nodes[parent.NodeId].Count = 0;
+  left.NodeId = offset;
+  right.NodeId = offset + 1;
+  for (Range* child : { &left, &right })
+  {
+    Node node;
+    std::copy_n(child->Bounds.Min, 3, node.Min);
+    std::copy_n(child->Bounds.Max, 3, node.Max);
+    // A leaf until its cells are split.
+    node.Offset = static_cast<vtkTypeUInt32>(child->Begin);
+    node.Count = static_cast<vtkTypeUInt32>(child->Size());
+    nodes.push_back(node);
+  }
+}
+
+//------------------------------------------------------------------------------
+void TreeBuilder::BuildSubtree(const Range& subtree, std::vector<Node>& nodes, int& depth)
+{
+  Node root;
+  std::copy_n(subtree.Bounds.Min, 3, root.Min);
+  std::copy_n(subtree.Bounds.Max, 3, root.Max);
+  root.Offset = static_cast<vtkTypeUInt32>(subtree.Begin);
+  root.Count = static_cast<vtkTypeUInt32>(subtree.Size());
+  nodes.assign(1, root);
+  depth = subtree.Level;
+
+  std::vector<Range> stack(1, subtree);
+  stack.back().NodeId = 0;
+  std::vector<Bin> bins(3 * this->NumberOfBins);
+  while (!stack.empty())
+  {
+    Range range = stack.back();
+    stack.pop_back();
+    depth = std::max(depth, range.Level);
+    if (range.Size() <= this->LeafSize)
+    {
+      continue;
+    }
+    std::fill(bins.begin(), bins.end(), Bin());
+    this->BinCells(range, range.Begin, range.End, bins);
+    Range left, right;
+    this->Split(range, bins, left, right);
+    TreeBuilder::AddChildren(nodes, range, left, right);
+    stack.push_back(right);
+    stack.push_back(left);
+  }
+}
+
+//------------------------------------------------------------------------------
+// The top of the tree is built one node after the other, binning the cells of
+// each node in parallel. The subtrees below are built concurrently, each in
+// its own array of nodes, then appended to the nodes of the tree.
+void TreeBuilder::Build(const Range& root, std::vector<Node>& nodes, int& depth)
+{
+  const vtkIdType numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  const vtkIdType parallelSize = std::max<vtkIdType>(root.Size() / (8 * numberOfThreads), 16384);
+
+  Node rootNode;
+  std::copy_n(root.Bounds.Min, 3, rootNode.Min);
+  std::copy_n(root.Bounds.Max, 3, rootNode.Max);
+  rootNode.Offset = static_cast<vtkTypeUInt32>(root.Begin);
+  rootNode.Count = static_cast<vtkTypeUInt32>(root.Size());
+  nodes.assign(1, rootNode);
+  depth = 0;
+
+  std::vector<Range> stack(1, root);
+  stack.back().NodeId = 0;
+  std::vector<Range> subtrees;
+  std::vector<Bin> bins(3 * this->NumberOfBins);
+  while (!stack.empty())
+  {
+    Range range = stack.back();
+    stack.pop_back();
+    if (range.Size() <= parallelSize || range.Size() <= this->LeafSize)
+    {
+      subtrees.push_back(range);
+      continue;
+    }
+    std::fill(bins.begin(), bins.end(), Bin());
+    this->BinCellsInParallel(range, bins);
+    Range left, right;
+    this->Split(range, bins, left, right);
+    TreeBuilder::AddChildren(nodes, range, left, right);
+    stack.push_back(right);
+    stack.push_back(left);
+  }
+
+  std::vector<std::vector<Node>> subtreeNodes(subtrees.size());
+  std::vector<int> subtreeDepths(subtrees.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      this->BuildSubtree(subtrees[i], subtreeNodes[i], subtreeDepths[i]);
+    }
+  });
+
+  for (size_t i = 0; i < subtrees.size(); ++i)
+  {
+    // The root of the subtree replaces its node, the other nodes are appended.
+    const vtkTypeUInt32 offset = static_cast<vtkTypeUInt32>(nodes.size() - 1);
+    for (size_t j = 0; j < subtreeNodes[i].size(); ++j)
+    {
+      Node node = subtreeNodes[i][j];
+      if (!node.IsLeaf())
+      {
+        node.Offset += offset;
+      }
+      if (j == 0)
+      {
+        nodes[subtrees[i].NodeId] = node;
+      }
+      else
+      {
+        nodes.push_back(node);
+      }
+    }
+    depth = std::max(depth, subtreeDepths[i]);
+    std::vector<Node>().swap(subtreeNodes[i]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// A stack for the traversal of the tree, on the stack of the thread for the
+// usual depths.
+template <typename T>
+class TraversalStack
+{
+public:
+  TraversalStack(int depth)
+  {
+    // A traversal pushing both children of the nodes it visits holds at most
+    // depth + 1 entries.
+    if (depth + 2 > InlineSize)
+    {
+      this->Heap.resize(depth + 2);
+      this->Data = this->Heap.data();
+    }
+  }
+
+  bool Empty() const { return this->Size == 0; }
+  void Push(const T& value) { this->Data[this->Size++] = value; }
+  T Pop() { return this->Data[--this->Size]; }
+
+private:
+  enum
+  {
+    InlineSize = 64
+  };
+  T Inline[InlineSize];
+  std::vector<T> Heap;
+  T* Data = Inline;
+  int Size = 0;
+};
+
+//------------------------------------------------------------------------------
+void GetNodeBox(const Node& node, double tol, double lo[3], double hi[3])
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    lo[i] = node.Min[i] - tol;
+    hi[i] = node.Max[i] + tol;
+  }
+}
+
+void GetCellBox(const double bounds[6], double tol, double lo[3], double hi[3])
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    lo[i] = bounds[2 * i] - tol;
+    hi[i] = bounds[2 * i + 1] + tol;
+  }
+}
+
+double Distance2ToBox(const double x[3], const double lo[3], const double hi[3])
+{
+  double dist2 = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    const double d = x[i] < lo[i] ? lo[i] - x[i] : (x[i] > hi[i] ? x[i] - hi[i] : 0.0);
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+bool Overlap(const double lo[3], const double hi[3], const double bbox[6])
+{
+  return lo[0] <= bbox[1] && bbox[0] <= hi[0] && lo[1] <= bbox[3] && bbox[2] <= hi[1] &&
+    lo[2] <= bbox[5] && bbox[4] <= hi[2];
+}
+
+//------------------------------------------------------------------------------
+// A line segment p1 + t (p2 - p1), t in [0, 1], and its closest intersection.
+struct LineQuery
+{
+  double P1[3];
+  double P2[3];
+  vtkIdType CellId;
+  double T;
+  double X[3];
+  double PCoords[3];
+  int SubId;
+};
+
+//------------------------------------------------------------------------------
+// Width lines in structure of arrays layout, so that the loops over the lines
+// are vectorized. Lines past the number of lines of the packet never hit.
+template <int Width>
+struct Packet
+{
+  double Origin[3][Width];
+  double Direction[3][Width];
+  double InvDirection[3][Width];
+  // Whether the line is parallel to the slabs of an axis.
+  bool Parallel[3][Width];
+  // Hits further than TLimit are rejected: 1, or the closest hit found.
+  double TLimit[Width];
+
+  Packet(const LineQuery* lines, int numberOfLines)
+  {
+    for (int lane = 0; lane < Width; ++lane)
+    {
+      const bool valid = lane < numberOfLines;
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const double origin = valid ? lines[lane].P1[axis] : 0.0;
+        const double direction = valid ? lines[lane].P2[axis] - origin : 0.0;
+        this->Origin[axis][lane] = origin;
+        this->Direction[axis][lane] = direction;
+        this->Parallel[axis][lane] = direction == 0.0;
+        this->InvDirection[axis][lane] = direction == 0.0 ? 0.0 : 1.0 / direction;
+      }
+      this->TLimit[lane] = valid ? 1.0 : -1.0;
+    }
+  }
+
+  // Intersect the lines of mask with the box [lo, hi]. Return the lines hitting
+  // the box before their limit and the smallest parameter where they enter it.
+  unsigned int Intersect(
+    const double lo[3], const double hi[3], unsigned int mask, double& tEnter) const
+  {
+    double t0[Width], t1[Width];
+    for (int lane = 0; lane < Width; ++lane)
+    {
+      t0[lane] = 0.0;
+      t1[lane] = this->TLimit[lane];
+    }
+    const double inf = std::numeric_limits<double>::infinity();
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      for (int lane = 0; lane < Width; ++lane)
+      {
+        const double origin = this->Origin[axis][lane];
+        const double a = (lo[axis] - origin) * this->InvDirection[axis][lane];
+        const double b = (hi[axis] - origin) * this->InvDirection[axis][lane];
+        const bool inside = lo[axis] <= origin && origin <= hi[axis];
+        const bool parallel = this->Parallel[axis][lane];
+        const double tNear = parallel ? (inside ? -inf : inf) : (a < b ? a : b);
+        const double tFar = parallel ? inf : (a < b ? b : a);
+        t0[lane] = tNear > t0[lane] ? tNear : t0[lane];
+        t1[lane] = tFar < t1[lane] ? tFar : t1[lane];
+      }
+    }
+    unsigned int hits = 0;
+    tEnter = inf;
+    for (int lane = 0; lane < Width; ++lane)
+    {
+      if (((mask >> lane) & 1u) && t0[lane] <= t1[lane])
+      {
+        hits |= 1u << lane;
+        tEnter = std::min(tEnter, t0[lane]);
+      }
+    }
+    return hits;
+  }
+
+  // Position of the center of a node along the first line of mask.
+  double Project(const Node& node, unsigned int mask) const
+  {
+    int lane = 0;
+    while (!((mask >> lane) & 1u))
+    {
+      ++lane;
+    }
+    double projection = 0.0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      projection += (0.5 * (node.Min[axis] + node.Max[axis]) - this->Origin[axis][lane]) *
+        this->Direction[axis][lane];
+    }
+    return projection;
+  }
+};
+VTK_ABI_NAMESPACE_END
+} // anonymous namespace
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+struct vtkBVHCellLocator::vtkBVHTree
+{
+  std::vector<Node> Nodes;
+  std::vector<vtkTypeUInt32> CellIds;
+  int Depth = 0;
+
+  template <int Width>
+  void IntersectLines(vtkBVHCellLocator* self, LineQuery* lines, int numberOfLines, double tol,
+    vtkGenericCell* cell) const;
+  int IntersectWithLine(vtkBVHCellLocator* self, const double p1[3], const double p2[3],
+    double tol, vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell) const;
+  vtkIdType FindCell(vtkBVHCellLocator* self, const double x[3], vtkGenericCell* cell,
+    int& subId, double pcoords[3], double* weights) const;
+  vtkIdType FindClosestPointWithinRadius(vtkBVHCellLocator* self, const double x[3],
+    double radius, double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId,
+    double& dist2, int& inside) const;
+  void FindCellsWithinBounds(vtkBVHCellLocator* self, const double bbox[6], vtkIdList* cells) const;
+  void GenerateRepresentation(int level, vtkPolyData* pd) const;
+};
+
+//------------------------------------------------------------------------------
+// The nodes hit by any line of the packet are visited, closest first along the
+// first line. The cells of a leaf are loaded once for all the lines hitting
+// their bounds. On equal parameters, the hit with the smallest cell id is
+// kept, so that the result does not depend on the lines of the packet.
+template <int Width>
+void vtkBVHCellLocator::vtkBVHTree::IntersectLines(vtkBVHCellLocator* self, LineQuery* lines,
+  int numberOfLines, double tol, vtkGenericCell* cell) const
+{
+  Packet<Width> packet(lines, numberOfLines);
+  for (int lane = 0; lane < numberOfLines; ++lane)
+  {
+    lines[lane].CellId = -1;
+  }
+
+  struct Entry
+  {
+    vtkTypeUInt32 NodeId;
+    unsigned int Mask;
+  };
+  TraversalStack<Entry> stack(this->Depth);
+  stack.Push(Entry{ 0, (1u << numberOfLines) - 1 });
+
+  double lo[3], hi[3], tEnter, cellBounds[6], *cellBoundsPtr = cellBounds;
+  double t, x[3], pcoords[3];
+  int subId;
+  while (!stack.Empty())
+  {
+    const Entry entry = stack.Pop();
+    const Node& node = this->Nodes[entry.NodeId];
+    GetNodeBox(node, tol, lo, hi);
+    const unsigned int mask = packet.Intersect(lo, hi, entry.Mask, tEnter);
+    if (!mask)
+    {
+      continue;
+    }
+
+    if (!node.IsLeaf())
+    {
+      const Node& left = this->Nodes[node.Offset];
+      const Node& right = this->Nodes[node.Offset + 1];
+      const bool leftFirst = packet.Project(left, mask) <= packet.Project(right, mask);
+      stack.Push(Entry{ leftFirst ? node.Offset + 1 : node.Offset, mask });
+      stack.Push(Entry{ leftFirst ? node.Offset : node.Offset + 1, mask });
+      continue;
+    }
+
+    for (vtkTypeUInt32 i = 0; i < node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[node.Offset + i];
+      self->GetCellBounds(cellId, cellBoundsPtr);
+      GetCellBox(cellBoundsPtr, tol, lo, hi);
+      const unsigned int cellMask = packet.Intersect(lo, hi, mask, tEnter);
+      if (!cellMask)
+      {
+        continue;
+      }
+      self->DataSet->GetCell(cellId, cell);
+      for (int lane = 0; lane < numberOfLines; ++lane)
+      {
+        LineQuery& line = lines[lane];
+        if (((cellMask >> lane) & 1u) &&
+          cell->IntersectWithLine(line.P1, line.P2, tol, t, x, pcoords, subId) &&
+          (line.CellId < 0 || t < line.T || (t == line.T && cellId < line.CellId)))
+        {
+          line.CellId = cellId;
+          line.T = t;
+          std::copy_n(x, 3, line.X);
+          std::copy_n(pcoords, 3, line.PCoords);
+          line.SubId = subId;
+          packet.TLimit[lane] = std::min(t, 1.0);
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::vtkBVHTree::IntersectWithLine(vtkBVHCellLocator* self, const double p1[3],
+  const double p2[3], double tol, vtkPoints* points, vtkIdList* cellIds,
+  vtkGenericCell* cell) const
+{
+  if (points)
+  {
+    points->Reset();
+  }
+  if (cellIds)
+  {
+    cellIds->Reset();
+  }
+
+  struct Intersection
+  {
+    vtkIdType CellId;
+    double T;
+    double X[3];
+  };
+  std::vector<Intersection> intersections;
+
+  LineQuery line;
+  std::copy_n(p1, 3, line.P1);
+  std::copy_n(p2, 3, line.P2);
+  const Packet<1> packet(&line, 1);
+  TraversalStack<vtkTypeUInt32> stack(this->Depth);
+  stack.Push(0);
+
+  double lo[3], hi[3], tEnter, cellBounds[6], *cellBoundsPtr = cellBounds;
+  double t, x[3], pcoords[3];
+  int subId;
+  while (!stack.Empty())
+  {
+    const Node& node = this->Nodes[stack.Pop()];
+    GetNodeBox(node, tol, lo, hi);
+    if (!packet.Intersect(lo, hi, 1u, tEnter))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.Push(node.Offset + 1);
+      stack.Push(node.Offset);
+      continue;
+    }
+    for (vtkTypeUInt32 i = 0; i < node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[node.Offset + i];
+      self->GetCellBounds(cellId, cellBoundsPtr);
+      GetCellBox(cellBoundsPtr, tol, lo, hi);
+      if (!packet.Intersect(lo, hi, 1u, tEnter))
+      {
+        continue;
+      }
+      if (!cell)
+      {
+        Intersection intersection{ cellId, tEnter, { 0.0, 0.0, 0.0 } };
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          intersection.X[axis] = p1[axis] + tEnter * (p2[axis] - p1[axis]);
+        }
+        intersections.push_back(intersection);
+        continue;
+      }
+      self->DataSet->GetCell(cellId, cell);
+      if (cell->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId))
+      {
+        intersections.push_back(Intersection{ cellId, t, { x[0], x[1], x[2] } });
+      }
+    }
+  }
+
+  if (intersections.empty())
+  {
+    return 0;
+  }
+  std::sort(intersections.begin(), intersections.end(),
+    [](const Intersection& a, const Intersection& b) {
+      return a.T < b.T || (a.T == b.T && a.CellId < b.CellId);
+    });
+  const vtkIdType numberOfIntersections = static_cast<vtkIdType>(intersections.size());
+  if (points)
+  {
+    points->SetNumberOfPoints(numberOfIntersections);
+    for (vtkIdType i = 0; i < numberOfIntersections; ++i)
+    {
+      points->SetPoint(i, intersections[i].X);
+    }
+  }
+  if (cellIds)
+  {
+    cellIds->SetNumberOfIds(numberOfIntersections);
+    for (vtkIdType i = 0; i < numberOfIntersections; ++i)
+    {
+      cellIds->SetId(i, intersections[i].CellId);
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::vtkBVHTree::FindCell(vtkBVHCellLocator* self, const double x[3],
+  vtkGenericCell* cell, int& subId, double pcoords[3], double* weights) const
+{
+  double pos[3] = { x[0], x[1], x[2] };
+  double lo[3], hi[3], dist2;
+  TraversalStack<vtkTypeUInt32> stack(this->Depth);
+  stack.Push(0);
+  while (!stack.Empty())
+  {
+    const Node& node = this->Nodes[stack.Pop()];
+    GetNodeBox(node, 0.0, lo, hi);
+    if (Distance2ToBox(pos, lo, hi) > 0.0)
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.Push(node.Offset + 1);
+      stack.Push(node.Offset);
+      continue;
+    }
+    for (vtkTypeUInt32 i = 0; i < node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[node.Offset + i];
+      if (self->InsideCellBounds(pos, cellId))
+      {
+        self->DataSet->GetCell(cellId, cell);
+        if (cell->EvaluatePosition(pos, nullptr, subId, pcoords, dist2, weights) == 1)
+        {
+          return cellId;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::vtkBVHTree::FindClosestPointWithinRadius(vtkBVHCellLocator* self,
+  const double x[3], double radius, double closestPoint[3], vtkGenericCell* cell,
+  vtkIdType& closestCellId, int& closestSubId, double& minDist2, int& inside) const
+{
+  std::vector<double> weights(std::max(self->DataSet->GetMaxCellSize(), 1));
+  double lo[3], hi[3], cellBounds[6], *cellBoundsPtr = cellBounds;
+  double pcoords[3], point[3], dist2;
+  int subId;
+  vtkIdType retVal = 0;
+  minDist2 = radius * radius;
+
+  struct Entry
+  {
+    vtkTypeUInt32 NodeId;
+    double Dist2;
+  };
+  TraversalStack<Entry> stack(this->Depth);
+  GetNodeBox(this->Nodes[0], 0.0, lo, hi);
+  stack.Push(Entry{ 0, Distance2ToBox(x, lo, hi) });
+  while (!stack.Empty())
+  {
+    const Entry entry = stack.Pop();
+    if (entry.Dist2 > minDist2)
+    {
+      continue;
+    }
+    const Node& node = this->Nodes[entry.NodeId];
+    if (!node.IsLeaf())
+    {
+      // Visit the closest child first.
+      GetNodeBox(this->Nodes[node.Offset], 0.0, lo, hi);
+      const Entry left{ node.Offset, Distance2ToBox(x, lo, hi) };
+      GetNodeBox(this->Nodes[node.Offset + 1], 0.0, lo, hi);
+      const Entry right{ node.Offset + 1, Distance2ToBox(x, lo, hi) };
+      stack.Push(left.Dist2 <= right.Dist2 ? right : left);
+      stack.Push(left.Dist2 <= right.Dist2 ? left : right);
+      continue;
+    }
+    for (vtkTypeUInt32 i = 0; i < node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[node.Offset + i];
+      self->GetCellBounds(cellId, cellBoundsPtr);
+      GetCellBox(cellBoundsPtr, 0.0, lo, hi);
+      if (Distance2ToBox(x, lo, hi) >= minDist2)
+      {
+        continue;
+      }
+      self->DataSet->GetCell(cellId, cell);
+      // stat==(-1) is numerical error; stat==0 means outside; stat=1 means inside.
+      const int stat = cell->EvaluatePosition(x, point, subId, pcoords, dist2, weights.data());
+      if (stat != -1 && dist2 < minDist2)
+      {
+        retVal = 1;
+        inside = stat;
+        minDist2 = dist2;
+        closestCellId = cellId;
+        closestSubId = subId;
+        std::copy_n(point, 3, closestPoint);
+      }
+    }
+  }
+
+  // Make sure the cell is the closest one.
+  if (retVal)
+  {
+    self->DataSet->GetCell(closestCellId, cell);
+  }
+  return retVal;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::vtkBVHTree::FindCellsWithinBounds(
+  vtkBVHCellLocator* self, const double bbox[6], vtkIdList* cells) const
+{
+  double lo[3], hi[3], cellBounds[6], *cellBoundsPtr = cellBounds;
+  TraversalStack<vtkTypeUInt32> stack(this->Depth);
+  stack.Push(0);
+  while (!stack.Empty())
+  {
+    const Node& node = this->Nodes[stack.Pop()];
+    GetNodeBox(node, 0.0, lo, hi);
+    if (!Overlap(lo, hi, bbox))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.Push(node.Offset + 1);
+      stack.Push(node.Offset);
+      continue;
+    }
+    for (vtkTypeUInt32 i = 0; i < node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[node.Offset + i];
+      self->GetCellBounds(cellId, cellBoundsPtr);
+      GetCellBox(cellBoundsPtr, 0.0, lo, hi);
+      if (Overlap(lo, hi, bbox))
+      {
+        cells->InsertNextId(cellId);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::vtkBVHTree::GenerateRepresentation(int level, vtkPolyData* pd) const
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> lines;
+  pd->SetPoints(points);
+  pd->SetLines(lines);
+
+  // The edges of a box, as pairs of corners indexed by (i, j, k) bits.
+  static const int edges[12][2] = { { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 }, { 0, 2 }, { 1, 3 },
+    { 4, 6 }, { 5, 7 }, { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 } };
+
+  struct Entry
+  {
+    vtkTypeUInt32 NodeId;
+    int Level;
+  };
+  TraversalStack<Entry> stack(this->Depth);
+  stack.Push(Entry{ 0, 0 });
+  while (!stack.Empty())
+  {
+    const Entry entry = stack.Pop();
+    const Node& node = this->Nodes[entry.NodeId];
+    if (level == -1 ? node.IsLeaf() : entry.Level == level)
+    {
+      vtkIdType corners[8];
+      for (int corner = 0; corner < 8; ++corner)
+      {
+        corners[corner] = points->InsertNextPoint((corner & 1) ? node.Max[0] : node.Min[0],
+          (corner & 2) ? node.Max[1] : node.Min[1], (corner & 4) ? node.Max[2] : node.Min[2]);
+      }
+      for (int edge = 0; edge < 12; ++edge)
+      {
+        const vtkIdType ids[2] = { corners[edges[edge][0]], corners[edges[edge][1]] };
+        lines->InsertNextCell(2, ids);
+      }
+    }
+    else if (!node.IsLeaf() && (level == -1 || entry.Level < level))
+    {
+      stack.Push(Entry{ node.Offset + 1, entry.Level + 1 });
+      stack.Push(Entry{ node.Offset, entry.Level + 1 });
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::vtkBVHCellLocator()
+{
+  this->NumberOfCellsPerNode = 4;
+  this->NumberOfBins = 16;
+}
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::~vtkBVHCellLocator()
+{
+  this->FreeSearchStructure();
+  this->FreeCellBounds();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::GetNumberOfNodes()
+{
+  return this->Tree ? static_cast<vtkIdType>(this->Tree->Nodes.size()) : 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::GetDepth()
+{
+  return this->Tree ? this->Tree->Depth : 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FreeSearchStructure()
+{
+  this->Tree.reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocator()
+{
+  // don't rebuild if build time is newer than modified and dataset modified time
+  if (this->Tree && this->BuildTime > this->MTime && this->BuildTime > this->DataSet->GetMTime())
+  {
+    return;
+  }
+  // don't rebuild if UseExistingSearchStructure is ON and a search structure already exists
+  if (this->Tree && this->UseExistingSearchStructure)
+  {
+    this->BuildTime.Modified();
+    vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
+    return;
+  }
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ForceBuildLocator()
+{
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocatorInternal()
+{
+  vtkIdType numCells;
+  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
+  {
+    vtkErrorMacro(<< " No Cells in the data set\n");
+    return;
+  }
+  // Nodes reference their children and cells with 32 bits offsets.
+  if (numCells > VTK_INT_MAX)
+  {
+    vtkErrorMacro(<< "Too many cells in the data set: " << numCells);
+    return;
+  }
+  this->FreeSearchStructure();
+  this->ComputeCellBounds();
+
+  // Single precision bounds of the cells, rounded outwards, and the boxes of
+  // all the cells and of their centroids.
+  std::vector<float> boxes(6 * static_cast<size_t>(numCells));
+  struct Boxes
+  {
+    Box Bounds;
+    Box Centroids;
+  };
+  vtkSMPThreadLocal<Boxes> localBoxes;
+  double cellBounds[6];
+  if (!this->CellBounds)
+  {
+    // Initialize the data set before using it from several threads.
+    this->DataSet->GetCellBounds(0, cellBounds);
+  }
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    Boxes& threadBoxes = localBoxes.Local();
+    double bounds[6], *boundsPtr = bounds;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      this->GetCellBounds(cellId, boundsPtr);
+      float* box = &boxes[6 * cellId];
+      float centroid[3];
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        box[axis] = RoundDown(boundsPtr[2 * axis]);
+        box[axis + 3] = RoundUp(boundsPtr[2 * axis + 1]);
+        centroid[axis] = 0.5f * (box[axis] + box[axis + 3]);
+      }
+      threadBoxes.Bounds.Add(box, box + 3);
+      threadBoxes.Centroids.Add(centroid, centroid);
+    }
+  });
+
+  Range root;
+  root.NodeId = 0;
+  root.Begin = 0;
+  root.End = numCells;
+  root.Level = 0;
+  for (const Boxes& threadBoxes : localBoxes)
+  {
+    root.Bounds.Add(threadBoxes.Bounds);
+    root.Centroids.Add(threadBoxes.Centroids);
+  }
+
+  auto tree = std::make_shared<vtkBVHTree>();
+  tree->CellIds.resize(numCells);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      tree->CellIds[cellId] = static_cast<vtkTypeUInt32>(cellId);
+    }
+  });
+  TreeBuilder builder(boxes, tree->CellIds, this->NumberOfBins, this->NumberOfCellsPerNode);
+  builder.Build(root, tree->Nodes, tree->Depth);
+
+  this->Tree = tree;
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
+  this->BuildLocator();
+  return this->IntersectWithLineBatched(p1, p2, tol, t, x, pcoords, subId, cellId, cell);
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLineBatched(const double p1[3], const double p2[3],
+  double tol, double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+  vtkGenericCell* cell)
+{
+  cellId = -1;
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  LineQuery line;
+  std::copy_n(p1, 3, line.P1);
+  std::copy_n(p2, 3, line.P2);
+  this->Tree->IntersectLines<1>(this, &line, 1, tol, cell);
+  if (line.CellId < 0)
+  {
+    return 0;
+  }
+  this->DataSet->GetCell(line.CellId, cell);
+  cellId = line.CellId;
+  t = line.T;
+  std::copy_n(line.X, 3, x);
+  std::copy_n(line.PCoords, 3, pcoords);
+  subId = line.SubId;
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::IntersectWithLinesBatched(vtkPoints* p1, vtkPoints* p2, vtkIdType begin,
+  vtkIdType end, double tol, vtkIdType* cellIds, double* t, double* x, double* pcoords,
+  vtkGenericCell* cell)
+{
+  if (!this->Tree)
+  {
+    this->Superclass::IntersectWithLinesBatched(
+      p1, p2, begin, end, tol, cellIds, t, x, pcoords, cell);
+    return;
+  }
+
+  LineQuery lines[PacketSize];
+  for (vtkIdType first = begin; first < end; first += PacketSize)
+  {
+    const int numberOfLines = static_cast<int>(std::min<vtkIdType>(PacketSize, end - first));
+    for (int i = 0; i < numberOfLines; ++i)
+    {
+      p1->GetPoint(first + i, lines[i].P1);
+      p2->GetPoint(first + i, lines[i].P2);
+    }
+    this->Tree->IntersectLines<PacketSize>(this, lines, numberOfLines, tol, cell);
+    for (int i = 0; i < numberOfLines; ++i)
+    {
+      const LineQuery& line = lines[i];
+      const vtkIdType lineId = first + i;
+      const bool hit = line.CellId >= 0;
+      cellIds[lineId] = line.CellId;
+      if (t)
+      {
+        t[lineId] = hit ? line.T : 0.0;
+      }
+      for (int c = 0; c < 3; ++c)
+      {
+        if (x)
+        {
+          x[3 * lineId + c] = hit ? line.X[c] : 0.0;
+        }
+        if (pcoords)
+        {
+          pcoords[3 * lineId + c] = hit ? line.PCoords[c] : 0.0;
+        }
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  return this->Tree->IntersectWithLine(this, p1, p2, tol, points, cellIds, cell);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindClosestPointWithinRadius(double x[3], double radius,
+  double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2,
+  int& inside)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  return this->Tree->FindClosestPointWithinRadius(
+    this, x, radius, closestPoint, cell, cellId, subId, dist2, inside);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FindClosestPointBatched(const double x[3], double closestPoint[3],
+  vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2)
+{
+  cellId = -1;
+  if (!this->Tree)
+  {
+    return;
+  }
+  int inside;
+  this->Tree->FindClosestPointWithinRadius(
+    this, x, vtkMath::Inf(), closestPoint, cell, cellId, subId, dist2, inside);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FindCellsWithinBounds(double* bbox, vtkIdList* cells)
+{
+  cells->Reset();
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return;
+  }
+  this->Tree->FindCellsWithinBounds(this, bbox, cells);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindCell(
+  double x[3], double tol2, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  this->BuildLocator();
+  return this->FindCellBatched(x, tol2, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindCellBatched(double x[3], double vtkNotUsed(tol2),
+  vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  if (!this->Tree)
+  {
+    return -1;
+  }
+  return this->Tree->FindCell(this, x, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::GenerateRepresentation(int level, vtkPolyData* pd)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return;
+  }
+  this->Tree->GenerateRepresentation(level, pd);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
+{
+  vtkBVHCellLocator* bvhLocator = vtkBVHCellLocator::SafeDownCast(locator);
+  if (!bvhLocator)
+  {
+    vtkErrorMacro("Cannot cast " << locator->GetClassName() << " to vtkBVHCellLocator.");
+    return;
+  }
+  // we only copy what's actually used by vtkBVHCellLocator
+
+  // vtkLocator parameters
+  this->SetUseExistingSearchStructure(bvhLocator->GetUseExistingSearchStructure());
+
+  // vtkAbstractCellLocator parameters
+  this->SetNumberOfCellsPerNode(bvhLocator->GetNumberOfCellsPerNode());
+  this->CacheCellBounds = bvhLocator->CacheCellBounds;
+  this->CellBoundsSharedPtr = bvhLocator->CellBoundsSharedPtr; // This is important
+  this->CellBounds = this->CellBoundsSharedPtr.get() ? this->CellBoundsSharedPtr->data() : nullptr;
+
+  // vtkBVHCellLocator parameters
+  this->NumberOfBins = bvhLocator->NumberOfBins;
+  this->Tree = bvhLocator->Tree;
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfBins: " << this->NumberOfBins << "\n";
+  os << indent << "NumberOfNodes: " << this->GetNumberOfNodes() << "\n";
+  os << indent << "Depth: " << this->GetDepth() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkBVHCellLocator
+ * @brief   a bounding volume hierarchy of cells built with the surface area heuristic
+ *
+ * vtkBVHCellLocator is a binary tree of axis aligned boxes whose leaves hold
+ * the cells of the data set, each cell being in exactly one leaf. The cells
+ * of a node are split in two with the surface area heuristic (SAH): the
+ * centroids of the cells are binned along each axis and the split minimizing
+ * the sum over both children of their surface area times their number of
+ * cells is chosen. This heuristic minimizes the expected number of boxes and
+ * cells tested by a ray, which makes this locator well suited to ray casting
+ * (IntersectWithLine(), picking, inside/outside tests with
+ * vtkSelectEnclosedPoints::IsInsideSurface()) on large surfaces.
+ *
+ * The tree is built in parallel with vtkSMPTools: the binning of the large
+ * nodes is parallel, then the subtrees are built concurrently. The resulting
+ * tree does not depend on the number of threads. Nodes are stored in a
+ * single array, 32 bytes each, with single precision bounds rounded outwards
+ * and both children of a node stored next to each other.
+ *
+ * The batched IntersectWithLines() of vtkAbstractCellLocator traverses the
+ * tree with packets of 8 consecutive lines: each node is tested against all
+ * the lines of the packet at once, in loops the compiler vectorizes. Packets
+ * of coherent lines (e.g. starting from neighbor points or sharing their
+ * direction) visit almost the same nodes, so the cost of the traversal is
+ * shared among the lines.
+ *
+ * vtkBVHCellLocator utilizes the following parent class parameters:
+ * - NumberOfCellsPerNode        (default 4)
+ * - CacheCellBounds             (default true)
+ * - UseExistingSearchStructure  (default false)
+ *
+ * vtkBVHCellLocator does NOT utilize the following parameters:
+ * - Automatic
+ * - Level
+ * - MaxLevel
+ * - Tolerance
+ * - RetainCellLists
+ *
+ * @sa
+ * vtkAbstractCellLocator vtkCellLocator vtkStaticCellLocator vtkCellTreeLocator vtkModifiedBSPTree
+ * vtkOBBTree
+ */
+
+#ifndef vtkBVHCellLocator_h
+#define vtkBVHCellLocator_h
+
+#include "vtkAbstractCellLocator.h"
+#include "vtkCommonDataModelModule.h" // For export macro
+
+#include <memory> // For shared_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONDATAMODEL_EXPORT vtkBVHCellLocator : public vtkAbstractCellLocator
+{
+public:
+  ///@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkBVHCellLocator* New();
+  vtkTypeMacro(vtkBVHCellLocator, vtkAbstractCellLocator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of bins used to evaluate the surface area heuristic
+   * along each axis. More bins find better splits but slow down the build.
+   * Default is 16.
+   */
+  vtkSetClampMacro(NumberOfBins, int, 2, 256);
+  vtkGetMacro(NumberOfBins, int);
+  ///@}
+
+  /**
+   * Return the number of nodes and the depth of the tree. This is only
+   * meaningful after the locator has been built.
+   */
+  vtkIdType GetNumberOfNodes();
+  int GetDepth();
+
+  // Re-use any superclass signatures that we don't override.
+  using vtkAbstractCellLocator::FindCell;
+  using vtkAbstractCellLocator::FindClosestPoint;
+  using vtkAbstractCellLocator::FindClosestPointWithinRadius;
+  using vtkAbstractCellLocator::IntersectWithLine;
+
+  /**
+   * Return intersection point (if any) AND the cell which was intersected by
+   * the finite line. The cell is returned as a cell id and as a generic cell.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t, double x[3],
+    double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+
+  /**
+   * Take the passed line segment and intersect it with the data set.
+   * The return value of the function is 0 if no intersections were found.
+   * For each intersection with the bounds of a cell or with a cell (if a cell is provided),
+   * the points and cellIds have the relevant information added sorted by t.
+   * If points or cellIds are nullptr pointers, then no information is generated for that list.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
+    vtkIdList* cellIds, vtkGenericCell* cell) override;
+
+  /**
+   * Return the closest point within a specified radius and the cell which is
+   * closest to the point x. The nodes are visited closest first and the ones
+   * further than the closest point found so far are skipped.
+   *
+   * For other FindClosestPoint signatures, see vtkAbstractCellLocator.
+   */
+  vtkIdType FindClosestPointWithinRadius(double x[3], double radius, double closestPoint[3],
+    vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2, int& inside) override;
+
+  /**
+   * Return a list of unique cell ids inside of a given bounding box. The
+   * user must provide the vtkIdList to populate.
+   */
+  void FindCellsWithinBounds(double* bbox, vtkIdList* cells) override;
+
+  /**
+   * Find the cell containing a given point. returns -1 if no cell found
+   * the cell parameters are copied into the supplied variables, a cell must
+   * be provided to store the information.
+   */
+  vtkIdType FindCell(double x[3], double tol2, vtkGenericCell* cell, int& subId, double pcoords[3],
+    double* weights) override;
+
+  ///@{
+  /**
+   * Satisfy vtkLocator abstract interface. GenerateRepresentation() outputs
+   * the edges of the boxes of the nodes at the given level of the tree, or of
+   * all the leaves if level is -1.
+   */
+  void FreeSearchStructure() override;
+  void BuildLocator() override;
+  void ForceBuildLocator() override;
+  void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  ///@}
+
+  /**
+   * Shallow copy of a vtkBVHCellLocator: the tree is shared.
+   *
+   * Before you shallow copy, make sure to call SetDataSet()
+   */
+  void ShallowCopy(vtkAbstractCellLocator* locator) override;
+
+protected:
+  vtkBVHCellLocator();
+  ~vtkBVHCellLocator() override;
+
+  void BuildLocatorInternal() override;
+
+  ///@{
+  /**
+   * Query the tree directly for the batched queries of vtkAbstractCellLocator.
+   * IntersectWithLinesBatched() traverses the tree with packets of lines.
+   */
+  vtkIdType FindCellBatched(double x[3], double tol2, vtkGenericCell* cell, int& subId,
+    double pcoords[3], double* weights) override;
+  void FindClosestPointBatched(const double x[3], double closestPoint[3], vtkGenericCell* cell,
+    vtkIdType& cellId, int& subId, double& dist2) override;
+  int IntersectWithLineBatched(const double p1[3], const double p2[3], double tol, double& t,
+    double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+  void IntersectWithLinesBatched(vtkPoints* p1, vtkPoints* p2, vtkIdType begin, vtkIdType end,
+    double tol, vtkIdType* cellIds, double* t, double* x, double* pcoords,
+    vtkGenericCell* cell) override;
+  ///@}
+
+  int NumberOfBins;
+
+private:
+  vtkBVHCellLocator(const vtkBVHCellLocator&) = delete;
+  void operator=(const vtkBVHCellLocator&) = delete;
+
+  struct vtkBVHTree;
+  std::shared_ptr<vtkBVHTree> Tree;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "vtkCellArray.h"
 
+#include "vtkAffineArray.h"
 #include "vtkArrayDispatch.h"
 #include "vtkCellArrayIterator.h"
 #include "vtkDataArrayRange.h"
@@ -30,7 +31,8 @@ struct GetSizeImpl
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
-    return (cells.GetOffsets()->GetSize() + cells.GetConnectivity()->GetSize());
+    const vtkIdType offsetsSize = cells.GetFixedCellSize() > 0 ? 0 : cells.GetOffsets()->GetSize();
+    return offsetsSize + cells.GetConnectivity()->GetSize();
   }
 };
 
@@ -105,7 +107,7 @@ struct CellIdToLocationFunctor
   {
     // Adding the cellId to the offset of that cell id gives us the cell
     // location in the old-style vtkCellArray connectivity array.
-    return static_cast<vtkIdType>(cells.GetOffsets()->GetValue(cellId)) + cellId;
+    return cells.GetBeginOffset(cellId) + cellId;
   }
 };
 
@@ -116,8 +118,7 @@ struct GetInsertLocationImpl
   {
     // The insert location used to just be the tail of the connectivity array.
     // Compute the equivalent value:
-    return (
-      (cells.GetOffsets()->GetNumberOfValues() - 1) + cells.GetConnectivity()->GetNumberOfValues());
+    return cells.GetNumberOfCells() + cells.GetConnectivity()->GetNumberOfValues();
   }
 };
 
@@ -151,6 +152,7 @@ struct InitializeImpl
   template <typename CellStateT>
   void operator()(CellStateT& cells) const
   {
+    // Clear the connectivity first: fixed size storage then generates no offsets.
     cells.GetConnectivity()->Initialize();
     cells.GetOffsets()->Initialize();
     cells.GetOffsets()->InsertNextValue(0);
@@ -163,7 +165,10 @@ struct SqueezeImpl
   void operator()(CellStateT& cells) const
   {
     cells.GetConnectivity()->Squeeze();
-    cells.GetOffsets()->Squeeze();
+    if (cells.GetFixedCellSize() == 0)
+    {
+      cells.GetOffsets()->Squeeze();
+    }
   }
 };
 
@@ -173,10 +178,18 @@ struct IsValidImpl
   bool operator()(CellStateT& state) const
   {
     using ValueType = typename CellStateT::ValueType;
-    auto* offsetArray = state.GetOffsets();
     auto* connArray = state.GetConnectivity();
 
+    // Fixed size storage only needs whole cells in the connectivity.
+    const vtkIdType cellSize = state.GetFixedCellSize();
+    if (cellSize > 0)
+    {
+      return connArray->GetNumberOfComponents() == 1 &&
+        connArray->GetNumberOfValues() % cellSize == 0;
+    }
+
     // Both arrays must be single component
+    auto* offsetArray = state.GetOffsets();
     if (offsetArray->GetNumberOfComponents() != 1 || connArray->GetNumberOfComponents() != 1)
     {
       return false;
@@ -219,8 +232,9 @@ struct CanConvert
 
     // offsets are sorted, so just check the last value, but we have to compute
     // the full range of the connectivity array.
-    auto* off = state.GetOffsets();
-    if (off->GetNumberOfValues() > 0 && !this->CheckValue(off->GetValue(off->GetMaxId())))
+    const vtkIdType numCells = state.GetNumberOfCells();
+    if (numCells >= 0 &&
+      !this->CheckValue(static_cast<ValueType>(state.GetBeginOffset(numCells))))
     {
       return false;
     }
@@ -251,8 +265,9 @@ struct ExtractAndInitialize
   template <typename CellStateT, typename TargetArrayT>
   bool operator()(CellStateT& state, TargetArrayT* offsets, TargetArrayT* conn) const
   {
-    return (
-      this->Process(state.GetOffsets(), offsets) && this->Process(state.GetConnectivity(), conn));
+    // Fixed size storage has no offsets to convert.
+    return ((state.GetFixedCellSize() > 0 || this->Process(state.GetOffsets(), offsets)) &&
+      this->Process(state.GetConnectivity(), conn));
   }
 
   template <typename SourceArrayT, typename TargetArrayT>
@@ -280,7 +295,6 @@ struct IsHomogeneousImpl
   vtkIdType operator()(CellArraysT& state) const
   {
     using ValueType = typename CellArraysT::ValueType;
-    auto* offsets = state.GetOffsets();
 
     const vtkIdType numCells = state.GetNumberOfCells();
     if (numCells == 0)
@@ -290,9 +304,13 @@ struct IsHomogeneousImpl
 
     // Initialize using the first cell:
     const vtkIdType firstCellSize = state.GetCellSize(0);
+    if (state.GetFixedCellSize() > 0)
+    {
+      return firstCellSize;
+    }
 
     // Verify the rest:
-    auto offsetRange = vtk::DataArrayValueRange<1>(offsets);
+    auto offsetRange = vtk::DataArrayValueRange<1>(state.GetOffsets());
     auto it = std::adjacent_find(offsetRange.begin() + 1, offsetRange.end(),
       [&](const ValueType a, const ValueType b) -> bool { return (b - a != firstCellSize); });
 
@@ -378,8 +396,9 @@ struct GetActualMemorySizeImpl
   template <typename CellStateT>
   unsigned long operator()(CellStateT& cells) const
   {
-    return (
-      cells.GetOffsets()->GetActualMemorySize() + cells.GetConnectivity()->GetActualMemorySize());
+    const unsigned long offsetsSize =
+      cells.GetFixedCellSize() > 0 ? 0 : cells.GetOffsets()->GetActualMemorySize();
+    return offsetsSize + cells.GetConnectivity()->GetActualMemorySize();
   }
 };
 
@@ -388,8 +407,16 @@ struct PrintSelfImpl
   template <typename CellStateT>
   void operator()(CellStateT& cells, ostream& os, vtkIndent indent) const
   {
-    os << indent << "Offsets:\n";
-    cells.GetOffsets()->PrintSelf(os, indent.GetNextIndent());
+    const vtkIdType cellSize = cells.GetFixedCellSize();
+    if (cellSize > 0)
+    {
+      os << indent << "FixedCellSize: " << cellSize << "\n";
+    }
+    else
+    {
+      os << indent << "Offsets:\n";
+      cells.GetOffsets()->PrintSelf(os, indent.GetNextIndent());
+    }
     os << indent << "Connectivity:\n";
     cells.GetConnectivity()->PrintSelf(os, indent.GetNextIndent());
   }
@@ -400,8 +427,7 @@ struct GetLegacyDataSizeImpl
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
-    return (
-      (cells.GetOffsets()->GetNumberOfValues() - 1) + cells.GetConnectivity()->GetNumberOfValues());
+    return cells.GetNumberOfCells() + cells.GetConnectivity()->GetNumberOfValues();
   }
 };
 
@@ -482,11 +508,38 @@ struct AppendImpl
   template <typename SrcCellStateT, typename DstCellStateT>
   void operator()(SrcCellStateT& src, DstCellStateT& dst, vtkIdType pointOffsets) const
   {
-    this->AppendArrayWithOffset(
-      src.GetOffsets(), dst.GetOffsets(), dst.GetConnectivity()->GetNumberOfValues(), true);
+    // Cells of the same fixed size only append their connectivity, and the
+    // offsets of fixed size storage are not generated in src.
+    const vtkIdType srcCellSize = src.GetFixedCellSize();
+    if (srcCellSize == 0)
+    {
+      this->AppendArrayWithOffset(
+        src.GetOffsets(), dst.GetOffsets(), dst.GetConnectivity()->GetNumberOfValues(), true);
+    }
+    else if (dst.GetFixedCellSize() != srcCellSize)
+    {
+      this->AppendFixedSizeOffsets(src.GetNumberOfCells(), srcCellSize, dst.GetOffsets(),
+        dst.GetConnectivity()->GetNumberOfValues());
+    }
     this->AppendArrayWithOffset(src.GetConnectivity(), dst.GetConnectivity(), pointOffsets, false);
   }
 
+  // Append the offsets of numCells cells of cellSize points to dst.
+  template <typename DstArrayT>
+  void AppendFixedSizeOffsets(
+    vtkIdType numCells, vtkIdType cellSize, DstArrayT* dstArray, vtkIdType offset) const
+  {
+    using DstValueType = vtk::GetAPIType<DstArrayT>;
+
+    const vtkIdType dstBegin = dstArray->GetNumberOfValues();
+    dstArray->InsertValue(dstBegin + numCells - 1, 0);
+    auto dstRange = vtk::DataArrayValueRange<1>(dstArray, dstBegin, dstBegin + numCells);
+    for (vtkIdType i = 0; i < numCells; ++i)
+    {
+      dstRange[i] = static_cast<DstValueType>(offset + (i + 1) * cellSize);
+    }
+  }
+
   // Assumes both arrays are 1 component. src's data is appended to dst with
   // offset added to each value.
   template <typename SrcArrayT, typename DstArrayT>
@@ -688,7 +741,12 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     this->Storage.Use64BitStorage();
     auto& srcStorage = other->Storage.GetArrays64();
     auto& dstStorage = this->Storage.GetArrays64();
-    dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
+    const vtkIdType cellSize = srcStorage.GetFixedCellSize();
+    if (cellSize == 0)
+    {
+      dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
+    }
+    dstStorage.SetFixedCellSize(cellSize);
     dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
     this->Modified();
   }
@@ -697,7 +755,12 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     this->Storage.Use32BitStorage();
     auto& srcStorage = other->Storage.GetArrays32();
     auto& dstStorage = this->Storage.GetArrays32();
-    dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
+    const vtkIdType cellSize = srcStorage.GetFixedCellSize();
+    if (cellSize == 0)
+    {
+      dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
+    }
+    dstStorage.SetFixedCellSize(cellSize);
     dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
     this->Modified();
   }
@@ -716,16 +779,24 @@ void vtkCellArray::ShallowCopy(vtkAbstractCellArray* ca)
     return;
   }
 
+  // The empty offsets of fixed size storage are not shared, each cell array
+  // generates its own when needed.
+  const vtkIdType cellSize = other->GetFixedCellSize();
   if (other->Storage.Is64Bit())
   {
     auto& srcStorage = other->Storage.GetArrays64();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
+    vtkNew<ArrayType64> offsets;
+    this->SetData(cellSize > 0 ? offsets.Get() : srcStorage.GetOffsets(),
+      srcStorage.GetConnectivity());
   }
   else
   {
     auto& srcStorage = other->Storage.GetArrays32();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
+    vtkNew<ArrayType32> offsets;
+    this->SetData(cellSize > 0 ? offsets.Get() : srcStorage.GetOffsets(),
+      srcStorage.GetConnectivity());
   }
+  this->SetFixedCellSize(cellSize);
 }
 
 //------------------------------------------------------------------------------
@@ -770,6 +841,7 @@ void vtkCellArray::SetData(vtkTypeInt32Array* offsets, vtkTypeInt32Array* connec
   // vtkArrayDownCast to ensure this works when ArrayType32 is vtkIdTypeArray.
   storage.Offsets = vtkArrayDownCast<ArrayType32>(offsets);
   storage.Connectivity = vtkArrayDownCast<ArrayType32>(connectivity);
+  storage.SetFixedCellSize(0);
   this->Modified();
 }
 
@@ -789,6 +861,7 @@ void vtkCellArray::SetData(vtkTypeInt64Array* offsets, vtkTypeInt64Array* connec
   // vtkArrayDownCast to ensure this works when ArrayType64 is vtkIdTypeArray.
   storage.Offsets = vtkArrayDownCast<ArrayType64>(offsets);
   storage.Connectivity = vtkArrayDownCast<ArrayType64>(connectivity);
+  storage.SetFixedCellSize(0);
   this->Modified();
 }
 
@@ -915,6 +988,38 @@ struct GenerateOffsetsImpl
   }
 };
 
+template <typename ArrayT>
+void GenerateFixedSizeOffsetsImpl(ArrayT* offsets, vtkIdType numCells, vtkIdType cellSize)
+{
+  using ValueType = typename ArrayT::ValueType;
+  // This runs under the lock of VisitState::ExpandOffsets(), don't spawn
+  // nested SMP work that could try to take it again.
+  offsets->SetNumberOfValues(numCells + 1);
+  ValueType* values = offsets->GetPointer(0);
+  for (vtkIdType i = 0; i <= numCells; ++i)
+  {
+    values[i] = static_cast<ValueType>(i * cellSize);
+  }
+}
+
+// Return previous if it already is the affine array of the offsets of cells
+// of cellSize points, else a new one, with numOffsets values.
+template <typename ValueType>
+vtkSmartPointer<vtkDataArray> UpdateImplicitOffsets(
+  vtkDataArray* previous, vtkIdType cellSize, vtkIdType numOffsets)
+{
+  using AffineArrayType = vtkAffineArray<ValueType>;
+  vtkSmartPointer<AffineArrayType> offsets = AffineArrayType::SafeDownCast(previous);
+  // The second offset is the slope of the affine function.
+  if (!offsets || offsets->GetValue(1) != static_cast<ValueType>(cellSize))
+  {
+    offsets = vtkSmartPointer<AffineArrayType>::New();
+    offsets->ConstructBackend(static_cast<ValueType>(cellSize), 0);
+  }
+  offsets->SetNumberOfTuples(numOffsets);
+  return offsets;
+}
+
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -973,6 +1078,79 @@ bool vtkCellArray::SetData(vtkIdType cellSize, vtkDataArray* connectivity)
   return this->SetData(offsets, connectivity);
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellArray::SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity)
+{
+  if (connectivity == nullptr || cellSize <= 0)
+  {
+    vtkErrorMacro("Invalid cellSize or connectivity array.");
+    return false;
+  }
+
+  if ((connectivity->GetNumberOfTuples() % cellSize) != 0)
+  {
+    vtkErrorMacro("Connectivity array size is not suitable for chosen cellSize");
+    return false;
+  }
+
+  // The offsets are implied by the cell size, an empty array of the same type
+  // stands for them.
+  vtkSmartPointer<vtkDataArray> offsets;
+  offsets.TakeReference(connectivity->NewInstance());
+  if (!this->SetData(offsets, connectivity))
+  {
+    return false;
+  }
+  this->SetFixedCellSize(cellSize);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkDataArray* vtkCellArray::GetOffsetsArray()
+{
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  if (cellSize == 0)
+  {
+    if (this->Storage.Is64Bit())
+    {
+      return this->GetOffsetsArray64();
+    }
+    else
+    {
+      return this->GetOffsetsArray32();
+    }
+  }
+
+  // Fixed size storage: describe the offsets with an affine array instead of
+  // generating them.
+  const vtkIdType numOffsets = this->GetNumberOfCells() + 1;
+  if (this->Storage.Is64Bit())
+  {
+    this->ImplicitOffsets =
+      UpdateImplicitOffsets<ArrayType64::ValueType>(this->ImplicitOffsets, cellSize, numOffsets);
+  }
+  else
+  {
+    this->ImplicitOffsets =
+      UpdateImplicitOffsets<ArrayType32::ValueType>(this->ImplicitOffsets, cellSize, numOffsets);
+  }
+  return this->ImplicitOffsets;
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::GenerateFixedSizeOffsets(
+  ArrayType32* offsets, vtkIdType numCells, vtkIdType cellSize)
+{
+  GenerateFixedSizeOffsetsImpl(offsets, numCells, cellSize);
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::GenerateFixedSizeOffsets(
+  ArrayType64* offsets, vtkIdType numCells, vtkIdType cellSize)
+{
+  GenerateFixedSizeOffsetsImpl(offsets, numCells, cellSize);
+}
+
 //------------------------------------------------------------------------------
 void vtkCellArray::Use32BitStorage()
 {
@@ -1038,6 +1216,7 @@ bool vtkCellArray::ConvertTo32BitStorage()
   {
     return true;
   }
+  const vtkIdType cellSize = this->GetFixedCellSize();
   vtkNew<ArrayType32> offsets;
   vtkNew<ArrayType32> conn;
   if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
@@ -1046,6 +1225,7 @@ bool vtkCellArray::ConvertTo32BitStorage()
   }
 
   this->SetData(offsets, conn);
+  this->SetFixedCellSize(cellSize);
   return true;
 }
 
@@ -1056,6 +1236,7 @@ bool vtkCellArray::ConvertTo64BitStorage()
   {
     return true;
   }
+  const vtkIdType cellSize = this->GetFixedCellSize();
   vtkNew<ArrayType64> offsets;
   vtkNew<ArrayType64> conn;
   if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
@@ -1064,6 +1245,7 @@ bool vtkCellArray::ConvertTo64BitStorage()
   }
 
   this->SetData(offsets, conn);
+  this->SetFixedCellSize(cellSize);
   return true;
 }
 
@@ -1088,6 +1270,23 @@ bool vtkCellArray::ConvertToSmallestStorage()
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToFixedSizeStorage()
+{
+  if (this->IsStorageFixedSize())
+  {
+    return true;
+  }
+  const vtkIdType cellSize = this->IsHomogeneous();
+  if (cellSize <= 0)
+  {
+    return false;
+  }
+  this->SetFixedCellSize(cellSize);
+  this->Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 bool vtkCellArray::AllocateExact(vtkIdType numCells, vtkIdType connectivitySize)
 {
@@ -83,6 +83,18 @@
  * - `bool ConvertTo64BitStorage()`
  * - `bool ConvertToDefaultStorage() // Depends on vtkIdType`
  * - `bool ConvertToSmallestStorage() // Depends on current values in arrays`
+ * - `bool IsStorageFixedSize()`
+ * - `bool ConvertToFixedSizeStorage() // All the cells must have the same size`
+ *
+ * When all the cells have the same number of points (e.g. triangle meshes or
+ * hexahedral grids), the offsets are implied by the cell size and the cell
+ * array can drop its Offsets array, see ConvertToFixedSizeStorage() and
+ * SetFixedSizeData(). This saves 8 bytes per cell with 64-bit storage. This
+ * storage is never selected implicitly. Cells of the same size can still be
+ * inserted without leaving it, and GetOffsetsArray() returns a read-only
+ * vtkAffineArray. Operations that need writable offsets (GetOffsetsArray32(),
+ * GetOffsetsArray64(), inserting a cell of another size, ...) generate them
+ * first and go back to explicit offsets.
  *
  * Note that some legacy methods are still available that reflect the
  * previous storage format of this data, which embedded the cell sizes into
@@ -136,8 +148,10 @@
 #include "vtkTypeInt64Array.h"       // Needed for inline methods
 #include "vtkTypeList.h"             // Needed for ArrayList definition
 
+#include <atomic>           // for std::atomic
 #include <cassert>          // for assert
 #include <initializer_list> // for API
+#include <mutex>            // for std::mutex
 #include <type_traits>      // for std::is_same
 #include <utility>          // for std::forward
 
@@ -295,6 +309,8 @@ public:
    * - The offset array values never decrease.
    * - The connectivity array has as many entries as the last value in the
    *   offset array.
+   * For fixed size storage, the connectivity array must have one component
+   * and hold a whole number of cells.
    */
   bool IsValid();
 
@@ -305,11 +321,11 @@ public:
   {
     if (this->Storage.Is64Bit())
     {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues() - 1;
+      return this->Storage.GetArrays64().GetNumberOfCells();
     }
     else
     {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues() - 1;
+      return this->Storage.GetArrays32().GetNumberOfCells();
     }
   }
 
@@ -317,17 +333,7 @@ public:
    * Get the number of elements in the offsets array. This will be the number of
    * cells + 1.
    */
-  vtkIdType GetNumberOfOffsets() const override
-  {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues();
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues();
-    }
-  }
+  vtkIdType GetNumberOfOffsets() const override { return this->GetNumberOfCells() + 1; }
 
   /**
    * Get the offset (into the connectivity) for a specified cell id.
@@ -336,11 +342,11 @@ public:
   {
     if (this->Storage.Is64Bit())
     {
-      return this->Storage.GetArrays64().Offsets->GetValue(cellId);
+      return this->Storage.GetArrays64().GetBeginOffset(cellId);
     }
     else
     {
-      return this->Storage.GetArrays32().Offsets->GetValue(cellId);
+      return this->Storage.GetArrays32().GetBeginOffset(cellId);
     }
   }
 
@@ -417,6 +423,13 @@ public:
    */
   bool SetData(vtkIdType cellSize, vtkDataArray* connectivity);
 
+  /**
+   * Same as SetData(vtkIdType, vtkDataArray*), but the cell array uses fixed
+   * size storage and no offsets array is generated, see
+   * ConvertToFixedSizeStorage().
+   */
+  bool SetFixedSizeData(vtkIdType cellSize, vtkDataArray* connectivity);
+
   /**
    * @return True if the internal storage is using 64 bit arrays. If false,
    * the storage is using 32 bit arrays.
@@ -489,24 +502,36 @@ public:
   bool ConvertToSmallestStorage();
   /**@}*/
 
+  /**
+   * Drop the offsets array when all the cells have the same number of points:
+   * the offsets are then implied by the cell size. They are generated again,
+   * going back to explicit offsets, only when they must be writable, i.e. by
+   * GetOffsetsArray32(), GetOffsetsArray64(), a non-const
+   * VisitState::GetOffsets() or when a cell of another size is inserted.
+   *
+   * @return True if the storage is now fixed size, false if the cells do not
+   * all have the same size or if there is no cell.
+   */
+  bool ConvertToFixedSizeStorage();
+
+  /**
+   * @return True if the offsets are implied by a fixed cell size instead of
+   * being stored, see ConvertToFixedSizeStorage().
+   */
+  bool IsStorageFixedSize() const { return this->GetFixedCellSize() > 0; }
+
   /**
    * Return the array used to store cell offsets. The 32/64 variants are only
    * valid when IsStorage64Bit() returns the appropriate value.
+   *
+   * With fixed size storage, GetOffsetsArray() returns a read-only
+   * vtkAffineArray of the offsets and the storage is unchanged, while the
+   * 32/64 variants generate the offsets and go back to explicit offsets.
    * @{
    */
-  vtkDataArray* GetOffsetsArray()
-  {
-    if (this->Storage.Is64Bit())
-    {
-      return this->GetOffsetsArray64();
-    }
-    else
-    {
-      return this->GetOffsetsArray32();
-    }
-  }
-  ArrayType32* GetOffsetsArray32() { return this->Storage.GetArrays32().Offsets; }
-  ArrayType64* GetOffsetsArray64() { return this->Storage.GetArrays64().Offsets; }
+  vtkDataArray* GetOffsetsArray();
+  ArrayType32* GetOffsetsArray32() { return this->Storage.GetArrays32().GetOffsets(); }
+  ArrayType64* GetOffsetsArray64() { return this->Storage.GetArrays64().GetOffsets(); }
   /**@}*/
 
   /**
@@ -810,8 +835,25 @@ public:
     static constexpr bool ValueTypeIsSameAsIdType = std::is_integral<ValueType>::value &&
       std::is_signed<ValueType>::value && (sizeof(ValueType) == sizeof(vtkIdType));
 
-    ArrayType* GetOffsets() { return this->Offsets; }
-    const ArrayType* GetOffsets() const { return this->Offsets; }
+    // In fixed size storage, the non-const GetOffsets() generates the offsets
+    // and goes back to explicit offsets, while the const one has no side
+    // effect and returns nullptr. Use GetBeginOffset() / GetEndOffset() to
+    // support both storages.
+    ArrayType* GetOffsets()
+    {
+      this->ExpandOffsets();
+      return this->Offsets;
+    }
+    const ArrayType* GetOffsets() const
+    {
+      return this->GetFixedCellSize() > 0 ? nullptr : this->Offsets.Get();
+    }
+
+    // The number of points of all the cells in fixed size storage, else 0.
+    vtkIdType GetFixedCellSize() const
+    {
+      return this->FixedCellSize.load(std::memory_order_acquire);
+    }
 
     ArrayType* GetConnectivity() { return this->Connectivity; }
     const ArrayType* GetConnectivity() const { return this->Connectivity; }
@@ -867,8 +909,27 @@ public:
 #endif
     }
 
+    // Switch to fixed size storage (cellSize > 0), releasing the offsets, or
+    // back to explicit offsets (cellSize == 0) once they have been set.
+    void SetFixedCellSize(vtkIdType cellSize)
+    {
+      if (cellSize > 0)
+      {
+        // The offsets may be shared with another cell array, don't clear them.
+        this->Offsets = vtkSmartPointer<ArrayType>::New();
+      }
+      this->FixedCellSize.store(cellSize, std::memory_order_release);
+    }
+
+    // Generate the offsets of fixed size storage and go back to explicit
+    // offsets. Thread safe, so that functors reading the offsets can still
+    // visit the cell array concurrently.
+    void ExpandOffsets();
+
     vtkSmartPointer<ArrayType> Connectivity;
     vtkSmartPointer<ArrayType> Offsets;
+    std::atomic<vtkIdType> FixedCellSize{ 0 };
+    std::mutex ExpandOffsetsMutex;
 
   private:
     VisitState(const VisitState&) = delete;
@@ -1336,8 +1397,44 @@ protected:
 
   vtkNew<vtkIdTypeArray> LegacyData; // For GetData().
 
+  // The affine offsets returned by GetOffsetsArray() in fixed size storage.
+  vtkSmartPointer<vtkDataArray> ImplicitOffsets;
+
   static bool DefaultStorageIs64Bit;
 
+  // The size of the cells in fixed size storage, else 0.
+  vtkIdType GetFixedCellSize() const
+  {
+    if (this->Storage.Is64Bit())
+    {
+      return this->Storage.GetArrays64().GetFixedCellSize();
+    }
+    else
+    {
+      return this->Storage.GetArrays32().GetFixedCellSize();
+    }
+  }
+
+  // Switch to fixed size storage with cells of cellSize points, or back to
+  // explicit offsets if cellSize is 0.
+  void SetFixedCellSize(vtkIdType cellSize)
+  {
+    if (this->Storage.Is64Bit())
+    {
+      this->Storage.GetArrays64().SetFixedCellSize(cellSize);
+    }
+    else
+    {
+      this->Storage.GetArrays32().SetFixedCellSize(cellSize);
+    }
+  }
+
+  // Fill the offsets of numCells cells of cellSize points each.
+  static void GenerateFixedSizeOffsets(
+    ArrayType32* offsets, vtkIdType numCells, vtkIdType cellSize);
+  static void GenerateFixedSizeOffsets(
+    ArrayType64* offsets, vtkIdType numCells, vtkIdType cellSize);
+
 private:
   vtkCellArray(const vtkCellArray&) = delete;
   void operator=(const vtkCellArray&) = delete;
@@ -1346,27 +1443,65 @@ private:
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetNumberOfCells() const
 {
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  if (cellSize > 0)
+  {
+    return this->Connectivity->GetNumberOfValues() / cellSize;
+  }
   return this->Offsets->GetNumberOfValues() - 1;
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetBeginOffset(vtkIdType cellId) const
 {
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  if (cellSize > 0)
+  {
+    return cellId * cellSize;
+  }
   return static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetEndOffset(vtkIdType cellId) const
 {
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  if (cellSize > 0)
+  {
+    return (cellId + 1) * cellSize;
+  }
   return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1));
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetCellSize(vtkIdType cellId) const
 {
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  if (cellSize > 0)
+  {
+    return cellSize;
+  }
   return this->GetEndOffset(cellId) - this->GetBeginOffset(cellId);
 }
 
+template <typename ArrayT>
+void vtkCellArray::VisitState<ArrayT>::ExpandOffsets()
+{
+  if (this->GetFixedCellSize() == 0)
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(this->ExpandOffsetsMutex);
+  // Another thread may have generated the offsets while this one was waiting.
+  const vtkIdType cellSize = this->FixedCellSize.load(std::memory_order_relaxed);
+  if (cellSize > 0)
+  {
+    vtkCellArray::GenerateFixedSizeOffsets(
+      this->Offsets, this->Connectivity->GetNumberOfValues() / cellSize, cellSize);
+    this->FixedCellSize.store(0, std::memory_order_release);
+  }
+}
+
 template <typename ArrayT>
 typename vtkCellArray::VisitState<ArrayT>::CellRangeType
 vtkCellArray::VisitState<ArrayT>::GetCellRange(vtkIdType cellId)
@@ -1388,6 +1523,18 @@ struct InsertNextCellImpl
   {
     using ValueType = typename CellStateT::ValueType;
     auto* conn = state.GetConnectivity();
+
+    // Fixed size storage only needs the point ids.
+    if (npts > 0 && npts == state.GetFixedCellSize())
+    {
+      const vtkIdType cellId = state.GetNumberOfCells();
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        conn->InsertNextValue(static_cast<ValueType>(pts[i]));
+      }
+      return cellId;
+    }
+
     auto* offsets = state.GetOffsets();
 
     const vtkIdType cellId = offsets->GetNumberOfValues() - 1;
@@ -1537,8 +1684,12 @@ struct ResetImpl
   template <typename CellStateT>
   void operator()(CellStateT& state)
   {
-    state.GetOffsets()->Reset();
     state.GetConnectivity()->Reset();
+    if (state.GetFixedCellSize() > 0)
+    {
+      return;
+    }
+    state.GetOffsets()->Reset();
     state.GetOffsets()->InsertNextValue(0);
   }
 };
@@ -7,8 +7,13 @@
 #include "vtkGenericCell.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -153,6 +158,64 @@ void vtkCellLinks::BuildLinks()
     this->Allocate(numPts);
   }
 
+  // Unless SequentialProcessing is on, the cells of unstructured grids are
+  // linked in parallel, directly into the link lists. One counter per point
+  // first counts the cells using the point, then gives the position of the
+  // next cell in its list. The cells of each point are finally sorted by id,
+  // in the order of the serial traversal below.
+  if (this->DataSet->GetDataObjectType() == VTK_UNSTRUCTURED_GRID && !this->SequentialProcessing)
+  {
+    vtkUnstructuredGrid* ugrid = static_cast<vtkUnstructuredGrid*>(this->DataSet);
+    std::unique_ptr<std::atomic<vtkIdType>[]> counts(new std::atomic<vtkIdType>[numPts]());
+    vtkSMPThreadLocalObject<vtkIdList> threadIds;
+    vtkSMPTools::For(0, numCells, [&](vtkIdType beginCellId, vtkIdType endCellId) {
+      vtkIdList* ids = threadIds.Local();
+      vtkIdType numCellPts;
+      const vtkIdType* cellPts;
+      for (vtkIdType id = beginCellId; id < endCellId; ++id)
+      {
+        ugrid->GetCellPoints(id, numCellPts, cellPts, ids);
+        for (vtkIdType i = 0; i < numCellPts; ++i)
+        {
+          counts[cellPts[i]].fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+    vtkSMPTools::For(0, numPts, [&](vtkIdType beginPtId, vtkIdType endPtId) {
+      for (vtkIdType ptId = beginPtId; ptId < endPtId; ++ptId)
+      {
+        Link& link = this->Array[ptId];
+        link.ncells = counts[ptId].load(std::memory_order_relaxed);
+        link.cells = new vtkIdType[link.ncells];
+        counts[ptId].store(0, std::memory_order_relaxed);
+      }
+    });
+    vtkSMPTools::For(0, numCells, [&](vtkIdType beginCellId, vtkIdType endCellId) {
+      vtkIdList* ids = threadIds.Local();
+      vtkIdType numCellPts;
+      const vtkIdType* cellPts;
+      for (vtkIdType id = beginCellId; id < endCellId; ++id)
+      {
+        ugrid->GetCellPoints(id, numCellPts, cellPts, ids);
+        for (vtkIdType i = 0; i < numCellPts; ++i)
+        {
+          const vtkIdType ptId = cellPts[i];
+          this->Array[ptId].cells[counts[ptId].fetch_add(1, std::memory_order_relaxed)] = id;
+        }
+      }
+    });
+    vtkSMPTools::For(0, numPts, [&](vtkIdType beginPtId, vtkIdType endPtId) {
+      for (vtkIdType ptId = beginPtId; ptId < endPtId; ++ptId)
+      {
+        Link& link = this->Array[ptId];
+        std::sort(link.cells, link.cells + link.ncells);
+      }
+    });
+    this->MaxId = numPts - 1;
+    this->BuildTime.Modified();
+    return;
+  }
+
   // Use fast path if polydata
   vtkIdType npts;
   const vtkIdType* pts;
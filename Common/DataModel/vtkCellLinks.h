@@ -59,7 +59,10 @@ public:
   ///@}
 
   /**
-   * Build the link list array from the input dataset.
+   * Build the link list array from the input dataset. The links of a
+   * vtkUnstructuredGrid are built in parallel unless SequentialProcessing is
+   * on; the cells of each point are always sorted by increasing id. Besides
+   * the links, both builds use a temporary counter per point.
    */
   void BuildLinks() override;
 
@@ -135,6 +135,13 @@ int vtkCellLocator::IntersectWithLine(const double p1[3], const double p2[3], do
   double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
 {
   this->BuildLocator();
+  return this->IntersectWithLineBatched(p1, p2, tol, t, x, pcoords, subId, cellId, cell);
+}
+
+//------------------------------------------------------------------------------
+int vtkCellLocator::IntersectWithLineBatched(const double p1[3], const double p2[3], double tol,
+  double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
   if (this->Tree == nullptr)
   {
     return 0;
@@ -1096,10 +1103,17 @@ double vtkCellLocator::Distance2ToBounds(const double x[3], double bounds[6])
 }
 
 //------------------------------------------------------------------------------
-vtkIdType vtkCellLocator::FindCell(double x[3], double vtkNotUsed(tol2), vtkGenericCell* cell,
-  int& subId, double pcoords[3], double* weights)
+vtkIdType vtkCellLocator::FindCell(
+  double x[3], double tol2, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
 {
   this->BuildLocator();
+  return this->FindCellBatched(x, tol2, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkCellLocator::FindCellBatched(double x[3], double vtkNotUsed(tol2),
+  vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
   if (this->Tree == nullptr)
   {
     return -1;
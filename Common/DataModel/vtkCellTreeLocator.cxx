@@ -10,6 +10,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
@@ -403,9 +405,41 @@ private:
       std::fill((*this)[1].begin(), (*this)[1].end(), Bucket());
       std::fill((*this)[2].begin(), (*this)[2].end(), Bucket());
     }
+
+    void Merge(const BucketsType& other)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        for (size_t i = 0; i < (*this)[d].size(); ++i)
+        {
+          Bucket& bucket = (*this)[d][i];
+          const Bucket& otherBucket = other[d][i];
+          bucket.Cnt += otherBucket.Cnt;
+          bucket.Min = std::min(bucket.Min, otherBucket.Min);
+          bucket.Max = std::max(bucket.Max, otherBucket.Max);
+        }
+      }
+    }
   };
   BucketsType Buckets;
 
+  // A subtree that is built independently of the others, see operator().
+  struct Subtree
+  {
+    SplitInfo Root;
+    std::vector<CellTreeNode<T>> Nodes;
+
+    Subtree(const SplitInfo& root)
+      : Root(root)
+    {
+    }
+  };
+
+  // Nodes holding more cells than this are split one after the other, each
+  // split processing the cells in parallel. Smaller nodes are the roots of
+  // subtrees built in parallel.
+  T ParallelSize;
+
   // -------------------------------------------------------------------------
   void FindMinMax(const CellInfo* begin, const CellInfo* end, double* min, double* max)
   {
@@ -414,6 +448,41 @@ private:
       return;
     }
 
+    if (end - begin > this->ParallelSize)
+    {
+      struct MinMax
+      {
+        double Min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
+        double Max[3] = { -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+      };
+      vtkSMPThreadLocal<MinMax> localMinMax;
+      vtkSMPTools::For(0, end - begin, [&](vtkIdType first, vtkIdType last) {
+        MinMax& minMax = localMinMax.Local();
+        for (const CellInfo* pc = begin + first; pc != begin + last; ++pc)
+        {
+          for (uint8_t d = 0; d < 3; ++d)
+          {
+            minMax.Min[d] = std::min(minMax.Min[d], pc->Min[d]);
+            minMax.Max[d] = std::max(minMax.Max[d], pc->Max[d]);
+          }
+        }
+      });
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        min[d] = VTK_DOUBLE_MAX;
+        max[d] = -VTK_DOUBLE_MAX;
+      }
+      for (const MinMax& minMax : localMinMax)
+      {
+        for (uint8_t d = 0; d < 3; ++d)
+        {
+          min[d] = std::min(min[d], minMax.Min[d]);
+          max[d] = std::max(max[d], minMax.Max[d]);
+        }
+      }
+      return;
+    }
+
     for (uint8_t d = 0; d < 3; ++d)
     {
       min[d] = begin->Min[d];
@@ -437,10 +506,30 @@ private:
   }
 
   // -------------------------------------------------------------------------
-  void Split(T index, double min[3], double max[3], BucketsType& buckets)
+  void Bin(const CellInfo* begin, const CellInfo* end, const double min[3], const double iext[3],
+    BucketsType& buckets)
   {
-    const T& start = this->Nodes[index].Start();
-    const T& size = this->Nodes[index].Size();
+    for (const CellInfo* pc = begin; pc != end; ++pc)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
+        double dblIdx = (cen - min[d]) * iext[d];
+        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
+        size_t ind = static_cast<size_t>(dblIdx);
+
+        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Split the node index of nodes, pushing its children on splitStack.
+  void Split(T index, double min[3], double max[3], BucketsType& buckets,
+    std::vector<CellTreeNode<T>>& nodes, std::stack<SplitInfo>& splitStack)
+  {
+    const T& start = nodes[index].Start();
+    const T& size = nodes[index].Size();
 
     if (size < this->NumberOfNodesPerLeaf)
     {
@@ -457,18 +546,23 @@ private:
 
     buckets.Reset();
 
-    for (const CellInfo* pc = begin; pc != end; ++pc)
+    if (size > this->ParallelSize)
     {
-      for (uint8_t d = 0; d < 3; ++d)
+      // The counts and extents of the buckets do not depend on the order in
+      // which the cells are added, so are the same as when binned serially.
+      vtkSMPThreadLocal<BucketsType> localBuckets(BucketsType(this->NumberOfBuckets));
+      vtkSMPTools::For(0, size, [&](vtkIdType first, vtkIdType last) {
+        this->Bin(begin + first, begin + last, min, iext, localBuckets.Local());
+      });
+      for (const BucketsType& threadBuckets : localBuckets)
       {
-        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
-        double dblIdx = (cen - min[d]) * iext[d];
-        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
-        size_t ind = static_cast<size_t>(dblIdx);
-
-        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+        buckets.Merge(threadBuckets);
       }
     }
+    else
+    {
+      this->Bin(begin, end, min, iext, buckets);
+    }
 
     double cost = VTK_DOUBLE_MAX;
     double plane = VTK_DOUBLE_MIN; // bad value in case it doesn't get setx
@@ -546,11 +640,11 @@ private:
     child[0].MakeLeaf(begin - this->CellsInfo.data(), mid - begin);
     child[1].MakeLeaf(mid - this->CellsInfo.data(), end - mid);
 
-    this->Nodes[index].MakeNode(static_cast<T>(this->Nodes.size()), dim, clip);
-    this->Nodes.insert(this->Nodes.end(), child, child + 2);
+    nodes[index].MakeNode(static_cast<T>(nodes.size()), dim, clip);
+    nodes.insert(nodes.end(), child, child + 2);
 
-    this->SplitStack.emplace(this->Nodes[index].GetRightChildIndex(), rMin, rMax);
-    this->SplitStack.emplace(this->Nodes[index].GetLeftChildIndex(), lMin, lMax);
+    splitStack.emplace(nodes[index].GetRightChildIndex(), rMin, rMax);
+    splitStack.emplace(nodes[index].GetLeftChildIndex(), lMin, lMax);
   }
 
 public:
@@ -564,6 +658,9 @@ public:
   {
     const auto numberOfCells = static_cast<T>(this->DataSet->GetNumberOfCells());
     this->CellsInfo.resize(static_cast<size_t>(numberOfCells));
+    this->ParallelSize = std::max(static_cast<T>(numberOfCells /
+                                    (8 * vtkSMPTools::GetEstimatedNumberOfThreads())),
+      static_cast<T>(16384));
 
     double min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
     double max[3] = {
@@ -572,28 +669,27 @@ public:
       -VTK_DOUBLE_MAX,
     };
 
+    // Call GetCellBounds() once so that possible side effects (e.g. building
+    // the cells of the data set) do not happen in parallel.
     double cellBounds[6], *cellBoundsPtr;
     cellBoundsPtr = cellBounds;
-    for (T i = 0; i < numberOfCells; ++i)
-    {
-      this->CellsInfo[i].Ind = i;
-      this->Locator->GetCellBounds(i, cellBoundsPtr);
+    this->Locator->GetCellBounds(0, cellBoundsPtr);
 
-      for (uint8_t d = 0; d < 3; ++d)
+    vtkSMPTools::For(0, numberOfCells, [&](vtkIdType first, vtkIdType last) {
+      double localBounds[6], *localBoundsPtr;
+      for (vtkIdType i = first; i < last; ++i)
       {
-        this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
-        this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
-
-        if (this->CellsInfo[i].Min[d] < min[d])
+        localBoundsPtr = localBounds;
+        this->CellsInfo[i].Ind = static_cast<T>(i);
+        this->Locator->GetCellBounds(i, localBoundsPtr);
+        for (uint8_t d = 0; d < 3; ++d)
         {
-          min[d] = this->CellsInfo[i].Min[d];
-        }
-        if (this->CellsInfo[i].Max[d] > max[d])
-        {
-          max[d] = this->CellsInfo[i].Max[d];
+          this->CellsInfo[i].Min[d] = localBoundsPtr[2 * d + 0];
+          this->CellsInfo[i].Max[d] = localBoundsPtr[2 * d + 1];
         }
       }
-    }
+    });
+    this->FindMinMax(this->CellsInfo.data(), this->CellsInfo.data() + numberOfCells, min, max);
 
     this->Tree.DataBBox[0] = min[0];
     this->Tree.DataBBox[1] = max[0];
@@ -615,14 +711,64 @@ public:
     buckets = BucketsType(this->NumberOfBuckets);
   }
 
+  // Build the tree top-down. The nodes holding many cells are split first,
+  // each split binning the cells in parallel. The remaining nodes are the
+  // roots of disjoint subtrees, holding disjoint ranges of cells, which are
+  // built in parallel and then appended to the nodes. Reduce() orders the
+  // nodes breadth-first, so the tree is the same as if built serially.
   void operator()()
   {
     auto& buckets = this->Buckets;
+    std::vector<Subtree> subtrees;
     while (!this->SplitStack.empty())
     {
       auto splitInfo = std::move(this->SplitStack.top());
       this->SplitStack.pop();
-      this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets);
+      if (this->Nodes[splitInfo.Index].Size() > this->ParallelSize)
+      {
+        this->Split(
+          splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets, this->Nodes, this->SplitStack);
+      }
+      else if (this->Nodes[splitInfo.Index].Size() >= this->NumberOfNodesPerLeaf)
+      {
+        subtrees.emplace_back(splitInfo);
+      }
+    }
+
+    vtkSMPThreadLocal<BucketsType> localBuckets(BucketsType(this->NumberOfBuckets));
+    vtkSMPTools::For(0, static_cast<vtkIdType>(subtrees.size()),
+      [&](vtkIdType first, vtkIdType last) {
+        BucketsType& threadBuckets = localBuckets.Local();
+        std::stack<SplitInfo> splitStack;
+        for (vtkIdType i = first; i < last; ++i)
+        {
+          Subtree& subtree = subtrees[i];
+          subtree.Nodes.push_back(this->Nodes[subtree.Root.Index]);
+          splitStack.emplace(0, subtree.Root.Min, subtree.Root.Max);
+          while (!splitStack.empty())
+          {
+            auto splitInfo = std::move(splitStack.top());
+            splitStack.pop();
+            this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, threadBuckets,
+              subtree.Nodes, splitStack);
+          }
+        }
+      });
+
+    // The root of a subtree replaces its node, the other nodes are appended.
+    for (Subtree& subtree : subtrees)
+    {
+      const T offset = static_cast<T>(this->Nodes.size()) - 1;
+      for (TCellTreeNode& node : subtree.Nodes)
+      {
+        if (node.IsNode())
+        {
+          node.SetChildren(node.GetLeftChildIndex() + offset);
+        }
+      }
+      this->Nodes[subtree.Root.Index] = subtree.Nodes[0];
+      this->Nodes.insert(this->Nodes.end(), subtree.Nodes.begin() + 1, subtree.Nodes.end());
+      std::vector<TCellTreeNode>().swap(subtree.Nodes);
     }
   }
 
@@ -644,12 +790,14 @@ public:
       ni->SetChildren(nn - this->Tree.Nodes.begin() - 2);
     }
 
-    const auto numberOfCells = static_cast<size_t>(this->DataSet->GetNumberOfCells());
-    this->Tree.Leaves.resize(numberOfCells);
-    for (size_t i = 0; i < numberOfCells; ++i)
-    {
-      this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
-    }
+    const auto numberOfCells = static_cast<vtkIdType>(this->DataSet->GetNumberOfCells());
+    this->Tree.Leaves.resize(static_cast<size_t>(numberOfCells));
+    vtkSMPTools::For(0, numberOfCells, [&](vtkIdType first, vtkIdType last) {
+      for (vtkIdType i = first; i < last; ++i)
+      {
+        this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
+      }
+    });
     this->CellsInfo.clear();
   }
 };
@@ -1318,7 +1466,7 @@ void vtkCellTreeLocator::BuildLocatorInternal()
 {
   using namespace detail;
   vtkIdType numCells;
-  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells() < 1))
+  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
   {
     vtkErrorMacro(<< " No Cells in the data set\n");
     return;
@@ -1364,6 +1512,29 @@ vtkIdType vtkCellTreeLocator::FindCell(
   return this->Tree->FindCell(pos, cell, subId, pcoords, weights);
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkCellTreeLocator::FindCellBatched(
+  double x[3], double, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  if (!this->Tree)
+  {
+    return -1;
+  }
+  return this->Tree->FindCell(x, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+int vtkCellTreeLocator::IntersectWithLineBatched(const double p1[3], const double p2[3],
+  double tol, double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+  vtkGenericCell* cell)
+{
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  return this->Tree->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell);
+}
+
 //------------------------------------------------------------------------------
 void vtkCellTreeLocator::FindCellsWithinBounds(double* bbox, vtkIdList* cells)
 {
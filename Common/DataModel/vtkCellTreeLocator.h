@@ -170,6 +170,16 @@ protected:
 
   void BuildLocatorInternal() override;
 
+  ///@{
+  /**
+   * Query the tree directly for the batched queries of vtkAbstractCellLocator.
+   */
+  vtkIdType FindCellBatched(double x[3], double tol2, vtkGenericCell* cell, int& subId,
+    double pcoords[3], double* weights) override;
+  int IntersectWithLineBatched(const double p1[3], const double p2[3], double tol, double& t,
+    double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+  ///@}
+
   int NumberOfBuckets;
   bool LargeIds = false;
 
@@ -34,6 +34,9 @@
 // Constructor with default bounds (0,1, 0,1, 0,1).
 VTK_ABI_NAMESPACE_BEGIN
 vtkDataSet::vtkDataSet()
+  : CachedMTime(0)
+  , MTimeVersion(0)
+  , CachedMTimeVersion(VTK_MTIME_MAX)
 {
   vtkMath::UninitializeBounds(this->Bounds);
   // Observer for updating the cell/point ghost arrays pointers
@@ -44,10 +47,13 @@ vtkDataSet::vtkDataSet()
   this->PointData = vtkPointData::New();
   // when point data is modified, we update the point data ghost array cache
   this->PointData->AddObserver(vtkCommand::ModifiedEvent, this->DataObserver);
+  // when its arrays are modified, we invalidate the cached modification time
+  this->PointData->MTimeOwner = this;
 
   this->CellData = vtkCellData::New();
   // when cell data is modified, we update the cell data ghost array cache
   this->CellData->AddObserver(vtkCommand::ModifiedEvent, this->DataObserver);
+  this->CellData->MTimeOwner = this;
 
   this->ScalarRange[0] = 0.0;
   this->ScalarRange[1] = 1.0;
@@ -57,9 +63,11 @@ vtkDataSet::vtkDataSet()
 vtkDataSet::~vtkDataSet()
 {
   this->PointData->RemoveObserver(this->DataObserver);
+  this->PointData->MTimeOwner = nullptr;
   this->PointData->Delete();
 
   this->CellData->RemoveObserver(this->DataObserver);
+  this->CellData->MTimeOwner = nullptr;
   this->CellData->Delete();
 
   this->DataObserver->Delete();
@@ -335,11 +343,37 @@ vtkMTimeType vtkDataSet::GetMTime()
 
   result = vtkDataObject::GetMTime();
 
-  mtime = this->PointData->GetMTime();
-  result = (mtime > result ? mtime : result);
+  const vtkMTimeType version = this->MTimeVersion.load();
+  if (this->CachedMTimeVersion.load() == version)
+  {
+    mtime = this->CachedMTime.load();
+    return (mtime > result ? mtime : result);
+  }
 
+  vtkMTimeType attributesMTime = this->PointData->GetMTime();
   mtime = this->CellData->GetMTime();
-  return (mtime > result ? mtime : result);
+  attributesMTime = (mtime > attributesMTime ? mtime : attributesMTime);
+
+  // As in vtkFieldData::GetMTime(), the aggregated time only grows while the
+  // set of arrays is unchanged, so keeping the maximum of concurrent results
+  // and storing the version last keeps the cache valid.
+  vtkMTimeType cached = this->CachedMTime.load();
+  while (cached < attributesMTime &&
+    !this->CachedMTime.compare_exchange_weak(cached, attributesMTime))
+  {
+  }
+  this->CachedMTimeVersion = version;
+  return (attributesMTime > result ? attributesMTime : result);
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSet::InvalidateCachedMTime(bool reset)
+{
+  if (reset)
+  {
+    this->CachedMTime = 0;
+  }
+  ++this->MTimeVersion;
 }
 
 //------------------------------------------------------------------------------
@@ -1145,6 +1179,7 @@ void vtkDataSet::OnDataModified(vtkObject* source, unsigned long, void* clientda
 {
   // update the point/cell pointers to ghost data arrays.
   vtkDataSet* This = static_cast<vtkDataSet*>(clientdata);
+  This->InvalidateCachedMTime(false);
   if (source == This->GetPointData())
   {
     This->UpdatePointGhostArrayCache();
@@ -35,6 +35,8 @@
 #include "vtkSmartPointer.h"  // For vtkSmartPointer
 #include "vtkWrappingHints.h" // For VTK_MARSHALAUTO
 
+#include <atomic> // For CachedMTime
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCell;
 class vtkCellData;
@@ -283,7 +285,9 @@ public:
     int& subId, double pcoords[3], double* weights);
 
   /**
-   * Datasets are composite objects and need to check each part for MTime
+   * Datasets are composite objects and need to check each part for MTime.
+   * The time aggregated from the point and cell data is cached until they or
+   * their arrays are modified.
    * THIS METHOD IS THREAD SAFE
    */
   vtkMTimeType GetMTime() override;
@@ -589,7 +593,8 @@ private:
   void InternalDataSetCopy(vtkDataSet* src);
   /**
    * Called when point/cell data is modified
-   * Updates caches to point/cell ghost arrays.
+   * Updates caches to point/cell ghost arrays and invalidates the cached
+   * modification time.
    */
   static void OnDataModified(
     vtkObject* source, unsigned long eid, void* clientdata, void* calldata);
@@ -597,6 +602,24 @@ private:
   // This should only be used if a vtkDataSet subclass don't define GetPoints()
   vtkSmartPointer<vtkPoints> TempPoints;
 
+  friend class vtkFieldData;
+
+  /**
+   * Invalidate the modification time aggregated from the point and cell
+   * data, called when they or their arrays are modified. With reset, also
+   * forget the cached time since it may decrease when their set of arrays
+   * changes.
+   */
+  void InvalidateCachedMTime(bool reset);
+
+  // Modification time aggregated from the point and cell data by
+  // vtkDataSet::GetMTime(). CachedMTimeVersion is the value of MTimeVersion
+  // it was computed for, MTimeVersion being incremented when it becomes
+  // invalid.
+  std::atomic<vtkMTimeType> CachedMTime;
+  std::atomic<vtkMTimeType> MTimeVersion;
+  std::atomic<vtkMTimeType> CachedMTimeVersion;
+
   vtkDataSet(const vtkDataSet&) = delete;
   void operator=(const vtkDataSet&) = delete;
 };
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkFieldData.h"
 
+#include "vtkCallbackCommand.h"
 #include "vtkDataArray.h"
+#include "vtkDataSet.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
 #include "vtkIdList.h"
@@ -11,6 +13,7 @@
 #include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <tuple>
@@ -248,6 +251,15 @@ vtkFieldData::vtkFieldData()
   this->GhostsToSkip = 0;
   this->GhostArray = nullptr;
 
+  // Observer invalidating the cached modification time of the arrays
+  this->ArrayObserver = vtkCallbackCommand::New();
+  this->ArrayObserver->SetCallback(&vtkFieldData::OnArrayModified);
+  this->ArrayObserver->SetClientData(this);
+  this->ArraysMTime = 0;
+  this->ArraysVersion = 0;
+  this->ArraysMTimeVersion = VTK_MTIME_MAX;
+  this->MTimeOwner = nullptr;
+
   this->CopyAllOn();
 }
 
@@ -256,6 +268,7 @@ vtkFieldData::~vtkFieldData()
 {
   this->Initialize();
   this->ClearFieldFlags();
+  this->ArrayObserver->Delete();
 }
 
 //------------------------------------------------------------------------------
@@ -266,6 +279,7 @@ void vtkFieldData::InitializeFields()
   {
     for (int i = 0; i < this->GetNumberOfArrays(); ++i)
     {
+      this->Data[i]->RemoveObserver(this->ArrayObserverTags[i]);
       this->Data[i]->UnRegister(this);
     }
 
@@ -276,6 +290,7 @@ void vtkFieldData::InitializeFields()
   this->GhostArray = nullptr;
   this->NumberOfArrays = 0;
   this->NumberOfActiveArrays = 0;
+  this->InvalidateArraysMTime(true);
   this->Modified();
 }
 
@@ -388,6 +403,7 @@ void vtkFieldData::AllocateArrays(int num)
     {
       if (this->Data[i])
       {
+        this->Data[i]->RemoveObserver(this->ArrayObserverTags[i]);
         this->Data[i]->UnRegister(this);
       }
     }
@@ -398,6 +414,7 @@ void vtkFieldData::AllocateArrays(int num)
     vtkAbstractArray** data = new vtkAbstractArray*[num];
     this->Ranges.resize(num);
     this->FiniteRanges.resize(num);
+    this->ArrayObserverTags.resize(num);
     // copy the original data
     for (int i = 0; i < this->NumberOfArrays; ++i)
     {
@@ -417,6 +434,7 @@ void vtkFieldData::AllocateArrays(int num)
     this->Data = data;
     this->NumberOfArrays = num;
   }
+  this->InvalidateArraysMTime(true);
   this->Modified();
 }
 
@@ -447,10 +465,14 @@ void vtkFieldData::SetArray(int i, vtkAbstractArray* data)
     this->GhostArray = vtkArrayDownCast<vtkUnsignedCharArray>(data);
   }
 
+  // The array may be activated again without being replaced, see ShallowCopy.
+  this->InvalidateArraysMTime(true);
+
   if (this->Data[i] != data)
   {
     if (this->Data[i] != nullptr)
     {
+      this->Data[i]->RemoveObserver(this->ArrayObserverTags[i]);
       this->Data[i]->UnRegister(this);
     }
     this->Data[i] = data;
@@ -476,6 +498,8 @@ void vtkFieldData::SetArray(int i, vtkAbstractArray* data)
       std::get<1>(range[1]) = 0;
       std::get<2>(range[1]).resize(2 * data->GetNumberOfComponents());
       this->Data[i]->Register(this);
+      this->ArrayObserverTags[i] =
+        this->Data[i]->AddObserver(vtkCommand::ModifiedEvent, this->ArrayObserver);
     }
     this->Modified();
   }
@@ -713,6 +737,7 @@ void vtkFieldData::RemoveArray(int index)
   {
     this->GhostArray = nullptr;
   }
+  this->Data[index]->RemoveObserver(this->ArrayObserverTags[index]);
   this->Data[index]->UnRegister(this);
   this->Data[index] = nullptr;
   this->NumberOfActiveArrays--;
@@ -721,10 +746,12 @@ void vtkFieldData::RemoveArray(int index)
     this->Data[i] = this->Data[i + 1];
     this->Ranges[i] = std::move(this->Ranges[i + 1]);
     this->FiniteRanges[i] = std::move(this->FiniteRanges[i + 1]);
+    this->ArrayObserverTags[i] = this->ArrayObserverTags[i + 1];
   }
   this->Ranges[this->NumberOfActiveArrays] = std::array<CachedGhostRangeType, 2>();
   this->FiniteRanges[this->NumberOfActiveArrays] = std::array<CachedGhostRangeType, 2>();
   this->Data[this->NumberOfActiveArrays] = nullptr;
+  this->InvalidateArraysMTime(true);
   this->Modified();
 }
 
@@ -810,20 +837,60 @@ vtkMTimeType vtkFieldData::GetMTime()
 {
   vtkMTimeType mTime = this->MTime;
 
+  // Read before visiting the arrays, so that a modification made meanwhile
+  // invalidates the result.
+  const vtkMTimeType version = this->ArraysVersion.load();
+  if (this->ArraysMTimeVersion.load() == version)
+  {
+    return std::max(mTime, this->ArraysMTime.load());
+  }
+
+  vtkMTimeType arraysMTime = 0;
   for (int i = 0; i < this->NumberOfActiveArrays; ++i)
   {
     vtkAbstractArray* aa = this->Data[i];
     if (aa)
     {
       vtkMTimeType otherMTime = aa->GetMTime();
-      if (otherMTime > mTime)
+      if (otherMTime > arraysMTime)
       {
-        mTime = otherMTime;
+        arraysMTime = otherMTime;
       }
     }
   }
 
-  return mTime;
+  // Concurrent calls may store results computed for older versions. These are
+  // never greater than the current result since modification times only grow
+  // while the set of arrays is unchanged, so keeping the maximum and storing
+  // the version last is enough for a reader seeing the version to get a valid
+  // time.
+  vtkMTimeType cached = this->ArraysMTime.load();
+  while (cached < arraysMTime && !this->ArraysMTime.compare_exchange_weak(cached, arraysMTime))
+  {
+  }
+  this->ArraysMTimeVersion = version;
+
+  return std::max(mTime, arraysMTime);
+}
+
+//------------------------------------------------------------------------------
+void vtkFieldData::InvalidateArraysMTime(bool reset)
+{
+  if (reset)
+  {
+    this->ArraysMTime = 0;
+  }
+  ++this->ArraysVersion;
+  if (this->MTimeOwner)
+  {
+    this->MTimeOwner->InvalidateCachedMTime(reset);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkFieldData::OnArrayModified(vtkObject*, unsigned long, void* clientdata, void*)
+{
+  static_cast<vtkFieldData*>(clientdata)->InvalidateArraysMTime(false);
 }
 
 //------------------------------------------------------------------------------
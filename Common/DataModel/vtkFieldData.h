@@ -38,10 +38,13 @@
 #include "vtkAbstractArray.h" // Needed for inline methods.
 
 #include <array>  // For CachedGhostRangeType
+#include <atomic> // For ArraysMTime
 #include <tuple>  // For CachedGhostRangeType
 #include <vector> // For list indices
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkCallbackCommand;
+class vtkDataSet;
 class vtkIdList;
 class vtkDoubleArray;
 class vtkUnsignedCharArray;
@@ -280,7 +283,9 @@ public:
   virtual unsigned long GetActualMemorySize();
 
   /**
-   * Check object's components for modified times.
+   * Check object's components for modified times. The modification time
+   * aggregated from the arrays is cached until one of them is modified or the
+   * set of arrays changes, so that repeated calls do not visit every array.
    */
   vtkMTimeType GetMTime() override;
 
@@ -476,6 +481,47 @@ private:
   vtkFieldData(const vtkFieldData&) = delete;
   void operator=(const vtkFieldData&) = delete;
 
+  friend class vtkDataSet;
+
+  /**
+   * Invalidate the modification time aggregated from the arrays, and the one
+   * cached by the vtkDataSet owning this object if any. With reset, also
+   * forget the cached time, to be done when the set of arrays changes since
+   * the aggregated time may then decrease.
+   */
+  void InvalidateArraysMTime(bool reset);
+
+  /**
+   * Called when an array is modified.
+   */
+  static void OnArrayModified(
+    vtkObject* source, unsigned long eid, void* clientdata, void* calldata);
+
+  ///@{
+  /**
+   * Observer of the arrays, and the tag of its observation of each of them.
+   */
+  vtkCallbackCommand* ArrayObserver;
+  std::vector<unsigned long> ArrayObserverTags;
+  ///@}
+
+  ///@{
+  /**
+   * Modification time aggregated from the arrays. ArraysVersion is
+   * incremented when it becomes invalid and ArraysMTimeVersion is the version
+   * it was computed for.
+   */
+  std::atomic<vtkMTimeType> ArraysMTime;
+  std::atomic<vtkMTimeType> ArraysVersion;
+  std::atomic<vtkMTimeType> ArraysMTimeVersion;
+  ///@}
+
+  /**
+   * The vtkDataSet holding this object as point or cell data, notified when
+   * the arrays are modified.
+   */
+  vtkDataSet* MTimeOwner;
+
 public:
   class VTKCOMMONDATAMODEL_EXPORT BasicIterator
   {
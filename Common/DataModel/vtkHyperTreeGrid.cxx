@@ -1578,12 +1578,14 @@ void vtkHyperTreeGrid::GetLevelZeroOriginFromIndex(vtkIdType treeindex, double*
   unsigned int i, j, k;
   this->GetLevelZeroCoordinatesFromIndex(treeindex, i, j, k);
 
+  // GetComponent rather than GetTuple1, which is not thread-safe: cursors are
+  // initialized from several threads by the threaded filters.
   vtkDataArray* xCoords = this->XCoordinates;
   vtkDataArray* yCoords = this->YCoordinates;
   vtkDataArray* zCoords = this->ZCoordinates;
-  Origin[0] = xCoords->GetTuple1(i);
-  Origin[1] = yCoords->GetTuple1(j);
-  Origin[2] = zCoords->GetTuple1(k);
+  Origin[0] = xCoords->GetComponent(i, 0);
+  Origin[1] = yCoords->GetComponent(j, 0);
+  Origin[2] = zCoords->GetComponent(k, 0);
 }
 
 //------------------------------------------------------------------------------
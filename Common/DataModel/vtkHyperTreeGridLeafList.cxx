@@ -0,0 +1,280 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkHyperTreeGridLeafList.h"
+
+#include "vtkBitArray.h"
+#include "vtkHyperTree.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridScales.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <numeric>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkHyperTreeGridLeafList);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Cursor-free depth-first traversal of the unmasked leaves of a tree, in the
+// order of the cursors. The origins of the children are computed as in
+// vtkHyperTreeGridGeometryEntry::ToChild, the sizes as in
+// vtkHyperTreeGridScales, so that both are identical to those of a cursor.
+struct LeafTraversal
+{
+  const vtkHyperTree* Tree;
+  const vtkBitArray* Mask;
+  unsigned int DepthLimiter;
+  unsigned int NumberOfChildren;
+  // Offset of each child in units of the child size, 3 per child
+  const double* ChildOffsets;
+  // Size of the cells of each level, 3 per level
+  std::vector<double> Sizes;
+
+  LeafTraversal(vtkHyperTreeGrid* grid, const vtkHyperTree* tree, const double* childOffsets,
+    const double* rootSize)
+    : Tree(tree)
+    , Mask(grid->HasMask() ? grid->GetMask() : nullptr)
+    , DepthLimiter(grid->GetDepthLimiter())
+    , NumberOfChildren(grid->GetNumberOfChildren())
+    , ChildOffsets(childOffsets)
+  {
+    unsigned int numLevels = tree->GetNumberOfLevels();
+    if (this->DepthLimiter < numLevels)
+    {
+      numLevels = this->DepthLimiter + 1;
+    }
+    const double branchFactor = grid->GetBranchFactor();
+    this->Sizes.resize(3 * numLevels);
+    std::copy(rootSize, rootSize + 3, this->Sizes.begin());
+    for (size_t i = 3; i < this->Sizes.size(); ++i)
+    {
+      this->Sizes[i] = this->Sizes[i - 3] / branchFactor;
+    }
+  }
+
+  // Call visitor(globalIndex, level, origin) for each leaf below the node.
+  template <typename VisitorT>
+  void Visit(vtkIdType index, unsigned int level, const double* origin, VisitorT& visitor) const
+  {
+    const vtkIdType globalIndex = this->Tree->GetGlobalIndexFromLocal(index);
+    if (this->Mask && this->Mask->GetValue(globalIndex))
+    {
+      return;
+    }
+    if (level == this->DepthLimiter || this->Tree->IsLeaf(index))
+    {
+      visitor(globalIndex, level, origin);
+      return;
+    }
+    const double* childSize = this->Sizes.data() + 3 * (level + 1);
+    const vtkIdType elder = this->Tree->GetElderChildIndex(index);
+    for (unsigned int ichild = 0; ichild < this->NumberOfChildren; ++ichild)
+    {
+      const double* offset = this->ChildOffsets + 3 * ichild;
+      const double childOrigin[3] = { origin[0] + offset[0] * childSize[0],
+        origin[1] + offset[1] * childSize[1], origin[2] + offset[2] * childSize[2] };
+      this->Visit(elder + ichild, level + 1, childOrigin, visitor);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+struct LeafCounter
+{
+  vtkIdType Count = 0;
+  void operator()(vtkIdType, unsigned int, const double*) { ++this->Count; }
+};
+
+//------------------------------------------------------------------------------
+struct LeafRecorder
+{
+  vtkIdType Leaf;
+  vtkIdType* GlobalIndices;
+  unsigned char* Levels;
+  double* Origins;
+
+  void operator()(vtkIdType globalIndex, unsigned int level, const double* origin)
+  {
+    this->GlobalIndices[this->Leaf] = globalIndex;
+    this->Levels[this->Leaf] = static_cast<unsigned char>(level);
+    std::copy(origin, origin + 3, this->Origins + 3 * this->Leaf);
+    ++this->Leaf;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Offsets of the children of a cell in units of the child size, following
+// the orientation conventions of vtkHyperTreeGridGeometryEntry::ToChild.
+std::vector<double> ComputeChildOffsets(vtkHyperTreeGrid* grid)
+{
+  const unsigned int numChildren = grid->GetNumberOfChildren();
+  const unsigned int bf = grid->GetBranchFactor();
+  std::vector<double> offsets(3 * numChildren, 0.0);
+  unsigned int axis1 = 0;
+  unsigned int axis2 = 1;
+  if (grid->GetDimension() == 2)
+  {
+    switch (grid->GetOrientation())
+    {
+      case 0:
+        axis1 = 1;
+        VTK_FALLTHROUGH;
+      case 1:
+        axis2 = 2;
+    }
+  }
+  for (unsigned int ichild = 0; ichild < numChildren; ++ichild)
+  {
+    double* offset = offsets.data() + 3 * ichild;
+    switch (grid->GetDimension())
+    {
+      case 1:
+        offset[grid->GetOrientation()] = ichild % bf;
+        break;
+      case 2:
+        offset[axis1] = ichild % bf;
+        offset[axis2] = (ichild / bf) % bf;
+        break;
+      default:
+        offset[0] = ichild % bf;
+        offset[1] = (ichild / bf) % bf;
+        offset[2] = ichild / (bf * bf);
+        break;
+    }
+  }
+  return offsets;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkHyperTreeGridLeafList::vtkHyperTreeGridLeafList()
+  : BranchFactor(2.0)
+{
+  this->TreeOffsets.push_back(0);
+}
+
+//------------------------------------------------------------------------------
+vtkHyperTreeGridLeafList::~vtkHyperTreeGridLeafList() = default;
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGridLeafList::Initialize()
+{
+  this->TreeIndices = std::vector<vtkIdType>();
+  this->TreeOffsets = std::vector<vtkIdType>(1, 0);
+  this->TreeSizes = std::vector<double>();
+  this->GlobalIndices = std::vector<vtkIdType>();
+  this->Levels = std::vector<unsigned char>();
+  this->Origins = std::vector<double>();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGridLeafList::Build(vtkHyperTreeGrid* grid)
+{
+  this->Initialize();
+  if (!grid)
+  {
+    return;
+  }
+  this->BranchFactor = grid->GetBranchFactor();
+
+  // Gather the trees with the origin and size of their root cells. This is
+  // done serially as the grid coordinates are read through GetTuple1().
+  std::vector<vtkHyperTree*> trees;
+  std::vector<double> rootOrigins;
+  vtkHyperTree* tree;
+  vtkIdType index;
+  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
+  grid->InitializeTreeIterator(it);
+  while ((tree = it.GetNextTree(index)))
+  {
+    double origin[3], size[3];
+    grid->GetLevelZeroOriginAndSizeFromIndex(index, origin, size);
+    if (tree->HasScales())
+    {
+      tree->GetScales()->GetScale(0, size);
+    }
+    trees.push_back(tree);
+    this->TreeIndices.push_back(index);
+    rootOrigins.insert(rootOrigins.end(), origin, origin + 3);
+    this->TreeSizes.insert(this->TreeSizes.end(), size, size + 3);
+  }
+  const vtkIdType numTrees = static_cast<vtkIdType>(trees.size());
+  const std::vector<double> childOffsets = ComputeChildOffsets(grid);
+
+  // Count the leaves of each tree, then fill their ranges.
+  this->TreeOffsets.resize(numTrees + 1);
+  vtkSMPTools::For(0, numTrees, [&](vtkIdType t, vtkIdType endTree) {
+    for (; t < endTree; ++t)
+    {
+      LeafTraversal traversal(grid, trees[t], childOffsets.data(), &this->TreeSizes[3 * t]);
+      LeafCounter counter;
+      traversal.Visit(0, 0, &rootOrigins[3 * t], counter);
+      this->TreeOffsets[t + 1] = counter.Count;
+    }
+  });
+  std::partial_sum(this->TreeOffsets.begin(), this->TreeOffsets.end(), this->TreeOffsets.begin());
+
+  const vtkIdType numLeaves = this->TreeOffsets.back();
+  this->GlobalIndices.resize(numLeaves);
+  this->Levels.resize(numLeaves);
+  this->Origins.resize(3 * numLeaves);
+  vtkSMPTools::For(0, numTrees, [&](vtkIdType t, vtkIdType endTree) {
+    for (; t < endTree; ++t)
+    {
+      LeafTraversal traversal(grid, trees[t], childOffsets.data(), &this->TreeSizes[3 * t]);
+      LeafRecorder recorder{ this->TreeOffsets[t], this->GlobalIndices.data(),
+        this->Levels.data(), this->Origins.data() };
+      traversal.Visit(0, 0, &rootOrigins[3 * t], recorder);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkHyperTreeGridLeafList::FindTree(vtkIdType leaf) const
+{
+  // Trees without leaves have empty ranges: take the last tree starting at
+  // or before the leaf.
+  auto next = std::upper_bound(this->TreeOffsets.begin(), this->TreeOffsets.end() - 1, leaf);
+  return static_cast<vtkIdType>(next - this->TreeOffsets.begin()) - 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGridLeafList::GetSize(vtkIdType tree, unsigned int level, double size[3]) const
+{
+  // Same sequence of divisions as vtkHyperTreeGridScales
+  std::copy(&this->TreeSizes[3 * tree], &this->TreeSizes[3 * tree] + 3, size);
+  for (unsigned int l = 0; l < level; ++l)
+  {
+    size[0] /= this->BranchFactor;
+    size[1] /= this->BranchFactor;
+    size[2] /= this->BranchFactor;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGridLeafList::GetBounds(vtkIdType tree, vtkIdType leaf, double bounds[6]) const
+{
+  double size[3];
+  this->GetSize(tree, this->GetLevel(leaf), size);
+  const double* origin = this->GetOrigin(leaf);
+  for (int i = 0; i < 3; ++i)
+  {
+    bounds[2 * i] = origin[i];
+    bounds[2 * i + 1] = origin[i] + size[i];
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGridLeafList::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number of Trees: " << this->GetNumberOfTrees() << "\n";
+  os << indent << "Number of Leaves: " << this->GetNumberOfLeaves() << "\n";
+  os << indent << "Branch Factor: " << this->BranchFactor << "\n";
+}
+VTK_ABI_NAMESPACE_END
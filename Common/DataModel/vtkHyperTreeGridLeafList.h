@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkHyperTreeGridLeafList
+ * @brief   flat enumeration of the leaves of a vtkHyperTreeGrid
+ *
+ * vtkHyperTreeGridLeafList gathers the unmasked leaves of a vtkHyperTreeGrid
+ * in flat arrays: for each leaf its global index, its level and the origin
+ * of its cell. The leaves of each tree are stored contiguously, trees in the
+ * order of vtkHyperTreeGrid::vtkHyperTreeGridIterator and leaves in the
+ * depth-first order of the cursors, so that the range of the leaves of a
+ * tree is given by GetTreeBegin() and GetTreeEnd().
+ *
+ * Once built, the leaves can be visited without cursors, e.g., by
+ * vtkSMPTools over the leaves or over the trees, which is the purpose of
+ * this class: cursors are heavyweight objects that cannot be shared between
+ * threads and that are not needed by algorithms processing each leaf
+ * independently of its neighbors.
+ *
+ * Masked cells, and the subtrees of masked coarse cells, are skipped. The
+ * depth limiter of the grid is honored: cells at the depth limit are leaves.
+ * Ghost cells are not skipped.
+ *
+ * The size of a cell depends only on its tree and its level. It is not
+ * stored for each leaf but computed by GetSize() from the size of the root
+ * cell of the tree, as done by the geometry cursors.
+ *
+ * In Filters/HyperTree, the leaf list is used by vtkHyperTreeGridGeometry for
+ * 1D and 2D grids without interface. vtkHyperTreeGridThreshold (MaskInput
+ * strategy) and the pre-pass of vtkHyperTreeGridContour also process the
+ * trees in parallel, but recursively since they need the coarse cells. The
+ * 3D geometry and the contouring itself need the neighbors of each cell: they
+ * process ranges of trees in parallel with one super cursor per thread. The
+ * 1D and 2D geometry with interfaces remains serial, as does the construction
+ * of the vtkHyperTreeGrid itself.
+ *
+ * @warning
+ * The construction has been threaded with vtkSMPTools over the trees. Using
+ * TBB or other non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkHyperTreeGrid vtkHyperTree vtkHyperTreeGridNonOrientedGeometryCursor
+ */
+
+#ifndef vtkHyperTreeGridLeafList_h
+#define vtkHyperTreeGridLeafList_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <vector> // For std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkHyperTreeGrid;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkHyperTreeGridLeafList : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkHyperTreeGridLeafList* New();
+  vtkTypeMacro(vtkHyperTreeGridLeafList, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Enumerate the leaves of the given grid, replacing any previous content.
+   */
+  void Build(vtkHyperTreeGrid* grid);
+
+  /**
+   * Release the memory of the list and make it empty.
+   */
+  void Initialize();
+
+  /**
+   * Return the number of trees of the grid the list was built from.
+   */
+  vtkIdType GetNumberOfTrees() const
+  {
+    return static_cast<vtkIdType>(this->TreeIndices.size());
+  }
+
+  /**
+   * Return the index in the grid of the tree at the given position.
+   */
+  vtkIdType GetTreeIndex(vtkIdType tree) const { return this->TreeIndices[tree]; }
+
+  ///@{
+  /**
+   * Return the range [begin, end) of the leaves of the tree at the given
+   * position.
+   */
+  vtkIdType GetTreeBegin(vtkIdType tree) const { return this->TreeOffsets[tree]; }
+  vtkIdType GetTreeEnd(vtkIdType tree) const { return this->TreeOffsets[tree + 1]; }
+  ///@}
+
+  /**
+   * Return the position of the tree containing the given leaf. This is a
+   * binary search over the trees, useful to start a loop over a range of
+   * leaves; the following trees are then found with GetTreeEnd().
+   */
+  vtkIdType FindTree(vtkIdType leaf) const;
+
+  /**
+   * Return the total number of leaves.
+   */
+  vtkIdType GetNumberOfLeaves() const
+  {
+    return static_cast<vtkIdType>(this->GlobalIndices.size());
+  }
+
+  /**
+   * Return the global index of a leaf, i.e., the index of its cell data.
+   */
+  vtkIdType GetGlobalIndex(vtkIdType leaf) const { return this->GlobalIndices[leaf]; }
+
+  /**
+   * Return the level of a leaf, 0 for a root cell.
+   */
+  unsigned int GetLevel(vtkIdType leaf) const { return this->Levels[leaf]; }
+
+  /**
+   * Return the origin of the cell of a leaf.
+   */
+  const double* GetOrigin(vtkIdType leaf) const { return this->Origins.data() + 3 * leaf; }
+
+  /**
+   * Get the size of the cells of the given level in the tree at the given
+   * position.
+   */
+  void GetSize(vtkIdType tree, unsigned int level, double size[3]) const;
+
+  /**
+   * Get the bounds of the cell of a leaf of the tree at the given position.
+   */
+  void GetBounds(vtkIdType tree, vtkIdType leaf, double bounds[6]) const;
+
+protected:
+  vtkHyperTreeGridLeafList();
+  ~vtkHyperTreeGridLeafList() override;
+
+  double BranchFactor;
+  std::vector<vtkIdType> TreeIndices;
+  std::vector<vtkIdType> TreeOffsets;
+  std::vector<double> TreeSizes;
+  std::vector<vtkIdType> GlobalIndices;
+  std::vector<unsigned char> Levels;
+  std::vector<double> Origins;
+
+private:
+  vtkHyperTreeGridLeafList(const vtkHyperTreeGridLeafList&) = delete;
+  void operator=(const vtkHyperTreeGridLeafList&) = delete;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif
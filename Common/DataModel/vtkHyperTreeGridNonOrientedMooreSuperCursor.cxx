@@ -343,7 +343,7 @@ bool vtkHyperTreeGridNonOrientedMooreSuperCursor::GetCornerCursors(
       owner = false;
     }
     else if (this->GetGrid()->HasMask() &&
-      this->GetGrid()->GetMask()->GetTuple1(cursor.GetGlobalNodeIndex()))
+      this->GetGrid()->GetMask()->GetValue(cursor.GetGlobalNodeIndex()))
     {
       // If neighbor cell is masked, that leaf does Non own the corner
       owner = false;
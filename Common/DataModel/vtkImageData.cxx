@@ -23,6 +23,9 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkVoxel.h"
 
+#include <algorithm>
+#include <cmath>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageData);
 vtkStandardExtendedNewMacro(vtkImageData);
@@ -1079,6 +1082,91 @@ int vtkImageData::ComputeStructuredCoordinates(const double x[3], int ijk[3], do
   return isInBounds;
 }
 
+//------------------------------------------------------------------------------
+// Batched FindCell(). The points are processed in chunks, axis by axis, with
+// the same tests as ComputeStructuredCoordinates() and FindCell() written as
+// straight-line code so that the loops over the points vectorize.
+void vtkImageData::FindCells(vtkIdType numPts, const double* x, double tol2, vtkIdType* cellIds,
+  int* ijk, double* pcoords)
+{
+  // Same floating point error margin as ComputeStructuredCoordinates()
+  const double boundsTol2 = 1e-12;
+  const vtkIdType chunkSize = 256;
+
+  const double* m = this->PhysicalToIndexMatrix->GetData();
+  const int* extent = this->Extent;
+  const double* spacing = this->Spacing;
+  int dims[3];
+  this->GetDimensions(dims);
+  vtkUnsignedCharArray* cellGhosts = this->GetCellGhostArray();
+  vtkUnsignedCharArray* pointGhosts = this->GetPointGhostArray();
+
+  double dist2[chunkSize];
+  unsigned char outside[chunkSize];
+  for (vtkIdType chunk = 0; chunk < numPts; chunk += chunkSize)
+  {
+    const vtkIdType num = std::min(chunkSize, numPts - chunk);
+    const double* xc = x + 3 * chunk;
+    int* ijkc = ijk + 3 * chunk;
+    double* pc = pcoords + 3 * chunk;
+    std::fill_n(dist2, num, 0.0);
+    std::fill_n(outside, num, static_cast<unsigned char>(0));
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double* row = m + 4 * axis;
+      const int minExt = extent[2 * axis];
+      const int maxExt = extent[2 * axis + 1];
+      const bool flat = minExt == maxExt;
+      const double sp = spacing[axis];
+      for (vtkIdType i = 0; i < num; ++i)
+      {
+        const double loc =
+          row[0] * xc[3 * i] + row[1] * xc[3 * i + 1] + row[2] * xc[3 * i + 2] + row[3];
+        const double floorLoc = std::floor(loc);
+        int idx = static_cast<int>(floorLoc);
+        double p = loc - floorLoc;
+        // Points beyond a boundary are clamped on it; when they are farther
+        // than the error margin, their distance is accumulated to be
+        // checked against the tolerance as done by FindCell().
+        double dist = 0.0;
+        if (flat || idx < minExt)
+        {
+          dist = loc - minExt;
+          idx = minExt;
+          p = 0.0;
+        }
+        else if (idx >= maxExt)
+        {
+          dist = loc - maxExt;
+          idx = maxExt - 1;
+          p = 1.0;
+        }
+        const bool beyond = dist * dist > boundsTol2;
+        outside[i] |= beyond;
+        dist2[i] += beyond ? dist * dist * sp * sp : 0.0;
+        ijkc[3 * i + axis] = idx;
+        pc[3 * i + axis] = p;
+      }
+    }
+
+    for (vtkIdType i = 0; i < num; ++i)
+    {
+      vtkIdType cellId = -1;
+      if (!outside[i] || dist2[i] <= tol2)
+      {
+        cellId = vtkStructuredData::ComputeCellIdForExtent(extent, ijkc + 3 * i);
+        if (!vtkStructuredData::IsCellVisible(
+              cellId, dims, this->DataDescription, cellGhosts, pointGhosts))
+        {
+          cellId = -1;
+        }
+      }
+      cellIds[chunk + i] = cellId;
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkImageData::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -12,6 +12,7 @@
 #include "vtkDataSetCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
@@ -23,6 +24,9 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -32,6 +36,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -637,52 +642,54 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     }
   }
 
-  double* weights = new double[maxCellSize];
-
-  float* cptr = center;
-  double dcenter[3];
-
-  if (set)
-  {
-    for (int j = 0; j < totalCells; j++)
+  // The centers of the cells of a data set are computed in parallel. GetCell()
+  // is called once first so that possible side effects (e.g. building the
+  // cells) do not happen in parallel.
+  vtkSMPThreadLocalObject<vtkGenericCell> localCell;
+  vtkSMPThreadLocal<std::vector<double>> localWeights{ std::vector<double>(maxCellSize) };
+  auto computeCenters = [&](vtkDataSet* iset, float* cptr) {
+    vtkIdType nCells = iset->GetNumberOfCells();
+    if (nCells == 0)
     {
-      this->ComputeCellCenter(set->GetCell(j), dcenter, weights);
-      cptr[0] = static_cast<float>(dcenter[0]);
-      cptr[1] = static_cast<float>(dcenter[1]);
-      cptr[2] = static_cast<float>(dcenter[2]);
-      cptr += 3;
-      if (j % 1000 == 0)
+      return;
+    }
+    localCell.Local()->SetCellTypeToEmptyCell();
+    iset->GetCell(0, localCell.Local());
+    vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+      vtkGenericCell* cell = localCell.Local();
+      double* weights = localWeights.Local().data();
+      double dcenter[3];
+      for (vtkIdType j = begin; j < end; j++)
       {
-        this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
+        iset->GetCell(j, cell);
+        this->ComputeCellCenter(cell, dcenter, weights);
+        cptr[3 * j] = static_cast<float>(dcenter[0]);
+        cptr[3 * j + 1] = static_cast<float>(dcenter[1]);
+        cptr[3 * j + 2] = static_cast<float>(dcenter[2]);
       }
-    }
+    });
+  };
+
+  if (set)
+  {
+    computeCenters(set, center);
   }
   else
   {
+    float* cptr = center;
+    int cellsSoFar = 0;
     vtkCollectionSimpleIterator cookie;
     this->DataSets->InitTraversal(cookie);
     for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
          iset = this->DataSets->GetNextDataSet(cookie))
     {
-      int nCells = iset->GetNumberOfCells();
-
-      for (int j = 0; j < nCells; j++)
-      {
-        this->ComputeCellCenter(iset->GetCell(j), dcenter, weights);
-        cptr[0] = static_cast<float>(dcenter[0]);
-        cptr[1] = static_cast<float>(dcenter[1]);
-        cptr[2] = static_cast<float>(dcenter[2]);
-        cptr += 3;
-        if (j % 1000 == 0)
-        {
-          this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-        }
-      }
+      computeCenters(iset, cptr);
+      cptr += 3 * iset->GetNumberOfCells();
+      cellsSoFar += iset->GetNumberOfCells();
+      this->UpdateSubOperationProgress(static_cast<double>(cellsSoFar) / totalCells);
     }
   }
 
-  delete[] weights;
-
   this->UpdateSubOperationProgress(1.0);
   return center;
 }
@@ -912,7 +919,7 @@ void vtkKdTree::BuildLocatorInternal()
 
     this->ProgressOffset += this->ProgressScale;
     this->ProgressScale = 0.7;
-    this->DivideRegion(kd, ptarray, nullptr, 0);
+    this->DivideRegionInParallel(kd, ptarray, nullptr);
 
     TIMERDONE("Build tree");
 
@@ -1255,7 +1262,7 @@ int vtkKdTree::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
-int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+int vtkKdTree::SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level)
 {
   int ok = this->DivideTest(kd->GetNumberOfPoints(), level);
 
@@ -1310,9 +1317,15 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
 
   this->DoMedianFind(kd, c1, ids, dim1, dim2, dim3);
 
-  if (kd->GetLeft() == nullptr)
+  return kd->GetLeft() != nullptr ? 1 : 0; // 0 if unable to divide region further
+}
+
+//------------------------------------------------------------------------------
+int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+{
+  if (!this->SplitRegion(kd, c1, ids, level))
   {
-    return 0; // unable to divide region further
+    return 0;
   }
 
   int nleft = kd->GetLeft()->GetNumberOfPoints();
@@ -1327,6 +1340,62 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
   return 0;
 }
 
+//------------------------------------------------------------------------------
+// The regions of a level are disjoint: they are divided independently of
+// each other, and their centers (and ids) are disjoint ranges of c1 (and
+// ids). Hence the tree is the same as the one built by DivideRegion().
+void vtkKdTree::DivideRegionInParallel(vtkKdNode* kd, float* c1, int* ids)
+{
+  struct Region
+  {
+    vtkKdNode* Node;
+    float* Centers;
+    int* Ids;
+  };
+
+  std::vector<Region> regions(1, Region{ kd, c1, ids });
+  const size_t numberOfSubtrees = 8 * vtkSMPTools::GetEstimatedNumberOfThreads();
+  int level = 0;
+
+  while (!regions.empty() && regions.size() < numberOfSubtrees)
+  {
+    std::vector<Region> divided(2 * regions.size(), Region{ nullptr, nullptr, nullptr });
+    vtkSMPTools::For(0, static_cast<vtkIdType>(regions.size()),
+      [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          const Region& region = regions[i];
+          if (this->SplitRegion(region.Node, region.Centers, region.Ids, level))
+          {
+            int nleft = region.Node->GetLeft()->GetNumberOfPoints();
+            divided[2 * i] = Region{ region.Node->GetLeft(), region.Centers, region.Ids };
+            divided[2 * i + 1] = Region{ region.Node->GetRight(), region.Centers + nleft * 3,
+              region.Ids ? region.Ids + nleft : nullptr };
+          }
+        }
+      });
+
+    // Regions that could not be divided are leaves
+    regions.clear();
+    for (const Region& region : divided)
+    {
+      if (region.Node)
+      {
+        regions.push_back(region);
+      }
+    }
+    ++level;
+  }
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(regions.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        this->DivideRegion(regions[i].Node, regions[i].Centers, regions[i].Ids, level);
+      }
+    });
+}
+
 //------------------------------------------------------------------------------
 // Rearrange the point array.  Try dim1 first.  If there's a problem
 // go to dim2, then dim3.
@@ -1873,7 +1942,7 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
 
   TIMER("Build tree");
 
-  this->DivideRegion(kd, points, ptIds, 0);
+  this->DivideRegionInParallel(kd, points, ptIds);
 
   this->SetActualLevel();
   this->BuildRegionList();
@@ -768,6 +768,15 @@ protected:
 
   int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
 
+  // Divide the region kd in two, without dividing the new regions. Returns 1
+  // if the region was divided.
+  int SplitRegion(vtkKdNode* kd, float* c1, int* ids, int level);
+
+  // Same as DivideRegion() from the root kd. The first levels are divided
+  // level by level, the regions of each level in parallel, then the subtrees
+  // below them are divided in parallel.
+  void DivideRegionInParallel(vtkKdNode* kd, float* c1, int* ids);
+
   void DoMedianFind(vtkKdNode* kd, float* c1, int* ids, int d1, int d2, int d3);
 
   void SelfRegister(vtkKdNode* kd);
@@ -1432,6 +1432,43 @@ int vtkStaticCellLocator::IntersectWithLine(const double p1[3], const double p2[
   return this->Processor->IntersectWithLine(p1, p2, tol, points, cellIds, cell);
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkStaticCellLocator::FindCellBatched(
+  double x[3], double, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  if (!this->Processor)
+  {
+    return -1;
+  }
+  return this->Processor->FindCell(x, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticCellLocator::FindClosestPointBatched(const double x[3], double closestPoint[3],
+  vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2)
+{
+  if (!this->Processor)
+  {
+    cellId = -1;
+    return;
+  }
+  int inside;
+  this->Processor->FindClosestPointWithinRadius(
+    x, vtkMath::Inf(), closestPoint, cell, cellId, subId, dist2, inside);
+}
+
+//------------------------------------------------------------------------------
+int vtkStaticCellLocator::IntersectWithLineBatched(const double p1[3], const double p2[3],
+  double tol, double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId,
+  vtkGenericCell* cell)
+{
+  if (!this->Processor)
+  {
+    return 0;
+  }
+  return this->Processor->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell);
+}
+
 //------------------------------------------------------------------------------
 bool vtkStaticCellLocator::InsideCellBounds(double x[3], vtkIdType cellId)
 {
@@ -222,6 +222,18 @@ protected:
 
   void BuildLocatorInternal() override;
 
+  ///@{
+  /**
+   * Query the bins directly for the batched queries of vtkAbstractCellLocator.
+   */
+  vtkIdType FindCellBatched(double x[3], double tol2, vtkGenericCell* cell, int& subId,
+    double pcoords[3], double* weights) override;
+  void FindClosestPointBatched(const double x[3], double closestPoint[3], vtkGenericCell* cell,
+    vtkIdType& cellId, int& subId, double& dist2) override;
+  int IntersectWithLineBatched(const double p1[3], const double p2[3], double tol, double& t,
+    double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+  ///@}
+
   double Bounds[6]; // Bounding box of the whole dataset
   int Divisions[3]; // Number of sub-divisions in x-y-z directions
   double H[3];      // Width of each bin in x-y-z directions
@@ -11,6 +11,7 @@
 #include "vtkLine.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSMPThreadLocal.h"
@@ -18,6 +19,8 @@
 #include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -101,6 +104,7 @@ struct vtkBucketList
   // Virtuals for templated subclasses
   virtual ~vtkBucketList() = default;
   virtual void BuildLocator() = 0;
+  virtual vtkIdType UpdateLocator() = 0;
 
   // place points in appropriate buckets
   void GetBucketNeighbors(
@@ -474,6 +478,42 @@ struct BucketList : public vtkBucketList
     }
   }
 
+  // Order queries by bucket so that consecutive queries visit the same
+  // buckets. The points of the locator are sorted by bucket already.
+  void ComputeQueryOrder(vtkPoints* queries, vtkIdType* order)
+  {
+    vtkIdType numQueries = queries->GetNumberOfPoints();
+    vtkPointSet* ps = vtkPointSet::SafeDownCast(this->DataSet);
+    if (ps && ps->GetPoints() == queries && numQueries == this->NumPts)
+    {
+      vtkSMPTools::For(0, numQueries, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          order[i] = static_cast<vtkIdType>(this->Map[i].PtId);
+        }
+      });
+      return;
+    }
+
+    std::vector<LocatorTuple<vtkIdType>> tuples(numQueries);
+    vtkSMPTools::For(0, numQueries, [&](vtkIdType begin, vtkIdType end) {
+      double x[3];
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        queries->GetPoint(i, x);
+        tuples[i].PtId = i;
+        tuples[i].Bucket = this->GetBucketIndex(x);
+      }
+    });
+    vtkSMPTools::Sort(tuples.begin(), tuples.end());
+    vtkSMPTools::For(0, numQueries, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        order[i] = tuples[i].PtId;
+      }
+    });
+  }
+
   // Templated implementations of the locator
   vtkIdType FindClosestPoint(const double x[3]);
   vtkIdType FindClosestPointWithinRadius(
@@ -1025,6 +1065,121 @@ struct BucketList : public vtkBucketList
     MapOffsets<TIds> offMapper(this);
     vtkSMPTools::For(0, numBatches, offMapper);
   }
+
+  // Find the entries of the sorted map whose point is now in another bucket.
+  // The positions of these entries in the map and their updated tuples are
+  // returned sorted.
+  template <typename TPointFunctor>
+  void FindMovedPoints(TPointFunctor getPoint, std::vector<vtkIdType>& removed,
+    std::vector<LocatorTuple<TIds>>& inserted)
+  {
+    vtkSMPThreadLocal<std::vector<std::pair<vtkIdType, LocatorTuple<TIds>>>> tlMoved;
+    vtkSMPTools::For(0, this->NumPts, [&](vtkIdType i, vtkIdType end) {
+      auto& moved = tlMoved.Local();
+      double p[3];
+      for (; i < end; ++i)
+      {
+        LocatorTuple<TIds> t = this->Map[i];
+        getPoint(t.PtId, p);
+        const TIds bucket = static_cast<TIds>(this->GetBucketIndex(p));
+        if (bucket != t.Bucket)
+        {
+          t.Bucket = bucket;
+          moved.emplace_back(i, t);
+        }
+      }
+    });
+
+    for (const auto& moved : tlMoved)
+    {
+      for (const auto& entry : moved)
+      {
+        removed.push_back(entry.first);
+        inserted.push_back(entry.second);
+      }
+    }
+    vtkSMPTools::Sort(removed.begin(), removed.end());
+    vtkSMPTools::Sort(inserted.begin(), inserted.end());
+  }
+
+  // Update the map after the points moved, keeping the buckets. Only the
+  // points which changed bucket are sorted; they are then merged with the
+  // other points, which are still sorted, bucket range by bucket range.
+  // Return the number of points which changed bucket.
+  vtkIdType UpdateLocator() override
+  {
+    std::vector<vtkIdType> removed;
+    std::vector<LocatorTuple<TIds>> inserted;
+    vtkPointSet* ps = vtkPointSet::SafeDownCast(this->DataSet);
+    int dataType = ps ? ps->GetPoints()->GetDataType() : VTK_VOID;
+    if (dataType == VTK_FLOAT)
+    {
+      const float* pts = static_cast<float*>(ps->GetPoints()->GetVoidPointer(0));
+      this->FindMovedPoints(
+        [pts](vtkIdType ptId, double p[3]) {
+          p[0] = static_cast<double>(pts[3 * ptId]);
+          p[1] = static_cast<double>(pts[3 * ptId + 1]);
+          p[2] = static_cast<double>(pts[3 * ptId + 2]);
+        },
+        removed, inserted);
+    }
+    else if (dataType == VTK_DOUBLE)
+    {
+      const double* pts = static_cast<double*>(ps->GetPoints()->GetVoidPointer(0));
+      this->FindMovedPoints(
+        [pts](vtkIdType ptId, double p[3]) { std::copy(pts + 3 * ptId, pts + 3 * ptId + 3, p); },
+        removed, inserted);
+    }
+    else
+    {
+      vtkDataSet* ds = this->DataSet;
+      this->FindMovedPoints(
+        [ds](vtkIdType ptId, double p[3]) { ds->GetPoint(ptId, p); }, removed, inserted);
+    }
+    if (inserted.empty())
+    {
+      return 0;
+    }
+
+    // Each range of buckets is written at the same place in the new map by
+    // all threads: it follows the points of the previous buckets which did
+    // not move and the moved points inserted in the previous buckets.
+    LocatorTuple<TIds>* map = new LocatorTuple<TIds>[this->NumPts + 1];
+    map[this->NumPts] = this->Map[this->NumPts];
+    auto bucketLess = [](const LocatorTuple<TIds>& t, vtkIdType bucket) {
+      return static_cast<vtkIdType>(t.Bucket) < bucket;
+    };
+    vtkSMPTools::For(0, this->NumBuckets, [&](vtkIdType bucket, vtkIdType endBucket) {
+      const vtkIdType begin = this->Offsets[bucket];
+      const vtkIdType end = this->Offsets[endBucket];
+      auto ins = std::lower_bound(inserted.begin(), inserted.end(), bucket, bucketLess);
+      auto insEnd = std::lower_bound(ins, inserted.end(), endBucket, bucketLess);
+      auto rem = std::lower_bound(removed.begin(), removed.end(), begin);
+      LocatorTuple<TIds>* out = map + begin - (rem - removed.begin()) + (ins - inserted.begin());
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        if (rem != removed.end() && *rem == i)
+        {
+          ++rem;
+          continue;
+        }
+        for (; ins != insEnd && *ins < this->Map[i]; ++ins)
+        {
+          *out++ = *ins;
+        }
+        *out++ = this->Map[i];
+      }
+      std::copy(ins, insEnd, out);
+    });
+    delete[] this->Map;
+    this->Map = map;
+
+    int numBatches = static_cast<int>(ceil(static_cast<double>(this->NumPts) / this->BatchSize));
+    MapOffsets<TIds> offMapper(this);
+    vtkSMPTools::For(0, numBatches, offMapper);
+
+    return static_cast<vtkIdType>(inserted.size());
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -1919,6 +2074,8 @@ vtkStaticPointLocator::vtkStaticPointLocator()
   this->MaxNumberOfBuckets = VTK_INT_MAX;
   this->LargeIds = false;
   this->TraversalOrder = BIN_ORDER;
+  this->IncrementalUpdate = false;
+  this->NumberOfMovedPoints = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -1958,9 +2115,41 @@ void vtkStaticPointLocator::BuildLocator()
     vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
     return;
   }
+  // only move the points which changed bucket if the points moved
+  if (this->Buckets && this->IncrementalUpdate && this->BuildTime > this->MTime &&
+    this->UpdateLocatorInternal())
+  {
+    return;
+  }
   this->BuildLocatorInternal();
 }
 
+//------------------------------------------------------------------------------
+// Update the locator in place when the points moved but the buckets can be
+// kept, i.e., the number of points is unchanged and all points still lie
+// within the locator bounds. Returns false if a full build is needed.
+bool vtkStaticPointLocator::UpdateLocatorInternal()
+{
+  if (!this->DataSet || this->DataSet != this->Buckets->DataSet ||
+    this->DataSet->GetNumberOfPoints() != this->Buckets->NumPts)
+  {
+    return false;
+  }
+  const double* bounds = this->DataSet->GetBounds();
+  for (int i = 0; i < 3; i++)
+  {
+    if (bounds[2 * i] < this->Bounds[2 * i] || bounds[2 * i + 1] > this->Bounds[2 * i + 1])
+    {
+      return false;
+    }
+  }
+
+  vtkDebugMacro(<< "Updating point buckets...");
+  this->NumberOfMovedPoints = this->Buckets->UpdateLocator();
+  this->BuildTime.Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkStaticPointLocator::ForceBuildLocator()
 {
@@ -2042,6 +2231,7 @@ void vtkStaticPointLocator::BuildLocatorInternal()
 
   // Actually construct the locator
   this->Buckets->BuildLocator();
+  this->NumberOfMovedPoints = numPts;
 
   this->BuildTime.Modified();
 }
@@ -2135,6 +2325,7 @@ void vtkStaticPointLocator::BuildLocator(const double* inBounds)
 
   // Actually construct the locator
   this->Buckets->BuildLocator();
+  this->NumberOfMovedPoints = numPts;
 
   this->BuildTime.Modified();
 }
@@ -2237,6 +2428,23 @@ void vtkStaticPointLocator::FindPointsWithinRadius(double R, const double x[3],
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::ComputeQueryOrder(vtkPoints* queries, vtkIdType* order)
+{
+  if (!this->Buckets)
+  {
+    this->Superclass::ComputeQueryOrder(queries, order);
+  }
+  else if (this->LargeIds)
+  {
+    static_cast<BucketList<vtkIdType>*>(this->Buckets)->ComputeQueryOrder(queries, order);
+  }
+  else
+  {
+    static_cast<BucketList<int>*>(this->Buckets)->ComputeQueryOrder(queries, order);
+  }
+}
+
 //------------------------------------------------------------------------------
 // This method traverses the locator along the defined ray, finding the
 // closest point to a0 when projected onto the line (a0,a1) (i.e., min
@@ -2381,5 +2589,9 @@ void vtkStaticPointLocator::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Large IDs: " << this->LargeIds << "\n";
 
   os << indent << "Traversal Order: " << (this->TraversalOrder ? "On\n" : "Off\n");
+
+  os << indent << "Incremental Update: " << (this->IncrementalUpdate ? "On\n" : "Off\n");
+
+  os << indent << "Number Of Moved Points: " << this->NumberOfMovedPoints << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -282,19 +282,57 @@ public:
   void SetTraversalOrderToBinOrder() { this->SetTraversalOrder(vtkStaticPointLocator::BIN_ORDER); }
   ///@}
 
+  ///@{
+  /**
+   * Enable incremental updates for point sets whose points move while their
+   * number stays constant (e.g., time-dependent simulations). When enabled,
+   * and BuildLocator() is invoked after the points moved, the buckets are
+   * kept and only the points which changed bucket are re-sorted, instead of
+   * rebuilding the locator from scratch. If the number of points changed or
+   * some points left the bounds of the locator, the locator is fully
+   * rebuilt. Since the buckets are not adapted to the new point distribution,
+   * queries may slow down if the points drift far from it; ForceBuildLocator()
+   * always rebuilds from scratch. By default incremental updates are off.
+   */
+  vtkSetMacro(IncrementalUpdate, bool);
+  vtkGetMacro(IncrementalUpdate, bool);
+  vtkBooleanMacro(IncrementalUpdate, bool);
+  ///@}
+
+  /**
+   * Return the number of points which were placed in a new bucket by the
+   * last build of the locator: all the points after a full build, only the
+   * points which changed bucket after an incremental update. This is
+   * useful for diagnostics.
+   */
+  vtkGetMacro(NumberOfMovedPoints, vtkIdType);
+
 protected:
   vtkStaticPointLocator();
   ~vtkStaticPointLocator() override;
 
   void BuildLocatorInternal() override;
 
-  int NumberOfPointsPerBucket;  // Used with AutomaticOn to control subdivide
-  int Divisions[3];             // Number of sub-divisions in x-y-z directions
-  double H[3];                  // Width of each bucket in x-y-z directions
-  vtkBucketList* Buckets;       // Lists of point ids in each bucket
-  vtkIdType MaxNumberOfBuckets; // Maximum number of buckets in locator
-  bool LargeIds;                // indicate whether integer ids are small or large
-  int TraversalOrder;           // Control traversal order when threading
+  /**
+   * Update the buckets after the points moved. Returns false if the locator
+   * must be rebuilt instead.
+   */
+  bool UpdateLocatorInternal();
+
+  /**
+   * Order the queries of the batched queries by bucket.
+   */
+  void ComputeQueryOrder(vtkPoints* queries, vtkIdType* order) override;
+
+  int NumberOfPointsPerBucket;   // Used with AutomaticOn to control subdivide
+  int Divisions[3];              // Number of sub-divisions in x-y-z directions
+  double H[3];                   // Width of each bucket in x-y-z directions
+  vtkBucketList* Buckets;        // Lists of point ids in each bucket
+  vtkIdType MaxNumberOfBuckets;  // Maximum number of buckets in locator
+  bool LargeIds;                 // indicate whether integer ids are small or large
+  int TraversalOrder;            // Control traversal order when threading
+  bool IncrementalUpdate;        // Only move the points which changed bucket
+  vtkIdType NumberOfMovedPoints; // Points placed in a new bucket by last build
 
 private:
   vtkStaticPointLocator(const vtkStaticPointLocator&) = delete;
@@ -19,12 +19,15 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStaticCellLinks.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGridCellIterator.h"
 
 #include <algorithm>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkUnstructuredGrid);
@@ -35,6 +38,9 @@ namespace
 constexpr unsigned char MASKED_CELL_VALUE = vtkDataSetAttributes::HIDDENCELL |
   vtkDataSetAttributes::DUPLICATECELL | vtkDataSetAttributes::REFINEDCELL;
 
+// Size of the cell type counts: any value of the unsigned char Types array.
+constexpr int NumberOfCellTypeValues = VTK_UNSIGNED_CHAR_MAX + 1;
+
 //==============================================================================
 struct RemoveGhostCellsWorker
 {
@@ -252,6 +258,7 @@ vtkUnstructuredGrid::vtkUnstructuredGrid()
   this->Information->Set(vtkDataObject::DATA_NUMBER_OF_GHOST_LEVELS(), 0);
 
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeCountsUpdateMTime = 0;
   this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
   this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
   this->Connectivity = vtkSmartPointer<vtkCellArray>::New();
@@ -294,6 +301,7 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
   this->Types = ug->Types;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeCounts.clear();
   this->Faces = ug->Faces;
   this->FaceLocations = ug->FaceLocations;
 }
@@ -306,6 +314,7 @@ void vtkUnstructuredGrid::Cleanup()
   this->Types = nullptr;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeCounts.clear();
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
 }
@@ -458,6 +467,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(int type, vtkIdList* ptIds
   }
 
   // insert cell type
+  this->CountInsertedCell(type);
   return this->Types->InsertNextValue(static_cast<unsigned char>(type));
 }
 
@@ -506,6 +516,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
       npts, ptIds, realnpts, this->Connectivity, this->Faces, this->FaceLocations);
   }
 
+  this->CountInsertedCell(type);
   return this->Types->InsertNextValue(static_cast<unsigned char>(type));
 }
 
@@ -553,6 +564,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
     faces += npts + 1;
   } // for all faces
 
+  this->CountInsertedCell(type);
   return this->Types->InsertNextValue(static_cast<unsigned char>(type));
 }
 
@@ -594,6 +606,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(
   }
   this->Faces->Append(faces); // all faces
 
+  this->CountInsertedCell(type);
   return this->Types->InsertNextValue(static_cast<unsigned char>(type));
 }
 
@@ -1039,6 +1052,7 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkCellArray
   this->Types = cellTypes;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeCounts.clear();
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
   if (faceLocations != nullptr && faces != nullptr)
@@ -1090,6 +1104,7 @@ void vtkUnstructuredGrid::SetPolyhedralCells(vtkUnsignedCharArray* cellTypes, vt
   this->Types = cellTypes;
   this->DistinctCellTypes = nullptr;
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeCounts.clear();
   this->Faces = faces;
   this->FaceLocations = faceLocations;
   this->LegacyFaces = nullptr;
@@ -1176,6 +1191,7 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
     return this->DistinctCellTypes->GetCellTypesArray();
   }
 
+  this->UpdateCellTypeCounts();
   if (this->DistinctCellTypes == nullptr ||
     this->Types->GetMTime() > this->DistinctCellTypesUpdateMTime)
   {
@@ -1186,10 +1202,15 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
     else
     {
       this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
-      this->DistinctCellTypes->Register(this);
-      this->DistinctCellTypes->Delete();
     }
-    vtkDataSet::GetCellTypes(this->DistinctCellTypes);
+    // The types present in the grid, in increasing order.
+    for (int type = 0; type < NumberOfCellTypeValues; ++type)
+    {
+      if (this->CellTypeCounts[type] > 0)
+      {
+        this->DistinctCellTypes->InsertNextType(static_cast<unsigned char>(type));
+      }
+    }
 
     this->DistinctCellTypesUpdateMTime = this->Types->GetMTime();
   }
@@ -1197,6 +1218,61 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
   return this->DistinctCellTypes->GetCellTypesArray();
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkUnstructuredGrid::GetNumberOfCellsOfType(int type)
+{
+  if (this->Types == nullptr || type < 0 || type >= NumberOfCellTypeValues)
+  {
+    return 0;
+  }
+  this->UpdateCellTypeCounts();
+  return this->CellTypeCounts[type];
+}
+
+//------------------------------------------------------------------------------
+// Count the cells of each type in parallel, unless the counts are up to date.
+void vtkUnstructuredGrid::UpdateCellTypeCounts()
+{
+  if (!this->CellTypeCounts.empty() && this->Types->GetMTime() <= this->CellTypeCountsUpdateMTime)
+  {
+    return;
+  }
+
+  const unsigned char* types = this->Types->GetPointer(0);
+  vtkSMPThreadLocal<std::vector<vtkIdType>> localCounts{ std::vector<vtkIdType>(
+    NumberOfCellTypeValues, 0) };
+  vtkSMPTools::For(0, this->Types->GetNumberOfValues(), [&](vtkIdType begin, vtkIdType end) {
+    std::vector<vtkIdType>& counts = localCounts.Local();
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      ++counts[types[cellId]];
+    }
+  });
+  this->CellTypeCounts.assign(NumberOfCellTypeValues, 0);
+  for (const std::vector<vtkIdType>& counts : localCounts)
+  {
+    for (int type = 0; type < NumberOfCellTypeValues; ++type)
+    {
+      this->CellTypeCounts[type] += counts[type];
+    }
+  }
+  this->CellTypeCountsUpdateMTime = this->Types->GetMTime();
+  // The distinct cell types are derived from the counts.
+  this->DistinctCellTypesUpdateMTime = 0;
+}
+
+//------------------------------------------------------------------------------
+// Keep the counts of the cell types up to date as cells are inserted. A type
+// inserted for the first time changes the distinct cell types.
+void vtkUnstructuredGrid::CountInsertedCell(int type)
+{
+  if (!this->CellTypeCounts.empty() &&
+    this->CellTypeCounts[static_cast<unsigned char>(type)]++ == 0)
+  {
+    this->DistinctCellTypesUpdateMTime = 0;
+  }
+}
+
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkUnstructuredGrid::GetCellTypesArray()
 {
@@ -1371,6 +1447,7 @@ void vtkUnstructuredGrid::Reset()
   {
     this->DistinctCellTypes->Reset();
   }
+  this->CellTypeCounts.clear();
   if (this->Faces)
   {
     this->Faces->Reset();
@@ -1527,6 +1604,7 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->Types = grid->Types;
     this->DistinctCellTypes = nullptr;
     this->DistinctCellTypesUpdateMTime = 0;
+    this->CellTypeCounts.clear();
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
 
@@ -1606,6 +1684,7 @@ void vtkUnstructuredGrid::DeepCopy(vtkDataObject* dataObject)
     {
       this->DistinctCellTypes = nullptr;
     }
+    this->CellTypeCounts.clear();
     if (grid->Faces)
     {
       this->Faces = vtkSmartPointer<vtkCellArray>::New();
@@ -1665,6 +1744,7 @@ bool vtkUnstructuredGrid::AllocateExact(vtkIdType numCells, vtkIdType connectivi
   }
 
   this->DistinctCellTypesUpdateMTime = 0;
+  this->CellTypeCounts.clear();
   this->DistinctCellTypes = vtkSmartPointer<vtkCellTypes>::New();
   this->Types = vtkSmartPointer<vtkUnsignedCharArray>::New();
   this->Connectivity = vtkSmartPointer<vtkCellArray>::New();
@@ -1724,7 +1804,6 @@ struct IsCellBoundaryImpl
     // Now for each cell, see if it contains all the face points
     // in the facePts list. If so, then this is not a boundary face.
     const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-    const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
     bool match;
     vtkIdType j;
     ValueType k;
@@ -1734,8 +1813,8 @@ struct IsCellBoundaryImpl
       if (minCellId != cellId) // don't include current cell
       {
         // get cell points
-        const ValueType nCellPts = offsetsPtr[minCellId + 1] - offsetsPtr[minCellId];
-        const ValueType* cellPts = connectivityPtr + offsetsPtr[minCellId];
+        const ValueType nCellPts = static_cast<ValueType>(state.GetCellSize(minCellId));
+        const ValueType* cellPts = connectivityPtr + state.GetBeginOffset(minCellId);
         match = true;
         for (j = 0; j < nPts && match; ++j) // for all pts in input boundary entity
         {
@@ -1795,7 +1874,6 @@ struct GetCellNeighborsImpl
     // Now for each cell, see if it contains all the face points
     // in the facePts list. If so, then this is not a boundary face.
     const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-    const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
     bool match;
     vtkIdType j;
     ValueType k;
@@ -1805,8 +1883,8 @@ struct GetCellNeighborsImpl
       if (minCellId != cellId) // don't include current cell
       {
         // get cell points
-        const ValueType nCellPts = offsetsPtr[minCellId + 1] - offsetsPtr[minCellId];
-        const ValueType* cellPts = connectivityPtr + offsetsPtr[minCellId];
+        const ValueType nCellPts = static_cast<ValueType>(state.GetCellSize(minCellId));
+        const ValueType* cellPts = connectivityPtr + state.GetBeginOffset(minCellId);
         match = true;
         for (j = 0; j < nPts && match; ++j) // for all pts in input boundary entity
         {
@@ -1910,21 +1988,26 @@ void vtkUnstructuredGrid::GetCellNeighbors(
 //------------------------------------------------------------------------------
 int vtkUnstructuredGrid::IsHomogeneous()
 {
-  unsigned char type;
-  if (this->Types && this->Types->GetMaxId() >= 0)
+  if (!this->Types || this->Types->GetMaxId() < 0)
   {
-    type = Types->GetValue(0);
-    vtkIdType numCells = this->GetNumberOfCells();
-    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    return 0;
+  }
+  const unsigned char type = this->Types->GetValue(0);
+  // The cell type counts are used when they are up to date, but never
+  // computed here so that this method stays read-only.
+  if (!this->CellTypeCounts.empty() && this->Types->GetMTime() <= this->CellTypeCountsUpdateMTime)
+  {
+    return this->CellTypeCounts[type] == this->Types->GetNumberOfValues() ? 1 : 0;
+  }
+  const vtkIdType numCells = this->Types->GetNumberOfValues();
+  for (vtkIdType cellId = 1; cellId < numCells; ++cellId)
+  {
+    if (this->Types->GetValue(cellId) != type)
     {
-      if (this->Types->GetValue(cellId) != type)
-      {
-        return 0;
-      }
+      return 0;
     }
-    return 1;
   }
-  return 0;
+  return 1;
 }
 
 //------------------------------------------------------------------------------
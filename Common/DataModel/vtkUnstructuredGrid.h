@@ -25,6 +25,8 @@
 
 #include "vtkSmartPointer.h" // for smart pointer
 
+#include <vector> // for CellTypeCounts
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
 class vtkIdList;
@@ -147,6 +149,20 @@ public:
    */
   vtkUnsignedCharArray* GetDistinctCellTypesArray();
 
+  /**
+   * Return the number of cells of the given type. The number of cells of each
+   * type is counted in parallel on the first call, then kept up to date as
+   * cells are inserted, and only counted again when the types of the cells
+   * may have changed otherwise. This lets filters check cheaply for a type,
+   * e.g. VTK_POLYHEDRON, and skip the code paths that handle it. The distinct
+   * cell types are derived from these counts, and IsHomogeneous() uses them
+   * when they are up to date.
+   *
+   * THIS METHOD IS THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND
+   * THE DATASET IS NOT MODIFIED
+   */
+  vtkIdType GetNumberOfCellsOfType(int type);
+
   /**
    * A higher-performing variant of the virtual vtkDataSet::GetCellPoints()
    * for unstructured grids. Given a cellId, return the number of defining
@@ -386,7 +402,10 @@ public:
   void GetIdsOfCellsOfType(int type, vtkIdTypeArray* array) override;
 
   /**
-   * Returns whether cells are all of the same type.
+   * Returns whether cells are all of the same type. The cell type counts
+   * (see GetNumberOfCellsOfType()) answer in constant time when they are up
+   * to date; otherwise the cell types are visited until two differ. This
+   * method does not update any cache.
    */
   int IsHomogeneous() override;
 
@@ -569,6 +588,14 @@ protected:
   // updated so we can compare it to the modified time of the Types array.
   vtkMTimeType DistinctCellTypesUpdateMTime;
 
+  // Number of cells of each type, indexed by the type. It is empty until it
+  // is computed, then incremented as cells are inserted. It is recomputed
+  // when the Types array has been modified since CellTypeCountsUpdateMTime.
+  std::vector<vtkIdType> CellTypeCounts;
+  vtkMTimeType CellTypeCountsUpdateMTime;
+  void UpdateCellTypeCounts();
+  void CountInsertedCell(int type);
+
   /**
    *  Special support for polyhedra/cells with explicit face representations.
    * The Faces class represents polygonal faces using a vtkCellArray structure.
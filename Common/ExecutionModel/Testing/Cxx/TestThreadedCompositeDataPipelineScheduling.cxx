@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Compares the scheduling modes of vtkThreadedCompositeDataPipeline on a
+// vtkPartitionedDataSetCollection made of many small blocks and a few large
+// ones, checks that both modes produce the same output, and that the shared
+// thread budget mode starts the blocks in decreasing order of size.
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkElevationFilter.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkThreadedCompositeDataPipeline.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkImageData> MakeBlock(int extent)
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(-extent, extent, -extent, extent, -extent, extent);
+  source->Update();
+  auto block = vtkSmartPointer<vtkImageData>::New();
+  block->ShallowCopy(source->GetOutput());
+  return block;
+}
+
+double Execute(vtkElevationFilter* filter, int mode)
+{
+  auto executive = vtkThreadedCompositeDataPipeline::SafeDownCast(filter->GetExecutive());
+  executive->SetSchedulingMode(mode);
+  filter->Modified();
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  filter->Update();
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+
+bool CompareOutputs(vtkPartitionedDataSetCollection* a, vtkPartitionedDataSetCollection* b)
+{
+  if (a->GetNumberOfPartitionedDataSets() != b->GetNumberOfPartitionedDataSets())
+  {
+    return false;
+  }
+  for (unsigned int i = 0; i < a->GetNumberOfPartitionedDataSets(); ++i)
+  {
+    vtkDataSet* dsA = a->GetPartition(i, 0);
+    vtkDataSet* dsB = b->GetPartition(i, 0);
+    if (!dsA || !dsB || dsA->GetNumberOfPoints() != dsB->GetNumberOfPoints())
+    {
+      return false;
+    }
+    vtkDataArray* elevationA = dsA->GetPointData()->GetArray("Elevation");
+    vtkDataArray* elevationB = dsB->GetPointData()->GetArray("Elevation");
+    if (!elevationA || !elevationB)
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < elevationA->GetNumberOfTuples(); ++j)
+    {
+      if (elevationA->GetTuple1(j) != elevationB->GetTuple1(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// The blocks must start in decreasing order of size, the ones larger than
+// the share of one thread being executed first, one at a time.
+bool CheckBlockOrder(
+  vtkThreadedCompositeDataPipeline* executive, vtkPartitionedDataSetCollection* input)
+{
+  const vtkIdType numberOfBlocks = input->GetNumberOfPartitionedDataSets();
+  std::vector<vtkIdType> sizes(numberOfBlocks);
+  vtkIdType totalSize = 0;
+  for (vtkIdType i = 0; i < numberOfBlocks; ++i)
+  {
+    vtkDataSet* block = input->GetPartition(static_cast<unsigned int>(i), 0);
+    sizes[i] = std::max<vtkIdType>(1, block->GetNumberOfPoints() + block->GetNumberOfCells());
+    totalSize += sizes[i];
+  }
+
+  vtkNew<vtkIdList> order;
+  executive->GetLastBlockOrder(order);
+  const int numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  if (numberOfThreads == 1)
+  {
+    // Nothing to share, the blocks are processed as in BLOCK_PARALLELISM.
+    return order->GetNumberOfIds() == 0;
+  }
+  if (order->GetNumberOfIds() != numberOfBlocks)
+  {
+    vtkLog(ERROR, "Expected " << numberOfBlocks << " scheduled blocks, got "
+                              << order->GetNumberOfIds() << ".");
+    return false;
+  }
+
+  std::vector<bool> scheduled(numberOfBlocks, false);
+  for (vtkIdType i = 0; i < numberOfBlocks; ++i)
+  {
+    const vtkIdType blockId = order->GetId(i);
+    if (blockId < 0 || blockId >= numberOfBlocks || scheduled[blockId] ||
+      (i > 0 && sizes[order->GetId(i - 1)] < sizes[blockId]))
+    {
+      vtkLog(ERROR, "Block " << blockId << " is out of order at position " << i << ".");
+      return false;
+    }
+    scheduled[blockId] = true;
+  }
+
+  const vtkIdType threadShare = totalSize / numberOfThreads;
+  const vtkIdType numberOfSerialBlocks = static_cast<vtkIdType>(std::count_if(
+    sizes.begin(), sizes.end(), [threadShare](vtkIdType size) { return size > threadShare; }));
+  if (executive->GetLastNumberOfSerialBlocks() != numberOfSerialBlocks)
+  {
+    vtkLog(ERROR, "Expected " << numberOfSerialBlocks << " serial blocks, got "
+                              << executive->GetLastNumberOfSerialBlocks() << ".");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestThreadedCompositeDataPipelineScheduling(int, char*[])
+{
+  const int numberOfSmallBlocks = 2000;
+  const int numberOfLargeBlocks = 4;
+
+  vtkNew<vtkPartitionedDataSetCollection> input;
+  vtkSmartPointer<vtkImageData> smallBlock = MakeBlock(4);
+  vtkSmartPointer<vtkImageData> mediumBlock = MakeBlock(12);
+  vtkSmartPointer<vtkImageData> largeBlock = MakeBlock(50);
+  for (int i = 0; i < numberOfSmallBlocks + numberOfLargeBlocks; ++i)
+  {
+    // Interleave the large blocks with the small ones, one small block in
+    // fifty being replaced by a medium one to check the ordering by size.
+    const bool large = i % (numberOfSmallBlocks / numberOfLargeBlocks + 1) == 0;
+    const bool medium = i % 50 == 25;
+    input->SetPartition(i, 0, large ? largeBlock : (medium ? mediumBlock : smallBlock));
+  }
+
+  vtkNew<vtkThreadedCompositeDataPipeline> executive;
+  vtkNew<vtkElevationFilter> filter;
+  filter->SetExecutive(executive);
+  filter->SetInputData(input);
+  filter->SetLowPoint(-50, -50, -50);
+  filter->SetHighPoint(50, 50, 50);
+
+  std::cout << "Backend: " << vtkSMPTools::GetBackend()
+            << ", threads: " << vtkSMPTools::GetEstimatedNumberOfThreads() << std::endl;
+
+  // Warm up the thread pool.
+  Execute(filter, vtkThreadedCompositeDataPipeline::BLOCK_PARALLELISM);
+
+  const double blockTime = Execute(filter, vtkThreadedCompositeDataPipeline::BLOCK_PARALLELISM);
+  vtkNew<vtkPartitionedDataSetCollection> blockOutput;
+  blockOutput->DeepCopy(filter->GetOutputDataObject(0));
+
+  const double sharedTime = Execute(filter, vtkThreadedCompositeDataPipeline::SHARED_THREAD_BUDGET);
+  auto sharedOutput = vtkPartitionedDataSetCollection::SafeDownCast(filter->GetOutputDataObject(0));
+  if (!sharedOutput)
+  {
+    vtkLog(ERROR, "Expected a vtkPartitionedDataSetCollection output.");
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "BLOCK_PARALLELISM: " << blockTime << " s" << std::endl;
+  std::cout << "SHARED_THREAD_BUDGET: " << sharedTime << " s" << std::endl;
+  if (sharedTime > 0)
+  {
+    std::cout << "Speedup: " << blockTime / sharedTime << std::endl;
+  }
+
+  if (!CompareOutputs(blockOutput, sharedOutput))
+  {
+    vtkLog(ERROR, "Scheduling modes produced different outputs.");
+    return EXIT_FAILURE;
+  }
+  if (!CheckBlockOrder(executive, input))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
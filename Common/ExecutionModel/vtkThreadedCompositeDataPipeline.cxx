@@ -17,6 +17,7 @@
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDebugLeaks.h"
+#include "vtkIdList.h"
 #include "vtkImageData.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
@@ -28,7 +29,10 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <numeric>
 #include <vector>
 
 //------------------------------------------------------------------------------
@@ -152,26 +156,52 @@ public:
 
   void operator()(vtkIdType begin, vtkIdType end)
   {
-    vtkInformationVector** inInfoVec = this->InInfoVecs.Local();
-    vtkInformationVector* outInfoVec = this->OutInfoVecs.Local();
-    vtkInformation* request = this->Requests.Local();
+    this->ProcessRange(
+      this->InInfoVecs.Local(), this->OutInfoVecs.Local(), this->Requests.Local(), begin, end);
+  }
 
+  // Process blocks on the calling thread, outside of any parallel section, so
+  // that the algorithm can use all the threads for each of them.
+  void ProcessSerially(vtkIdType begin, vtkIdType end)
+  {
+    if (begin >= end)
+    {
+      return;
+    }
+    vtkInformationVector** inInfoVec = Clone(this->InfoPrototype->In, this->InfoPrototype->InSize);
+    vtkNew<vtkInformationVector> outInfoVec;
+    outInfoVec->Copy(this->InfoPrototype->Out, 1);
+    vtkNew<vtkInformation> request;
+    request->Copy(this->Request, 1);
+    this->ProcessRange(inInfoVec, outInfoVec, request, begin, end);
+    DeleteAll(inInfoVec, this->InfoPrototype->InSize);
+  }
+
+  // When set, the range processed by the functor indexes this array of
+  // block ids instead of the blocks themselves.
+  void SetOrder(const vtkIdType* order) { this->Order = order; }
+
+  void Reduce() {}
+
+protected:
+  void ProcessRange(vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec,
+    vtkInformation* request, vtkIdType begin, vtkIdType end)
+  {
     vtkInformation* inInfo = inInfoVec[this->CompositePort]->GetInformationObject(this->Connection);
+    const int numberOfOutputs = outInfoVec->GetNumberOfInformationObjects();
 
     for (vtkIdType i = begin; i < end; ++i)
     {
+      const vtkIdType blockId = this->Order ? this->Order[i] : i;
       std::vector<vtkDataObject*> outObjList = this->Exec->ExecuteSimpleAlgorithmForBlock(
-        &inInfoVec[0], outInfoVec, inInfo, request, this->InObjs[i]);
-      for (int j = 0; j < outInfoVec->GetNumberOfInformationObjects(); ++j)
+        &inInfoVec[0], outInfoVec, inInfo, request, this->InObjs[blockId]);
+      for (int j = 0; j < numberOfOutputs; ++j)
       {
-        this->OutObjs[i * outInfoVec->GetNumberOfInformationObjects() + j] = outObjList[j];
+        this->OutObjs[blockId * numberOfOutputs + j] = outObjList[j];
       }
     }
   }
 
-  void Reduce() {}
-
-protected:
   vtkThreadedCompositeDataPipeline* Exec;
   vtkInformationVector** InInfoVec;
   vtkInformationVector* OutInfoVec;
@@ -181,12 +211,46 @@ protected:
   vtkInformation* Request;
   const std::vector<vtkDataObject*>& InObjs;
   vtkDataObject** OutObjs;
+  const vtkIdType* Order = nullptr;
 
   vtkSMPThreadLocal<vtkInformationVector**> InInfoVecs;
   vtkSMPThreadLocal<vtkInformationVector*> OutInfoVecs;
   vtkSMPThreadLocalObject<vtkInformation> Requests;
 };
 
+//------------------------------------------------------------------------------
+// Hands the blocks to the threads one at a time, in the order set on the
+// ProcessBlock, from a shared counter: a thread that finishes a block takes
+// the next one. Unlike splitting the range with vtkSMPTools::For(), this
+// guarantees that the blocks start in order.
+class ProcessBlocksInOrder
+{
+public:
+  ProcessBlocksInOrder(ProcessBlock& processBlock, vtkIdType begin, vtkIdType end)
+    : Blocks(processBlock)
+    , Next(begin)
+    , End(end)
+  {
+  }
+
+  void Initialize() { this->Blocks.Initialize(); }
+
+  void operator()(vtkIdType, vtkIdType)
+  {
+    for (vtkIdType i = this->Next++; i < this->End; i = this->Next++)
+    {
+      this->Blocks(i, i + 1);
+    }
+  }
+
+  void Reduce() {}
+
+private:
+  ProcessBlock& Blocks;
+  std::atomic<vtkIdType> Next;
+  vtkIdType End;
+};
+
 //------------------------------------------------------------------------------
 vtkThreadedCompositeDataPipeline::vtkThreadedCompositeDataPipeline() = default;
 
@@ -197,6 +261,19 @@ vtkThreadedCompositeDataPipeline::~vtkThreadedCompositeDataPipeline() = default;
 void vtkThreadedCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "SchedulingMode: "
+     << (this->SchedulingMode == SHARED_THREAD_BUDGET ? "SharedThreadBudget" : "BlockParallelism")
+     << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkThreadedCompositeDataPipeline::GetLastBlockOrder(vtkIdList* order)
+{
+  if (order)
+  {
+    order->SetNumberOfIds(static_cast<vtkIdType>(this->LastBlockOrder.size()));
+    std::copy(this->LastBlockOrder.begin(), this->LastBlockOrder.end(), order->begin());
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -235,7 +312,55 @@ void vtkThreadedCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* ite
   vtkSmartPointer<vtkProgressObserver> origPo(this->Algorithm->GetProgressObserver());
   vtkNew<vtkSMPProgressObserver> po;
   this->Algorithm->SetProgressObserver(po);
-  vtkSMPTools::For(0, static_cast<vtkIdType>(inObjs.size()), processBlock);
+  const vtkIdType numberOfBlocks = static_cast<vtkIdType>(inObjs.size());
+  const int numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  if (this->SchedulingMode == SHARED_THREAD_BUDGET && numberOfThreads > 1)
+  {
+    // Estimate the cost of each block from its size.
+    std::vector<vtkIdType> costs(numberOfBlocks);
+    vtkIdType totalCost = 0;
+    for (vtkIdType i = 0; i < numberOfBlocks; ++i)
+    {
+      costs[i] = std::max<vtkIdType>(1,
+        inObjs[i]->GetNumberOfElements(vtkDataObject::POINT) +
+          inObjs[i]->GetNumberOfElements(vtkDataObject::CELL));
+      totalCost += costs[i];
+    }
+    std::vector<vtkIdType> order(numberOfBlocks);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+      [&costs](vtkIdType a, vtkIdType b) { return costs[a] > costs[b]; });
+
+    // Distributing blocks over the threads cannot balance a block larger than
+    // the share of one thread, the algorithm has to split it instead.
+    const vtkIdType threadShare = totalCost / numberOfThreads;
+    vtkIdType numberOfLargeBlocks = 0;
+    while (numberOfLargeBlocks < numberOfBlocks && costs[order[numberOfLargeBlocks]] > threadShare)
+    {
+      ++numberOfLargeBlocks;
+    }
+
+    this->LastBlockOrder = order;
+    this->LastNumberOfSerialBlocks = numberOfLargeBlocks;
+
+    processBlock.SetOrder(order.data());
+    processBlock.ProcessSerially(0, numberOfLargeBlocks);
+    if (numberOfLargeBlocks < numberOfBlocks)
+    {
+      // The remaining blocks are processed concurrently, largest first, each
+      // one by a single thread. One task per thread pulls the blocks in order.
+      ProcessBlocksInOrder inOrder(processBlock, numberOfLargeBlocks, numberOfBlocks);
+      vtkSMPTools::Config config(numberOfThreads, vtkSMPTools::GetBackend(), false);
+      vtkSMPTools::LocalScope(
+        config, [&]() { vtkSMPTools::For(0, numberOfThreads, 1, inOrder); });
+    }
+  }
+  else
+  {
+    this->LastBlockOrder.clear();
+    this->LastNumberOfSerialBlocks = 0;
+    vtkSMPTools::For(0, numberOfBlocks, processBlock);
+  }
   this->Algorithm->SetProgressObserver(origPo);
 
   int i = 0;
@@ -11,6 +11,18 @@
  * algorithm implement all pipeline passes in a re-entrant way. It should
  * store/retrieve all state changes using input and output information
  * objects, which are unique to each thread.
+ *
+ * By default, the blocks are distributed over the threads and the
+ * algorithm runs on each block with whatever parallelism vtkSMPTools
+ * grants to nested code. In the SHARED_THREAD_BUDGET scheduling mode, the
+ * executive instead shares one thread budget between the two levels:
+ * blocks too large to be balanced across threads are processed one at a
+ * time so that the algorithm can use all the threads internally, and the
+ * remaining blocks are handed to the threads one at a time in decreasing
+ * order of size, with nested parallelism disabled so that the threads are
+ * not oversubscribed. The size of a block is its number of points plus its
+ * number of cells. This keeps the cores busy for inputs made of thousands of
+ * small blocks as well as for inputs made of a few huge ones.
  */
 
 #ifndef vtkThreadedCompositeDataPipeline_h
@@ -19,7 +31,10 @@
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkCompositeDataPipeline.h"
 
+#include <vector> // For LastBlockOrder
+
 VTK_ABI_NAMESPACE_BEGIN
+class vtkIdList;
 class vtkInformationVector;
 class vtkInformation;
 
@@ -38,6 +53,37 @@ public:
   int CallAlgorithm(vtkInformation* request, int direction, vtkInformationVector** inInfo,
     vtkInformationVector* outInfo) override;
 
+  enum SchedulingModes
+  {
+    BLOCK_PARALLELISM = 0,
+    SHARED_THREAD_BUDGET = 1
+  };
+
+  ///@{
+  /**
+   * Set/Get how blocks and the parallelism inside the algorithm share the
+   * threads. BLOCK_PARALLELISM, the default, distributes the blocks over the
+   * threads. SHARED_THREAD_BUDGET balances the threads between the blocks and
+   * the algorithm based on the size of each block.
+   */
+  vtkSetClampMacro(SchedulingMode, int, BLOCK_PARALLELISM, SHARED_THREAD_BUDGET);
+  vtkGetMacro(SchedulingMode, int);
+  void SetSchedulingModeToBlockParallelism() { this->SetSchedulingMode(BLOCK_PARALLELISM); }
+  void SetSchedulingModeToSharedThreadBudget() { this->SetSchedulingMode(SHARED_THREAD_BUDGET); }
+  ///@}
+
+  ///@{
+  /**
+   * Get the schedule of the last execution in the SHARED_THREAD_BUDGET mode.
+   * GetLastBlockOrder() fills the list with the indices of the non-null
+   * blocks, in traversal order, in the order the blocks were started. The
+   * first GetLastNumberOfSerialBlocks() of them were executed one at a time
+   * with all the threads. Both are empty in the BLOCK_PARALLELISM mode.
+   */
+  void GetLastBlockOrder(vtkIdList* order);
+  vtkIdType GetLastNumberOfSerialBlocks() { return this->LastNumberOfSerialBlocks; }
+  ///@}
+
 protected:
   vtkThreadedCompositeDataPipeline();
   ~vtkThreadedCompositeDataPipeline() override;
@@ -45,6 +91,10 @@ protected:
     vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
     std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutput) override;
 
+  int SchedulingMode = BLOCK_PARALLELISM;
+  std::vector<vtkIdType> LastBlockOrder;
+  vtkIdType LastNumberOfSerialBlocks = 0;
+
 private:
   vtkThreadedCompositeDataPipeline(const vtkThreadedCompositeDataPipeline&) = delete;
   void operator=(const vtkThreadedCompositeDataPipeline&) = delete;
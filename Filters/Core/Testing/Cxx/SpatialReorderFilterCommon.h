@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Shuffled datasets shared by the tests of vtkSpatialReorderFilter.
+
+#ifndef SpatialReorderFilterCommon_h
+#define SpatialReorderFilterCommon_h
+
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace SpatialReorderFilterCommon
+{
+//------------------------------------------------------------------------------
+inline std::vector<vtkIdType> RandomPermutation(vtkIdType size, int seed)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(seed);
+  std::vector<vtkIdType> permutation(size);
+  std::iota(permutation.begin(), permutation.end(), 0);
+  for (vtkIdType i = size - 1; i > 0; --i)
+  {
+    const vtkIdType j = static_cast<vtkIdType>(random->GetNextRangeValue(0, i + 1)) % (i + 1);
+    std::swap(permutation[i], permutation[j]);
+  }
+  return permutation;
+}
+
+//------------------------------------------------------------------------------
+// Copy the input to the output with its points and cells, and their
+// attributes, in random order, as they may be after merging many partitions.
+inline void ShuffleGrid(vtkUnstructuredGrid* input, vtkUnstructuredGrid* output, int seed)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const std::vector<vtkIdType> ptIds = RandomPermutation(numPts, seed);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkPointData* inPD = input->GetPointData();
+  vtkPointData* outPD = output->GetPointData();
+  outPD->CopyAllocate(inPD, numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    points->SetPoint(ptIds[ptId], input->GetPoint(ptId));
+    outPD->CopyData(inPD, ptId, ptIds[ptId]);
+  }
+  output->SetPoints(points);
+
+  const vtkIdType numCells = input->GetNumberOfCells();
+  const std::vector<vtkIdType> cellIds = RandomPermutation(numCells, seed + 1);
+  vtkCellData* inCD = input->GetCellData();
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(inCD, numCells);
+  output->Allocate(numCells);
+  vtkNew<vtkIdList> cellPts;
+  for (const vtkIdType cellId : cellIds)
+  {
+    input->GetCellPoints(cellId, cellPts);
+    for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+    {
+      cellPts->SetId(i, ptIds[cellPts->GetId(i)]);
+    }
+    const vtkIdType newCellId = output->InsertNextCell(input->GetCellType(cellId), cellPts);
+    outCD->CopyData(inCD, cellId, newCellId);
+  }
+}
+}
+
+#endif
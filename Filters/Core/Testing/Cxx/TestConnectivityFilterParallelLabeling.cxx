@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that the parallel labeling of vtkConnectivityFilter and
+// vtkPolyDataConnectivityFilter extracts the same cells, with the same region
+// ids and sizes, as the serial traversal in every extraction mode.
+
+#include "vtkAppendPolyData.h"
+#include "vtkCellData.h"
+#include "vtkConnectivityFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPlaneSource.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataConnectivityFilter.h"
+#include "vtkShrinkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+// A plane, a sphere and a plane made of separate cells: many regions, whose
+// points are not in the order of the traversal.
+void MakeFragments(vtkPolyData* fragments)
+{
+  vtkNew<vtkPlaneSource> plane;
+  plane->SetResolution(20, 10);
+  vtkNew<vtkPlaneSource> shrunkPlane;
+  shrunkPlane->SetResolution(15, 15);
+  shrunkPlane->SetCenter(0.0, 0.0, 2.0);
+  vtkNew<vtkShrinkPolyData> shrink;
+  shrink->SetInputConnection(shrunkPlane->GetOutputPort());
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(0.0, 0.0, -2.0);
+
+  vtkNew<vtkAppendPolyData> append;
+  append->AddInputConnection(shrink->GetOutputPort());
+  append->AddInputConnection(sphere->GetOutputPort());
+  append->AddInputConnection(plane->GetOutputPort());
+  append->Update();
+  fragments->ShallowCopy(append->GetOutput());
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("X");
+  scalars->SetNumberOfTuples(fragments->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < fragments->GetNumberOfPoints(); ++ptId)
+  {
+    scalars->SetValue(ptId, fragments->GetPoint(ptId)[0]);
+  }
+  fragments->GetPointData()->SetScalars(scalars);
+}
+
+// Same cells with the same point coordinates, and the same cell region ids if
+// all the cells have been labeled, as the serial traversal does not set them
+// for the cells out of the seeded regions.
+bool CompareOutputs(vtkPolyData* serial, vtkPolyData* parallel, bool seeded, const char* name)
+{
+  if (serial->GetNumberOfCells() != parallel->GetNumberOfCells() ||
+    serial->GetNumberOfPoints() != parallel->GetNumberOfPoints())
+  {
+    std::cerr << name << ": " << parallel->GetNumberOfCells() << " cells and "
+              << parallel->GetNumberOfPoints() << " points, expected "
+              << serial->GetNumberOfCells() << " cells and " << serial->GetNumberOfPoints()
+              << " points." << std::endl;
+    return false;
+  }
+  vtkNew<vtkIdList> serialIds;
+  vtkNew<vtkIdList> parallelIds;
+  for (vtkIdType cellId = 0; cellId < serial->GetNumberOfCells(); ++cellId)
+  {
+    serial->GetCellPoints(cellId, serialIds);
+    parallel->GetCellPoints(cellId, parallelIds);
+    if (serialIds->GetNumberOfIds() != parallelIds->GetNumberOfIds())
+    {
+      std::cerr << name << ": different cell " << cellId << "." << std::endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < serialIds->GetNumberOfIds(); ++i)
+    {
+      double x[3], y[3];
+      serial->GetPoint(serialIds->GetId(i), x);
+      parallel->GetPoint(parallelIds->GetId(i), y);
+      if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+      {
+        std::cerr << name << ": different points for cell " << cellId << "." << std::endl;
+        return false;
+      }
+    }
+  }
+  auto serialRegions = vtkIdTypeArray::SafeDownCast(serial->GetCellData()->GetArray("RegionId"));
+  auto parallelRegions =
+    vtkIdTypeArray::SafeDownCast(parallel->GetCellData()->GetArray("RegionId"));
+  if (!serialRegions != !parallelRegions)
+  {
+    std::cerr << name << ": missing cell region ids." << std::endl;
+    return false;
+  }
+  if (!serialRegions || seeded)
+  {
+    return true;
+  }
+  for (vtkIdType cellId = 0; cellId < serial->GetNumberOfCells(); ++cellId)
+  {
+    if (serialRegions->GetValue(cellId) != parallelRegions->GetValue(cellId))
+    {
+      std::cerr << name << ": region " << parallelRegions->GetValue(cellId) << " for cell "
+                << cellId << ", expected " << serialRegions->GetValue(cellId) << "."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CompareRegionSizes(vtkIdTypeArray* serial, vtkIdTypeArray* parallel, const char* name)
+{
+  if (serial->GetNumberOfValues() != parallel->GetNumberOfValues())
+  {
+    std::cerr << name << ": " << parallel->GetNumberOfValues() << " regions, expected "
+              << serial->GetNumberOfValues() << "." << std::endl;
+    return false;
+  }
+  for (vtkIdType regionId = 0; regionId < serial->GetNumberOfValues(); ++regionId)
+  {
+    if (serial->GetValue(regionId) != parallel->GetValue(regionId))
+    {
+      std::cerr << name << ": wrong size of region " << regionId << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename FilterT>
+void Configure(FilterT* filter, int mode, bool scalars)
+{
+  filter->SetExtractionMode(mode);
+  filter->SetColorRegions(true);
+  // Cells or points of the shrunk plane and of the plane
+  filter->AddSeed(5);
+  filter->AddSeed(mode == VTK_EXTRACT_CELL_SEEDED_REGIONS ? 400 : 1000);
+  filter->AddSpecifiedRegion(2);
+  filter->AddSpecifiedRegion(226);
+  filter->SetClosestPoint(0.1, 0.2, -1.5);
+  filter->SetScalarConnectivity(scalars);
+  filter->SetScalarRange(-0.2, 0.3);
+}
+}
+
+int TestConnectivityFilterParallelLabeling(int, char*[])
+{
+  vtkNew<vtkPolyData> fragments;
+  MakeFragments(fragments);
+
+  bool success = true;
+  for (int mode = VTK_EXTRACT_POINT_SEEDED_REGIONS; mode <= VTK_EXTRACT_CLOSEST_POINT_REGION;
+       ++mode)
+  {
+    const bool seeded = mode == VTK_EXTRACT_POINT_SEEDED_REGIONS ||
+      mode == VTK_EXTRACT_CELL_SEEDED_REGIONS || mode == VTK_EXTRACT_CLOSEST_POINT_REGION;
+    for (bool scalars : { false, true })
+    {
+      vtkNew<vtkConnectivityFilter> serial;
+      vtkNew<vtkConnectivityFilter> parallel;
+      Configure(serial.Get(), mode, scalars);
+      Configure(parallel.Get(), mode, scalars);
+      parallel->ParallelLabelingOn();
+      serial->SetInputData(fragments);
+      parallel->SetInputData(fragments);
+      serial->Update();
+      parallel->Update();
+      const char* name = serial->GetExtractionModeAsString();
+      std::cout << "vtkConnectivityFilter, " << name << (scalars ? " with scalars: " : ": ")
+                << parallel->GetNumberOfExtractedRegions() << " regions." << std::endl;
+      success &= CompareOutputs(serial->GetPolyDataOutput(), parallel->GetPolyDataOutput(), seeded,
+        "vtkConnectivityFilter");
+      success &= parallel->GetNumberOfExtractedRegions() == serial->GetNumberOfExtractedRegions();
+
+      vtkNew<vtkPolyDataConnectivityFilter> pdSerial;
+      vtkNew<vtkPolyDataConnectivityFilter> pdParallel;
+      Configure(pdSerial.Get(), mode, scalars);
+      Configure(pdParallel.Get(), mode, scalars);
+      pdParallel->ParallelLabelingOn();
+      pdSerial->SetInputData(fragments);
+      pdParallel->SetInputData(fragments);
+      pdSerial->Update();
+      pdParallel->Update();
+      success &= CompareOutputs(
+        pdSerial->GetOutput(), pdParallel->GetOutput(), seeded, "vtkPolyDataConnectivityFilter");
+      success &= CompareRegionSizes(
+        pdSerial->GetRegionSizes(), pdParallel->GetRegionSizes(), "vtkPolyDataConnectivityFilter");
+    }
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that inserting the points of vtkDelaunay2D and vtkDelaunay3D in
+// spatially coherent order (SpatialPointInsertion) gives the triangulation
+// obtained in the given order, with and without alpha and bounding
+// triangulation.
+
+#include "vtkCell.h"
+#include "vtkDataSet.h"
+#include "vtkDelaunay2D.h"
+#include "vtkDelaunay3D.h"
+#include "vtkIdList.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <set>
+
+namespace
+{
+using CellKey = std::array<vtkIdType, 5>;
+
+void MakePoints(vtkPolyData* input, vtkIdType numPts, bool planar)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(7);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = random->GetNextRangeValue(-1.0, 1.0);
+    }
+    if (planar)
+    {
+      // A terrain: the triangulation ignores the elevation.
+      x[2] = 0.1 * x[0] * x[1];
+    }
+    points->SetPoint(ptId, x);
+  }
+  input->SetPoints(points);
+}
+
+// The cells as sorted point ids prefixed with their type, which does not
+// depend on the insertion order.
+std::set<CellKey> GetCellKeys(vtkDataSet* output)
+{
+  std::set<CellKey> keys;
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    output->GetCellPoints(cellId, ptIds);
+    CellKey key;
+    key.fill(-1);
+    key[0] = output->GetCellType(cellId);
+    for (vtkIdType i = 0; i < ptIds->GetNumberOfIds() && i < 4; ++i)
+    {
+      key[i + 1] = ptIds->GetId(i);
+    }
+    std::sort(key.begin() + 1, key.end());
+    keys.insert(key);
+  }
+  return keys;
+}
+
+// Both triangulations are unique for random points, up to the few nearly
+// cospherical configurations that the tolerances may resolve differently.
+bool Compare(vtkDataSet* given, vtkDataSet* spatial, const char* name)
+{
+  const std::set<CellKey> givenKeys = GetCellKeys(given);
+  const std::set<CellKey> spatialKeys = GetCellKeys(spatial);
+  std::size_t numShared = 0;
+  for (const CellKey& key : spatialKeys)
+  {
+    numShared += givenKeys.count(key);
+  }
+  const std::size_t numCells = std::max(givenKeys.size(), spatialKeys.size());
+  if (givenKeys.empty() || numShared < 0.99 * numCells)
+  {
+    std::cerr << name << ": " << givenKeys.size() << " cells in given order, "
+              << spatialKeys.size() << " in spatial order, " << numShared << " shared."
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestDelaunay2D(double alpha, bool bounding)
+{
+  vtkNew<vtkPolyData> input;
+  MakePoints(input, 5000, true);
+  vtkNew<vtkDelaunay2D> given;
+  given->SetInputData(input);
+  given->SetAlpha(alpha);
+  given->SetBoundingTriangulation(bounding);
+  given->Update();
+
+  vtkNew<vtkDelaunay2D> spatial;
+  spatial->SetInputData(input);
+  spatial->SetAlpha(alpha);
+  spatial->SetBoundingTriangulation(bounding);
+  spatial->SpatialPointInsertionOn();
+  spatial->Update();
+  return Compare(given->GetOutput(), spatial->GetOutput(), "vtkDelaunay2D");
+}
+
+bool TestDelaunay3D(double alpha, bool bounding)
+{
+  vtkNew<vtkPolyData> input;
+  MakePoints(input, 2000, false);
+  vtkNew<vtkDelaunay3D> given;
+  given->SetInputData(input);
+  given->SetAlpha(alpha);
+  given->SetBoundingTriangulation(bounding);
+  given->Update();
+
+  vtkNew<vtkDelaunay3D> spatial;
+  spatial->SetInputData(input);
+  spatial->SetAlpha(alpha);
+  spatial->SetBoundingTriangulation(bounding);
+  spatial->SpatialPointInsertionOn();
+  spatial->Update();
+  return Compare(given->GetOutput(), spatial->GetOutput(), "vtkDelaunay3D");
+}
+}
+
+int TestDelaunaySpatialPointInsertion(int, char*[])
+{
+  bool success = true;
+  success &= TestDelaunay2D(0.0, false);
+  success &= TestDelaunay2D(0.0, true);
+  success &= TestDelaunay2D(0.05, false);
+  success &= TestDelaunay3D(0.0, false);
+  success &= TestDelaunay3D(0.0, true);
+  success &= TestDelaunay3D(0.2, false);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,418 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks the glyphs generated in parallel by vtkGlyph3D and vtkGlyph2D
+// against their instances (GenerateInstances), with a table of sources,
+// a source transform, hidden points, point ids and cell data, and that the
+// sources are output once. Also checks the vectors of the glyphs following
+// the camera, the serial calls to IsPointVisible(), and the cell order of
+// vtkTensorGlyph.
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGlyph2D.h"
+#include "vtkGlyph3D.h"
+#include "vtkGlyphSource2D.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTable.h"
+#include "vtkTensorGlyph.h"
+#include "vtkTransform.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cmath>
+#include <thread>
+
+namespace
+{
+const vtkIdType NumberOfPoints = 3000;
+
+// Hides the points of odd id, checking that it is called from one thread.
+class OddPointsGlyph3D : public vtkGlyph3D
+{
+public:
+  static OddPointsGlyph3D* New();
+  vtkTypeMacro(OddPointsGlyph3D, vtkGlyph3D);
+
+  int IsPointVisible(vtkDataSet*, vtkIdType ptId) override
+  {
+    if (this->NumberOfCalls++ == 0)
+    {
+      this->Thread = std::this_thread::get_id();
+    }
+    else if (this->Thread != std::this_thread::get_id())
+    {
+      this->Concurrent = true;
+    }
+    return ptId % 2 == 0;
+  }
+
+  vtkIdType NumberOfCalls = 0;
+  std::thread::id Thread;
+  bool Concurrent = false;
+};
+vtkStandardNewMacro(OddPointsGlyph3D);
+
+// Random points with scalars and vectors, every seventh point hidden.
+void MakeInput(vtkPolyData* input)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(5);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(NumberOfPoints);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(NumberOfPoints);
+  vtkNew<vtkFloatArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(NumberOfPoints);
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfTuples(NumberOfPoints);
+  vtkNew<vtkDoubleArray> tensors;
+  tensors->SetName("Tensors");
+  tensors->SetNumberOfComponents(9);
+  tensors->SetNumberOfTuples(NumberOfPoints);
+  for (vtkIdType ptId = 0; ptId < NumberOfPoints; ++ptId)
+  {
+    double x[3], v[3], t[9];
+    for (int i = 0; i < 3; ++i)
+    {
+      x[i] = random->GetNextRangeValue(-10.0, 10.0);
+      v[i] = random->GetNextRangeValue(-1.0, 1.0);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = i; j < 3; ++j)
+      {
+        t[3 * i + j] = t[3 * j + i] = random->GetNextRangeValue(-1.0, 1.0) + (i == j ? 2.0 : 0.0);
+      }
+    }
+    points->SetPoint(ptId, x);
+    scalars->SetValue(ptId, static_cast<float>(random->GetNextRangeValue(0.0, 1.0)));
+    vectors->SetTuple(ptId, v);
+    tensors->SetTuple(ptId, t);
+    ghosts->SetValue(ptId, ptId % 7 ? 0 : vtkDataSetAttributes::HIDDENPOINT);
+  }
+  input->SetPoints(points);
+  input->GetPointData()->SetScalars(scalars);
+  input->GetPointData()->SetVectors(vectors);
+  input->GetPointData()->SetTensors(tensors);
+  input->GetPointData()->AddArray(ghosts);
+}
+
+// Each glyph of the geometry output must be the source of its instance
+// transformed by the matrix of the instance, with the same point id.
+bool CompareInstances(vtkGlyph3D* glyph, bool fillCellData, const char* name)
+{
+  glyph->GeneratePointIdsOn();
+  glyph->SetFillCellData(fillCellData);
+  glyph->GenerateInstancesOff();
+  glyph->Update();
+  vtkNew<vtkPolyData> geometry;
+  geometry->ShallowCopy(glyph->GetOutput());
+  if (glyph->GetOutputDataObject(vtkGlyph3D::INSTANCES_PORT)->GetNumberOfElements(
+        vtkDataObject::ROW) != 0)
+  {
+    std::cerr << name << ": instances generated without GenerateInstances." << std::endl;
+    return false;
+  }
+  glyph->GenerateInstancesOn();
+  glyph->Update();
+  auto instances = vtkTable::SafeDownCast(glyph->GetOutputDataObject(vtkGlyph3D::INSTANCES_PORT));
+  auto sources =
+    vtkPartitionedDataSet::SafeDownCast(glyph->GetOutputDataObject(vtkGlyph3D::SOURCES_PORT));
+  if (!instances || !sources)
+  {
+    std::cerr << name << ": missing instance outputs." << std::endl;
+    return false;
+  }
+
+  // The sources are output once, not once per glyph.
+  vtkPolyData* glyphs = glyph->GetOutput();
+  const int numberOfSources = glyph->GetNumberOfInputConnections(1);
+  vtkIdType numSourcePts = 0;
+  for (int id = 0; id < numberOfSources; ++id)
+  {
+    numSourcePts += glyph->GetSource(id)->GetNumberOfPoints();
+  }
+  if (glyphs->GetNumberOfPoints() != 0 || glyphs->GetNumberOfCells() != 0 ||
+    sources->GetNumberOfPartitions() != static_cast<unsigned int>(numberOfSources) ||
+    sources->GetNumberOfPoints() != numSourcePts)
+  {
+    std::cerr << name << ": the geometry is duplicated in instance mode." << std::endl;
+    return false;
+  }
+
+  auto matrices = vtkDoubleArray::SafeDownCast(instances->GetColumnByName("GlyphTransform"));
+  auto sourceIds = vtkIntArray::SafeDownCast(instances->GetColumnByName("GlyphSourceIndex"));
+  auto instanceIds = vtkIdTypeArray::SafeDownCast(instances->GetColumnByName("InputPointIds"));
+  auto pointIds = vtkIdTypeArray::SafeDownCast(geometry->GetPointData()->GetArray("InputPointIds"));
+  const vtkIdType numVisible = NumberOfPoints - (NumberOfPoints + 6) / 7;
+  if (!matrices || !sourceIds || !instanceIds || !pointIds ||
+    instances->GetNumberOfRows() != numVisible)
+  {
+    std::cerr << name << ": wrong instance output." << std::endl;
+    return false;
+  }
+
+  auto cellScalars = vtkFloatArray::SafeDownCast(geometry->GetCellData()->GetArray("Scalars"));
+  auto input = vtkPolyData::SafeDownCast(glyph->GetInputDataObject(0, 0));
+  auto inScalars = vtkFloatArray::SafeDownCast(input->GetPointData()->GetScalars());
+  if (fillCellData && (!cellScalars || !inScalars))
+  {
+    std::cerr << name << ": missing cell data." << std::endl;
+    return false;
+  }
+
+  vtkIdType ptOffset = 0;
+  vtkIdType cellOffset = 0;
+  vtkIdType previousId = -1;
+  for (vtkIdType instanceId = 0; instanceId < numVisible; ++instanceId)
+  {
+    const vtkIdType inPtId = instanceIds->GetValue(instanceId);
+    if (inPtId <= previousId || inPtId % 7 == 0)
+    {
+      std::cerr << name << ": wrong input point " << inPtId << " for instance " << instanceId
+                << "." << std::endl;
+      return false;
+    }
+    previousId = inPtId;
+
+    vtkPolyData* source =
+      vtkPolyData::SafeDownCast(sources->GetPartition(sourceIds->GetValue(instanceId)));
+    vtkNew<vtkTransform> transform;
+    transform->SetMatrix(matrices->GetPointer(16 * instanceId));
+    for (vtkIdType i = 0; i < source->GetNumberOfPoints(); ++i)
+    {
+      double p[3], q[3];
+      source->GetPoint(i, p);
+      transform->TransformPoint(p, p);
+      geometry->GetPoint(ptOffset + i, q);
+      if (std::sqrt(vtkMath::Distance2BetweenPoints(p, q)) > 1e-4 ||
+        pointIds->GetValue(ptOffset + i) != inPtId)
+      {
+        std::cerr << name << ": point " << i << " of instance " << instanceId << " is "
+                  << q[0] << " " << q[1] << " " << q[2] << ", expected " << p[0] << " " << p[1]
+                  << " " << p[2] << "." << std::endl;
+        return false;
+      }
+    }
+    for (vtkIdType i = 0; fillCellData && i < source->GetNumberOfCells(); ++i)
+    {
+      if (cellScalars->GetValue(cellOffset + i) != inScalars->GetValue(inPtId))
+      {
+        std::cerr << name << ": wrong cell data for instance " << instanceId << "." << std::endl;
+        return false;
+      }
+    }
+    ptOffset += source->GetNumberOfPoints();
+    cellOffset += source->GetNumberOfCells();
+  }
+  if (ptOffset != geometry->GetNumberOfPoints() || cellOffset != geometry->GetNumberOfCells())
+  {
+    std::cerr << name << ": " << geometry->GetNumberOfPoints() << " points and "
+              << geometry->GetNumberOfCells() << " cells, expected " << ptOffset << " and "
+              << cellOffset << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool CheckGlyph3D(vtkPolyData* input)
+{
+  vtkNew<vtkSphereSource> small;
+  small->SetThetaResolution(6);
+  small->SetPhiResolution(4);
+  vtkNew<vtkSphereSource> large;
+  large->SetThetaResolution(12);
+  large->SetPhiResolution(8);
+  vtkNew<vtkTransform> sourceTransform;
+  sourceTransform->Translate(0.5, 0.0, 0.0);
+  sourceTransform->RotateZ(30.0);
+
+  // A table of glyphs indexed by scalar, oriented and scaled by vector
+  vtkNew<vtkGlyph3D> indexed;
+  indexed->SetInputData(input);
+  indexed->SetSourceConnection(0, small->GetOutputPort());
+  indexed->SetSourceConnection(1, large->GetOutputPort());
+  indexed->SetIndexModeToScalar();
+  indexed->SetScaleModeToScaleByVector();
+  indexed->SetScaleFactor(0.5);
+  indexed->SetSourceTransform(sourceTransform);
+  bool success = CompareInstances(indexed, false, "vtkGlyph3D (indexed)");
+
+  // A single glyph scaled by scalar, with cell data
+  vtkNew<vtkGlyph3D> single;
+  single->SetInputData(input);
+  single->SetSourceConnection(large->GetOutputPort());
+  single->SetColorModeToColorByScalar();
+  success &= CompareInstances(single, true, "vtkGlyph3D");
+  return success;
+}
+
+// IsPointVisible() is called once per point, serially, and the points it
+// hides are not glyphed.
+bool CheckPointVisibility(vtkPolyData* input)
+{
+  vtkNew<OddPointsGlyph3D> glyph;
+  glyph->SetInputData(input);
+  glyph->GeneratePointIdsOn();
+  glyph->Update();
+  auto pointIds =
+    vtkIdTypeArray::SafeDownCast(glyph->GetOutput()->GetPointData()->GetArray("InputPointIds"));
+  const vtkIdType numGhosts = (NumberOfPoints + 6) / 7;
+  if (glyph->NumberOfCalls != NumberOfPoints - numGhosts || glyph->Concurrent || !pointIds)
+  {
+    std::cerr << "IsPointVisible: " << glyph->NumberOfCalls << " calls"
+              << (glyph->Concurrent ? " from several threads" : "") << "." << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < pointIds->GetNumberOfValues(); ++i)
+  {
+    if (pointIds->GetValue(i) % 2 != 0)
+    {
+      std::cerr << "IsPointVisible: hidden point " << pointIds->GetValue(i) << " is glyphed."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Following the camera, the vector of each glyph is the direction to the
+// camera of the previous glyph, zero for the first glyph.
+bool CheckFollowCamera(vtkPolyData* input)
+{
+  const double camera[3] = { 1.0, 2.0, 30.0 };
+  vtkNew<vtkGlyph3D> glyph;
+  glyph->SetInputData(input);
+  glyph->SetVectorModeToFollowCameraDirection();
+  glyph->SetFollowedCameraPosition(camera);
+  glyph->GeneratePointIdsOn();
+  glyph->Update();
+  vtkPolyData* output = glyph->GetOutput();
+  vtkDataArray* vectors = output->GetPointData()->GetArray("GlyphVector");
+  auto pointIds = vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("InputPointIds"));
+  if (!vectors || !pointIds)
+  {
+    std::cerr << "Follow camera: missing arrays." << std::endl;
+    return false;
+  }
+  double expected[3] = { 0.0, 0.0, 0.0 };
+  vtkIdType previousId = -1;
+  for (vtkIdType i = 0; i < output->GetNumberOfPoints(); ++i)
+  {
+    const vtkIdType inPtId = pointIds->GetValue(i);
+    if (inPtId != previousId && previousId >= 0)
+    {
+      double x[3];
+      input->GetPoint(previousId, x);
+      vtkMath::Subtract(camera, x, expected);
+      vtkMath::Normalize(expected);
+    }
+    previousId = inPtId;
+    double v[3];
+    vectors->GetTuple(i, v);
+    if (std::sqrt(vtkMath::Distance2BetweenPoints(v, expected)) > 1e-6)
+    {
+      std::cerr << "Follow camera: wrong vector for point " << inPtId << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CheckGlyph2D(vtkPolyData* input)
+{
+  vtkNew<vtkGlyphSource2D> arrow;
+  arrow->SetGlyphTypeToArrow();
+  arrow->FilledOff();
+  vtkNew<vtkGlyph2D> glyph;
+  glyph->SetInputData(input);
+  glyph->SetSourceConnection(arrow->GetOutputPort());
+  glyph->SetScaleModeToScaleByVector();
+  return CompareInstances(glyph, false, "vtkGlyph2D");
+}
+
+// The points of vtkTensorGlyph are ordered by input point, then by
+// direction, each direction being a copy of the source. The cells are
+// ordered by input point, then by source cell, then by direction.
+bool CheckTensorGlyph(vtkPolyData* input)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(8);
+  sphere->SetPhiResolution(6);
+  sphere->Update();
+  vtkPolyData* source = sphere->GetOutput();
+  vtkNew<vtkTensorGlyph> glyph;
+  glyph->SetInputData(input);
+  glyph->SetSourceConnection(sphere->GetOutputPort());
+  glyph->ThreeGlyphsOn();
+  glyph->SymmetricOn();
+  glyph->SetColorModeToEigenvalues();
+  glyph->Update();
+  vtkPolyData* output = glyph->GetOutput();
+
+  const int numDirs = 6;
+  const vtkIdType numGlyphs = numDirs * NumberOfPoints;
+  const vtkIdType numSourcePts = source->GetNumberOfPoints();
+  const vtkIdType numSourcePolys = source->GetNumberOfPolys();
+  if (output->GetNumberOfPoints() != numGlyphs * numSourcePts ||
+    output->GetNumberOfPolys() != numGlyphs * numSourcePolys ||
+    !output->GetPointData()->GetArray("MaxEigenvalue") || !output->GetPointData()->GetNormals())
+  {
+    std::cerr << "vtkTensorGlyph: wrong output." << std::endl;
+    return false;
+  }
+  auto iter = vtk::TakeSmartPointer(output->GetPolys()->NewIterator());
+  auto sourceIter = vtk::TakeSmartPointer(source->GetPolys()->NewIterator());
+  vtkIdType npts, sourceNpts;
+  const vtkIdType *pts, *sourcePts;
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    const vtkIdType cellId = iter->GetCurrentCellId();
+    const vtkIdType inPtId = cellId / (numDirs * numSourcePolys);
+    const vtkIdType glyphId = inPtId * numDirs + cellId % numDirs;
+    iter->GetCurrentCell(npts, pts);
+    sourceIter->GetCellAtId((cellId / numDirs) % numSourcePolys, sourceNpts, sourcePts);
+    bool same = npts == sourceNpts;
+    for (vtkIdType i = 0; i < npts && same; ++i)
+    {
+      same = pts[i] == sourcePts[i] + glyphId * numSourcePts;
+    }
+    if (!same)
+    {
+      std::cerr << "vtkTensorGlyph: wrong polygon " << cellId << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestGlyphInstances(int, char*[])
+{
+  vtkNew<vtkPolyData> input;
+  MakeInput(input);
+  bool success = CheckGlyph3D(input);
+  success &= CheckGlyph2D(input);
+  success &= CheckPointVisibility(input);
+  success &= CheckFollowCamera(input);
+  success &= CheckTensorGlyph(input);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
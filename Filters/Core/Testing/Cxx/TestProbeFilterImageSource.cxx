@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks the batched location of points in images, vtkImageData::FindCells(),
+// against FindCell(), and the probing of oriented images of dimension 1, 2
+// and 3 with vtkProbeFilter, which uses it.
+
+#include "vtkCellData.h"
+#include "vtkCharArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkProbeFilter.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+const vtkIdType NumberOfProbes = 5000;
+
+// A linear field, interpolated exactly by the trilinear interpolation.
+double Field(const double x[3])
+{
+  return 1.0 + 2.0 * x[0] - 3.0 * x[1] + 0.5 * x[2];
+}
+
+void MakeImage(vtkImageData* image, int extent[6], const double direction[9])
+{
+  image->SetExtent(extent);
+  image->SetOrigin(0.5, -1.0, 2.0);
+  image->SetSpacing(0.5, 0.25, 2.0);
+  image->SetDirectionMatrix(direction);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Field");
+  scalars->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < image->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    image->GetPoint(ptId, x);
+    scalars->SetValue(ptId, Field(x));
+  }
+  image->GetPointData()->SetScalars(scalars);
+
+  // Blank a cell
+  if (image->GetNumberOfCells() == 1)
+  {
+    return;
+  }
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  ghosts->SetNumberOfTuples(image->GetNumberOfCells());
+  ghosts->FillValue(0);
+  ghosts->SetValue(image->GetNumberOfCells() / 2, vtkDataSetAttributes::HIDDENCELL);
+  image->GetCellData()->AddArray(ghosts);
+}
+
+// Random points around the image, some of them outside, some of them on its
+// boundary.
+void MakeProbes(vtkImageData* image, vtkPoints* points)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(3);
+  const int* extent = image->GetExtent();
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(NumberOfProbes);
+  for (vtkIdType ptId = 0; ptId < NumberOfProbes; ++ptId)
+  {
+    double index[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double minExt = extent[2 * axis];
+      const double maxExt = extent[2 * axis + 1];
+      index[axis] = random->GetNextRangeValue(minExt - 0.5, maxExt + 0.5);
+      if (ptId % 7 == 0)
+      {
+        index[axis] = ptId % 2 ? minExt : maxExt;
+      }
+      else if (minExt == maxExt && ptId % 3)
+      {
+        index[axis] = minExt;
+      }
+    }
+    double x[3];
+    image->TransformContinuousIndexToPhysicalPoint(index, x);
+    points->SetPoint(ptId, x);
+  }
+}
+
+bool CheckFindCells(vtkImageData* image, vtkPoints* points, const char* name)
+{
+  const double tol2 = 1e-3;
+  std::vector<vtkIdType> cellIds(NumberOfProbes);
+  std::vector<int> ijk(3 * NumberOfProbes);
+  std::vector<double> pcoords(3 * NumberOfProbes);
+  const double* x = vtkDoubleArray::SafeDownCast(points->GetData())->GetPointer(0);
+  image->FindCells(NumberOfProbes, x, tol2, cellIds.data(), ijk.data(), pcoords.data());
+
+  vtkIdType numFound = 0;
+  for (vtkIdType ptId = 0; ptId < NumberOfProbes; ++ptId)
+  {
+    double point[3];
+    points->GetPoint(ptId, point);
+    int subId;
+    double pc[3], weights[8];
+    const vtkIdType cellId = image->FindCell(point, nullptr, -1, tol2, subId, pc, weights);
+    if (cellId != cellIds[ptId])
+    {
+      std::cerr << name << ": FindCells() gives cell " << cellIds[ptId] << " for point " << ptId
+                << ", FindCell() gives " << cellId << "." << std::endl;
+      return false;
+    }
+    numFound += cellId >= 0;
+  }
+  if (numFound == 0 || numFound == NumberOfProbes)
+  {
+    std::cerr << name << ": the probes should be partly inside the image." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool CheckProbe(vtkImageData* image, vtkPoints* points, const char* name)
+{
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  vtkNew<vtkProbeFilter> probe;
+  probe->SetInputData(input);
+  probe->SetSourceData(image);
+  probe->Update();
+
+  vtkDataSet* output = probe->GetOutput();
+  auto field = vtkDoubleArray::SafeDownCast(output->GetPointData()->GetArray("Field"));
+  auto mask = vtkCharArray::SafeDownCast(output->GetPointData()->GetArray("vtkValidPointMask"));
+  if (!field || !mask)
+  {
+    std::cerr << name << ": missing output arrays." << std::endl;
+    return false;
+  }
+  for (vtkIdType ptId = 0; ptId < NumberOfProbes; ++ptId)
+  {
+    double x[3];
+    points->GetPoint(ptId, x);
+    // Points found without tolerance must be found by the probe.
+    int subId;
+    double pcoords[3], weights[8];
+    const bool found = image->FindCell(x, nullptr, -1, 1e-12, subId, pcoords, weights) >= 0;
+    if (found && (!mask->GetValue(ptId) || std::abs(field->GetValue(ptId) - Field(x)) > 1e-9))
+    {
+      std::cerr << name << ": wrong value " << field->GetValue(ptId) << " at point " << ptId
+                << ", expected " << Field(x) << "." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestProbeFilterImageSource(int, char*[])
+{
+  // A rotation about (1, 1, 1)
+  const double rotation[9] = { 0.0, 0.0, 1.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0 };
+  const double identity[9] = { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+  int extents[4][6] = { { -2, 10, 0, 8, 3, 9 }, { 0, 12, 4, 4, -3, 5 }, { 1, 1, 0, 20, 0, 0 },
+    { 0, 0, 0, 0, 0, 0 } };
+  const char* names[4] = { "volume", "XZ plane", "Y line", "single point" };
+
+  bool success = true;
+  for (int i = 0; i < 4; ++i)
+  {
+    for (const double* direction : { identity, rotation })
+    {
+      vtkNew<vtkImageData> image;
+      MakeImage(image, extents[i], direction);
+      vtkNew<vtkPoints> points;
+      MakeProbes(image, points);
+      success &= CheckFindCells(image, points, names[i]);
+      success &= CheckProbe(image, points, names[i]);
+    }
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
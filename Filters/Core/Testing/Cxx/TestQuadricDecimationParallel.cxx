@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks the parallel mode of vtkQuadricDecimation against the serial one: the
+// target reduction must be reached with valid triangles, a similar number of
+// cells, and consistent statistics of the rounds.
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkQuadricDecimation.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+vtkIdType Decimate(vtkPolyData* input, bool parallel, bool attributes, vtkPolyData* output,
+  vtkQuadricDecimation* decimator)
+{
+  decimator->SetInputData(input);
+  decimator->SetTargetReduction(0.9);
+  decimator->SetVolumePreservation(true);
+  decimator->SetMapPointData(true);
+  decimator->SetAttributeErrorMetric(attributes);
+  decimator->SetParallelCollapse(parallel);
+  decimator->Update();
+  output->ShallowCopy(decimator->GetOutput());
+  return output->GetNumberOfCells();
+}
+
+bool CheckTriangles(vtkPolyData* output)
+{
+  const vtkIdType* pts;
+  vtkIdType npts;
+  auto iter = vtk::TakeSmartPointer(output->GetPolys()->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    if (npts != 3 || pts[0] == pts[1] || pts[1] == pts[2] || pts[2] == pts[0])
+    {
+      std::cerr << "Invalid triangle " << iter->GetCurrentCellId() << "." << std::endl;
+      return false;
+    }
+  }
+  return output->GetNumberOfCells() == output->GetNumberOfPolys();
+}
+
+bool CheckRounds(vtkQuadricDecimation* decimator)
+{
+  const int numRounds = decimator->GetNumberOfCollapseRounds();
+  if (numRounds == 0)
+  {
+    std::cerr << "No collapse round." << std::endl;
+    return false;
+  }
+  double reduction = 0.0;
+  for (int round = 0; round < numRounds; ++round)
+  {
+    if (decimator->GetRoundReduction(round) < reduction ||
+      decimator->GetRoundMaximumCost(round) < 0.0)
+    {
+      std::cerr << "Inconsistent statistics for round " << round << "." << std::endl;
+      return false;
+    }
+    reduction = decimator->GetRoundReduction(round);
+  }
+  if (reduction != decimator->GetActualReduction())
+  {
+    std::cerr << "The reduction of the last round is " << reduction << ", expected "
+              << decimator->GetActualReduction() << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestQuadricDecimationParallel(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(80);
+  sphere->SetPhiResolution(80);
+  sphere->Update();
+  vtkNew<vtkPolyData> input;
+  input->ShallowCopy(sphere->GetOutput());
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(input->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    input->GetPoint(ptId, x);
+    scalars->SetValue(ptId, std::sin(3.0 * (x[0] + x[1] + x[2])));
+  }
+  input->GetPointData()->SetScalars(scalars);
+
+  bool success = true;
+  for (bool attributes : { false, true })
+  {
+    vtkNew<vtkQuadricDecimation> serial;
+    vtkNew<vtkPolyData> serialOutput;
+    const vtkIdType numSerialCells = Decimate(input, false, attributes, serialOutput, serial);
+    if (serial->GetNumberOfCollapseRounds() != 0)
+    {
+      std::cerr << "The serial decimation should not report rounds." << std::endl;
+      success = false;
+    }
+
+    vtkNew<vtkQuadricDecimation> parallel;
+    vtkNew<vtkPolyData> parallelOutput;
+    const vtkIdType numCells = Decimate(input, true, attributes, parallelOutput, parallel);
+    std::cout << "Attribute error metric " << (attributes ? "on" : "off") << ": " << numCells
+              << " cells in " << parallel->GetNumberOfCollapseRounds() << " rounds, "
+              << numSerialCells << " cells serially." << std::endl;
+
+    if (parallel->GetActualReduction() < parallel->GetTargetReduction())
+    {
+      std::cerr << "Target reduction not achieved: " << parallel->GetActualReduction() << "."
+                << std::endl;
+      success = false;
+    }
+    if (std::abs(numCells - numSerialCells) > numSerialCells / 20)
+    {
+      std::cerr << "Too different from the serial decimation." << std::endl;
+      success = false;
+    }
+    if (!parallelOutput->GetPointData()->GetArray("Scalars"))
+    {
+      std::cerr << "Point data not mapped." << std::endl;
+      success = false;
+    }
+    success &= CheckTriangles(parallelOutput);
+    success &= CheckRounds(parallel);
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
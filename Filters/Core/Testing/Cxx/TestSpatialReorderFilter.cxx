@@ -0,0 +1,271 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks that vtkSpatialReorderFilter permutes the points, cells and
+// attributes of shuffled datasets consistently and improves their locality.
+
+#include "SpatialReorderFilterCommon.h"
+#include "vtkAppendFilter.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCellTypeSource.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSpatialReorderFilter.h"
+#include "vtkSphereSource.h"
+#include "vtkStringArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+const int Resolution = 12;
+
+using SpatialReorderFilterCommon::RandomPermutation;
+
+// A grid of Resolution^3 hexahedra followed by tetrahedra covering the same
+// blocks, whose points and cells are shuffled, with point and cell data
+// identifying them.
+void MakeShuffledGrid(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkCellTypeSource> hexahedra;
+  hexahedra->SetCellType(VTK_HEXAHEDRON);
+  hexahedra->SetBlocksDimensions(Resolution, Resolution, Resolution);
+  vtkNew<vtkCellTypeSource> tetrahedra;
+  tetrahedra->SetCellType(VTK_TETRA);
+  tetrahedra->SetBlocksDimensions(Resolution, Resolution, Resolution);
+  vtkNew<vtkAppendFilter> append;
+  append->AddInputConnection(hexahedra->GetOutputPort());
+  append->AddInputConnection(tetrahedra->GetOutputPort());
+  append->Update();
+
+  vtkNew<vtkUnstructuredGrid> ordered;
+  ordered->ShallowCopy(append->GetOutput());
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  pointScalars->SetNumberOfValues(ordered->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < ordered->GetNumberOfPoints(); ++ptId)
+  {
+    pointScalars->SetValue(ptId, ptId);
+  }
+  ordered->GetPointData()->SetScalars(pointScalars);
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  vtkNew<vtkStringArray> cellNames;
+  cellNames->SetName("CellNames");
+  for (vtkIdType cellId = 0; cellId < ordered->GetNumberOfCells(); ++cellId)
+  {
+    cellScalars->InsertNextValue(cellId);
+    cellNames->InsertNextValue(std::to_string(cellId));
+  }
+  ordered->GetCellData()->SetScalars(cellScalars);
+  ordered->GetCellData()->AddArray(cellNames);
+
+  SpatialReorderFilterCommon::ShuffleGrid(ordered, grid, 1);
+}
+
+// A sphere with vertices on each of its points, in shuffled order.
+void MakeShuffledSphere(vtkPolyData* output)
+{
+  vtkNew<vtkSphereSource> source;
+  source->SetThetaResolution(32);
+  source->SetPhiResolution(32);
+  source->Update();
+  vtkPolyData* sphere = source->GetOutput();
+  const vtkIdType numPts = sphere->GetNumberOfPoints();
+  const std::vector<vtkIdType> ptIds = RandomPermutation(numPts, 3);
+
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  pointScalars->SetNumberOfValues(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    points->SetPoint(ptIds[ptId], sphere->GetPoint(ptId));
+    pointScalars->SetValue(ptIds[ptId], ptId);
+  }
+
+  vtkNew<vtkCellArray> verts;
+  for (vtkIdType ptId = numPts - 1; ptId >= 0; --ptId)
+  {
+    verts->InsertNextCell(1, &ptId);
+  }
+  vtkNew<vtkCellArray> polys;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  const vtkIdType numPolys = sphere->GetNumberOfPolys();
+  const std::vector<vtkIdType> polyIds = RandomPermutation(numPolys, 4);
+  for (const vtkIdType polyId : polyIds)
+  {
+    sphere->GetPolys()->GetCellAtId(polyId, npts, pts);
+    std::vector<vtkIdType> newPts(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      newPts[i] = ptIds[pts[i]];
+    }
+    polys->InsertNextCell(npts, newPts.data());
+  }
+
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  for (vtkIdType cellId = 0; cellId < numPts + numPolys; ++cellId)
+  {
+    cellScalars->InsertNextValue(cellId);
+  }
+  output->SetPoints(points);
+  output->SetVerts(verts);
+  output->SetPolys(polys);
+  output->GetPointData()->SetScalars(pointScalars);
+  output->GetCellData()->SetScalars(cellScalars);
+}
+
+double PathLength(vtkPointSet* dataset)
+{
+  double length = 0.0;
+  double previous[3], x[3];
+  dataset->GetPoint(0, previous);
+  for (vtkIdType ptId = 1; ptId < dataset->GetNumberOfPoints(); ++ptId)
+  {
+    dataset->GetPoint(ptId, x);
+    length += std::sqrt(vtkMath::Distance2BetweenPoints(previous, x));
+    std::copy(x, x + 3, previous);
+  }
+  return length;
+}
+
+// Check that each output point, cell and attribute is the one of the input
+// given by the original ids.
+bool CheckPermutation(vtkPointSet* input, vtkPointSet* output)
+{
+  auto origPts =
+    vtkIdTypeArray::SafeDownCast(output->GetPointData()->GetArray("vtkOriginalPointIds"));
+  auto origCells =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("vtkOriginalCellIds"));
+  if (!origPts || !origCells || output->GetNumberOfPoints() != input->GetNumberOfPoints() ||
+    output->GetNumberOfCells() != input->GetNumberOfCells())
+  {
+    std::cerr << "The output does not match the size of the input." << std::endl;
+    return false;
+  }
+
+  vtkDataArray* inPtScalars = input->GetPointData()->GetScalars();
+  vtkDataArray* outPtScalars = output->GetPointData()->GetArray("PointScalars");
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    const vtkIdType inPtId = origPts->GetValue(ptId);
+    if (vtkMath::Distance2BetweenPoints(output->GetPoint(ptId), input->GetPoint(inPtId)) != 0.0 ||
+      outPtScalars->GetTuple1(ptId) != inPtScalars->GetTuple1(inPtId))
+    {
+      std::cerr << "Point " << ptId << " does not match input point " << inPtId << "."
+                << std::endl;
+      return false;
+    }
+  }
+
+  vtkDataArray* inCellScalars = input->GetCellData()->GetScalars();
+  vtkDataArray* outCellScalars = output->GetCellData()->GetArray("CellScalars");
+  auto inNames = vtkStringArray::SafeDownCast(input->GetCellData()->GetAbstractArray("CellNames"));
+  auto outNames =
+    vtkStringArray::SafeDownCast(output->GetCellData()->GetAbstractArray("CellNames"));
+  vtkNew<vtkIdList> inPts;
+  vtkNew<vtkIdList> outPts;
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    const vtkIdType inCellId = origCells->GetValue(cellId);
+    input->GetCellPoints(inCellId, inPts);
+    output->GetCellPoints(cellId, outPts);
+    bool same = output->GetCellType(cellId) == input->GetCellType(inCellId) &&
+      inPts->GetNumberOfIds() == outPts->GetNumberOfIds() &&
+      outCellScalars->GetTuple1(cellId) == inCellScalars->GetTuple1(inCellId) &&
+      (!inNames || (outNames && outNames->GetValue(cellId) == inNames->GetValue(inCellId)));
+    for (vtkIdType i = 0; same && i < outPts->GetNumberOfIds(); ++i)
+    {
+      same = origPts->GetValue(outPts->GetId(i)) == inPts->GetId(i);
+    }
+    if (!same)
+    {
+      std::cerr << "Cell " << cellId << " does not match input cell " << inCellId << "."
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestDataSet(vtkPointSet* input, const char* name)
+{
+  bool success = true;
+  const double inputLength = PathLength(input);
+  for (int curve = vtkSpatialReorderFilter::MORTON_CURVE;
+       curve <= vtkSpatialReorderFilter::HILBERT_CURVE; ++curve)
+  {
+    vtkNew<vtkSpatialReorderFilter> reorder;
+    reorder->SetInputData(input);
+    reorder->SetCurveType(curve);
+    reorder->PassThroughPointIdsOn();
+    reorder->PassThroughCellIdsOn();
+    reorder->Update();
+    vtkPointSet* output = reorder->GetOutput();
+    if (!CheckPermutation(input, output))
+    {
+      std::cerr << "Wrong permutation of the " << name << " with curve " << curve << "."
+                << std::endl;
+      success = false;
+    }
+    if (PathLength(output) > 0.5 * inputLength)
+    {
+      std::cerr << "The points of the " << name << " are not sorted along curve " << curve << "."
+                << std::endl;
+      success = false;
+    }
+  }
+
+  // Only the points are reordered: the cells keep their order.
+  vtkNew<vtkSpatialReorderFilter> reorder;
+  reorder->SetInputData(input);
+  reorder->ReorderCellsOff();
+  reorder->PassThroughPointIdsOn();
+  reorder->PassThroughCellIdsOn();
+  reorder->Update();
+  vtkPointSet* output = reorder->GetOutput();
+  auto origCells =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("vtkOriginalCellIds"));
+  for (vtkIdType cellId = 0; origCells && cellId < origCells->GetNumberOfValues(); ++cellId)
+  {
+    if (origCells->GetValue(cellId) != cellId)
+    {
+      origCells = nullptr;
+    }
+  }
+  if (!origCells || !CheckPermutation(input, output))
+  {
+    std::cerr << "Wrong permutation of the " << name << " with the cells kept in order."
+              << std::endl;
+    success = false;
+  }
+  return success;
+}
+}
+
+int TestSpatialReorderFilter(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  MakeShuffledGrid(grid);
+  bool success = TestDataSet(grid, "unstructured grid");
+
+  vtkNew<vtkPolyData> sphere;
+  MakeShuffledSphere(sphere);
+  success &= TestDataSet(sphere, "polydata");
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
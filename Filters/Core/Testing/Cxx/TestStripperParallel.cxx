@@ -0,0 +1,255 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Checks the threaded triangulation of vtkTriangleFilter, and the parallel
+// stripping and vertex cache ordering modes of vtkStripper.
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkStripper.h"
+#include "vtkTriangleFilter.h"
+#include "vtkTriangleStrip.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <set>
+
+namespace
+{
+using Triangle = std::array<vtkIdType, 3>;
+
+Triangle MakeTriangle(const vtkIdType* pts)
+{
+  Triangle tri = { { pts[0], pts[1], pts[2] } };
+  std::sort(tri.begin(), tri.end());
+  return tri;
+}
+
+std::multiset<Triangle> GetTriangles(vtkCellArray* cells)
+{
+  std::multiset<Triangle> triangles;
+  vtkNew<vtkCellArray> decomposed;
+  auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    decomposed->Reset();
+    vtkTriangleStrip::DecomposeStrip(static_cast<int>(npts), pts, decomposed);
+    auto triIter = vtk::TakeSmartPointer(decomposed->NewIterator());
+    for (triIter->GoToFirstCell(); !triIter->IsDoneWithTraversal(); triIter->GoToNextCell())
+    {
+      triIter->GetCurrentCell(npts, pts);
+      triangles.insert(MakeTriangle(pts));
+    }
+  }
+  return triangles;
+}
+
+// Average number of points entering a FIFO cache per triangle.
+double ComputeACMR(vtkCellArray* triangles, int cacheSize)
+{
+  std::deque<vtkIdType> cache;
+  vtkIdType numMisses = 0;
+  auto iter = vtk::TakeSmartPointer(triangles->NewIterator());
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      if (std::find(cache.begin(), cache.end(), pts[i]) == cache.end())
+      {
+        ++numMisses;
+        cache.push_back(pts[i]);
+        if (static_cast<int>(cache.size()) > cacheSize)
+        {
+          cache.pop_front();
+        }
+      }
+    }
+  }
+  return static_cast<double>(numMisses) / std::max<vtkIdType>(triangles->GetNumberOfCells(), 1);
+}
+
+// A grid of quads, and of concave pentagons with a triangle, with a
+// poly-vertex and a polyline, and their ids as cell data.
+void MakePolygons(vtkPolyData* input)
+{
+  const int n = 60;
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j <= n; ++j)
+  {
+    for (int i = 0; i <= 2 * n; ++i)
+    {
+      points->InsertNextPoint(0.5 * i, j + (i % 2 ? 0.2 : 0.0), 0.0);
+    }
+  }
+  vtkNew<vtkCellArray> polys;
+  const vtkIdType row = 2 * n + 1;
+  for (vtkIdType j = 0; j < n; ++j)
+  {
+    for (vtkIdType i = 0; i < 2 * n; i += 2)
+    {
+      const vtkIdType p0 = j * row + i;
+      if ((i / 2 + j) % 3 == 0)
+      {
+        const vtkIdType quad[4] = { p0, p0 + 2, p0 + row + 2, p0 + row };
+        polys->InsertNextCell(4, quad);
+      }
+      else
+      {
+        const vtkIdType pentagon[5] = { p0, p0 + 1, p0 + 2, p0 + row + 2, p0 + row + 1 };
+        polys->InsertNextCell(5, pentagon);
+        const vtkIdType triangle[3] = { p0, p0 + row + 1, p0 + row };
+        polys->InsertNextCell(3, triangle);
+      }
+    }
+  }
+  vtkNew<vtkCellArray> verts;
+  const vtkIdType vert[2] = { 0, 1 };
+  verts->InsertNextCell(2, vert);
+  vtkNew<vtkCellArray> lines;
+  const vtkIdType line[3] = { 0, 1, 2 };
+  lines->InsertNextCell(3, line);
+
+  input->SetPoints(points);
+  input->SetVerts(verts);
+  input->SetLines(lines);
+  input->SetPolys(polys);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfValues(input->GetNumberOfCells());
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    ids->SetValue(cellId, cellId);
+  }
+  input->GetCellData()->AddArray(ids);
+}
+
+bool TestTriangleFilter()
+{
+  vtkNew<vtkPolyData> input;
+  MakePolygons(input);
+  vtkNew<vtkTriangleFilter> triangulator;
+  triangulator->SetInputData(input);
+  triangulator->Update();
+  vtkPolyData* output = triangulator->GetOutput();
+
+  // Each polygon gives npts - 2 triangles using its points, in the order of
+  // the polygons, with the cell data of the polygon.
+  vtkIdTypeArray* ids = vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("Ids"));
+  const vtkIdType firstPolyId = input->GetNumberOfVerts() + input->GetNumberOfLines();
+  const vtkIdType firstTriId = output->GetNumberOfVerts() + output->GetNumberOfLines();
+  if (!ids || output->GetNumberOfVerts() != 2 || output->GetNumberOfLines() != 2)
+  {
+    std::cerr << "vtkTriangleFilter: wrong verts, lines or cell data." << std::endl;
+    return false;
+  }
+  vtkIdType triId = firstTriId;
+  auto iter = vtk::TakeSmartPointer(input->GetPolys()->NewIterator());
+  vtkIdType npts, numTriPts;
+  const vtkIdType *pts, *triPts;
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    const vtkIdType polyId = firstPolyId + iter->GetCurrentCellId();
+    for (vtkIdType i = 0; i < npts - 2; ++i, ++triId)
+    {
+      output->GetCellPoints(triId, numTriPts, triPts);
+      bool inPolygon = numTriPts == 3;
+      for (vtkIdType j = 0; j < numTriPts && inPolygon; ++j)
+      {
+        inPolygon = std::find(pts, pts + npts, triPts[j]) != pts + npts;
+      }
+      if (!inPolygon || ids->GetValue(triId) != polyId)
+      {
+        std::cerr << "vtkTriangleFilter: wrong triangle " << triId << " for polygon " << polyId
+                  << "." << std::endl;
+        return false;
+      }
+    }
+  }
+  if (triId != output->GetNumberOfCells())
+  {
+    std::cerr << "vtkTriangleFilter: " << output->GetNumberOfCells() - firstTriId
+              << " triangles, expected " << triId - firstTriId << "." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestStripper(vtkPolyData* input, bool parallel, bool optimizeCache)
+{
+  vtkNew<vtkStripper> stripper;
+  stripper->SetInputData(input);
+  stripper->SetParallelStripping(parallel);
+  stripper->SetOptimizeVertexCache(optimizeCache);
+  stripper->PassThroughCellIdsOn();
+  stripper->Update();
+  vtkPolyData* output = stripper->GetOutput();
+
+  // The triangles are all there, once.
+  vtkCellArray* outCells = optimizeCache ? output->GetPolys() : output->GetStrips();
+  if (GetTriangles(input->GetPolys()) != GetTriangles(outCells))
+  {
+    std::cerr << "vtkStripper: the output triangles differ from the input ones." << std::endl;
+    return false;
+  }
+  auto cellIds =
+    vtkIdTypeArray::SafeDownCast(output->GetFieldData()->GetArray("vtkOriginalCellIds"));
+  vtkIdType numTriangles = 0;
+  auto iter = vtk::TakeSmartPointer(outCells->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    numTriangles += iter->GetCurrentCell()->GetNumberOfIds() - 2;
+  }
+  // One id per triangle, in strips or not.
+  if (!cellIds || cellIds->GetNumberOfValues() != numTriangles)
+  {
+    std::cerr << "vtkStripper: wrong number of original cell ids." << std::endl;
+    return false;
+  }
+
+  if (optimizeCache)
+  {
+    const double inACMR = ComputeACMR(input->GetPolys(), 16);
+    const double outACMR = ComputeACMR(output->GetPolys(), 16);
+    if (outACMR >= inACMR || outACMR > 0.8)
+    {
+      std::cerr << "vtkStripper: ACMR " << outACMR << " after ordering, " << inACMR
+                << " before." << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestStripperParallel(int, char*[])
+{
+  bool success = TestTriangleFilter();
+
+  // Enough triangles for several patches
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(300);
+  sphere->SetPhiResolution(150);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  success &= TestStripper(input, false, false);
+  success &= TestStripper(input, true, false);
+  success &= TestStripper(input, false, true);
+  success &= TestStripper(input, true, true);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Times vtkProbeFilter, vtkGradientFilter and the construction of
+// vtkStaticCellLocator on a shuffled grid before and after sorting it with
+// vtkSpatialReorderFilter, and checks that their results do not change.
+
+#include "SpatialReorderFilterCommon.h"
+#include "vtkCellTypeSource.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGradientFilter.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkProbeFilter.h"
+#include "vtkSMPTools.h"
+#include "vtkSpatialReorderFilter.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkTimerLog.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+const int Resolution = 40;
+
+// A grid of Resolution^3 hexahedra covering [0, Resolution]^3 with a scalar
+// field, whose points and cells are randomly ordered.
+void MakeShuffledGrid(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkCellTypeSource> source;
+  source->SetCellType(VTK_HEXAHEDRON);
+  source->SetBlocksDimensions(Resolution, Resolution, Resolution);
+  source->Update();
+
+  vtkNew<vtkUnstructuredGrid> ordered;
+  ordered->ShallowCopy(source->GetOutput());
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfValues(ordered->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < ordered->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    ordered->GetPoint(ptId, x);
+    vtkMath::MultiplyScalar(x, 1.0 / Resolution);
+    scalars->SetValue(ptId, std::sin(4.0 * x[0]) * std::cos(3.0 * x[1]) + x[2] * x[2]);
+  }
+  ordered->GetPointData()->SetScalars(scalars);
+
+  SpatialReorderFilterCommon::ShuffleGrid(ordered, grid, 1);
+}
+
+// Run the downstream algorithms on the grid, returning their times and the
+// probed values and gradients.
+void RunAlgorithms(vtkUnstructuredGrid* grid, vtkTimerLog* timer, double times[3],
+  std::vector<double>& probed, vtkSmartPointer<vtkDataArray>& gradients)
+{
+  vtkNew<vtkStaticCellLocator> locator;
+  locator->SetDataSet(grid);
+  timer->StartTimer();
+  locator->BuildLocator();
+  timer->StopTimer();
+  times[0] = timer->GetElapsedTime();
+
+  vtkNew<vtkImageData> image;
+  const double spacing = static_cast<double>(Resolution) / 97;
+  image->SetDimensions(97, 97, 97);
+  image->SetSpacing(spacing, spacing, spacing);
+  image->SetOrigin(0.5 * spacing, 0.5 * spacing, 0.5 * spacing);
+  vtkNew<vtkProbeFilter> probe;
+  probe->SetInputData(image);
+  probe->SetSourceData(grid);
+  timer->StartTimer();
+  probe->Update();
+  timer->StopTimer();
+  times[1] = timer->GetElapsedTime();
+  vtkDataArray* values = probe->GetOutput()->GetPointData()->GetArray("Scalars");
+  probed.resize(values->GetNumberOfTuples());
+  for (vtkIdType i = 0; i < values->GetNumberOfTuples(); ++i)
+  {
+    probed[i] = values->GetTuple1(i);
+  }
+
+  vtkNew<vtkGradientFilter> gradient;
+  gradient->SetInputData(grid);
+  gradient->SetInputScalars(vtkDataObject::FIELD_ASSOCIATION_POINTS, "Scalars");
+  gradient->SetResultArrayName("Gradients");
+  timer->StartTimer();
+  gradient->Update();
+  timer->StopTimer();
+  times[2] = timer->GetElapsedTime();
+  gradients =
+    vtkDataSet::SafeDownCast(gradient->GetOutput())->GetPointData()->GetArray("Gradients");
+}
+}
+
+int TimeSpatialReorderFilter(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  MakeShuffledGrid(grid);
+  vtkNew<vtkTimerLog> timer;
+
+  vtkNew<vtkSpatialReorderFilter> reorder;
+  reorder->SetInputData(grid);
+  reorder->PassThroughPointIdsOn();
+  timer->StartTimer();
+  reorder->Update();
+  timer->StopTimer();
+  vtkUnstructuredGrid* sorted = vtkUnstructuredGrid::SafeDownCast(reorder->GetOutput());
+
+  cout << "\nTimes for " << grid->GetNumberOfCells() << " cells, " << grid->GetNumberOfPoints()
+       << " points (" << vtkSMPTools::GetBackend() << " backend)\n";
+  cout << "vtkSpatialReorderFilter: " << timer->GetElapsedTime() << "\n";
+  cout << "ordering\tvtkStaticCellLocator\tvtkProbeFilter\tvtkGradientFilter\n";
+
+  double times[3];
+  std::vector<double> probed, sortedProbed;
+  vtkSmartPointer<vtkDataArray> gradients, sortedGradients;
+  RunAlgorithms(grid, timer, times, probed, gradients);
+  cout << "shuffled\t" << times[0] << "\t" << times[1] << "\t" << times[2] << "\n";
+  RunAlgorithms(sorted, timer, times, sortedProbed, sortedGradients);
+  cout << "sorted\t" << times[0] << "\t" << times[1] << "\t" << times[2] << "\n";
+
+  bool success = probed.size() == sortedProbed.size();
+  for (size_t i = 0; success && i < probed.size(); ++i)
+  {
+    success = std::abs(probed[i] - sortedProbed[i]) < 1e-9;
+  }
+  if (!success)
+  {
+    std::cerr << "vtkProbeFilter gives different results on the sorted grid." << std::endl;
+  }
+
+  vtkDataArray* origPts = sorted->GetPointData()->GetArray("vtkOriginalPointIds");
+  for (vtkIdType ptId = 0; ptId < sorted->GetNumberOfPoints(); ++ptId)
+  {
+    const vtkIdType inPtId = static_cast<vtkIdType>(origPts->GetTuple1(ptId));
+    for (int c = 0; c < 3; ++c)
+    {
+      if (std::abs(gradients->GetComponent(inPtId, c) - sortedGradients->GetComponent(ptId, c)) >
+        1e-9)
+      {
+        std::cerr << "vtkGradientFilter gives a different result for point " << ptId
+                  << " of the sorted grid." << std::endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -4,6 +4,7 @@
 
 #include "vtkCell.h"
 #include "vtkCellData.h"
+#include "vtkConnectivityInternal.h"
 #include "vtkDataSet.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkFloatArray.h"
@@ -19,6 +20,7 @@
 #include "vtkUnstructuredGrid.h"
 
 #include <map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryNewMacro(vtkConnectivityFilter);
@@ -30,6 +32,7 @@ vtkConnectivityFilter::vtkConnectivityFilter()
   this->ExtractionMode = VTK_EXTRACT_LARGEST_REGION;
   this->ColorRegions = 0;
   this->RegionIdAssignmentMode = UNSPECIFIED;
+  this->ParallelLabeling = 0;
 
   this->ScalarConnectivity = 0;
   this->ScalarRange[0] = 0.0;
@@ -213,9 +216,12 @@ int vtkConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(request),
   // using a connected wave propagation.
   //
   this->Wave = vtkIdList::New();
-  this->Wave->Allocate(numPts / 4 + 1, numPts);
   this->Wave2 = vtkIdList::New();
-  this->Wave2->Allocate(numPts / 4 + 1, numPts);
+  if (!this->ParallelLabeling)
+  {
+    this->Wave->Allocate(numPts / 4 + 1, numPts);
+    this->Wave2->Allocate(numPts / 4 + 1, numPts);
+  }
 
   this->PointNumber = 0;
   this->RegionNumber = 0;
@@ -226,7 +232,11 @@ int vtkConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(request),
   this->PointIds = vtkIdList::New();
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
 
-  if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if (this->ParallelLabeling)
+  {
+    largestRegionId = this->LabelRegionsInParallel(input);
+  }
+  else if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
   { // visit all cells marking with region number
@@ -620,6 +630,106 @@ void vtkConnectivityFilter::TraverseAndMark(vtkDataSet* input)
   } // while wave is not empty
 }
 
+vtkIdType vtkConnectivityFilter::LabelRegionsInParallel(vtkDataSet* input)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+
+  // The seeds of the seeded extraction modes, as cell flags
+  std::vector<unsigned char> seeds;
+  if (this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS)
+  {
+    std::vector<unsigned char> seedPoints(numPts, 0);
+    for (vtkIdType i = 0; i < this->Seeds->GetNumberOfIds(); i++)
+    {
+      const vtkIdType ptId = this->Seeds->GetId(i);
+      if (ptId >= 0 && ptId < numPts)
+      {
+        seedPoints[ptId] = 1;
+      }
+    }
+    seeds = GetCellsUsingPoints(input, seedPoints);
+  }
+  else if (this->ExtractionMode == VTK_EXTRACT_CELL_SEEDED_REGIONS)
+  {
+    seeds.resize(numCells, 0);
+    for (vtkIdType i = 0; i < this->Seeds->GetNumberOfIds(); i++)
+    {
+      const vtkIdType cellId = this->Seeds->GetId(i);
+      if (cellId >= 0 && cellId < numCells)
+      {
+        seeds[cellId] = 1;
+      }
+    }
+  }
+  else if (this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION)
+  {
+    double minDist2 = VTK_DOUBLE_MAX, x[3];
+    vtkIdType minId = 0;
+    for (vtkIdType i = 0; i < numPts; i++)
+    {
+      input->GetPoint(i, x);
+      const double dist2 = vtkMath::Distance2BetweenPoints(x, this->ClosestPoint);
+      if (dist2 < minDist2)
+      {
+        minId = i;
+        minDist2 = dist2;
+      }
+    }
+    std::vector<unsigned char> seedPoints(numPts, 0);
+    seedPoints[minId] = 1;
+    seeds = GetCellsUsingPoints(input, seedPoints);
+  }
+  this->UpdateProgress(0.2);
+
+  // Cells are connected through their points if the scalars of one of their
+  // points lie in the range, compared in single precision as in
+  // TraverseAndMark().
+  vtkDataArray* inScalars = this->InScalars;
+  const double range[2] = { this->ScalarRange[0], this->ScalarRange[1] };
+  auto qualifies = [inScalars, &range](vtkIdType npts, const vtkIdType* pts) {
+    if (!inScalars)
+    {
+      return true;
+    }
+    double cellRange[2] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+    for (vtkIdType i = 0; i < npts; i++)
+    {
+      const double s = static_cast<float>(inScalars->GetComponent(pts[i], 0));
+      cellRange[0] = std::min(cellRange[0], s);
+      cellRange[1] = std::max(cellRange[1], s);
+    }
+    return cellRange[1] >= range[0] && cellRange[0] <= range[1];
+  };
+
+  std::vector<vtkIdType> regionSizes;
+  const vtkIdType numRegions = LabelConnectedRegions(
+    input, qualifies, seeds.empty() ? nullptr : seeds.data(), this->Visited, regionSizes);
+  this->UpdateProgress(0.7);
+  if (this->CheckAbort())
+  {
+    return 0;
+  }
+
+  vtkIdType largestRegionId = 0;
+  this->RegionSizes->SetNumberOfValues(numRegions);
+  for (vtkIdType regionId = 0; regionId < numRegions; regionId++)
+  {
+    this->RegionSizes->SetValue(regionId, regionSizes[regionId]);
+    if (regionSizes[regionId] > regionSizes[largestRegionId])
+    {
+      largestRegionId = regionId;
+    }
+  }
+  this->RegionNumber = seeds.empty() ? numRegions : 0;
+  std::copy(this->Visited, this->Visited + numCells, this->NewCellScalars->GetPointer(0));
+
+  this->PointNumber =
+    MapConnectedPoints(input, this->Visited, this->PointMap, this->NewScalars->GetPointer(0));
+  this->UpdateProgress(0.9);
+  return largestRegionId;
+}
+
 void vtkConnectivityFilter::OrderRegionIds(
   vtkIdTypeArray* pointRegionIds, vtkIdTypeArray* cellRegionIds)
 {
@@ -778,5 +888,6 @@ void vtkConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   double* range = this->GetScalarRange();
   os << indent << "Scalar Range: (" << range[0] << ", " << range[1] << ")\n";
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Parallel Labeling: " << (this->ParallelLabeling ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -38,6 +38,11 @@
  * was processed and has no other significance with respect to the size of
  * or number of cells.
  *
+ * The regions can be labeled in parallel with vtkSMPTools by turning on
+ * ParallelLabeling, which is much faster on large datasets made of many
+ * regions. See SetParallelLabeling() for the differences with the serial
+ * traversal.
+ *
  * @sa
  * vtkPolyDataConnectivityFilter
  */
@@ -194,6 +199,22 @@ public:
   vtkSetMacro(RegionIdAssignmentMode, int);
   vtkGetMacro(RegionIdAssignmentMode, int);
 
+  ///@{
+  /**
+   * Turn on/off the parallel labeling of the regions. Instead of traversing
+   * the regions one at a time, the points of the cells are merged with a
+   * lock-free union-find, with vtkSMPTools. The extraction modes, the region
+   * ids, which are ordered by the smallest cell id of each region, and the
+   * region sizes are the same as with the serial traversal, also with
+   * ScalarConnectivity. The only difference is that the output points are in
+   * the order of the input points instead of the order of traversal.
+   * Default is off.
+   */
+  vtkSetMacro(ParallelLabeling, vtkTypeBool);
+  vtkGetMacro(ParallelLabeling, vtkTypeBool);
+  vtkBooleanMacro(ParallelLabeling, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output types. See the documentation
@@ -232,8 +253,16 @@ protected:
 
   int RegionIdAssignmentMode;
 
+  vtkTypeBool ParallelLabeling;
+
   void TraverseAndMark(vtkDataSet* input);
 
+  /**
+   * Label the cells and map the points in parallel, filling the same
+   * execution data as the serial traversal. Return the largest region id.
+   */
+  vtkIdType LabelRegionsInParallel(vtkDataSet* input);
+
   void OrderRegionIds(vtkIdTypeArray* pointRegionIds, vtkIdTypeArray* cellRegionIds);
 
 private:
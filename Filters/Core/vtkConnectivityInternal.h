@@ -0,0 +1,393 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConnectivityInternal
+ * @brief   parallel labeling of the connected regions of a dataset
+ *
+ * vtkConnectivityInternal gathers the parallel labeling shared by
+ * vtkConnectivityFilter and vtkPolyDataConnectivityFilter. Instead of growing
+ * the regions one at a time by waves of neighbor cells, the points of the
+ * cells are merged with a lock-free union-find: the points of a cell are
+ * connected, and two cells are connected if they share a point. This needs
+ * neither cell links nor waves, and each step is a vtkSMPTools loop over the
+ * cells or the points.
+ *
+ * Cells that do not qualify (the scalar connectivity criterion) do not merge
+ * their points. As in the serial traversal, each of them starts a region, or
+ * belongs to the seeded region, and takes with it the qualifying cells that
+ * use its points and have not been reached before. The regions are numbered
+ * in the order of their smallest cell id, which is the order of the serial
+ * traversal when all the regions are extracted.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkConnectivityFilter vtkPolyDataConnectivityFilter
+ */
+
+#ifndef vtkConnectivityInternal_h
+#define vtkConnectivityInternal_h
+
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Lower an atomic value to the given one.
+inline void AtomicMin(std::atomic<vtkIdType>& value, vtkIdType candidate)
+{
+  vtkIdType current = value.load();
+  while (candidate < current && !value.compare_exchange_weak(current, candidate))
+  {
+  }
+}
+
+//------------------------------------------------------------------------------
+// Lock-free union-find over point ids. A root is always linked under a root
+// of smaller id, so that the root of a set is its smallest id whatever the
+// order of the unions: the result is deterministic.
+class PointUnionFind
+{
+public:
+  explicit PointUnionFind(vtkIdType numPts)
+    : Parents(numPts)
+  {
+    vtkSMPTools::For(0, numPts, [this](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        this->Parents[ptId].store(ptId);
+      }
+    });
+  }
+
+  // Return the root of the set of the point, halving the path to it.
+  vtkIdType Find(vtkIdType ptId)
+  {
+    for (;;)
+    {
+      vtkIdType parent = this->Parents[ptId].load();
+      if (parent == ptId)
+      {
+        return ptId;
+      }
+      const vtkIdType grandParent = this->Parents[parent].load();
+      if (grandParent != parent)
+      {
+        this->Parents[ptId].compare_exchange_weak(parent, grandParent);
+      }
+      ptId = grandParent;
+    }
+  }
+
+  void Unite(vtkIdType ptId0, vtkIdType ptId1)
+  {
+    for (;;)
+    {
+      ptId0 = this->Find(ptId0);
+      ptId1 = this->Find(ptId1);
+      if (ptId0 == ptId1)
+      {
+        return;
+      }
+      if (ptId0 < ptId1)
+      {
+        std::swap(ptId0, ptId1);
+      }
+      // Fails if ptId0 is no longer a root, then retry from the new roots.
+      vtkIdType root = ptId0;
+      if (this->Parents[ptId0].compare_exchange_strong(root, ptId1))
+      {
+        return;
+      }
+    }
+  }
+
+  // Link each point directly to its root. Must be called after the unions.
+  void Flatten()
+  {
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->Parents.size()),
+      [this](vtkIdType ptId, vtkIdType endPtId) {
+        for (; ptId < endPtId; ++ptId)
+        {
+          this->Parents[ptId].store(this->Find(ptId));
+        }
+      });
+  }
+
+  // Root of a point once flattened.
+  vtkIdType GetRoot(vtkIdType ptId) const { return this->Parents[ptId].load(); }
+
+private:
+  std::vector<std::atomic<vtkIdType>> Parents;
+};
+
+//------------------------------------------------------------------------------
+// Call functor(cellId, npts, pts) for each cell of the dataset, in parallel.
+template <typename FunctorT>
+void ForEachCell(vtkDataSet* input, FunctorT&& functor)
+{
+  const vtkIdType numCells = input->GetNumberOfCells();
+  if (numCells == 0)
+  {
+    return;
+  }
+  // GetCellPoints() is thread safe once called from a single thread.
+  vtkNew<vtkIdList> ptIds;
+  input->GetCellPoints(0, ptIds);
+
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdList* cellPtIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (; cellId < endCellId; ++cellId)
+    {
+      input->GetCellPoints(cellId, npts, pts, cellPtIds);
+      functor(cellId, npts, pts);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Flag the cells using at least one of the flagged points.
+inline std::vector<unsigned char> GetCellsUsingPoints(
+  vtkDataSet* input, const std::vector<unsigned char>& pointFlags)
+{
+  std::vector<unsigned char> cellFlags(input->GetNumberOfCells(), 0);
+  ForEachCell(input, [&](vtkIdType cellId, vtkIdType npts, const vtkIdType* pts) {
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      if (pointFlags[pts[i]])
+      {
+        cellFlags[cellId] = 1;
+        break;
+      }
+    }
+  });
+  return cellFlags;
+}
+
+//------------------------------------------------------------------------------
+// Label the connected regions of the cells of the input. The qualifier,
+// called as qualifies(npts, pts), tells whether a cell connects its points.
+//
+// Without seeds, every cell is labeled with its region in cellRegions, the
+// regions being numbered by their smallest cell id, and regionSizes receives
+// the number of cells of each region. With seeds, flags given for each cell,
+// the seeds and the qualifying cells connected to them form region 0 and the
+// other cells are labeled -1. Returns the number of regions.
+template <typename QualifierT>
+vtkIdType LabelConnectedRegions(vtkDataSet* input, QualifierT&& qualifies,
+  const unsigned char* seeds, vtkIdType* cellRegions, std::vector<vtkIdType>& regionSizes)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+
+  // Merge the points of the qualifying cells, and keep the root of the
+  // points of each qualifying cell in cellRegions, -1 for the others.
+  PointUnionFind components(numPts);
+  ForEachCell(input, [&](vtkIdType cellId, vtkIdType npts, const vtkIdType* pts) {
+    if (npts == 0 || !qualifies(npts, pts))
+    {
+      cellRegions[cellId] = -1;
+      return;
+    }
+    cellRegions[cellId] = pts[0];
+    for (vtkIdType i = 1; i < npts; ++i)
+    {
+      components.Unite(pts[0], pts[i]);
+    }
+  });
+  components.Flatten();
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      if (cellRegions[cellId] >= 0)
+      {
+        cellRegions[cellId] = components.GetRoot(cellRegions[cellId]);
+      }
+    }
+  });
+
+  if (seeds)
+  {
+    // The components reached by the points of the seeds
+    std::vector<unsigned char> reached(numPts, 0);
+    ForEachCell(input, [&](vtkIdType cellId, vtkIdType npts, const vtkIdType* pts) {
+      if (seeds[cellId])
+      {
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          reached[components.GetRoot(pts[i])] = 1;
+        }
+      }
+    });
+    vtkSMPThreadLocal<vtkIdType> tlNumCells(0);
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      vtkIdType& count = tlNumCells.Local();
+      for (; cellId < endCellId; ++cellId)
+      {
+        const vtkIdType root = cellRegions[cellId];
+        cellRegions[cellId] = (seeds[cellId] || (root >= 0 && reached[root])) ? 0 : -1;
+        count += cellRegions[cellId] == 0;
+      }
+    });
+    vtkIdType numCellsInRegion = 0;
+    for (vtkIdType count : tlNumCells)
+    {
+      numCellsInRegion += count;
+    }
+    regionSizes.assign(1, numCellsInRegion);
+    return 1;
+  }
+
+  // A region starts at each cell that does not qualify, which takes the
+  // components using its points that have not been reached yet, and at the
+  // smallest cell of the other components. A component thus belongs to the
+  // region of the smallest of its cells and of the cells that do not qualify
+  // using its points.
+  std::vector<std::atomic<vtkIdType>> firstCells(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      firstCells[ptId].store(numCells);
+    }
+  });
+  ForEachCell(input, [&](vtkIdType cellId, vtkIdType npts, const vtkIdType* pts) {
+    const vtkIdType root = cellRegions[cellId];
+    if (root >= 0)
+    {
+      AtomicMin(firstCells[root], cellId);
+      return;
+    }
+    // The points used only by cells that do not qualify are roots of their
+    // own, with no component to take.
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      AtomicMin(firstCells[components.GetRoot(pts[i])], cellId);
+    }
+  });
+  std::vector<vtkIdType> regionIds(numCells + 1, 0);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      const vtkIdType root = cellRegions[cellId];
+      regionIds[cellId] = root < 0 || firstCells[root].load() == cellId;
+    }
+  });
+  vtkSMPTools::ExclusiveScan(
+    regionIds.begin(), regionIds.end(), regionIds.begin(), static_cast<vtkIdType>(0));
+  const vtkIdType numRegions = regionIds.back();
+
+  // Label the cells and count them. Neighboring cells are usually in the same
+  // region: the counts are accumulated over runs of cells to limit the
+  // contention on the counters of the large regions.
+  std::vector<std::atomic<vtkIdType>> counts(numRegions);
+  vtkSMPTools::For(0, numRegions, [&](vtkIdType regionId, vtkIdType endRegionId) {
+    for (; regionId < endRegionId; ++regionId)
+    {
+      counts[regionId].store(0);
+    }
+  });
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdType runRegion = -1;
+    vtkIdType runLength = 0;
+    for (; cellId < endCellId; ++cellId)
+    {
+      const vtkIdType root = cellRegions[cellId];
+      const vtkIdType regionId =
+        root < 0 ? regionIds[cellId] : regionIds[firstCells[root].load()];
+      cellRegions[cellId] = regionId;
+      if (regionId != runRegion)
+      {
+        if (runLength > 0)
+        {
+          counts[runRegion] += runLength;
+        }
+        runRegion = regionId;
+        runLength = 0;
+      }
+      ++runLength;
+    }
+    if (runLength > 0)
+    {
+      counts[runRegion] += runLength;
+    }
+  });
+  regionSizes.resize(numRegions);
+  vtkSMPTools::For(0, numRegions, [&](vtkIdType regionId, vtkIdType endRegionId) {
+    for (; regionId < endRegionId; ++regionId)
+    {
+      regionSizes[regionId] = counts[regionId].load();
+    }
+  });
+  return numRegions;
+}
+
+//------------------------------------------------------------------------------
+// Number the points used by the labeled cells (cellRegions >= 0) in
+// increasing id order into pointMap, -1 for the unused points. If
+// pointRegions is given, it receives for each output point the smallest
+// region of the cells using it. Returns the number of output points.
+inline vtkIdType MapConnectedPoints(
+  vtkDataSet* input, const vtkIdType* cellRegions, vtkIdType* pointMap, vtkIdType* pointRegions)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  std::vector<std::atomic<vtkIdType>> regions(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      regions[ptId].store(VTK_ID_MAX);
+    }
+  });
+  ForEachCell(input, [&](vtkIdType cellId, vtkIdType npts, const vtkIdType* pts) {
+    if (cellRegions[cellId] >= 0)
+    {
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        AtomicMin(regions[pts[i]], cellRegions[cellId]);
+      }
+    }
+  });
+
+  std::vector<vtkIdType> offsets(numPts + 1, 0);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      offsets[ptId] = regions[ptId].load() != VTK_ID_MAX;
+    }
+  });
+  vtkSMPTools::ExclusiveScan(
+    offsets.begin(), offsets.end(), offsets.begin(), static_cast<vtkIdType>(0));
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType regionId = regions[ptId].load();
+      pointMap[ptId] = regionId != VTK_ID_MAX ? offsets[ptId] : -1;
+      if (pointRegions && pointMap[ptId] >= 0)
+      {
+        pointRegions[pointMap[ptId]] = regionId;
+      }
+    }
+  });
+  return offsets.back();
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkConnectivityInternal.h
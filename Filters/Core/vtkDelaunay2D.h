@@ -56,7 +56,8 @@
  * problems are present, you will see a warning message to this effect at
  * the end of the triangulation process. Note also that the
  * RandomPointInsertion mode can be set which will insert the points in
- * pseudo-random order.
+ * pseudo-random order, and the SpatialPointInsertion mode which will insert
+ * them in a spatially coherent order (see below).
  *
  * To create constrained meshes, you must define an additional
  * input. This input is an instance of vtkPolyData which contains
@@ -255,6 +256,23 @@ public:
   vtkBooleanMacro(RandomPointInsertion, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points in a biased randomized insertion
+   * order (BRIO): the points are dealt into rounds of increasing sizes, and
+   * each round is sorted along a Hilbert curve. Successive points are then
+   * close to each other, so that locating the triangle containing a point is
+   * a short walk from the last inserted point, while the rounds keep the
+   * benefits of a random order. This greatly speeds up the triangulation of
+   * large point sets. Only the sort is threaded with vtkSMPTools, the points
+   * are still inserted one at a time. When on, this mode takes precedence
+   * over RandomPointInsertion. By default it is off.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
 protected:
   vtkDelaunay2D();
 
@@ -265,6 +283,7 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   vtkTypeBool RandomPointInsertion;
+  vtkTypeBool SpatialPointInsertion;
 
   // Transform input points (if necessary)
   vtkSmartPointer<vtkAbstractTransform> Transform;
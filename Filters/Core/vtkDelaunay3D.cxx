@@ -13,10 +13,13 @@
 #include "vtkPointData.h"
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
+#include "vtkSpaceFillingCurveInternal.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDelaunay3D);
 
@@ -127,6 +130,7 @@ vtkDelaunay3D::vtkDelaunay3D()
   this->BoundingTriangulation = 0;
   this->Offset = 2.5;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+  this->SpatialPointInsertion = 0;
   this->Locator = nullptr;
   this->TetraArray = nullptr;
   this->References = nullptr;
@@ -138,6 +142,7 @@ vtkDelaunay3D::vtkDelaunay3D()
   this->Faces->Allocate(15);
   this->CheckedTetras = vtkIdList::New();
   this->CheckedTetras->Allocate(25);
+  this->LastInsertedPoint = -1;
 }
 
 //------------------------------------------------------------------------------
@@ -193,26 +198,39 @@ vtkIdType vtkDelaunay3D::FindEnclosingFaces(double x[3], vtkUnstructuredGrid* Me
     return 0;
   }
 
-  closestPoint = locator->FindClosestInsertedPoint(x);
+  // When the points are inserted in spatially coherent order, the last
+  // inserted point is close to this one: walk from one of its tetras and
+  // skip the closest point search (unless the walk fails).
   vtkCellLinks* links = static_cast<vtkCellLinks*>(Mesh->GetLinks());
-  int numCells = links->GetNcells(closestPoint);
-  vtkIdType* cells = links->GetCells(closestPoint);
-  if (numCells <= 0) // shouldn't happen
-  {
-    this->NumberOfDegeneracies++;
-    return 0;
-  }
-  else
+  tetraId = -1;
+  if (this->SpatialPointInsertion && this->LastInsertedPoint >= 0 &&
+    links->GetNcells(this->LastInsertedPoint) > 0)
   {
-    tetraId = cells[0];
+    tetraId = this->FindTetra(Mesh, xd, links->GetCells(this->LastInsertedPoint)[0], 0);
   }
 
-  // Okay, walk towards the containing tetrahedron
-  tetraId = this->FindTetra(Mesh, xd, tetraId, 0);
   if (tetraId < 0)
   {
-    this->NumberOfDegeneracies++;
-    return 0;
+    closestPoint = locator->FindClosestInsertedPoint(x);
+    int numCells = links->GetNcells(closestPoint);
+    vtkIdType* cells = links->GetCells(closestPoint);
+    if (numCells <= 0) // shouldn't happen
+    {
+      this->NumberOfDegeneracies++;
+      return 0;
+    }
+    else
+    {
+      tetraId = cells[0];
+    }
+
+    // Okay, walk towards the containing tetrahedron
+    tetraId = this->FindTetra(Mesh, xd, tetraId, 0);
+    if (tetraId < 0)
+    {
+      this->NumberOfDegeneracies++;
+      return 0;
+    }
   }
 
   // Initialize the list of tetras who contain the point according
@@ -484,17 +502,24 @@ int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
   // Insert each point into triangulation. Points laying "inside"
   // of tetra cause tetra to be deleted, leaving a void with bounding
   // faces. Combination of point and each face is used to form new
-  // tetrahedra.
-  for (ptId = 0; ptId < numPoints; ptId++)
+  // tetrahedra. The points may be inserted in given order, or in spatially
+  // coherent order.
+  std::vector<vtkIdType> insertionOrder;
+  if (this->SpatialPointInsertion)
+  {
+    insertionOrder = ComputeBRIOOrder(inPoints, input->GetBounds(), false);
+  }
+  for (vtkIdType idx = 0; idx < numPoints; idx++)
   {
+    ptId = this->SpatialPointInsertion ? insertionOrder[idx] : idx;
     inPoints->GetPoint(ptId, x);
 
     this->InsertPoint(Mesh, points, ptId, x, holeTetras);
 
-    if (!(ptId % 250))
+    if (!(idx % 250))
     {
-      vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      vtkDebugMacro(<< "point #" << idx);
+      this->UpdateProgress(static_cast<double>(idx) / numPoints);
       if (this->CheckAbort())
       {
         break;
@@ -787,6 +812,7 @@ vtkUnstructuredGrid* vtkDelaunay3D::InitPointInsertion(
 
   this->NumberOfDuplicatePoints = 0;
   this->NumberOfDegeneracies = 0;
+  this->LastInsertedPoint = -1;
 
   if (length <= 0.0)
   {
@@ -911,6 +937,7 @@ void vtkDelaunay3D::InsertPoint(
   if ((numFaces = this->FindEnclosingFaces(x, Mesh, this->Tetras, this->Faces, this->Locator)) > 0)
   {
     this->Locator->InsertPoint(ptId, x); // point is part of mesh now
+    this->LastInsertedPoint = ptId;
     numTetras = this->Tetras->GetNumberOfIds();
 
     // create new tetra for each face
@@ -1051,6 +1078,7 @@ void vtkDelaunay3D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
+  os << indent << "Spatial Point Insertion: " << (this->SpatialPointInsertion ? "On\n" : "Off\n");
 
   if (this->Locator)
   {
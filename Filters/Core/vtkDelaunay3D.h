@@ -186,6 +186,23 @@ public:
   vtkBooleanMacro(BoundingTriangulation, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether to insert the points in given order, or in a biased
+   * randomized insertion order (BRIO): the points are dealt into rounds of
+   * increasing sizes, and each round is sorted along a Hilbert curve.
+   * Successive points are then close to each other, so that the walk towards
+   * the tetrahedron containing a point starts from the last inserted point
+   * instead of the closest point given by the locator, while the rounds keep
+   * the benefits of a random order. This greatly speeds up the triangulation
+   * of large point sets. Only the sort is threaded with vtkSMPTools, the
+   * points are still inserted one at a time. By default this is off.
+   */
+  vtkSetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkGetMacro(SpatialPointInsertion, vtkTypeBool);
+  vtkBooleanMacro(SpatialPointInsertion, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set / get a spatial locator for merging points. By default,
@@ -267,6 +284,7 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   int OutputPointsPrecision;
+  vtkTypeBool SpatialPointInsertion;
 
   vtkIncrementalPointLocator* Locator; // help locate points faster
 
@@ -286,10 +304,11 @@ protected:
 
   int FillInputPortInformation(int, vtkInformation*) override;
 
-private:                    // members added for performance
-  vtkIdList* Tetras;        // used in InsertPoint
-  vtkIdList* Faces;         // used in InsertPoint
-  vtkIdList* CheckedTetras; // used by InsertPoint
+private:                       // members added for performance
+  vtkIdList* Tetras;           // used in InsertPoint
+  vtkIdList* Faces;            // used in InsertPoint
+  vtkIdList* CheckedTetras;    // used by InsertPoint
+  vtkIdType LastInsertedPoint; // used by InsertPoint with SpatialPointInsertion
 
   vtkDelaunay3D(const vtkDelaunay3D&) = delete;
   void operator=(const vtkDelaunay3D&) = delete;
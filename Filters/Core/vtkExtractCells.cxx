@@ -351,15 +351,18 @@ void ExtractPolyhedralFaces(
   offsetsPolyFaces->SetNumberOfValues(outFaceLocSize + 1);
   connectivityPolyFaces->SetNumberOfValues(outFacesSize);
   connectivityPolyFaces->FillValue(0);
-  offsetsPolyFaces->SetValue(0, 0);
-  // Prepare offsets needed for SMPTools
-  facePos = 0;
-  for (vtkIdType face = 0; face < outFaceLocSize; ++face)
-  {
-    const auto size = inFaces->GetCellSize(connectivityPoly->GetValue(face));
-    facePos += size;
-    offsetsPolyFaces->SetValue(face + 1, facePos);
-  }
+  // Prepare offsets needed for SMPTools: gather the face sizes, then turn
+  // them into offsets with a prefix sum.
+  vtkIdType* polyFacesOffsets = offsetsPolyFaces->GetPointer(0);
+  vtkSMPTools::For(0, outFaceLocSize, [&](vtkIdType start, vtkIdType end) {
+    for (vtkIdType face = start; face < end; ++face)
+    {
+      polyFacesOffsets[face] = inFaces->GetCellSize(connectivityPoly->GetValue(face));
+    }
+  });
+  polyFacesOffsets[outFaceLocSize] = 0;
+  vtkSMPTools::ExclusiveScan(polyFacesOffsets, polyFacesOffsets + outFaceLocSize + 1,
+    polyFacesOffsets, static_cast<vtkIdType>(0));
   // Now copy polyhedron Faces.
   vtkSMPTools::For(0, outFaceLocSize, [&](vtkIdType start, vtkIdType end) {
     vtkNew<vtkIdList> facePts;
@@ -21,6 +21,7 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkFlyingEdges3D);
@@ -388,6 +389,83 @@ public:
       }   // for all slices in this batch
     }
   };
+  // Pass 3 is a prefix sum over the edge metadata. It is performed in
+  // three steps: the point and triangle counts are summed per slice (in
+  // parallel), the slice sums are scanned to produce slice offsets, and then
+  // each slice converts its row counts into offsets (in parallel).
+  struct SliceSums
+  {
+    vtkIdType NumPts;
+    vtkIdType NumTris;
+  };
+  struct AddSliceSums
+  {
+    SliceSums operator()(const SliceSums& a, const SliceSums& b) const
+    {
+      return SliceSums{ a.NumPts + b.NumPts, a.NumTris + b.NumTris };
+    }
+  };
+  template <class TT>
+  class Pass3Sums
+  {
+  public:
+    Pass3Sums(vtkFlyingEdges3DAlgorithm<TT>* algo, SliceSums* sums)
+      : Algo(algo)
+      , Sums(sums)
+    {
+    }
+    vtkFlyingEdges3DAlgorithm<TT>* Algo;
+    SliceSums* Sums;
+    void operator()(vtkIdType slice, vtkIdType end)
+    {
+      for (; slice < end; ++slice)
+      {
+        SliceSums sums{ 0, 0 };
+        vtkIdType* eMD = this->Algo->EdgeMetaData + slice * 6 * this->Algo->Dims[1];
+        for (vtkIdType row = 0; row < this->Algo->Dims[1]; ++row, eMD += 6)
+        {
+          sums.NumPts += eMD[0] + eMD[1] + eMD[2];
+          sums.NumTris += eMD[3];
+        }
+        this->Sums[slice] = sums;
+      }
+    }
+  };
+  template <class TT>
+  class Pass3Offsets
+  {
+  public:
+    Pass3Offsets(vtkFlyingEdges3DAlgorithm<TT>* algo, const SliceSums* offsets)
+      : Algo(algo)
+      , Offsets(offsets)
+    {
+    }
+    vtkFlyingEdges3DAlgorithm<TT>* Algo;
+    const SliceSums* Offsets;
+    void operator()(vtkIdType slice, vtkIdType end)
+    {
+      vtkIdType numXPts, numYPts, numZPts, numTris;
+      for (; slice < end; ++slice)
+      {
+        vtkIdType numOutPts = this->Offsets[slice].NumPts;
+        vtkIdType numOutTris = this->Offsets[slice].NumTris;
+        vtkIdType* eMD = this->Algo->EdgeMetaData + slice * 6 * this->Algo->Dims[1];
+        for (vtkIdType row = 0; row < this->Algo->Dims[1]; ++row, eMD += 6)
+        {
+          numXPts = eMD[0];
+          numYPts = eMD[1];
+          numZPts = eMD[2];
+          numTris = eMD[3];
+          eMD[0] = numOutPts;
+          eMD[1] = eMD[0] + numXPts;
+          eMD[2] = eMD[1] + numYPts;
+          eMD[3] = numOutTris;
+          numOutPts += numXPts + numYPts + numZPts;
+          numOutTris += numTris;
+        }
+      }
+    }
+  };
   template <class TT>
   class Pass4
   {
@@ -1354,11 +1432,9 @@ void vtkFlyingEdges3DAlgorithm<T>::Contour(vtkFlyingEdges3D* self, vtkImageData*
 {
   double value, *values = self->GetValues();
   vtkIdType numContours = self->GetNumberOfContours();
-  vtkIdType vidx, row, slice, *eMD, zInc;
-  vtkIdType numOutXPts, numOutYPts, numOutZPts, numOutTris;
-  vtkIdType numXPts = 0, numYPts = 0, numZPts = 0, numTris = 0;
-  vtkIdType startXPts, startYPts, startZPts, startTris;
-  startXPts = startYPts = startZPts = startTris = 0;
+  vtkIdType vidx;
+  vtkIdType numOutPts, numOutTris;
+  vtkIdType startPts = 0, startTris = 0;
 
   // This may be subvolume of the total 3D image. Capture information for
   // subsequent processing.
@@ -1421,42 +1497,25 @@ void vtkFlyingEdges3DAlgorithm<T>::Contour(vtkFlyingEdges3D* self, vtkImageData*
 
     // PASS 3: Now allocate and generate output. First we have to update the
     // edge meta data to partition the output into separate pieces so
-    // independent threads can write without collisions. Once allocation is
-    // complete, the volume is processed on a voxel row by row basis to
-    // produce output points and triangles, and interpolate point attribute
-    // data (as necessary). NOTE: This implementation is serial. It is
-    // possible to use a threaded prefix sum to make it even faster. Since
-    // this pass usually takes a small amount of time, we choose simplicity
-    // over performance.
-    numOutXPts = startXPts;
-    numOutYPts = startYPts;
-    numOutZPts = startZPts;
-    numOutTris = startTris;
-
-    // Count number of points and tris generate along each cell row
-    for (slice = 0; slice < algo.Dims[2]; ++slice)
-    {
-      zInc = slice * algo.Dims[1];
-      for (row = 0; row < algo.Dims[1]; ++row)
-      {
-        eMD = algo.EdgeMetaData + (zInc + row) * 6;
-        numXPts = eMD[0];
-        numYPts = eMD[1];
-        numZPts = eMD[2];
-        numTris = eMD[3];
-        eMD[0] = numOutXPts + numOutYPts + numOutZPts;
-        eMD[1] = eMD[0] + numXPts;
-        eMD[2] = eMD[1] + numYPts;
-        eMD[3] = numOutTris;
-        numOutXPts += numXPts;
-        numOutYPts += numYPts;
-        numOutZPts += numZPts;
-        numOutTris += numTris;
-      }
-    }
+    // independent threads can write without collisions. This is a threaded
+    // prefix sum: the counts are summed per slice, the slice sums are scanned
+    // (the extra last entry ends up holding the totals), and the rows of each
+    // slice are then converted to offsets. Once allocation is complete, the
+    // volume is processed on a voxel row by row basis to produce output
+    // points and triangles, and interpolate point attribute data (as
+    // necessary).
+    std::vector<SliceSums> sliceOffsets(algo.Dims[2] + 1, SliceSums{ 0, 0 });
+    Pass3Sums<T> pass3Sums(&algo, sliceOffsets.data());
+    vtkSMPTools::For(0, algo.Dims[2], pass3Sums);
+    vtkSMPTools::ExclusiveScan(sliceOffsets.begin(), sliceOffsets.end(), sliceOffsets.begin(),
+      SliceSums{ startPts, startTris }, AddSliceSums());
+    Pass3Offsets<T> pass3Offsets(&algo, sliceOffsets.data());
+    vtkSMPTools::For(0, algo.Dims[2], pass3Offsets);
+    numOutPts = sliceOffsets.back().NumPts;
+    numOutTris = sliceOffsets.back().NumTris;
 
     // Output can now be allocated.
-    vtkIdType totalPts = numOutXPts + numOutYPts + numOutZPts;
+    vtkIdType totalPts = numOutPts;
     if (totalPts > 0)
     {
       newPts->GetData()->WriteVoidPointer(0, 3 * totalPts);
@@ -1509,9 +1568,7 @@ void vtkFlyingEdges3DAlgorithm<T>::Contour(vtkFlyingEdges3D* self, vtkImageData*
     } // if anything generated
 
     // Handle multiple contours
-    startXPts = numOutXPts;
-    startYPts = numOutYPts;
-    startZPts = numOutZPts;
+    startPts = numOutPts;
     startTris = numOutTris;
 
     // Process Cell Data: Some applications require the production of cell
@@ -2,20 +2,247 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkGlyph2D.h"
 
-#include "vtkCell.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkDoubleArray.h"
+#include "vtkGlyphInternal.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTransform.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <cmath>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGlyph2D);
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Compute the 2D glyph of each input point. The source of the glyph (if any)
+// is computed first for all points, then the transform and the attributes of
+// each glyph are computed again while the glyph is generated.
+struct Glyph2DWorker
+{
+  vtkDataSet* Input;
+  const unsigned char* GhostLevels;
+  vtkDataArray* Scalars;
+  vtkDataArray* Vectors;
+  const std::vector<GlyphSource>& Sources;
+  bool HaveVectors;
+  double Den;
+  int ScaleMode;
+  int ColorMode;
+  int IndexMode;
+  bool Scaling;
+  bool Orient;
+  bool Clamping;
+  double ScaleFactor;
+  double Range[2];
+
+  GlyphGenerator* Generator = nullptr;
+  vtkDataArray* NewScalars = nullptr;
+  vtkDataArray* NewVectors = nullptr;
+  ArrayList PointArrays;
+  vtkSMPThreadLocalObject<vtkTransform> Transform;
+
+  Glyph2DWorker(vtkGlyph2D* self, vtkDataSet* input, const unsigned char* ghostLevels,
+    vtkDataArray* scalars, vtkDataArray* vectors, const std::vector<GlyphSource>& sources,
+    bool haveVectors, double den)
+    : Input(input)
+    , GhostLevels(ghostLevels)
+    , Scalars(scalars)
+    , Vectors(vectors)
+    , Sources(sources)
+    , HaveVectors(haveVectors)
+    , Den(den)
+    , ScaleMode(self->GetScaleMode())
+    , ColorMode(self->GetColorMode())
+    , IndexMode(self->GetIndexMode())
+    , Scaling(self->GetScaling() != 0)
+    , Orient(self->GetOrient() != 0)
+    , Clamping(self->GetClamping() != 0)
+    , ScaleFactor(self->GetScaleFactor())
+  {
+    self->GetRange(this->Range);
+  }
+
+  // Compute the scale and vector of the glyph of the point, and return the
+  // index of its source, or -1 if the point is not glyphed.
+  int ComputeParameters(vtkIdType ptId, double scale[2], double v[3], double& vMag) const
+  {
+    double s = 0.0;
+    scale[0] = scale[1] = 1.0;
+    v[0] = v[1] = v[2] = 0.0;
+    vMag = 0.0;
+
+    // Get the scalar and vector data
+    if (this->Scalars)
+    {
+      s = this->Scalars->GetComponent(ptId, 0);
+      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+      {
+        scale[0] = scale[1] = s;
+      }
+    }
+
+    if (this->HaveVectors)
+    {
+      this->Vectors->GetTuple(ptId, v);
+      vMag = vtkMath::Norm(v);
+      if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
+      {
+        scale[0] = v[0];
+        scale[1] = v[1];
+      }
+      else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+      {
+        scale[0] = scale[1] = vMag;
+      }
+    }
+
+    // Clamp data scale if enabled
+    if (this->Clamping)
+    {
+      for (int i = 0; i < 2; ++i)
+      {
+        scale[i] = (scale[i] < this->Range[0]
+            ? this->Range[0]
+            : (scale[i] > this->Range[1] ? this->Range[1] : scale[i]));
+        scale[i] = (scale[i] - this->Range[0]) / this->Den;
+      }
+    }
+
+    // Compute index into table of glyphs
+    int index = 0;
+    if (this->IndexMode != VTK_INDEXING_OFF)
+    {
+      const int numberOfSources = static_cast<int>(this->Sources.size());
+      const double value = this->IndexMode == VTK_INDEXING_BY_SCALAR ? s : vMag;
+      index = static_cast<int>((value - this->Range[0]) * numberOfSources / this->Den);
+      index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
+    }
+
+    // Make sure we're not indexing into empty glyph
+    if (index < 0 || this->Sources[index].Source == nullptr)
+    {
+      return -1;
+    }
+
+    // Check ghost/blanked points.
+    if (this->GhostLevels &&
+      this->GhostLevels[ptId] &
+        (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
+    {
+      return -1;
+    }
+    return index;
+  }
+
+  void operator()(const GlyphPlacement& glyph)
+  {
+    const vtkIdType inPtId = glyph.GlyphId;
+    const vtkIdType ptIncr = glyph.FirstPoint;
+    const vtkIdType numGlyphPts = glyph.NumberOfPoints;
+    double scale[2], v[3], vMag;
+    this->ComputeParameters(inPtId, scale, v, vMag);
+    double scalex = scale[0];
+    double scaley = scale[1];
+
+    // Now begin copying/transforming glyph
+    vtkTransform* trans = this->Transform.Local();
+    trans->Identity();
+
+    // translate Source to Input point
+    double x[3];
+    this->Input->GetPoint(inPtId, x);
+    x[2] = 0.0;
+    trans->Translate(x[0], x[1], 0.0);
+
+    if (this->HaveVectors)
+    {
+      // Copy Input vector
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->NewVectors->SetTuple(i + ptIncr, v);
+      }
+      if (this->Orient && (vMag > 0.0))
+      {
+        const double theta = vtkMath::DegreesFromRadians(atan2(v[1], v[0]));
+        trans->RotateWXYZ(theta, 0.0, 0.0, 1.0);
+      }
+    }
+
+    // determine scale factor from scalars if appropriate
+    if (this->Scalars)
+    {
+      // Copy scalar value
+      if (this->ColorMode == VTK_COLOR_BY_SCALE)
+      {
+        for (vtkIdType i = 0; i < numGlyphPts; i++)
+        {
+          this->NewScalars->SetTuple(i + ptIncr, &scalex);
+        }
+      }
+      else if (this->ColorMode == VTK_COLOR_BY_SCALAR)
+      {
+        for (vtkIdType i = 0; i < numGlyphPts; i++)
+        {
+          this->NewScalars->SetTuple(i + ptIncr, inPtId, this->Scalars);
+        }
+      }
+    }
+    if (this->HaveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
+    {
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->NewScalars->SetTuple(i + ptIncr, &vMag);
+      }
+    }
+
+    // scale data if appropriate
+    if (this->Scaling)
+    {
+      if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+      {
+        scalex = scaley = this->ScaleFactor;
+      }
+      else
+      {
+        scalex *= this->ScaleFactor;
+        scaley *= this->ScaleFactor;
+      }
+
+      if (scalex == 0.0)
+      {
+        scalex = 1.0e-10;
+      }
+      if (scaley == 0.0)
+      {
+        scaley = 1.0e-10;
+      }
+      trans->Scale(scalex, scaley, 1.0);
+    }
+
+    // multiply points and normals by resulting matrix
+    this->Generator->TransformPoints(glyph, trans->GetMatrix(), x);
+    this->Generator->TransformNormals(glyph, trans->GetMatrix());
+
+    // Copy point data from source (if possible)
+    for (vtkIdType i = 0; i < numGlyphPts; i++)
+    {
+      this->PointArrays.Copy(i, ptIncr + i);
+    }
+  }
+};
+} // anonymous namespace
+
 int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationVector** inputVector,
   vtkInformationVector* outputVector)
 {
@@ -26,23 +253,14 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   vtkDataArray* inScalars;
   vtkDataArray* inVectors;
   unsigned char* inGhostLevels = nullptr;
-  vtkDataArray *inNormals, *sourceNormals = nullptr;
-  vtkIdType numPts, numSourcePts, numSourceCells, inPtId, i;
-  int index;
-  vtkPoints* sourcePts = nullptr;
+  vtkDataArray* inNormals;
+  vtkIdType numPts, i;
   vtkPoints* newPts;
   vtkDataArray* newScalars = nullptr;
   vtkDataArray* newVectors = nullptr;
   vtkDataArray* newNormals = nullptr;
-  double x[3], v[3], s = 0.0, vMag = 0.0, value, theta;
-  vtkTransform* trans = vtkTransform::New();
-  vtkCell* cell;
-  vtkIdList* cellPts;
-  int npts;
-  vtkIdList* pts;
-  vtkIdType ptIncr, cellId;
-  int haveVectors, haveNormals;
-  double scalex, scaley, den;
+  bool haveVectors, haveNormals;
+  double den;
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
   vtkPointData* outputPD = output->GetPointData();
   vtkDataSet* input = vtkDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
@@ -51,9 +269,6 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
 
   vtkDebugMacro(<< "Generating 2D glyphs");
 
-  pts = vtkIdList::New();
-  pts->Allocate(VTK_CELL_SIZE);
-
   pd = input->GetPointData();
 
   inScalars = this->GetInputArrayToProcess(0, inputVector);
@@ -78,8 +293,6 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   if (numPts < 1)
   {
     vtkDebugMacro(<< "No points to glyph!");
-    pts->Delete();
-    trans->Delete();
     return 1;
   }
 
@@ -89,23 +302,14 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   {
     den = 1.0;
   }
-  if (this->VectorMode != VTK_VECTOR_ROTATION_OFF &&
+  haveVectors = this->VectorMode != VTK_VECTOR_ROTATION_OFF &&
     ((this->VectorMode == VTK_USE_VECTOR && inVectors != nullptr) ||
-      (this->VectorMode == VTK_USE_NORMAL && inNormals != nullptr)))
-  {
-    haveVectors = 1;
-  }
-  else
-  {
-    haveVectors = 0;
-  }
+      (this->VectorMode == VTK_USE_NORMAL && inNormals != nullptr));
 
   if (inNormals && numPts != inNormals->GetNumberOfTuples())
   {
     vtkErrorMacro(<< "Number of points (" << numPts << ") does not match "
                   << "number of normals (" << inNormals->GetNumberOfTuples() << ").");
-    pts->Delete();
-    trans->Delete();
     return 1;
   }
 
@@ -113,8 +317,6 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   {
     vtkErrorMacro(<< "Number of points (" << numPts << ") does not match "
                   << "number of vectors (" << inVectors->GetNumberOfTuples() << ").");
-    pts->Delete();
-    trans->Delete();
     return 1;
   }
 
@@ -122,8 +324,6 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   {
     vtkErrorMacro(<< "Number of points (" << numPts << ") does not match "
                   << "number of scalars (" << inScalars->GetNumberOfTuples() << ").");
-    pts->Delete();
-    trans->Delete();
     return 1;
   }
 
@@ -135,8 +335,6 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
     if (this->GetSource(0, inputVector[1]) == nullptr)
     {
       vtkErrorMacro(<< "Indexing on but don't have data to index with");
-      pts->Delete();
-      trans->Delete();
       return 1;
     }
     else
@@ -150,304 +348,113 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   //
   outputPD->CopyVectorsOff();
   outputPD->CopyNormalsOff();
+  std::vector<GlyphSource> sources;
   if (this->IndexMode != VTK_INDEXING_OFF)
   {
     pd = nullptr;
-    // numSourcePts = numSourceCells = 0;
-    haveNormals = 1;
-    for (numSourcePts = numSourceCells = i = 0; i < numberOfSources; i++)
+    haveNormals = true;
+    sources.resize(numberOfSources);
+    for (i = 0; i < numberOfSources; i++)
     {
       source = this->GetSource(i, inputVector[1]);
-      if (source != nullptr)
+      sources[i].Initialize(source);
+      if (source != nullptr && !source->GetPointData()->GetNormals())
       {
-        numSourcePts += source->GetNumberOfPoints();
-        numSourceCells += source->GetNumberOfCells();
-        sourceNormals = source->GetPointData()->GetNormals();
-        if (!sourceNormals)
-        {
-          haveNormals = 0;
-        }
+        haveNormals = false;
       }
     }
   }
   else
   {
     source = this->GetSource(0, inputVector[1]);
-    sourcePts = source->GetPoints();
-    numSourcePts = sourcePts->GetNumberOfPoints();
-    numSourceCells = source->GetNumberOfCells();
+    sources.resize(1);
+    sources[0].Initialize(source);
+    haveNormals = source && source->GetPointData()->GetNormals();
 
-    sourceNormals = source->GetPointData()->GetNormals();
-    if (sourceNormals)
-    {
-      haveNormals = 1;
-    }
-    else
+    // Prepare to copy output.
+    pd = source && !this->GenerateInstances ? source->GetPointData() : nullptr;
+  }
+  if (this->GenerateInstances)
+  {
+    haveNormals = false;
+  }
+
+  // Make the following GetPoint() calls thread safe
+  double x[3];
+  input->GetPoint(0, x);
+
+  // Find the source of the glyph of each input point, then the place of
+  // each glyph in the output.
+  vtkDataArray* vectors = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
+  Glyph2DWorker worker(
+    this, input, inGhostLevels, inScalars, vectors, sources, haveVectors, den);
+  std::vector<int> glyphSources(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double scale[2], v[3], vMag;
+    for (; ptId < endPtId; ++ptId)
     {
-      haveNormals = 0;
+      glyphSources[ptId] = worker.ComputeParameters(ptId, scale, v, vMag);
     }
+  });
+  GlyphGenerator generator(this, sources, numPts, std::move(glyphSources),
+    this->GenerateInstances != 0);
+  const vtkIdType numOutPts = generator.GetNumberOfPoints();
 
-    // Prepare to copy output.
-    pd = source->GetPointData();
-    outputPD->CopyAllocate(pd, numPts * numSourcePts);
+  if (pd)
+  {
+    outputPD->CopyAllocate(pd, numOutPts);
+    worker.PointArrays.AddArrays(numOutPts, pd, outputPD, 0.0, false);
   }
 
   newPts = vtkPoints::New();
-  newPts->Allocate(numPts * numSourcePts);
+  newPts->SetNumberOfPoints(numOutPts);
   if (this->ColorMode == VTK_COLOR_BY_SCALAR && inScalars)
   {
     newScalars = inScalars->NewInstance();
     newScalars->SetNumberOfComponents(inScalars->GetNumberOfComponents());
-    newScalars->Allocate(inScalars->GetNumberOfComponents() * numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
   }
   else if ((this->ColorMode == VTK_COLOR_BY_SCALE) && inScalars)
   {
     newScalars = vtkDoubleArray::New();
-    newScalars->Allocate(numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
     newScalars->SetName("GlyphScale");
   }
   else if ((this->ColorMode == VTK_COLOR_BY_VECTOR) && haveVectors)
   {
     newScalars = vtkDoubleArray::New();
-    newScalars->Allocate(numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
     newScalars->SetName("VectorMagnitude");
   }
   if (haveVectors)
   {
     newVectors = vtkDoubleArray::New();
     newVectors->SetNumberOfComponents(3);
-    newVectors->Allocate(3 * numPts * numSourcePts);
+    newVectors->SetNumberOfTuples(numOutPts);
     newVectors->SetName("GlyphVector");
   }
   if (haveNormals)
   {
     newNormals = vtkDoubleArray::New();
     newNormals->SetNumberOfComponents(3);
-    newNormals->Allocate(3 * numPts * numSourcePts);
+    newNormals->SetNumberOfTuples(numOutPts);
     newNormals->SetName("Normals");
   }
 
-  // Setting up for calls to PolyData::InsertNextCell()
-  if (this->IndexMode != VTK_INDEXING_OFF)
-  {
-    output->AllocateEstimate(numPts * numSourceCells, 3);
-  }
-  else
-  {
-    output->AllocateProportional(
-      this->GetSource(0, inputVector[1]), static_cast<double>(numSourceCells));
-  }
-
   // Traverse all Input points, transforming Source points and copying
   // point attributes.
   //
-  ptIncr = 0;
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    scalex = scaley = 1.0;
-    if (!(inPtId % 10000))
-    {
-      this->UpdateProgress(static_cast<double>(inPtId) / numPts);
-      if (this->CheckAbort())
-      {
-        break;
-      }
-    }
-
-    // Get the scalar and vector data
-    if (inScalars)
-    {
-      s = inScalars->GetComponent(inPtId, 0);
-      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
-      {
-        scalex = scaley = s;
-      }
-    }
-
-    if (haveVectors)
-    {
-      if (this->VectorMode == VTK_USE_NORMAL)
-      {
-        inNormals->GetTuple(inPtId, v);
-      }
-      else
-      {
-        inVectors->GetTuple(inPtId, v);
-      }
-      vMag = vtkMath::Norm(v);
-      if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
-      {
-        scalex = v[0];
-        scaley = v[1];
-      }
-      else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
-      {
-        scalex = scaley = vMag;
-      }
-    }
-
-    // Clamp data scale if enabled
-    if (this->Clamping)
-    {
-      scalex = (scalex < this->Range[0] ? this->Range[0]
-                                        : (scalex > this->Range[1] ? this->Range[1] : scalex));
-      scalex = (scalex - this->Range[0]) / den;
-      scaley = (scaley < this->Range[0] ? this->Range[0]
-                                        : (scaley > this->Range[1] ? this->Range[1] : scaley));
-      scaley = (scaley - this->Range[0]) / den;
-    }
-
-    // Compute index into table of glyphs
-    if (this->IndexMode == VTK_INDEXING_OFF)
-    {
-      index = 0;
-    }
-    else
-    {
-      if (this->IndexMode == VTK_INDEXING_BY_SCALAR)
-      {
-        value = s;
-      }
-      else
-      {
-        value = vMag;
-      }
-
-      index = static_cast<int>((value - this->Range[0]) * numberOfSources / den);
-      index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
-
-      source = this->GetSource(index, inputVector[1]);
-      if (source != nullptr)
-      {
-        sourcePts = source->GetPoints();
-        sourceNormals = source->GetPointData()->GetNormals();
-        numSourcePts = sourcePts->GetNumberOfPoints();
-        numSourceCells = source->GetNumberOfCells();
-      }
-    }
-
-    // Make sure we're not indexing into empty glyph
-    if (this->GetSource(index, inputVector[1]) == nullptr)
-    {
-      continue;
-    }
-
-    // Check ghost/blanked points.
-    if (inGhostLevels &&
-      inGhostLevels[inPtId] &
-        (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
-    {
-      continue;
-    }
-
-    // Now begin copying/transforming glyph
-    trans->Identity();
-
-    // Copy all topology (transformation independent)
-    for (cellId = 0; cellId < numSourceCells; cellId++)
-    {
-      cell = this->GetSource(index, inputVector[1])->GetCell(cellId);
-      cellPts = cell->GetPointIds();
-      npts = cellPts->GetNumberOfIds();
-      for (pts->Reset(), i = 0; i < npts; i++)
-      {
-        pts->InsertId(i, cellPts->GetId(i) + ptIncr);
-      }
-      output->InsertNextCell(cell->GetCellType(), pts);
-    }
-
-    // translate Source to Input point
-    input->GetPoint(inPtId, x);
-    trans->Translate(x[0], x[1], 0.0);
-
-    if (haveVectors)
-    {
-      // Copy Input vector
-      for (i = 0; i < numSourcePts; i++)
-      {
-        newVectors->InsertTuple(i + ptIncr, v);
-      }
-      if (this->Orient && (vMag > 0.0))
-      {
-        theta = vtkMath::DegreesFromRadians(atan2(v[1], v[0]));
-        trans->RotateWXYZ(theta, 0.0, 0.0, 1.0);
-      }
-    }
-
-    // determine scale factor from scalars if appropriate
-    if (inScalars)
-    {
-      // Copy scalar value
-      if (this->ColorMode == VTK_COLOR_BY_SCALE)
-      {
-        for (i = 0; i < numSourcePts; i++)
-        {
-          newScalars->InsertTuple(i + ptIncr, &scalex);
-        }
-      }
-      else if (this->ColorMode == VTK_COLOR_BY_SCALAR)
-      {
-        for (i = 0; i < numSourcePts; i++)
-        {
-          outputPD->CopyTuple(inScalars, newScalars, inPtId, ptIncr + i);
-        }
-      }
-    }
-    if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        newScalars->InsertTuple(i + ptIncr, &vMag);
-      }
-    }
-
-    // scale data if appropriate
-    if (this->Scaling)
-    {
-      if (this->ScaleMode == VTK_DATA_SCALING_OFF)
-      {
-        scalex = scaley = this->ScaleFactor;
-      }
-      else
-      {
-        scalex *= this->ScaleFactor;
-        scaley *= this->ScaleFactor;
-      }
-
-      if (scalex == 0.0)
-      {
-        scalex = 1.0e-10;
-      }
-      if (scaley == 0.0)
-      {
-        scaley = 1.0e-10;
-      }
-      trans->Scale(scalex, scaley, 1.0);
-    }
-
-    // multiply points and normals by resulting matrix
-    trans->TransformPoints(sourcePts, newPts);
-
-    if (haveNormals)
-    {
-      trans->TransformNormals(sourceNormals, newNormals);
-    }
-
-    // Copy point data from source (if possible)
-    if (pd)
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        outputPD->CopyData(pd, i, ptIncr + i);
-      }
-    }
-    ptIncr += numSourcePts;
-  }
+  generator.SetOutputArrays(newPts, newNormals);
+  worker.Generator = &generator;
+  worker.NewScalars = newScalars;
+  worker.NewVectors = newVectors;
+  const bool completed = generator.Generate(output, worker);
 
   // Update ourselves and release memory
   //
   output->SetPoints(newPts);
   newPts->Delete();
+  generator.AddInstanceArrays(outputPD);
 
   if (newScalars)
   {
@@ -468,9 +475,17 @@ int vtkGlyph2D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
     newNormals->Delete();
   }
 
+  if (!completed)
+  {
+    // Do not output partially generated glyphs.
+    output->Initialize();
+  }
   output->Squeeze();
-  trans->Delete();
-  pts->Delete();
+
+  if (this->GenerateInstances)
+  {
+    this->MoveInstances(inputVector[1], outputVector);
+  }
 
   return 1;
 }
@@ -2,29 +2,408 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkGlyph3D.h"
 
-#include "vtkCell.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCellData.h"
 #include "vtkFloatArray.h"
-#include "vtkIdList.h"
+#include "vtkGlyphInternal.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTable.h"
 #include "vtkTransform.h"
 #include "vtkTrivialProducer.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGlyph3D);
 vtkCxxSetObjectMacro(vtkGlyph3D, SourceTransform, vtkTransform);
 
+namespace
+{
+//------------------------------------------------------------------------------
+// The glyph used when no source is defined: a line from (0,0,0) to (1,0,0).
+vtkSmartPointer<vtkPolyData> NewDefaultSource()
+{
+  vtkNew<vtkPolyData> defaultSource;
+  defaultSource->AllocateExact(0, 0, 1, 2, 0, 0, 0, 0);
+  vtkNew<vtkPoints> defaultPoints;
+  defaultPoints->Allocate(6);
+  defaultPoints->InsertNextPoint(0, 0, 0);
+  defaultPoints->InsertNextPoint(1, 0, 0);
+  vtkIdType defaultPointIds[2];
+  defaultPointIds[0] = 0;
+  defaultPointIds[1] = 1;
+  defaultSource->SetPoints(defaultPoints);
+  defaultSource->InsertNextCell(VTK_LINE, 2, defaultPointIds);
+  return defaultSource;
+}
+
+//------------------------------------------------------------------------------
+// What the data of an input point gives to its glyph.
+struct GlyphParameters
+{
+  double Scale[3];
+  double Vector[3];
+  double VectorMagnitude;
+};
+
+//------------------------------------------------------------------------------
+// Compute the glyph of each input point. The source of the glyph (if any) is
+// computed first for all points, then the transform and the attributes of
+// each glyph are computed again while the glyph is generated.
+struct Glyph3DWorker
+{
+  vtkDataSet* Input;
+  vtkUniformGrid* InputUG;
+  const unsigned char* GhostLevels;
+  vtkDataArray* ScaleScalars;
+  vtkDataArray* ColorScalars;
+  vtkDataArray* Vectors;
+  const std::vector<GlyphSource>& Sources;
+  bool HaveVectors;
+  double Den;
+  int ScaleMode;
+  int ColorMode;
+  int VectorMode;
+  int IndexMode;
+  bool Scaling;
+  bool Orient;
+  bool Clamping;
+  double ScaleFactor;
+  double Range[2];
+  double FollowedCameraPosition[3];
+  double FollowedCameraViewUp[3];
+
+  GlyphGenerator* Generator = nullptr;
+  vtkDataArray* SourceTCoords = nullptr;
+  vtkDataArray* NewScalars = nullptr;
+  vtkDataArray* NewVectors = nullptr;
+  vtkDataArray* NewTCoords = nullptr;
+  vtkIdTypeArray* PointIds = nullptr;
+  ArrayList PointArrays;
+  ArrayList CellArrays;
+  vtkSMPThreadLocalObject<vtkTransform> Transform;
+
+  Glyph3DWorker(vtkGlyph3D* self, vtkDataSet* input, const unsigned char* ghostLevels,
+    vtkDataArray* scaleScalars, vtkDataArray* colorScalars, vtkDataArray* vectors,
+    const std::vector<GlyphSource>& sources, bool haveVectors, double den)
+    : Input(input)
+    , InputUG(vtkUniformGrid::SafeDownCast(input))
+    , GhostLevels(ghostLevels)
+    , ScaleScalars(scaleScalars)
+    , ColorScalars(colorScalars)
+    , Vectors(vectors)
+    , Sources(sources)
+    , HaveVectors(haveVectors)
+    , Den(den)
+    , ScaleMode(self->GetScaleMode())
+    , ColorMode(self->GetColorMode())
+    , VectorMode(self->GetVectorMode())
+    , IndexMode(self->GetIndexMode())
+    , Scaling(self->GetScaling() != 0)
+    , Orient(self->GetOrient() != 0)
+    , Clamping(self->GetClamping() != 0)
+    , ScaleFactor(self->GetScaleFactor())
+  {
+    self->GetRange(this->Range);
+    self->GetFollowedCameraPosition(this->FollowedCameraPosition);
+    self->GetFollowedCameraViewUp(this->FollowedCameraViewUp);
+  }
+
+  // Compute the parameters of the glyph of the point, and return the index
+  // of its source, or -1 if the point is not glyphed.
+  int ComputeParameters(vtkIdType ptId, GlyphParameters& params) const
+  {
+    double* scale = params.Scale;
+    double* v = params.Vector;
+    double s = 0.0;
+    scale[0] = scale[1] = scale[2] = 1.0;
+    v[0] = v[1] = v[2] = 0.0;
+    params.VectorMagnitude = 0.0;
+
+    // Get the scalar and vector data
+    if (this->ScaleScalars)
+    {
+      s = this->ScaleScalars->GetComponent(ptId, 0);
+      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+      {
+        scale[0] = scale[1] = scale[2] = s;
+      }
+    }
+
+    if (this->HaveVectors)
+    {
+      if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
+      {
+        params.VectorMagnitude = 1.0; // v is the direction of the camera
+      }
+      else
+      {
+        this->Vectors->GetTuple(ptId, v);
+        params.VectorMagnitude = vtkMath::Norm(v);
+        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
+        {
+          scale[0] = v[0];
+          scale[1] = v[1];
+          scale[2] = v[2];
+        }
+        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+        {
+          scale[0] = scale[1] = scale[2] = params.VectorMagnitude;
+        }
+      }
+    }
+
+    // Clamp data scale if enabled
+    if (this->Clamping)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        scale[i] = (scale[i] < this->Range[0]
+            ? this->Range[0]
+            : (scale[i] > this->Range[1] ? this->Range[1] : scale[i]));
+        scale[i] = (scale[i] - this->Range[0]) / this->Den;
+      }
+    }
+
+    // Compute index into table of glyphs
+    int index = 0;
+    if (this->IndexMode != VTK_INDEXING_OFF)
+    {
+      const int numberOfSources = static_cast<int>(this->Sources.size());
+      const double value =
+        this->IndexMode == VTK_INDEXING_BY_SCALAR ? s : params.VectorMagnitude;
+      index = static_cast<int>((value - this->Range[0]) * numberOfSources / this->Den);
+      index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
+    }
+
+    // Make sure we're not indexing into empty glyph
+    if (index < 0 || this->Sources[index].Source == nullptr)
+    {
+      return -1;
+    }
+
+    // Check ghost points.
+    // If we are processing a piece, we do not want to duplicate glyphs on the borders.
+    if (this->GhostLevels &&
+      this->GhostLevels[ptId] &
+        (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
+    {
+      return -1;
+    }
+
+    // input is a vtkUniformGrid and the current point is blanked. Don't glyph
+    // it.
+    if (this->InputUG && !this->InputUG->IsPointVisible(ptId))
+    {
+      return -1;
+    }
+    return index;
+  }
+
+  // The direction from the point to the followed camera.
+  void GetCameraDirection(vtkIdType ptId, double v[3]) const
+  {
+    double x[3];
+    this->Input->GetPoint(ptId, x);
+    v[0] = this->FollowedCameraPosition[0] - x[0];
+    v[1] = this->FollowedCameraPosition[1] - x[1];
+    v[2] = this->FollowedCameraPosition[2] - x[2];
+    vtkMath::Normalize(v);
+  }
+
+  void operator()(const GlyphPlacement& glyph)
+  {
+    const vtkIdType inPtId = glyph.GlyphId;
+    const vtkIdType ptIncr = glyph.FirstPoint;
+    const vtkIdType numGlyphPts = glyph.NumberOfPoints;
+    GlyphParameters params;
+    this->ComputeParameters(inPtId, params);
+    double* v = params.Vector;
+    double scalex = params.Scale[0];
+    double scaley = params.Scale[1];
+    double scalez = params.Scale[2];
+    const double vMag = params.VectorMagnitude;
+
+    // Now begin copying/transforming glyph
+    vtkTransform* trans = this->Transform.Local();
+    trans->Identity();
+
+    // translate Source to Input point
+    double x[3];
+    this->Input->GetPoint(inPtId, x);
+    trans->Translate(x[0], x[1], x[2]);
+
+    if (this->HaveVectors)
+    {
+      if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
+      {
+        // As in the serial implementation, the output vector is the camera
+        // direction of the previous glyph with Orient on, zero for the first
+        // glyph or with Orient off.
+        double glyphVector[3] = { 0.0, 0.0, 0.0 };
+        if (this->Orient)
+        {
+          vtkIdType previous = inPtId - 1;
+          while (previous >= 0 && this->Generator->GetSourceIndex(previous) < 0)
+          {
+            --previous;
+          }
+          if (previous >= 0)
+          {
+            this->GetCameraDirection(previous, glyphVector);
+          }
+        }
+        for (vtkIdType i = 0; i < numGlyphPts; i++)
+        {
+          this->NewVectors->SetTuple(i + ptIncr, glyphVector);
+        }
+
+        if (this->Orient)
+        {
+          // v = glyphNormal_World (glyph normal direction in World coordinate system)
+          this->GetCameraDirection(inPtId, v);
+          double glyphRight_World[3]; // glyph right direction in World coordinate system
+          vtkMath::Cross(this->FollowedCameraViewUp, v, glyphRight_World);
+          // glyph up direction in World coordinate system
+          // (approximately the same as this->FollowedCameraViewUp, but slightly adjusted to be
+          // orthogonal to the normal direction)
+          double glyphUp_World[3];
+          vtkMath::Cross(v, glyphRight_World, glyphUp_World);
+          double glyphToWorld[16] = { glyphRight_World[0], glyphUp_World[0], v[0], 0.0,
+            glyphRight_World[1], glyphUp_World[1], v[1], 0.0, glyphRight_World[2], glyphUp_World[2],
+            v[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
+          trans->Concatenate(glyphToWorld);
+        }
+      }
+      else if (this->Orient && vMag > 0.0)
+      {
+        // if there is no y or z component
+        if (v[1] == 0.0 && v[2] == 0.0)
+        {
+          if (v[0] < 0) // just flip x if we need to
+          {
+            trans->RotateWXYZ(180.0, 0, 1, 0);
+          }
+        }
+        else
+        {
+          trans->RotateWXYZ(180.0, (v[0] + vMag) / 2.0, v[1] / 2.0, v[2] / 2.0);
+        }
+      }
+
+      // Copy Input vector
+      if (this->VectorMode != VTK_FOLLOW_CAMERA_DIRECTION)
+      {
+        for (vtkIdType i = 0; i < numGlyphPts; i++)
+        {
+          this->NewVectors->SetTuple(i + ptIncr, v);
+        }
+      }
+    }
+
+    if (this->NewTCoords)
+    {
+      double tc[3];
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->SourceTCoords->GetTuple(i, tc);
+        this->NewTCoords->SetTuple(i + ptIncr, tc);
+      }
+    }
+
+    // determine scale factor from scalars if appropriate
+    // Copy scalar value
+    if (this->ScaleScalars && this->ColorMode == VTK_COLOR_BY_SCALE)
+    {
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->NewScalars->SetTuple(i + ptIncr, &scalex); // = scaley = scalez
+      }
+    }
+    else if (this->ColorScalars && this->ColorMode == VTK_COLOR_BY_SCALAR)
+    {
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->NewScalars->SetTuple(i + ptIncr, inPtId, this->ColorScalars);
+      }
+    }
+    if (this->HaveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
+    {
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->NewScalars->SetTuple(i + ptIncr, &vMag);
+      }
+    }
+
+    // scale data if appropriate
+    if (this->Scaling)
+    {
+      if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+      {
+        scalex = scaley = scalez = this->ScaleFactor;
+      }
+      else
+      {
+        scalex *= this->ScaleFactor;
+        scaley *= this->ScaleFactor;
+        scalez *= this->ScaleFactor;
+      }
+
+      if (scalex == 0.0)
+      {
+        scalex = 1.0e-10;
+      }
+      if (scaley == 0.0)
+      {
+        scaley = 1.0e-10;
+      }
+      if (scalez == 0.0)
+      {
+        scalez = 1.0e-10;
+      }
+      trans->Scale(scalex, scaley, scalez);
+    }
+
+    // multiply points and normals by resulting matrix
+    this->Generator->TransformPoints(glyph, trans->GetMatrix(), x);
+    this->Generator->TransformNormals(glyph, trans->GetMatrix());
+
+    // Copy point data from source (if possible)
+    for (vtkIdType i = 0; i < numGlyphPts; ++i)
+    {
+      this->PointArrays.Copy(inPtId, ptIncr + i);
+    }
+    for (vtkIdType i = 0; i < glyph.NumberOfCells; ++i)
+    {
+      this->CellArrays.Copy(inPtId, glyph.FirstCell + i);
+    }
+
+    // If point ids are to be generated, do it here
+    if (this->PointIds)
+    {
+      for (vtkIdType i = 0; i < numGlyphPts; i++)
+      {
+        this->PointIds->SetValue(i + ptIncr, inPtId);
+      }
+    }
+  }
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct object with scaling on, scaling mode is by scalar value,
 // scale factor = 1.0, the range is (0,1), orient geometry is on, and
@@ -51,7 +430,9 @@ vtkGlyph3D::vtkGlyph3D()
   this->PointIdsName = nullptr;
   this->SetPointIdsName("InputPointIds");
   this->SetNumberOfInputPorts(2);
+  this->SetNumberOfOutputPorts(3);
   this->FillCellData = 0;
+  this->GenerateInstances = 0;
   this->SourceTransform = nullptr;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
 
@@ -97,7 +478,15 @@ int vtkGlyph3D::RequestData(vtkInformation* vtkNotUsed(request), vtkInformationV
   vtkDataSet* input = vtkDataSet::GetData(inputVector[0], 0);
   vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
 
-  return this->Execute(input, inputVector[1], output) ? 1 : 0;
+  if (!this->Execute(input, inputVector[1], output))
+  {
+    return 0;
+  }
+  if (this->GenerateInstances)
+  {
+    this->MoveInstances(inputVector[1], outputVector);
+  }
+  return 1;
 }
 
 //------------------------------------------------------------------------------
@@ -119,46 +508,27 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     return true;
   }
 
-  // this is used to respect blanking specified on uniform grids.
-  vtkUniformGrid* inputUG = vtkUniformGrid::SafeDownCast(input);
-
   vtkPointData* pd;
   vtkDataArray* inCScalars; // Scalars for Coloring
   unsigned char* inGhostLevels = nullptr;
-  vtkDataArray *inNormals, *sourceNormals = nullptr;
+  vtkDataArray* inNormals;
   vtkDataArray* sourceTCoords = nullptr;
-  vtkIdType numPts, numSourcePts, numSourceCells, inPtId, i;
-  vtkPoints* sourcePts = nullptr;
-  vtkSmartPointer<vtkPoints> transformedSourcePts = vtkSmartPointer<vtkPoints>::New();
+  vtkIdType numPts, i;
   vtkPoints* newPts;
   vtkDataArray* newScalars = nullptr;
   vtkDataArray* newVectors = nullptr;
   vtkDataArray* newNormals = nullptr;
   vtkDataArray* newTCoords = nullptr;
-  double x[3], v[3], vNew[3], s = 0.0, vMag = 0.0, value, tc[3];
-  vtkTransform* trans = vtkTransform::New();
-  vtkNew<vtkIdList> pointIdList;
-  vtkIdList* cellPts;
-  int npts;
-  vtkIdList* pts;
-  vtkIdType ptIncr, cellIncr, cellId;
-  int haveVectors, haveNormals, haveTCoords = 0;
-  double scalex, scaley, scalez, den;
+  bool haveVectors, haveNormals, haveTCoords = false;
+  double den;
   vtkPointData* outputPD = output->GetPointData();
   vtkCellData* outputCD = output->GetCellData();
   int numberOfSources = this->GetNumberOfInputConnections(1);
   vtkIdTypeArray* pointIds = nullptr;
   vtkSmartPointer<vtkPolyData> source = this->GetSource(0, sourceVector);
-  vtkNew<vtkIdList> srcPointIdList;
-  vtkNew<vtkIdList> dstPointIdList;
-  vtkNew<vtkIdList> srcCellIdList;
-  vtkNew<vtkIdList> dstCellIdList;
 
   vtkDebugMacro(<< "Generating glyphs");
 
-  pts = vtkIdList::New();
-  pts->Allocate(VTK_CELL_SIZE);
-
   pd = input->GetPointData();
   inNormals = this->GetInputArrayToProcess(2, input);
   inCScalars = this->GetInputArrayToProcess(3, input);
@@ -185,8 +555,6 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   if (numPts < 1)
   {
     vtkDebugMacro(<< "No points to glyph!");
-    pts->Delete();
-    trans->Delete();
     return true;
   }
 
@@ -196,17 +564,10 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   {
     den = 1.0;
   }
-  if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION ||
+  haveVectors = this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION ||
     (this->VectorMode != VTK_VECTOR_ROTATION_OFF &&
       ((this->VectorMode == VTK_USE_VECTOR && inVectors != nullptr) ||
-        (this->VectorMode == VTK_USE_NORMAL && inNormals != nullptr))))
-  {
-    haveVectors = 1;
-  }
-  else
-  {
-    haveVectors = 0;
-  }
+        (this->VectorMode == VTK_USE_NORMAL && inNormals != nullptr)));
 
   if ((this->IndexMode == VTK_INDEXING_BY_SCALAR && !inSScalars) ||
     (this->IndexMode == VTK_INDEXING_BY_VECTOR &&
@@ -216,8 +577,6 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     if (source == nullptr)
     {
       vtkErrorMacro(<< "Indexing on but don't have data to index with");
-      pts->Delete();
-      trans->Delete();
       return true;
     }
     else
@@ -227,6 +586,14 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     }
   }
 
+  vtkDataArray* array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
+  if (haveVectors && this->VectorMode != VTK_FOLLOW_CAMERA_DIRECTION &&
+    array3D->GetNumberOfComponents() > 3)
+  {
+    vtkErrorMacro(<< "vtkDataArray " << array3D->GetName() << " has more than 3 components.\n");
+    return false;
+  }
+
   // Allocate storage for output PolyData
   //
   outputPD->CopyVectorsOff();
@@ -235,85 +602,82 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
 
   if (source == nullptr)
   {
-    vtkNew<vtkPolyData> defaultSource;
-    defaultSource->AllocateExact(0, 0, 1, 2, 0, 0, 0, 0);
-    vtkNew<vtkPoints> defaultPoints;
-    defaultPoints->Allocate(6);
-    defaultPoints->InsertNextPoint(0, 0, 0);
-    defaultPoints->InsertNextPoint(1, 0, 0);
-    vtkIdType defaultPointIds[2];
-    defaultPointIds[0] = 0;
-    defaultPointIds[1] = 1;
-    defaultSource->SetPoints(defaultPoints);
-    defaultSource->InsertNextCell(VTK_LINE, 2, defaultPointIds);
-    source = defaultSource;
+    source = NewDefaultSource();
   }
 
+  // Gather the table of glyphs
+  std::vector<GlyphSource> sources;
   if (this->IndexMode != VTK_INDEXING_OFF)
   {
     pd = nullptr;
-    haveNormals = 1;
-    for (numSourcePts = numSourceCells = i = 0; i < numberOfSources; i++)
+    haveNormals = true;
+    sources.resize(numberOfSources);
+    for (i = 0; i < numberOfSources; i++)
     {
-      source = this->GetSource(i, sourceVector);
-      if (source != nullptr)
+      vtkPolyData* indexedSource = this->GetSource(i, sourceVector);
+      sources[i].Initialize(indexedSource, this->SourceTransform);
+      if (indexedSource != nullptr && !indexedSource->GetPointData()->GetNormals())
       {
-        if (source->GetNumberOfPoints() > numSourcePts)
-        {
-          numSourcePts = source->GetNumberOfPoints();
-        }
-        if (source->GetNumberOfCells() > numSourceCells)
-        {
-          numSourceCells = source->GetNumberOfCells();
-        }
-        if (!(sourceNormals = source->GetPointData()->GetNormals()))
-        {
-          haveNormals = 0;
-        }
+        haveNormals = false;
       }
     }
   }
   else
   {
-    sourcePts = source->GetPoints();
-    numSourcePts = sourcePts->GetNumberOfPoints();
-    numSourceCells = source->GetNumberOfCells();
-
-    sourceNormals = source->GetPointData()->GetNormals();
-    if (sourceNormals)
-    {
-      haveNormals = 1;
-    }
-    else
-    {
-      haveNormals = 0;
-    }
-
+    sources.resize(1);
+    sources[0].Initialize(source, this->SourceTransform);
+    haveNormals = source->GetPointData()->GetNormals() != nullptr;
     sourceTCoords = source->GetPointData()->GetTCoords();
-    if (sourceTCoords)
+    haveTCoords = sourceTCoords != nullptr;
+  }
+  if (this->GenerateInstances)
+  {
+    haveNormals = haveTCoords = false;
+  }
+
+  // Make the following GetPoint() calls thread safe
+  double x[3];
+  input->GetPoint(0, x);
+
+  // Find the source of the glyph of each input point, then the place of
+  // each glyph in the output.
+  Glyph3DWorker worker(
+    this, input, inGhostLevels, inSScalars, inCScalars, array3D, sources, haveVectors, den);
+  std::vector<int> glyphSources(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    GlyphParameters params;
+    for (; ptId < endPtId; ++ptId)
     {
-      haveTCoords = 1;
+      glyphSources[ptId] = worker.ComputeParameters(ptId, params);
     }
-    else
+  });
+  // IsPointVisible() may be overridden by subclasses that are not thread
+  // safe, it is called serially.
+  for (i = 0; i < numPts; i++)
+  {
+    if (glyphSources[i] >= 0 && !this->IsPointVisible(input, i))
     {
-      haveTCoords = 0;
+      glyphSources[i] = -1;
     }
+  }
+  GlyphGenerator generator(this, sources, numPts, std::move(glyphSources),
+    this->GenerateInstances != 0);
+  const vtkIdType numOutPts = generator.GetNumberOfPoints();
+  const vtkIdType numOutCells = generator.GetNumberOfCells();
 
-    // Prepare to copy output.
-    pd = input->GetPointData();
-    outputPD->CopyAllocate(pd, numPts * numSourcePts);
-    if (this->FillCellData)
+  // Prepare to copy output.
+  if (pd)
+  {
+    outputPD->CopyAllocate(pd, numOutPts);
+    worker.PointArrays.AddArrays(numOutPts, pd, outputPD, 0.0, false);
+    if (this->FillCellData && !this->GenerateInstances)
     {
       outputCD->CopyGlobalIdsOn();
-      outputCD->CopyAllocate(pd, numPts * numSourceCells);
+      outputCD->CopyAllocate(pd, numOutCells);
+      worker.CellArrays.AddArrays(numOutCells, pd, outputCD, 0.0, false);
     }
   }
 
-  srcPointIdList->SetNumberOfIds(numSourcePts);
-  dstPointIdList->SetNumberOfIds(numSourcePts);
-  srcCellIdList->SetNumberOfIds(numSourceCells);
-  dstCellIdList->SetNumberOfIds(numSourceCells);
-
   newPts = vtkPoints::New();
 
   // Set the desired precision for the points in the output.
@@ -330,12 +694,12 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     newPts->SetDataType(VTK_DOUBLE);
   }
 
-  newPts->Allocate(numPts * numSourcePts);
+  newPts->SetNumberOfPoints(numOutPts);
   if (this->GeneratePointIds)
   {
     pointIds = vtkIdTypeArray::New();
     pointIds->SetName(this->PointIdsName);
-    pointIds->Allocate(numPts * numSourcePts);
+    pointIds->SetNumberOfValues(numOutPts);
     outputPD->AddArray(pointIds);
     pointIds->Delete();
   }
@@ -343,13 +707,13 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   {
     newScalars = inCScalars->NewInstance();
     newScalars->SetNumberOfComponents(inCScalars->GetNumberOfComponents());
-    newScalars->Allocate(inCScalars->GetNumberOfComponents() * numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
     newScalars->SetName(inCScalars->GetName());
   }
   else if ((this->ColorMode == VTK_COLOR_BY_SCALE) && inSScalars)
   {
     newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
     newScalars->SetName("GlyphScale");
     if (this->ScaleMode == VTK_SCALE_BY_SCALAR)
     {
@@ -359,360 +723,48 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   else if ((this->ColorMode == VTK_COLOR_BY_VECTOR) && haveVectors)
   {
     newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
     newScalars->SetName("VectorMagnitude");
   }
   if (haveVectors)
   {
     newVectors = vtkFloatArray::New();
     newVectors->SetNumberOfComponents(3);
-    newVectors->Allocate(3 * numPts * numSourcePts);
+    newVectors->SetNumberOfTuples(numOutPts);
     newVectors->SetName("GlyphVector");
   }
   if (haveNormals)
   {
     newNormals = vtkFloatArray::New();
     newNormals->SetNumberOfComponents(3);
-    newNormals->Allocate(3 * numPts * numSourcePts);
+    newNormals->SetNumberOfTuples(numOutPts);
     newNormals->SetName("Normals");
   }
   if (haveTCoords)
   {
     newTCoords = vtkFloatArray::New();
-    int numComps = sourceTCoords->GetNumberOfComponents();
-    newTCoords->SetNumberOfComponents(numComps);
-    newTCoords->Allocate(numComps * numPts * numSourcePts);
+    newTCoords->SetNumberOfComponents(sourceTCoords->GetNumberOfComponents());
+    newTCoords->SetNumberOfTuples(numOutPts);
     newTCoords->SetName("TCoords");
   }
 
-  // Setting up for calls to PolyData::InsertNextCell()
-  output->AllocateEstimate(numPts * numSourceCells, 3);
-
-  transformedSourcePts->SetDataTypeToDouble();
-  transformedSourcePts->Allocate(numSourcePts);
-
   // Traverse all Input points, transforming Source points and copying
   // point attributes.
   //
-  ptIncr = 0;
-  cellIncr = 0;
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    scalex = scaley = scalez = 1.0;
-    if (!(inPtId % 10000))
-    {
-      this->UpdateProgress(static_cast<double>(inPtId) / numPts);
-      if (this->CheckAbort())
-      {
-        break;
-      }
-    }
-
-    // Get the scalar and vector data
-    if (inSScalars)
-    {
-      s = inSScalars->GetComponent(inPtId, 0);
-      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
-      {
-        scalex = scaley = scalez = s;
-      }
-    }
-
-    if (haveVectors)
-    {
-      if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
-      {
-        vMag = 1.0; // v will be set later
-      }
-      else
-      {
-        vtkDataArray* array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
-        if (array3D->GetNumberOfComponents() > 3)
-        {
-          vtkErrorMacro(<< "vtkDataArray " << array3D->GetName()
-                        << " has more than 3 components.\n");
-          pts->Delete();
-          trans->Delete();
-          if (newPts)
-          {
-            newPts->Delete();
-          }
-          if (newVectors)
-          {
-            newVectors->Delete();
-          }
-          return false;
-        }
-
-        v[0] = 0;
-        v[1] = 0;
-        v[2] = 0;
-        array3D->GetTuple(inPtId, v);
-        vMag = vtkMath::Norm(v);
-        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
-        {
-          scalex = v[0];
-          scaley = v[1];
-          scalez = v[2];
-        }
-        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
-        {
-          scalex = scaley = scalez = vMag;
-        }
-      }
-    }
-
-    // Clamp data scale if enabled
-    if (this->Clamping)
-    {
-      scalex = (scalex < this->Range[0] ? this->Range[0]
-                                        : (scalex > this->Range[1] ? this->Range[1] : scalex));
-      scalex = (scalex - this->Range[0]) / den;
-      scaley = (scaley < this->Range[0] ? this->Range[0]
-                                        : (scaley > this->Range[1] ? this->Range[1] : scaley));
-      scaley = (scaley - this->Range[0]) / den;
-      scalez = (scalez < this->Range[0] ? this->Range[0]
-                                        : (scalez > this->Range[1] ? this->Range[1] : scalez));
-      scalez = (scalez - this->Range[0]) / den;
-    }
-
-    // Compute index into table of glyphs
-    if (this->IndexMode != VTK_INDEXING_OFF)
-    {
-      if (this->IndexMode == VTK_INDEXING_BY_SCALAR)
-      {
-        value = s;
-      }
-      else
-      {
-        value = vMag;
-      }
-
-      int index = static_cast<int>((value - this->Range[0]) * numberOfSources / den);
-      index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
-
-      source = this->GetSource(index, sourceVector);
-      if (source != nullptr)
-      {
-        sourcePts = source->GetPoints();
-        sourceNormals = source->GetPointData()->GetNormals();
-        numSourcePts = sourcePts->GetNumberOfPoints();
-        numSourceCells = source->GetNumberOfCells();
-      }
-    }
-
-    // Make sure we're not indexing into empty glyph
-    if (source == nullptr)
-    {
-      continue;
-    }
-
-    // Check ghost points.
-    // If we are processing a piece, we do not want to duplicate glyphs on the borders.
-    if (inGhostLevels &&
-      inGhostLevels[inPtId] &
-        (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
-    {
-      continue;
-    }
-
-    if (inputUG && !inputUG->IsPointVisible(inPtId))
-    {
-      // input is a vtkUniformGrid and the current point is blanked. Don't glyph
-      // it.
-      continue;
-    }
-
-    if (!this->IsPointVisible(input, inPtId))
-    {
-      continue;
-    }
-
-    // Now begin copying/transforming glyph
-    trans->Identity();
-
-    // Copy all topology (transformation independent)
-    for (cellId = 0; cellId < numSourceCells; cellId++)
-    {
-      source->GetCellPoints(cellId, pointIdList);
-      cellPts = pointIdList;
-      npts = cellPts->GetNumberOfIds();
-      for (pts->Reset(), i = 0; i < npts; i++)
-      {
-        pts->InsertId(i, cellPts->GetId(i) + ptIncr);
-      }
-      output->InsertNextCell(source->GetCellType(cellId), pts);
-    }
-
-    // translate Source to Input point
-    input->GetPoint(inPtId, x);
-    trans->Translate(x[0], x[1], x[2]);
-
-    if (haveVectors)
-    {
-      // Copy Input vector
-      for (i = 0; i < numSourcePts; i++)
-      {
-        newVectors->InsertTuple(i + ptIncr, v);
-      }
-      if (this->Orient)
-      {
-        if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
-        {
-          // v = glyphNormal_World (glyph normal direction in World coordinate system)
-          v[0] = this->FollowedCameraPosition[0] - x[0];
-          v[1] = this->FollowedCameraPosition[1] - x[1];
-          v[2] = this->FollowedCameraPosition[2] - x[2];
-          vtkMath::Normalize(v);
-          double glyphRight_World[3]; // glyph right direction in World coordinate system
-          vtkMath::Cross(this->FollowedCameraViewUp, v, glyphRight_World);
-          // glyph up direction in World coordinate system
-          // (approximately the same as this->FollowedCameraViewUp, but slightly adjusted to be
-          // orthogonal to the normal direction)
-          double glyphUp_World[3];
-          vtkMath::Cross(v, glyphRight_World, glyphUp_World);
-          double glyphToWorld[16] = { glyphRight_World[0], glyphUp_World[0], v[0], 0.0,
-            glyphRight_World[1], glyphUp_World[1], v[1], 0.0, glyphRight_World[2], glyphUp_World[2],
-            v[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
-          trans->Concatenate(glyphToWorld);
-        }
-        else if (vMag > 0.0)
-        {
-          // if there is no y or z component
-          if (v[1] == 0.0 && v[2] == 0.0)
-          {
-            if (v[0] < 0) // just flip x if we need to
-            {
-              trans->RotateWXYZ(180.0, 0, 1, 0);
-            }
-          }
-          else
-          {
-            vNew[0] = (v[0] + vMag) / 2.0;
-            vNew[1] = v[1] / 2.0;
-            vNew[2] = v[2] / 2.0;
-            trans->RotateWXYZ(180.0, vNew[0], vNew[1], vNew[2]);
-          }
-        }
-      }
-    }
-
-    if (haveTCoords)
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        sourceTCoords->GetTuple(i, tc);
-        newTCoords->InsertTuple(i + ptIncr, tc);
-      }
-    }
-
-    // determine scale factor from scalars if appropriate
-    // Copy scalar value
-    if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        newScalars->InsertTuple(i + ptIncr, &scalex); // = scaley = scalez
-      }
-    }
-    else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        outputPD->CopyTuple(inCScalars, newScalars, inPtId, ptIncr + i);
-      }
-    }
-    if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        newScalars->InsertTuple(i + ptIncr, &vMag);
-      }
-    }
-
-    // scale data if appropriate
-    if (this->Scaling)
-    {
-      if (this->ScaleMode == VTK_DATA_SCALING_OFF)
-      {
-        scalex = scaley = scalez = this->ScaleFactor;
-      }
-      else
-      {
-        scalex *= this->ScaleFactor;
-        scaley *= this->ScaleFactor;
-        scalez *= this->ScaleFactor;
-      }
-
-      if (scalex == 0.0)
-      {
-        scalex = 1.0e-10;
-      }
-      if (scaley == 0.0)
-      {
-        scaley = 1.0e-10;
-      }
-      if (scalez == 0.0)
-      {
-        scalez = 1.0e-10;
-      }
-      trans->Scale(scalex, scaley, scalez);
-    }
-
-    // multiply points and normals by resulting matrix
-    if (this->SourceTransform)
-    {
-      transformedSourcePts->Reset();
-      this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
-      trans->TransformPoints(transformedSourcePts, newPts);
-    }
-    else
-    {
-      trans->TransformPoints(sourcePts, newPts);
-    }
-
-    if (haveNormals)
-    {
-      trans->TransformNormals(sourceNormals, newNormals);
-    }
-
-    // Copy point data from source (if possible)
-    if (pd)
-    {
-      for (i = 0; i < numSourcePts; ++i)
-      {
-        srcPointIdList->SetId(i, inPtId);
-        dstPointIdList->SetId(i, ptIncr + i);
-      }
-      outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
-      if (this->FillCellData)
-      {
-        for (i = 0; i < numSourceCells; ++i)
-        {
-          srcCellIdList->SetId(i, inPtId);
-          dstCellIdList->SetId(i, cellIncr + i);
-        }
-        outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
-      }
-    }
-
-    // If point ids are to be generated, do it here
-    if (this->GeneratePointIds)
-    {
-      for (i = 0; i < numSourcePts; i++)
-      {
-        pointIds->InsertNextValue(inPtId);
-      }
-    }
-
-    ptIncr += numSourcePts;
-    cellIncr += numSourceCells;
-  }
+  generator.SetOutputArrays(newPts, newNormals);
+  worker.Generator = &generator;
+  worker.SourceTCoords = sourceTCoords;
+  worker.NewScalars = newScalars;
+  worker.NewVectors = newVectors;
+  worker.NewTCoords = newTCoords;
+  worker.PointIds = pointIds;
+  const bool completed = generator.Generate(output, worker);
 
   // Update ourselves and release memory
   //
   output->SetPoints(newPts);
   newPts->Delete();
+  generator.AddInstanceArrays(outputPD);
 
   if (newScalars)
   {
@@ -739,13 +791,46 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     newTCoords->Delete();
   }
 
+  if (!completed)
+  {
+    // Do not output partially generated glyphs.
+    output->Initialize();
+  }
   output->Squeeze();
-  trans->Delete();
-  pts->Delete();
 
   return true;
 }
 
+//------------------------------------------------------------------------------
+void vtkGlyph3D::MoveInstances(
+  vtkInformationVector* sourceVector, vtkInformationVector* outputVector)
+{
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, GLYPHS_PORT);
+  vtkTable* instances = vtkTable::GetData(outputVector, INSTANCES_PORT);
+  vtkPartitionedDataSet* sources = vtkPartitionedDataSet::GetData(outputVector, SOURCES_PORT);
+
+  // The positions of the glyphs are the translations of their transforms.
+  instances->GetRowData()->ShallowCopy(output->GetPointData());
+  output->Initialize();
+
+  const int numberOfSources = this->GetNumberOfInputConnections(1);
+  if (numberOfSources == 0)
+  {
+    sources->SetPartition(0, NewDefaultSource());
+    return;
+  }
+  sources->SetNumberOfPartitions(numberOfSources);
+  for (int id = 0; id < numberOfSources; ++id)
+  {
+    if (vtkPolyData* source = this->GetSource(id, sourceVector))
+    {
+      vtkNew<vtkPolyData> copy;
+      copy->ShallowCopy(source);
+      sources->SetPartition(id, copy);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 // Specify a source object at a specified table location.
 void vtkGlyph3D::SetSourceConnection(int id, vtkAlgorithmOutput* algOutput)
@@ -893,6 +978,7 @@ void vtkGlyph3D::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Fill Cell Data: " << (this->FillCellData ? "On\n" : "Off\n");
+  os << indent << "Generate Instances: " << (this->GenerateInstances ? "On\n" : "Off\n");
 
   os << indent << "SourceTransform: ";
   if (this->SourceTransform)
@@ -959,4 +1045,20 @@ int vtkGlyph3D::FillInputPortInformation(int port, vtkInformation* info)
   }
   return 0;
 }
+
+//------------------------------------------------------------------------------
+int vtkGlyph3D::FillOutputPortInformation(int port, vtkInformation* info)
+{
+  if (port == INSTANCES_PORT)
+  {
+    info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkTable");
+    return 1;
+  }
+  else if (port == SOURCES_PORT)
+  {
+    info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkPartitionedDataSet");
+    return 1;
+  }
+  return this->Superclass::FillOutputPortInformation(port, info);
+}
 VTK_ABI_NAMESPACE_END
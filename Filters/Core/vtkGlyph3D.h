@@ -22,6 +22,11 @@
  * you'll have to decide whether to index into it with scalar value or with
  * vector magnitude.
  *
+ * The glyphs are generated in parallel with vtkSMPTools. Consumers that can
+ * draw instances of the sources may turn GenerateInstances on to get one
+ * transform per glyph, on the second output, and the sources, on the third
+ * output, instead of the geometry of the glyphs.
+ *
  * @warning
  * The scaling of the glyphs is controlled by the ScaleFactor ivar multiplied
  * by the scalar value at each point (if VTK_SCALE_BY_SCALAR is set), or
@@ -290,9 +295,39 @@ public:
   vtkBooleanMacro(FillCellData, vtkTypeBool);
   ///@}
 
+  /**
+   * The output ports of the filter. The glyphs are on the first output. The
+   * two other outputs are only filled with GenerateInstances on.
+   */
+  enum OutputPorts
+  {
+    GLYPHS_PORT = 0,
+    INSTANCES_PORT = 1,
+    SOURCES_PORT = 2
+  };
+
+  ///@{
+  /**
+   * Enable/disable the generation of glyph instances instead of glyph
+   * geometry, for consumers that draw instances of the sources. When on, the
+   * first output is empty, the second output is a vtkTable with one row per
+   * glyph and the third output is a vtkPartitionedDataSet holding each
+   * source of the table of glyphs once, partition i holding source i (the
+   * default glyph, a line, when no source is defined). The columns of the
+   * table are the row-major 4x4 matrix mapping the source to the glyph (the
+   * 16-component "GlyphTransform" column, SourceTransform included), the
+   * index of the source ("GlyphSourceIndex"), and the attributes of the
+   * glyph: scalars, vector, point ids and input point data. Source normals,
+   * texture coordinates and FillCellData do not apply. Off by default.
+   */
+  vtkSetMacro(GenerateInstances, vtkTypeBool);
+  vtkGetMacro(GenerateInstances, vtkTypeBool);
+  vtkBooleanMacro(GenerateInstances, vtkTypeBool);
+  ///@}
+
   /**
    * This can be overwritten by subclass to return 0 when a point is
-   * blanked. Default implementation is to always return 1;
+   * blanked. Default implementation is to always return 1.
    */
   virtual int IsPointVisible(vtkDataSet*, vtkIdType) { return 1; }
 
@@ -328,14 +363,24 @@ protected:
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int, vtkInformation*) override;
+  int FillOutputPortInformation(int, vtkInformation*) override;
 
   vtkPolyData* GetSource(int idx, vtkInformationVector* sourceInfo);
 
+  /**
+   * Called by RequestData() with GenerateInstances on: move the instances,
+   * generated by Execute() as the points of the first output, to the rows of
+   * the second output, and shallow copy the sources to the third output.
+   */
+  void MoveInstances(vtkInformationVector* sourceVector, vtkInformationVector* outputVector);
+
   ///@{
   /**
    * Method called in RequestData() to do the actual data processing. This will
    * glyph the \c input, filling up the \c output based on the filter
-   * parameters.
+   * parameters. With GenerateInstances on, the \c output has one point per
+   * glyph, at the glyph position, and no cells, the attributes of the
+   * instances being its point data.
    */
   virtual bool Execute(vtkDataSet* input, vtkInformationVector* sourceVector, vtkPolyData* output);
   virtual bool Execute(vtkDataSet* input, vtkInformationVector* sourceVector, vtkPolyData* output,
@@ -357,6 +402,7 @@ protected:
   int IndexMode;                  // what to use to index into glyph table
   vtkTypeBool GeneratePointIds;   // produce input points ids for each output point
   vtkTypeBool FillCellData;       // whether to fill output cell data
+  vtkTypeBool GenerateInstances;  // output glyph transforms instead of geometry
   char* PointIdsName;
   vtkTransform* SourceTransform;
   int OutputPointsPrecision;
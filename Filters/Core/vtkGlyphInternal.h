@@ -0,0 +1,533 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkGlyphInternal
+ * @brief   parallel copy of glyph geometry
+ *
+ * vtkGlyphInternal gathers the glyphing engine shared by vtkGlyph3D,
+ * vtkGlyph2D and vtkTensorGlyph. The geometry of each source is gathered
+ * once, and every glyph is a copy of one of the sources (or nothing). The
+ * glyphs are processed by batches of consecutive ids with vtkSMPTools: a
+ * first pass counts the points and cells of each batch, a scan of the counts
+ * gives the place of each glyph in the output, and a second pass copies the
+ * cells and lets the filter fill the points and attributes of each glyph. The
+ * output is the one of a serial traversal of the glyphs, whatever the number
+ * of threads.
+ *
+ * In instance mode, a glyph is not copied: it becomes a single output point
+ * carrying the 4x4 matrix that maps its source to the glyph, and the index of
+ * its source.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkGlyph3D vtkGlyph2D vtkTensorGlyph
+ */
+
+#ifndef vtkGlyphInternal_h
+#define vtkGlyphInternal_h
+
+#include "vtkAlgorithm.h"
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkTransform.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// The geometry of a glyph source, gathered once so that the glyphs can be
+// copied in parallel. The points are converted to double after the optional
+// source transform, and the cells are split by kind (verts, lines, polys and
+// strips) like the cells of a vtkPolyData.
+struct GlyphSource
+{
+  vtkPolyData* Source = nullptr;
+  vtkIdType NumberOfPoints = 0;
+  vtkIdType NumberOfCells = 0;
+  std::vector<double> Points;
+  std::vector<double> Normals; // empty if the source has no normals
+  std::vector<vtkIdType> Offsets[4];
+  std::vector<vtkIdType> Connectivity[4];
+  bool HasTransform = false;
+  double Transform[16];
+
+  void Initialize(vtkPolyData* source, vtkTransform* transform = nullptr)
+  {
+    this->Source = source;
+    if (!source || !source->GetPoints())
+    {
+      return;
+    }
+    vtkPoints* points = source->GetPoints();
+    vtkNew<vtkPoints> transformedPoints;
+    if (transform)
+    {
+      transformedPoints->SetDataTypeToDouble();
+      transform->TransformPoints(points, transformedPoints);
+      points = transformedPoints;
+      vtkMatrix4x4::DeepCopy(this->Transform, transform->GetMatrix());
+      this->HasTransform = true;
+    }
+    this->NumberOfPoints = points->GetNumberOfPoints();
+    this->NumberOfCells = source->GetNumberOfCells();
+    this->Points.resize(3 * this->NumberOfPoints);
+    for (vtkIdType ptId = 0; ptId < this->NumberOfPoints; ++ptId)
+    {
+      points->GetPoint(ptId, this->Points.data() + 3 * ptId);
+    }
+    if (vtkDataArray* normals = source->GetPointData()->GetNormals())
+    {
+      this->Normals.resize(3 * this->NumberOfPoints);
+      for (vtkIdType ptId = 0; ptId < this->NumberOfPoints; ++ptId)
+      {
+        normals->GetTuple(ptId, this->Normals.data() + 3 * ptId);
+      }
+    }
+
+    vtkCellArray* cells[4] = { source->GetVerts(), source->GetLines(), source->GetPolys(),
+      source->GetStrips() };
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      const vtkIdType numCells = cells[kind] ? cells[kind]->GetNumberOfCells() : 0;
+      this->Offsets[kind].assign(1, 0);
+      this->Connectivity[kind].clear();
+      for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        cells[kind]->GetCellAtId(cellId, npts, pts);
+        this->Connectivity[kind].insert(this->Connectivity[kind].end(), pts, pts + npts);
+        this->Offsets[kind].push_back(static_cast<vtkIdType>(this->Connectivity[kind].size()));
+      }
+    }
+  }
+
+  // Make this source the given number of copies of another one. The points
+  // of the copies follow each other, while their cells are interleaved: the
+  // copies of the first cell of each kind, then the copies of the second
+  // one, and so on.
+  void Replicate(const GlyphSource& source, int copies)
+  {
+    this->Source = source.Source;
+    this->NumberOfPoints = copies * source.NumberOfPoints;
+    this->NumberOfCells = copies * source.NumberOfCells;
+    this->HasTransform = source.HasTransform;
+    std::copy(source.Transform, source.Transform + 16, this->Transform);
+    this->Points.clear();
+    this->Normals.clear();
+    for (int copy = 0; copy < copies; ++copy)
+    {
+      this->Points.insert(this->Points.end(), source.Points.begin(), source.Points.end());
+      this->Normals.insert(this->Normals.end(), source.Normals.begin(), source.Normals.end());
+    }
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      this->Offsets[kind].assign(1, 0);
+      this->Connectivity[kind].clear();
+      for (vtkIdType cellId = 0; cellId < source.GetNumberOfCells(kind); ++cellId)
+      {
+        const vtkIdType* begin = source.Connectivity[kind].data() + source.Offsets[kind][cellId];
+        const vtkIdType* end = source.Connectivity[kind].data() + source.Offsets[kind][cellId + 1];
+        for (int copy = 0; copy < copies; ++copy)
+        {
+          for (const vtkIdType* ptId = begin; ptId != end; ++ptId)
+          {
+            this->Connectivity[kind].push_back(*ptId + copy * source.NumberOfPoints);
+          }
+          this->Offsets[kind].push_back(static_cast<vtkIdType>(this->Connectivity[kind].size()));
+        }
+      }
+    }
+  }
+
+  vtkIdType GetNumberOfCells(int kind) const
+  {
+    return static_cast<vtkIdType>(this->Offsets[kind].size()) - 1;
+  }
+
+  vtkIdType GetConnectivitySize(int kind) const
+  {
+    return static_cast<vtkIdType>(this->Connectivity[kind].size());
+  }
+};
+
+//------------------------------------------------------------------------------
+// Where a glyph lands in the output: its first point and cell, and how many
+// of them it has. Glyphs of an empty source, or that are not generated, are
+// not visited.
+struct GlyphPlacement
+{
+  vtkIdType GlyphId;
+  int SourceIndex;
+  const GlyphSource* Source;
+  vtkIdType FirstPoint;
+  vtkIdType NumberOfPoints;
+  vtkIdType FirstCell;
+  vtkIdType NumberOfCells;
+};
+
+//------------------------------------------------------------------------------
+// The number of points and cells of a range of glyphs, or the offsets of
+// the first glyph of the range.
+struct GlyphCounts
+{
+  vtkIdType Points = 0;
+  vtkIdType Cells = 0;
+  vtkIdType KindCells[4] = { 0, 0, 0, 0 };
+  vtkIdType Connectivity[4] = { 0, 0, 0, 0 };
+
+  void Add(const GlyphSource& source, bool instances)
+  {
+    if (instances)
+    {
+      ++this->Points;
+      return;
+    }
+    this->Points += source.NumberOfPoints;
+    this->Cells += source.NumberOfCells;
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      this->KindCells[kind] += source.GetNumberOfCells(kind);
+      this->Connectivity[kind] += source.GetConnectivitySize(kind);
+    }
+  }
+
+  void Add(const GlyphCounts& other)
+  {
+    this->Points += other.Points;
+    this->Cells += other.Cells;
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      this->KindCells[kind] += other.KindCells[kind];
+      this->Connectivity[kind] += other.Connectivity[kind];
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// Generate the glyphs in parallel. Each glyph uses the source given by its
+// index in the table of sources (a negative index skips the glyph); without
+// indices, all the glyphs use the first source.
+class GlyphGenerator
+{
+public:
+  static constexpr vtkIdType BatchSize = 1024;
+
+  GlyphGenerator(vtkAlgorithm* filter, const std::vector<GlyphSource>& sources,
+    vtkIdType numGlyphs, std::vector<int> glyphSources, bool instances)
+    : Filter(filter)
+    , Sources(sources)
+    , NumberOfGlyphs(numGlyphs)
+    , GlyphSources(std::move(glyphSources))
+    , Instances(instances)
+  {
+    const vtkIdType numBatches = (numGlyphs + BatchSize - 1) / BatchSize;
+    this->BatchOffsets.resize(numBatches + 1);
+    vtkSMPTools::For(0, numBatches, [&](vtkIdType batch, vtkIdType endBatch) {
+      for (; batch < endBatch; ++batch)
+      {
+        GlyphCounts counts;
+        const vtkIdType endGlyphId = std::min((batch + 1) * BatchSize, numGlyphs);
+        for (vtkIdType glyphId = batch * BatchSize; glyphId < endGlyphId; ++glyphId)
+        {
+          const GlyphSource* source = this->GetSource(glyphId);
+          if (source)
+          {
+            counts.Add(*source, this->Instances);
+          }
+        }
+        this->BatchOffsets[batch + 1] = counts;
+      }
+    });
+    for (vtkIdType batch = 0; batch < numBatches; ++batch)
+    {
+      this->BatchOffsets[batch + 1].Add(this->BatchOffsets[batch]);
+    }
+
+    if (this->Instances)
+    {
+      this->InstanceTransforms->SetName("GlyphTransform");
+      this->InstanceTransforms->SetNumberOfComponents(16);
+      this->InstanceTransforms->SetNumberOfTuples(this->GetNumberOfPoints());
+      this->InstanceSources->SetName("GlyphSourceIndex");
+      this->InstanceSources->SetNumberOfTuples(this->GetNumberOfPoints());
+    }
+  }
+
+  vtkIdType GetNumberOfPoints() const { return this->BatchOffsets.back().Points; }
+  vtkIdType GetNumberOfCells() const { return this->BatchOffsets.back().Cells; }
+
+  // The output points (and normals) that the glyphs are copied into, sized
+  // by the filter.
+  void SetOutputArrays(vtkPoints* points, vtkDataArray* normals)
+  {
+    this->Points = points;
+    this->Normals = normals;
+  }
+
+  // Copy the cells of the glyphs into the output and call the functor on
+  // each glyph, in parallel. The functor fills the points and attributes of
+  // the glyph, with the methods below. Return false if the filter was
+  // aborted, the cells of the output being left empty.
+  template <typename Functor>
+  bool Generate(vtkPolyData* output, Functor& functor)
+  {
+    const GlyphCounts& totals = this->BatchOffsets.back();
+    vtkNew<vtkIdTypeArray> offsets[4];
+    vtkNew<vtkIdTypeArray> connectivity[4];
+    vtkIdType* offsetsData[4];
+    vtkIdType* connectivityData[4];
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      offsets[kind]->SetNumberOfValues(totals.KindCells[kind] + 1);
+      offsets[kind]->SetValue(totals.KindCells[kind], totals.Connectivity[kind]);
+      connectivity[kind]->SetNumberOfValues(totals.Connectivity[kind]);
+      offsetsData[kind] = offsets[kind]->GetPointer(0);
+      connectivityData[kind] = connectivity[kind]->GetPointer(0);
+    }
+
+    const vtkIdType numBatches = static_cast<vtkIdType>(this->BatchOffsets.size()) - 1;
+    vtkSMPTools::For(0, numBatches, 1, [&](vtkIdType batch, vtkIdType endBatch) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (; batch < endBatch; ++batch)
+      {
+        if (isFirst)
+        {
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
+        {
+          break;
+        }
+        GlyphCounts current = this->BatchOffsets[batch];
+        const vtkIdType endGlyphId = std::min((batch + 1) * BatchSize, this->NumberOfGlyphs);
+        for (vtkIdType glyphId = batch * BatchSize; glyphId < endGlyphId; ++glyphId)
+        {
+          const GlyphSource* source = this->GetSource(glyphId);
+          if (!source)
+          {
+            continue;
+          }
+          if (!this->Instances)
+          {
+            CopyCells(*source, current, offsetsData, connectivityData);
+          }
+          GlyphPlacement glyph;
+          glyph.GlyphId = glyphId;
+          glyph.SourceIndex = this->GlyphSources.empty() ? 0 : this->GlyphSources[glyphId];
+          glyph.Source = source;
+          glyph.FirstPoint = current.Points;
+          glyph.NumberOfPoints = this->Instances ? 1 : source->NumberOfPoints;
+          glyph.FirstCell = current.Cells;
+          glyph.NumberOfCells = this->Instances ? 0 : source->NumberOfCells;
+          functor(glyph);
+          current.Add(*source, this->Instances);
+        }
+      }
+    });
+    if (this->Filter->GetAbortOutput())
+    {
+      return false;
+    }
+
+    vtkNew<vtkCellArray> cells[4];
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      cells[kind]->SetData(offsets[kind], connectivity[kind]);
+    }
+    output->SetVerts(cells[0]);
+    output->SetLines(cells[1]);
+    output->SetPolys(cells[2]);
+    output->SetStrips(cells[3]);
+    return true;
+  }
+
+  // Return the index of the source of the glyph, or -1 if the glyph is not
+  // generated.
+  int GetSourceIndex(vtkIdType glyphId) const
+  {
+    return this->GlyphSources.empty() ? 0 : this->GlyphSources[glyphId];
+  }
+
+  // Transform the points of the source of the glyph into its output points.
+  // In instance mode, store the matrix and the source index of the glyph
+  // instead, the output point being the position of the glyph.
+  void TransformPoints(const GlyphPlacement& glyph, vtkMatrix4x4* matrix, const double position[3])
+  {
+    if (this->Instances)
+    {
+      double instance[16];
+      if (glyph.Source->HasTransform)
+      {
+        vtkMatrix4x4::Multiply4x4(matrix->GetData(), glyph.Source->Transform, instance);
+      }
+      else
+      {
+        vtkMatrix4x4::DeepCopy(instance, matrix);
+      }
+      this->InstanceTransforms->SetTypedTuple(glyph.FirstPoint, instance);
+      this->InstanceSources->SetValue(glyph.FirstPoint, glyph.SourceIndex);
+      this->Points->SetPoint(glyph.FirstPoint, position);
+      return;
+    }
+
+    const double* inPts = glyph.Source->Points.data();
+    vtkDataArray* outPts = this->Points->GetData();
+    if (auto floatPts = vtkFloatArray::FastDownCast(outPts))
+    {
+      TransformPoints(matrix->Element, inPts, floatPts->GetPointer(3 * glyph.FirstPoint),
+        glyph.NumberOfPoints);
+    }
+    else if (auto doublePts = vtkDoubleArray::FastDownCast(outPts))
+    {
+      TransformPoints(matrix->Element, inPts, doublePts->GetPointer(3 * glyph.FirstPoint),
+        glyph.NumberOfPoints);
+    }
+    else
+    {
+      double x[3];
+      for (vtkIdType i = 0; i < glyph.NumberOfPoints; ++i)
+      {
+        TransformPoints(matrix->Element, inPts + 3 * i, x, 1);
+        outPts->SetTuple(glyph.FirstPoint + i, x);
+      }
+    }
+  }
+
+  // Transform the normals of the source of the glyph into its output normals
+  // with the inverse transpose of the matrix, like vtkLinearTransform does.
+  void TransformNormals(const GlyphPlacement& glyph, vtkMatrix4x4* matrix)
+  {
+    if (this->Instances || !this->Normals || glyph.Source->Normals.empty())
+    {
+      return;
+    }
+    double normalMatrix[4][4];
+    vtkMatrix4x4::DeepCopy(*normalMatrix, matrix);
+    vtkMatrix4x4::Invert(*normalMatrix, *normalMatrix);
+    vtkMatrix4x4::Transpose(*normalMatrix, *normalMatrix);
+
+    const double* inNormals = glyph.Source->Normals.data();
+    if (auto floatNormals = vtkFloatArray::FastDownCast(this->Normals))
+    {
+      TransformNormals(normalMatrix, inNormals, floatNormals->GetPointer(3 * glyph.FirstPoint),
+        glyph.NumberOfPoints);
+    }
+    else if (auto doubleNormals = vtkDoubleArray::FastDownCast(this->Normals))
+    {
+      TransformNormals(normalMatrix, inNormals, doubleNormals->GetPointer(3 * glyph.FirstPoint),
+        glyph.NumberOfPoints);
+    }
+  }
+
+  // Add the instance arrays to the output point data.
+  void AddInstanceArrays(vtkPointData* outPD)
+  {
+    if (this->Instances)
+    {
+      outPD->AddArray(this->InstanceTransforms);
+      outPD->AddArray(this->InstanceSources);
+    }
+  }
+
+private:
+  const GlyphSource* GetSource(vtkIdType glyphId) const
+  {
+    const int index = this->GlyphSources.empty() ? 0 : this->GlyphSources[glyphId];
+    if (index < 0 || this->Sources[index].NumberOfPoints == 0)
+    {
+      return nullptr;
+    }
+    return &this->Sources[index];
+  }
+
+  // Copy the cells of the source, renumbering their points after the
+  // current ones.
+  static void CopyCells(const GlyphSource& source, const GlyphCounts& current,
+    vtkIdType* offsets[4], vtkIdType* connectivity[4])
+  {
+    for (int kind = 0; kind < 4; ++kind)
+    {
+      const vtkIdType numCells = source.GetNumberOfCells(kind);
+      vtkIdType* outOffsets = offsets[kind] + current.KindCells[kind];
+      for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+      {
+        outOffsets[cellId] = current.Connectivity[kind] + source.Offsets[kind][cellId];
+      }
+      const vtkIdType connSize = source.GetConnectivitySize(kind);
+      vtkIdType* outConn = connectivity[kind] + current.Connectivity[kind];
+      for (vtkIdType i = 0; i < connSize; ++i)
+      {
+        outConn[i] = current.Points + source.Connectivity[kind][i];
+      }
+    }
+  }
+
+  template <typename T>
+  static void TransformPoints(double matrix[4][4], const double* in, T* out, vtkIdType n)
+  {
+    for (vtkIdType i = 0; i < n; ++i, in += 3, out += 3)
+    {
+      const T x = static_cast<T>(
+        matrix[0][0] * in[0] + matrix[0][1] * in[1] + matrix[0][2] * in[2] + matrix[0][3]);
+      const T y = static_cast<T>(
+        matrix[1][0] * in[0] + matrix[1][1] * in[1] + matrix[1][2] * in[2] + matrix[1][3]);
+      const T z = static_cast<T>(
+        matrix[2][0] * in[0] + matrix[2][1] * in[1] + matrix[2][2] * in[2] + matrix[2][3]);
+      out[0] = x;
+      out[1] = y;
+      out[2] = z;
+    }
+  }
+
+  template <typename T>
+  static void TransformNormals(double matrix[4][4], const double* in, T* out, vtkIdType n)
+  {
+    for (vtkIdType i = 0; i < n; ++i, in += 3, out += 3)
+    {
+      const T x = static_cast<T>(matrix[0][0] * in[0] + matrix[0][1] * in[1] + matrix[0][2] * in[2]);
+      const T y = static_cast<T>(matrix[1][0] * in[0] + matrix[1][1] * in[1] + matrix[1][2] * in[2]);
+      const T z = static_cast<T>(matrix[2][0] * in[0] + matrix[2][1] * in[1] + matrix[2][2] * in[2]);
+      out[0] = x;
+      out[1] = y;
+      out[2] = z;
+      vtkMath::Normalize(out);
+    }
+  }
+
+  vtkAlgorithm* Filter;
+  const std::vector<GlyphSource>& Sources;
+  vtkIdType NumberOfGlyphs;
+  std::vector<int> GlyphSources;
+  bool Instances;
+  std::vector<GlyphCounts> BatchOffsets;
+  vtkPoints* Points = nullptr;
+  vtkDataArray* Normals = nullptr;
+  vtkNew<vtkDoubleArray> InstanceTransforms;
+  vtkNew<vtkIntArray> InstanceSources;
+};
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkGlyphInternal.h
@@ -5,6 +5,7 @@
 #include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkConnectivityInternal.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -16,6 +17,7 @@
 #include "vtkPolyData.h"
 
 #include <algorithm> // for fill_n
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPolyDataConnectivityFilter);
@@ -47,6 +49,7 @@ vtkPolyDataConnectivityFilter::vtkPolyDataConnectivityFilter()
   this->VisitedPointIds = vtkIdList::New();
 
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+  this->ParallelLabeling = 0;
 }
 
 vtkPolyDataConnectivityFilter::~vtkPolyDataConnectivityFilter()
@@ -122,7 +125,14 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
   //
   this->Mesh = vtkPolyData::New();
   this->Mesh->CopyStructure(input);
-  this->Mesh->BuildLinks();
+  if (this->ParallelLabeling)
+  {
+    this->Mesh->BuildCells();
+  }
+  else
+  {
+    this->Mesh->BuildLinks();
+  }
   this->UpdateProgress(0.10);
 
   // Remove all visited point ids
@@ -161,8 +171,11 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
   // starts a new connected region. Connected region grows
   // using a connected wave propagation.
   //
-  this->Wave.reserve(numPts);
-  this->Wave2.reserve(numPts);
+  if (!this->ParallelLabeling)
+  {
+    this->Wave.reserve(numPts);
+    this->Wave2.reserve(numPts);
+  }
 
   this->PointNumber = 0;
   this->RegionNumber = 0;
@@ -174,7 +187,11 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
   vtkIdType checkAbortInterval = 0;
 
-  if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if (this->ParallelLabeling)
+  {
+    largestRegionId = this->LabelRegionsInParallel();
+  }
+  else if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
   { // visit all cells marking with region number
@@ -532,6 +549,111 @@ void vtkPolyDataConnectivityFilter::TraverseAndMark()
   } // while wave is not empty
 }
 
+//------------------------------------------------------------------------------
+vtkIdType vtkPolyDataConnectivityFilter::LabelRegionsInParallel()
+{
+  const vtkIdType numPts = this->Mesh->GetNumberOfPoints();
+  const vtkIdType numCells = this->Mesh->GetNumberOfCells();
+
+  // The seeds of the seeded extraction modes, as cell flags
+  std::vector<unsigned char> seeds;
+  if (this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS)
+  {
+    std::vector<unsigned char> seedPoints(numPts, 0);
+    for (vtkIdType i = 0; i < this->Seeds->GetNumberOfIds(); i++)
+    {
+      const vtkIdType ptId = this->Seeds->GetId(i);
+      if (ptId >= 0 && ptId < numPts)
+      {
+        seedPoints[ptId] = 1;
+      }
+    }
+    seeds = GetCellsUsingPoints(this->Mesh, seedPoints);
+  }
+  else if (this->ExtractionMode == VTK_EXTRACT_CELL_SEEDED_REGIONS)
+  {
+    seeds.resize(numCells, 0);
+    for (vtkIdType i = 0; i < this->Seeds->GetNumberOfIds(); i++)
+    {
+      const vtkIdType cellId = this->Seeds->GetId(i);
+      if (cellId >= 0 && cellId < numCells)
+      {
+        seeds[cellId] = 1;
+      }
+    }
+  }
+  else if (this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION)
+  {
+    vtkPoints* points = this->Mesh->GetPoints();
+    double minDist2 = VTK_DOUBLE_MAX, x[3];
+    vtkIdType minId = 0;
+    for (vtkIdType i = 0; i < numPts; i++)
+    {
+      points->GetPoint(i, x);
+      const double dist2 = vtkMath::Distance2BetweenPoints(x, this->ClosestPoint);
+      if (dist2 < minDist2)
+      {
+        minId = i;
+        minDist2 = dist2;
+      }
+    }
+    std::vector<unsigned char> seedPoints(numPts, 0);
+    seedPoints[minId] = 1;
+    seeds = GetCellsUsingPoints(this->Mesh, seedPoints);
+  }
+  this->UpdateProgress(0.2);
+
+  // Same criterion as IsScalarConnected(), whose scalars are compared in
+  // single precision.
+  vtkDataArray* inScalars = this->InScalars;
+  const bool full = this->FullScalarConnectivity != 0;
+  const double range[2] = { this->ScalarRange[0], this->ScalarRange[1] };
+  auto qualifies = [inScalars, full, &range](vtkIdType npts, const vtkIdType* pts) {
+    if (!inScalars)
+    {
+      return true;
+    }
+    double cellRange[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+    for (vtkIdType i = 0; i < npts; i++)
+    {
+      const double s = static_cast<float>(inScalars->GetComponent(pts[i], 0));
+      cellRange[0] = std::min(cellRange[0], s);
+      cellRange[1] = std::max(cellRange[1], s);
+    }
+    if (full)
+    {
+      return cellRange[0] >= range[0] && cellRange[1] <= range[1];
+    }
+    return cellRange[1] >= range[0] && cellRange[0] <= range[1];
+  };
+
+  std::vector<vtkIdType> regionSizes;
+  const vtkIdType numRegions = LabelConnectedRegions(
+    this->Mesh, qualifies, seeds.empty() ? nullptr : seeds.data(), this->Visited, regionSizes);
+  this->UpdateProgress(0.7);
+  if (this->CheckAbort())
+  {
+    return 0;
+  }
+
+  vtkIdType largestRegionId = 0;
+  this->RegionSizes->SetNumberOfValues(numRegions);
+  for (vtkIdType regionId = 0; regionId < numRegions; regionId++)
+  {
+    this->RegionSizes->SetValue(regionId, regionSizes[regionId]);
+    if (regionSizes[regionId] > regionSizes[largestRegionId])
+    {
+      largestRegionId = regionId;
+    }
+  }
+  this->RegionNumber = seeds.empty() ? numRegions : 0;
+
+  this->PointNumber = MapConnectedPoints(this->Mesh, this->Visited, this->PointMap,
+    vtkArrayDownCast<vtkIdTypeArray>(this->NewScalars)->GetPointer(0));
+  this->UpdateProgress(0.9);
+  return largestRegionId;
+}
+
 //------------------------------------------------------------------------------
 int vtkPolyDataConnectivityFilter::IsScalarConnected(vtkIdType cellId)
 {
@@ -675,5 +797,6 @@ void vtkPolyDataConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Parallel Labeling: " << (this->ParallelLabeling ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
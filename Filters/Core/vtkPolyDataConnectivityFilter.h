@@ -31,6 +31,11 @@
  * This use of ScalarConnectivity is particularly useful for selecting cells
  * for later processing.
  *
+ * The regions can be labeled in parallel with vtkSMPTools by turning on
+ * ParallelLabeling, which is much faster on large meshes made of many
+ * regions. See SetParallelLabeling() for the differences with the serial
+ * traversal.
+ *
  * @sa
  * vtkConnectivityFilter
  */
@@ -206,6 +211,22 @@ public:
   vtkGetObjectMacro(VisitedPointIds, vtkIdList);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off the parallel labeling of the regions. Instead of traversing
+   * the regions one at a time, the points of the cells are merged with a
+   * lock-free union-find, with vtkSMPTools, and the cell links are not
+   * built. The extraction modes, the region ids, which are ordered by the
+   * smallest cell id of each region, and the region sizes are the same as
+   * with the serial traversal, also with ScalarConnectivity. The only
+   * difference is that the output points are in the order of the input
+   * points instead of the order of traversal. Default is off.
+   */
+  vtkSetMacro(ParallelLabeling, vtkTypeBool);
+  vtkGetMacro(ParallelLabeling, vtkTypeBool);
+  vtkBooleanMacro(ParallelLabeling, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output types. See the documentation
@@ -241,6 +262,12 @@ protected:
 
   void TraverseAndMark();
 
+  /**
+   * Label the cells and map the points in parallel, filling the same
+   * execution data as the serial traversal. Return the largest region id.
+   */
+  vtkIdType LabelRegionsInParallel();
+
   // used to support algorithm execution
   vtkDataArray* CellScalars;
   vtkIdList* NeighborCellPointIds;
@@ -260,6 +287,7 @@ protected:
 
   vtkTypeBool MarkVisitedPointIds;
   int OutputPointsPrecision;
+  vtkTypeBool ParallelLabeling;
 
 private:
   vtkPolyDataConnectivityFilter(const vtkPolyDataConnectivityFilter&) = delete;
@@ -3,12 +3,15 @@
 #include "vtkProbeFilter.h"
 
 #include "vtkAbstractCellLocator.h"
+#include "vtkArrayDispatch.h"
 #include "vtkBoundingBox.h"
 #include "vtkCell.h"
 #include "vtkCellData.h"
 #include "vtkCellLocatorStrategy.h"
 #include "vtkCharArray.h"
 #include "vtkClosestPointStrategy.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
 #include "vtkFindCellStrategy.h"
 #include "vtkGenericCell.h"
 #include "vtkIdTypeArray.h"
@@ -19,6 +22,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
@@ -405,6 +409,11 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
   vtkCharArray* MaskArray;
   double Tol2;
   int MaxCellSize;
+  // Results of the batched query of the cell locator, if any
+  const vtkIdType* QueryIds;
+  const vtkIdType* FoundCellIds;
+  const double* FoundWeights;
+  int FoundWeightsStride;
 
   struct LocalData
   {
@@ -426,7 +435,8 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
 public:
   ProbeEmptyPointsWorklet(vtkProbeFilter* probeFilter, int sourceIndex, vtkDataSet* input,
     vtkDataSet* source, vtkPointData* outputPD, vtkFindCellStrategy* strategy,
-    vtkUnsignedCharArray* sourceGhostFlags, vtkCharArray* maskArray, double tol2, int maxCellSize)
+    vtkUnsignedCharArray* sourceGhostFlags, vtkCharArray* maskArray, double tol2, int maxCellSize,
+    const vtkIdType* queryIds, vtkIdTypeArray* foundCellIds, vtkDoubleArray* foundWeights)
     : ProbeFilter(probeFilter)
     , SourceIdx(sourceIndex)
     , Input(input)
@@ -439,6 +449,10 @@ public:
     , MaskArray(maskArray)
     , Tol2(tol2)
     , MaxCellSize(maxCellSize)
+    , QueryIds(queryIds)
+    , FoundCellIds(foundCellIds ? foundCellIds->GetPointer(0) : nullptr)
+    , FoundWeights(foundWeights ? foundWeights->GetPointer(0) : nullptr)
+    , FoundWeightsStride(foundWeights ? foundWeights->GetNumberOfComponents() : 0)
   {
     // instantiate the cell map for polydata
     vtkNew<vtkGenericCell> cell;
@@ -519,7 +533,37 @@ public:
       this->Input->GetPoint(pointId, x);
 
       foundInCache = false;
-      if (lastCellId != -1)
+      if (this->FoundCellIds)
+      {
+        // the cell locator already looked for all the points
+        const vtkIdType queryId = this->QueryIds[pointId];
+        const vtkIdType foundCellId = this->FoundCellIds[queryId];
+        if (foundCellId != -1)
+        {
+          if (foundCellId != lastCellId)
+          {
+            this->Source->GetCell(foundCellId, currentCell);
+            lastBBox.SetBounds(currentCell->GetBounds());
+            lastLength2 = lastBBox.GetDiagonalLength2();
+          }
+          const double* foundWeights = this->FoundWeights + queryId * this->FoundWeightsStride;
+          const vtkIdType numCellPts = currentCell->GetNumberOfPoints();
+          std::copy(foundWeights, foundWeights + numCellPts, weights);
+          // the closest point is interpolated from the points of the cell
+          lastClosestPoint[0] = lastClosestPoint[1] = lastClosestPoint[2] = 0.0;
+          for (vtkIdType i = 0; i < numCellPts; ++i)
+          {
+            double cellPt[3];
+            currentCell->Points->GetPoint(i, cellPt);
+            lastClosestPoint[0] += weights[i] * cellPt[0];
+            lastClosestPoint[1] += weights[i] * cellPt[1];
+            lastClosestPoint[2] += weights[i] * cellPt[2];
+          }
+          foundInCache = true;
+        }
+        lastCellId = foundCellId;
+      }
+      else if (lastCellId != -1)
       {
         // check if it's inside cell bounds
         insideCellBounds = lastBBox.ContainsPoint(x);
@@ -537,7 +581,12 @@ public:
       if (!foundInCache)
       {
         // strategies are used for subclasses of vtkPointSet
-        if (strategy)
+        if (this->FoundCellIds)
+        {
+          // the cell locator did not find any cell containing this point
+          lastCellId = -1;
+        }
+        else if (strategy)
         {
           if (cellLocatorStrategy)
           {
@@ -747,8 +796,46 @@ void vtkProbeFilter::ProbeEmptyPoints(
     }
   }
 
+  // A cell locator finds the cells of all the points at once, in parallel,
+  // which is faster than querying it point by point. Points already probed
+  // with success are skipped.
+  std::vector<vtkIdType> queryIds;
+  vtkNew<vtkIdTypeArray> foundCellIds;
+  vtkNew<vtkDoubleArray> foundWeights;
+  auto cellLocatorStrategy = vtkCellLocatorStrategy::SafeDownCast(strategy);
+  const bool batchedQuery = cellLocatorStrategy && cellLocatorStrategy->GetCellLocator();
+  if (batchedQuery)
+  {
+    const vtkIdType numPts = input->GetNumberOfPoints();
+    const char* mask = this->MaskPoints->GetPointer(0);
+    queryIds.resize(static_cast<size_t>(numPts));
+    vtkIdType numQueries = 0;
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      queryIds[ptId] = mask[ptId] == static_cast<char>(1) ? -1 : numQueries++;
+    }
+    vtkNew<vtkPoints> queryPoints;
+    queryPoints->SetDataTypeToDouble();
+    queryPoints->SetNumberOfPoints(numQueries);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      double x[3];
+      for (vtkIdType ptId = begin; ptId < end; ++ptId)
+      {
+        if (queryIds[ptId] != -1)
+        {
+          input->GetPoint(ptId, x);
+          queryPoints->SetPoint(queryIds[ptId], x);
+        }
+      }
+    });
+    cellLocatorStrategy->GetCellLocator()->FindCells(
+      queryPoints, tol2, foundCellIds, nullptr, foundWeights);
+  }
+
   ProbeEmptyPointsWorklet worker(this, srcIdx, input, source, outPD, strategy, sourceGhostFlags,
-    this->MaskPoints, tol2, maxCellSize);
+    this->MaskPoints, tol2, maxCellSize, batchedQuery ? queryIds.data() : nullptr,
+    batchedQuery ? foundCellIds.GetPointer() : nullptr,
+    batchedQuery ? foundWeights.GetPointer() : nullptr);
   vtkSMPTools::For(0, input->GetNumberOfPoints(), worker);
 
   this->MaskPoints->Modified();
@@ -988,6 +1075,81 @@ struct ProbeImageDataPointsThreadLocal
   vtkSmartPointer<vtkIdList> PointIds;
 };
 
+// Number of points located at once by vtkImageData::FindCells()
+constexpr vtkIdType PROBE_BATCH_SIZE = 256;
+
+// Copy the coordinates of a range of points into an xyz buffer.
+struct GatherPoints
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* points, vtkIdType begin, vtkIdType end, double* x)
+  {
+    for (const auto tuple : vtk::DataArrayTupleRange<3>(points, begin, end))
+    {
+      *x++ = static_cast<double>(tuple[0]);
+      *x++ = static_cast<double>(tuple[1]);
+      *x++ = static_cast<double>(tuple[2]);
+    }
+  }
+};
+
+// Points and trilinear interpolation weights of the cells of an image, in
+// the order of vtkImageData::GetCellPoints(): the axes along which the image
+// is flat are skipped, so that the cells have 1, 2, 4 or 8 points.
+struct ImageCellInterpolator
+{
+  int Extent[6];
+  vtkIdType Increments[3];
+  int Axes[3];
+  int NumberOfAxes = 0;
+
+  ImageCellInterpolator(vtkImageData* image)
+  {
+    image->GetExtent(this->Extent);
+    int dims[3];
+    image->GetDimensions(dims);
+    this->Increments[0] = 1;
+    this->Increments[1] = dims[0];
+    this->Increments[2] = static_cast<vtkIdType>(dims[0]) * dims[1];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (this->Extent[2 * axis] < this->Extent[2 * axis + 1])
+      {
+        this->Axes[this->NumberOfAxes++] = axis;
+      }
+    }
+  }
+
+  int GetNumberOfCellPoints() const { return 1 << this->NumberOfAxes; }
+
+  void Compute(const int ijk[3], const double pcoords[3], vtkIdType* ptIds, double* weights) const
+  {
+    vtkIdType origin = 0;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      origin += (ijk[axis] - this->Extent[2 * axis]) * this->Increments[axis];
+    }
+    for (int pt = 0, numPts = this->GetNumberOfCellPoints(); pt < numPts; ++pt)
+    {
+      ptIds[pt] = origin;
+      weights[pt] = 1.0;
+      for (int a = 0; a < this->NumberOfAxes; ++a)
+      {
+        const int axis = this->Axes[a];
+        if (pt & (1 << a))
+        {
+          ptIds[pt] += this->Increments[axis];
+          weights[pt] *= pcoords[axis];
+        }
+        else
+        {
+          weights[pt] *= 1.0 - pcoords[axis];
+        }
+      }
+    }
+  }
+};
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -1092,52 +1254,83 @@ void vtkProbeFilter::ProbeImageDataPointsSMP(vtkDataSet* input, vtkImageData* so
   auto sourceGhostFlags =
     vtkUnsignedCharArray::SafeDownCast(cd->GetArray(vtkDataSetAttributes::GhostArrayName()));
 
+  // The points are located by batches with vtkImageData::FindCells(), then
+  // the source data is interpolated at the points found.
+  const ImageCellInterpolator interpolator(source);
+  const int numCellPts = interpolator.GetNumberOfCellPoints();
+  pointIds->SetNumberOfIds(numCellPts);
+  vtkDataArray* inputPoints = nullptr;
+  if (auto inputPointSet = vtkPointSet::SafeDownCast(input))
+  {
+    inputPoints = inputPointSet->GetPoints() ? inputPointSet->GetPoints()->GetData() : nullptr;
+  }
+  const vtkIdType batchSize = std::min<vtkIdType>(PROBE_BATCH_SIZE, endId - startId);
+  std::vector<double> x(3 * batchSize);
+  std::vector<vtkIdType> cellIds(batchSize);
+  std::vector<int> ijk(3 * batchSize);
+  std::vector<double> pcoords(3 * batchSize);
+  double weights[8];
+
   // Loop over all input points, interpolating source data
   vtkIdType progressInterval = endId / 20 + 1;
-  for (vtkIdType ptId = startId; ptId < endId; ptId++)
+  for (vtkIdType batchStart = startId; batchStart < endId; batchStart += batchSize)
   {
-    if (baseThread && !(ptId % progressInterval))
+    const vtkIdType batchEnd = std::min(batchStart + batchSize, endId);
+    if (baseThread &&
+      (batchStart % progressInterval == 0 ||
+        batchStart / progressInterval != (batchEnd - 1) / progressInterval))
     {
       // This is not ideal, because if the base thread executes more than one piece,
       // then the progress will repeat its 0.0 to 1.0 progression for each piece.
-      this->UpdateProgress(static_cast<double>(ptId) / endId);
+      this->UpdateProgress(static_cast<double>(batchStart) / endId);
       if (this->CheckAbort())
       {
         break;
       }
     }
 
-    if (maskArray[ptId] == static_cast<char>(1))
+    // Get the xyz coordinates of the points in the input dataset
+    const vtkIdType numBatchPts = batchEnd - batchStart;
+    GatherPoints gather;
+    if (!inputPoints ||
+      !vtkArrayDispatch::Dispatch::Execute(inputPoints, gather, batchStart, batchEnd, x.data()))
     {
-      // skip points which have already been probed with success.
-      // This is helpful for multiblock dataset probing.
-      continue;
+      for (vtkIdType ptId = batchStart; ptId < batchEnd; ++ptId)
+      {
+        input->GetPoint(ptId, &x[3 * (ptId - batchStart)]);
+      }
     }
 
-    // Get the xyz coordinate of the point in the input dataset
-    double x[3];
-    input->GetPoint(ptId, x);
+    // Find the cells and compute interpolation weights
+    source->FindCells(numBatchPts, x.data(), tol2, cellIds.data(), ijk.data(), pcoords.data());
 
-    // Find the cell and compute interpolation weights
-    int subId;
-    double pcoords[3], weights[8];
-    vtkIdType cellId = source->FindCell(x, nullptr, -1, tol2, subId, pcoords, weights);
-    if (cellId >= 0 && !::IsBlankedCell(sourceGhostFlags, cellId))
+    for (vtkIdType i = 0; i < numBatchPts; ++i)
     {
-      source->GetCellPoints(cellId, pointIds);
-
-      // Interpolate the point data
-      outPD->InterpolatePoint(*this->PointList, pd, srcIdx, ptId, pointIds, weights);
-      for (size_t i = 0, numArrays = this->InputCellArrays.size(); i < numArrays; ++i)
+      const vtkIdType ptId = batchStart + i;
+      const vtkIdType cellId = cellIds[i];
+      if (maskArray[ptId] == static_cast<char>(1))
       {
-        auto inputArray = this->InputCellArrays[i];
-        auto sourceArray = this->SourceCellArrays[i];
-        if (sourceArray)
+        // skip points which have already been probed with success.
+        // This is helpful for multiblock dataset probing.
+        continue;
+      }
+      if (cellId >= 0 && !::IsBlankedCell(sourceGhostFlags, cellId))
+      {
+        interpolator.Compute(&ijk[3 * i], &pcoords[3 * i], pointIds->GetPointer(0), weights);
+
+        // Interpolate the point data
+        outPD->InterpolatePoint(*this->PointList, pd, srcIdx, ptId, pointIds, weights);
+        for (size_t j = 0, numArrays = this->InputCellArrays.size(); j < numArrays; ++j)
         {
-          inputArray->SetTuple(ptId, cellId, sourceArray);
+          auto inputArray = this->InputCellArrays[j];
+          auto sourceArray = this->SourceCellArrays[j];
+          if (sourceArray)
+          {
+            inputArray->SetTuple(ptId, cellId, sourceArray);
+          }
         }
+        maskArray[ptId] = static_cast<char>(1);
       }
-      maskArray[ptId] = static_cast<char>(1);
     }
   }
 }
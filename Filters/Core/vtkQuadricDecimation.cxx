@@ -28,6 +28,7 @@
 // toggling on and off sets it to 1 and 0
 
 #include "vtkQuadricDecimation.h"
+#include "vtkBitArray.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDoubleArray.h"
@@ -41,8 +42,17 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkQuadricDecimation);
 
@@ -264,6 +274,12 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   this->Mesh->SetPoints(points);
   points->Delete();
   polys->DeepCopy(input->GetPolys());
+  if (this->ParallelCollapse && !polys->IsStorageShareable())
+  {
+    // The cell points are then accessed without temporary buffers, which is
+    // required for concurrent access.
+    polys->ConvertToDefaultStorage();
+  }
   this->Mesh->SetPolys(polys);
   polys->Delete();
   if (this->AttributeErrorMetric || this->MapPointData)
@@ -288,7 +304,10 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
 
   vtkDebugMacro(<< "Computing Edges");
   this->Edges->InitEdgeInsertion(numPts, 1); // storing edge id as attribute
-  this->EdgeCosts->Allocate(this->Mesh->GetPolys()->GetNumberOfCells() * 3);
+  if (!this->ParallelCollapse)
+  {
+    this->EdgeCosts->Allocate(this->Mesh->GetPolys()->GetNumberOfCells() * 3);
+  }
   for (i = 0; i < this->Mesh->GetNumberOfCells(); i++)
   {
     this->Mesh->GetCellPoints(i, npts, pts);
@@ -332,78 +351,88 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
     3 + this->NumberOfComponents + this->VolumePreservation);
 
   vtkDebugMacro(<< "Computing Quadrics");
-  this->InitializeQuadrics(numPts);
-  this->AddBoundaryConstraints();
-  this->UpdateProgress(0.15);
-
-  vtkDebugMacro(<< "Computing Costs");
-  // Compute the cost of and target point for collapsing each edge.
-  for (i = 0; i < this->Edges->GetNumberOfEdges(); i++)
+  this->CollapseRounds.clear();
+  if (this->ParallelCollapse)
   {
-    if (this->AttributeErrorMetric)
-    {
-      cost = this->ComputeCost2(i, x);
-    }
-    else
-    {
-      cost = this->ComputeCost(i, x);
-    }
-    this->EdgeCosts->Insert(cost, i);
-    this->TargetPoints->InsertTuple(i, x);
+    this->InitializeQuadricsInParallel(numPts);
+    this->UpdateProgress(0.15);
+    this->CollapseEdgesInParallel(numTris);
   }
-  this->UpdateProgress(0.20);
-
-  // Okay collapse edges until desired reduction is reached
-  this->ActualReduction = 0.0;
-  this->NumberOfEdgeCollapses = 0;
-  edgeId = this->EdgeCosts->Pop(0, cost);
-
-  bool abort = false;
-  while (
-    !abort && edgeId >= 0 && cost < VTK_DOUBLE_MAX && this->ActualReduction < this->TargetReduction)
+  else
   {
-    if (!(this->NumberOfEdgeCollapses % 10000))
+    this->InitializeQuadrics(numPts);
+    this->AddBoundaryConstraints();
+    this->UpdateProgress(0.15);
+
+    vtkDebugMacro(<< "Computing Costs");
+    // Compute the cost of and target point for collapsing each edge.
+    for (i = 0; i < this->Edges->GetNumberOfEdges(); i++)
     {
-      vtkDebugMacro(<< "Collapsing edge#" << this->NumberOfEdgeCollapses);
-      this->UpdateProgress(0.20 + 0.80 * this->NumberOfEdgeCollapses / numPts);
-      abort = this->CheckAbort();
+      if (this->AttributeErrorMetric)
+      {
+        cost = this->ComputeCost2(i, x);
+      }
+      else
+      {
+        cost = this->ComputeCost(i, x);
+      }
+      this->EdgeCosts->Insert(cost, i);
+      this->TargetPoints->InsertTuple(i, x);
     }
+    this->UpdateProgress(0.20);
 
-    endPtIds[0] = this->EndPoint1List->GetId(edgeId);
-    endPtIds[1] = this->EndPoint2List->GetId(edgeId);
-    this->TargetPoints->GetTuple(edgeId, x);
+    // Okay collapse edges until desired reduction is reached
+    this->ActualReduction = 0.0;
+    this->NumberOfEdgeCollapses = 0;
+    edgeId = this->EdgeCosts->Pop(0, cost);
 
-    // check for a poorly placed point
-    if (!this->IsGoodPlacement(endPtIds[0], endPtIds[1], x))
+    bool abort = false;
+    while (!abort && edgeId >= 0 && cost < VTK_DOUBLE_MAX &&
+      this->ActualReduction < this->TargetReduction)
     {
-      vtkDebugMacro(<< "Poor placement detected " << edgeId << " " << cost);
-      // return the point to the queue but with the max cost so that
-      // when it is recomputed it will be reconsidered
-      this->EdgeCosts->Insert(VTK_DOUBLE_MAX, edgeId);
+      if (!(this->NumberOfEdgeCollapses % 10000))
+      {
+        vtkDebugMacro(<< "Collapsing edge#" << this->NumberOfEdgeCollapses);
+        this->UpdateProgress(0.20 + 0.80 * this->NumberOfEdgeCollapses / numPts);
+        abort = this->CheckAbort();
+      }
 
-      edgeId = this->EdgeCosts->Pop(0, cost);
-      continue;
-    }
+      endPtIds[0] = this->EndPoint1List->GetId(edgeId);
+      endPtIds[1] = this->EndPoint2List->GetId(edgeId);
+      this->TargetPoints->GetTuple(edgeId, x);
 
-    this->NumberOfEdgeCollapses++;
+      // check for a poorly placed point
+      if (!this->IsGoodPlacement(endPtIds[0], endPtIds[1], x))
+      {
+        vtkDebugMacro(<< "Poor placement detected " << edgeId << " " << cost);
+        // return the point to the queue but with the max cost so that
+        // when it is recomputed it will be reconsidered
+        this->EdgeCosts->Insert(VTK_DOUBLE_MAX, edgeId);
 
-    // Set the new coordinates of point0.
-    this->SetPointAttributeArray(endPtIds, x);
-    vtkDebugMacro(<< "Cost: " << cost << " Edge: " << endPtIds[0] << " " << endPtIds[1]);
+        edgeId = this->EdgeCosts->Pop(0, cost);
+        continue;
+      }
 
-    // Merge the quadrics of the two points.
-    this->AddQuadric(endPtIds[1], endPtIds[0]);
+      this->NumberOfEdgeCollapses++;
 
-    this->UpdateEdgeData(endPtIds[0], endPtIds[1]);
+      // Set the new coordinates of point0.
+      this->SetPointAttributeArray(endPtIds, x);
+      vtkDebugMacro(<< "Cost: " << cost << " Edge: " << endPtIds[0] << " " << endPtIds[1]);
 
-    // Update the output triangles.
-    numDeletedTris += this->CollapseEdge(endPtIds[0], endPtIds[1]);
-    this->ActualReduction = (double)numDeletedTris / numTris;
-    edgeId = this->EdgeCosts->Pop(0, cost);
-  }
+      // Merge the quadrics of the two points.
+      this->AddQuadric(endPtIds[1], endPtIds[0]);
 
-  vtkDebugMacro(<< "Number Of Edge Collapses: " << this->NumberOfEdgeCollapses
-                << " Cost: " << cost);
+      this->UpdateEdgeData(endPtIds[0], endPtIds[1]);
+
+      // Update the output triangles.
+      numDeletedTris += this->CollapseEdge(endPtIds[0], endPtIds[1]);
+      this->ActualReduction = (double)numDeletedTris / numTris;
+      edgeId = this->EdgeCosts->Pop(0, cost);
+    }
+
+    vtkDebugMacro(<< "Number Of Edge Collapses: " << this->NumberOfEdgeCollapses
+                  << " Cost: " << cost);
+  }
 
   // clean up working data
   for (i = 0; i < numPts; i++)
@@ -459,29 +488,13 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
 //------------------------------------------------------------------------------
 void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
 {
-  vtkPolyData* input = this->Mesh;
   double* QEM;
   vtkIdType ptId;
   int i, j;
   vtkCellArray* polys;
   vtkIdType npts;
   const vtkIdType* pts = nullptr;
-  double point0[3], point1[3], point2[3];
-  double n[3];
-  double tempP1[3], tempP2[3], d, triArea2;
-  double data[16];
-  double *A[4], x[4];
-  int index[4];
-  A[0] = data;
-  A[1] = data + 4;
-  A[2] = data + 8;
-  A[3] = data + 12;
-
-  double regularizationVariance = 0.0;
-  if (this->Regularize)
-  {
-    regularizationVariance = std::pow(this->Regularization, 2);
-  }
+  double n[3], d, triArea2;
 
   // allocate local QEM sparse matrix
   QEM = new double[11 + 4 * this->NumberOfComponents];
@@ -496,161 +509,13 @@ void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
     }
   }
 
-  polys = input->GetPolys();
+  polys = this->Mesh->GetPolys();
   // compute the QEM for each face
   for (polys->InitTraversal(); polys->GetNextCell(npts, pts);)
   {
-    input->GetPoint(pts[0], point0);
-    input->GetPoint(pts[1], point1);
-    input->GetPoint(pts[2], point2);
-    for (i = 0; i < 3; i++)
-    {
-      tempP1[i] = point1[i] - point0[i];
-      tempP2[i] = point2[i] - point0[i];
-    }
-    vtkMath::Cross(tempP1, tempP2, n);
-    triArea2 = vtkMath::Normalize(n);
-    // triArea2 = (triArea2 * triArea2 * 0.25);
-    triArea2 = triArea2 * 0.5;
-    // I am unsure whether this should be squared or not??
-    d = -vtkMath::Dot(n, point0);
-    // could possible add in angle weights??
-
-    // set the geometric part of the QEM
-    QEM[0] = n[0] * n[0];
-    QEM[1] = n[0] * n[1];
-    QEM[2] = n[0] * n[2];
-    QEM[3] = d * n[0];
-
-    QEM[4] = n[1] * n[1];
-    QEM[5] = n[1] * n[2];
-    QEM[6] = d * n[1];
-
-    QEM[7] = n[2] * n[2];
-    QEM[8] = d * n[2];
-
-    QEM[9] = d * d;
-    QEM[10] = 1;
-
-    if (this->Regularize)
-    {
-      // Add in some regularizing identity \Sigma_n
-      QEM[0] += regularizationVariance;
-      QEM[4] += regularizationVariance;
-      QEM[7] += regularizationVariance;
-
-      // -\Sigma_n . q
-      QEM[3] -= regularizationVariance * point0[0];
-      QEM[6] -= regularizationVariance * point0[1];
-      QEM[8] -= regularizationVariance * point0[2];
-
-      // q^T \Sigma_n q + n^T \Sigma_q n + Tr(\Sigma_n \Sigma_q)
-      QEM[9] +=
-        regularizationVariance * (vtkMath::Dot(point0, point0) + 1 + 3 * regularizationVariance);
-    }
-
-    if (this->AttributeErrorMetric)
+    if (!this->ComputeTriangleQuadric(pts, QEM, n, d, triArea2))
     {
-      for (i = 0; i < 3; i++)
-      {
-        A[0][i] = point0[i];
-        A[1][i] = point1[i];
-        A[2][i] = point2[i];
-        A[3][i] = n[i];
-      }
-      A[0][3] = A[1][3] = A[2][3] = 1;
-      A[3][3] = 0;
-
-      // should handle poorly condition matrix better
-      if (vtkMath::LUFactorLinearSystem(A, index, 4))
-      {
-        for (i = 0; i < this->NumberOfComponents; i++)
-        {
-          x[3] = 0;
-          if (i < this->AttributeComponents[0])
-          {
-            x[0] = input->GetPointData()->GetScalars()->GetComponent(pts[0], i) *
-              this->AttributeScale[0];
-            x[1] = input->GetPointData()->GetScalars()->GetComponent(pts[1], i) *
-              this->AttributeScale[0];
-            x[2] = input->GetPointData()->GetScalars()->GetComponent(pts[2], i) *
-              this->AttributeScale[0];
-          }
-          else if (i < this->AttributeComponents[1])
-          {
-            x[0] = input->GetPointData()->GetVectors()->GetComponent(
-                     pts[0], i - this->AttributeComponents[0]) *
-              this->AttributeScale[1];
-            x[1] = input->GetPointData()->GetVectors()->GetComponent(
-                     pts[1], i - this->AttributeComponents[0]) *
-              this->AttributeScale[1];
-            x[2] = input->GetPointData()->GetVectors()->GetComponent(
-                     pts[2], i - this->AttributeComponents[0]) *
-              this->AttributeScale[1];
-          }
-          else if (i < this->AttributeComponents[2])
-          {
-            x[0] = input->GetPointData()->GetNormals()->GetComponent(
-                     pts[0], i - this->AttributeComponents[1]) *
-              this->AttributeScale[2];
-            x[1] = input->GetPointData()->GetNormals()->GetComponent(
-                     pts[1], i - this->AttributeComponents[1]) *
-              this->AttributeScale[2];
-            x[2] = input->GetPointData()->GetNormals()->GetComponent(
-                     pts[2], i - this->AttributeComponents[1]) *
-              this->AttributeScale[2];
-          }
-          else if (i < this->AttributeComponents[3])
-          {
-            x[0] = input->GetPointData()->GetTCoords()->GetComponent(
-                     pts[0], i - this->AttributeComponents[2]) *
-              this->AttributeScale[3];
-            x[1] = input->GetPointData()->GetTCoords()->GetComponent(
-                     pts[1], i - this->AttributeComponents[2]) *
-              this->AttributeScale[3];
-            x[2] = input->GetPointData()->GetTCoords()->GetComponent(
-                     pts[2], i - this->AttributeComponents[2]) *
-              this->AttributeScale[3];
-          }
-          else if (i < this->AttributeComponents[4])
-          {
-            x[0] = input->GetPointData()->GetTensors()->GetComponent(
-                     pts[0], i - this->AttributeComponents[3]) *
-              this->AttributeScale[4];
-            x[1] = input->GetPointData()->GetTensors()->GetComponent(
-                     pts[1], i - this->AttributeComponents[3]) *
-              this->AttributeScale[4];
-            x[2] = input->GetPointData()->GetTensors()->GetComponent(
-                     pts[2], i - this->AttributeComponents[3]) *
-              this->AttributeScale[4];
-          }
-          vtkMath::LUSolveLinearSystem(A, index, x, 4);
-
-          // add in the contribution of this element into the QEM
-          QEM[0] += x[0] * x[0];
-          QEM[1] += x[0] * x[1];
-          QEM[2] += x[0] * x[2];
-          QEM[3] += x[3] * x[0];
-
-          QEM[4] += x[1] * x[1];
-          QEM[5] += x[1] * x[2];
-          QEM[6] += x[3] * x[1];
-
-          QEM[7] += x[2] * x[2];
-          QEM[8] += x[3] * x[2];
-
-          QEM[9] += x[3] * x[3];
-
-          QEM[11 + i * 4] = -x[0];
-          QEM[12 + i * 4] = -x[1];
-          QEM[13 + i * 4] = -x[2];
-          QEM[14 + i * 4] = -x[3];
-        }
-      }
-      else
-      {
-        vtkErrorMacro(<< "Unable to factor attribute matrix!");
-      }
+      vtkErrorMacro(<< "Unable to factor attribute matrix!");
     }
 
     // add the QEM to all points of the face
@@ -680,6 +545,180 @@ void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
   delete[] QEM;
 }
 
+//------------------------------------------------------------------------------
+bool vtkQuadricDecimation::ComputeTriangleQuadric(
+  const vtkIdType* pts, double* QEM, double n[3], double& d, double& triArea2)
+{
+  vtkPolyData* input = this->Mesh;
+  int i;
+  double point0[3], point1[3], point2[3];
+  double tempP1[3], tempP2[3];
+  double data[16];
+  double *A[4], x[4];
+  int index[4];
+  A[0] = data;
+  A[1] = data + 4;
+  A[2] = data + 8;
+  A[3] = data + 12;
+
+  double regularizationVariance = 0.0;
+  if (this->Regularize)
+  {
+    regularizationVariance = std::pow(this->Regularization, 2);
+  }
+
+  input->GetPoint(pts[0], point0);
+  input->GetPoint(pts[1], point1);
+  input->GetPoint(pts[2], point2);
+  for (i = 0; i < 3; i++)
+  {
+    tempP1[i] = point1[i] - point0[i];
+    tempP2[i] = point2[i] - point0[i];
+  }
+  vtkMath::Cross(tempP1, tempP2, n);
+  triArea2 = vtkMath::Normalize(n);
+  // triArea2 = (triArea2 * triArea2 * 0.25);
+  triArea2 = triArea2 * 0.5;
+  // I am unsure whether this should be squared or not??
+  d = -vtkMath::Dot(n, point0);
+  // could possible add in angle weights??
+
+  // set the geometric part of the QEM
+  QEM[0] = n[0] * n[0];
+  QEM[1] = n[0] * n[1];
+  QEM[2] = n[0] * n[2];
+  QEM[3] = d * n[0];
+
+  QEM[4] = n[1] * n[1];
+  QEM[5] = n[1] * n[2];
+  QEM[6] = d * n[1];
+
+  QEM[7] = n[2] * n[2];
+  QEM[8] = d * n[2];
+
+  QEM[9] = d * d;
+  QEM[10] = 1;
+
+  if (this->Regularize)
+  {
+    // Add in some regularizing identity \Sigma_n
+    QEM[0] += regularizationVariance;
+    QEM[4] += regularizationVariance;
+    QEM[7] += regularizationVariance;
+
+    // -\Sigma_n . q
+    QEM[3] -= regularizationVariance * point0[0];
+    QEM[6] -= regularizationVariance * point0[1];
+    QEM[8] -= regularizationVariance * point0[2];
+
+    // q^T \Sigma_n q + n^T \Sigma_q n + Tr(\Sigma_n \Sigma_q)
+    QEM[9] +=
+      regularizationVariance * (vtkMath::Dot(point0, point0) + 1 + 3 * regularizationVariance);
+  }
+
+  if (!this->AttributeErrorMetric)
+  {
+    return true;
+  }
+
+  for (i = 0; i < 3; i++)
+  {
+    A[0][i] = point0[i];
+    A[1][i] = point1[i];
+    A[2][i] = point2[i];
+    A[3][i] = n[i];
+  }
+  A[0][3] = A[1][3] = A[2][3] = 1;
+  A[3][3] = 0;
+
+  // should handle poorly condition matrix better
+  if (!vtkMath::LUFactorLinearSystem(A, index, 4))
+  {
+    return false;
+  }
+  for (i = 0; i < this->NumberOfComponents; i++)
+  {
+    x[3] = 0;
+    if (i < this->AttributeComponents[0])
+    {
+      x[0] = input->GetPointData()->GetScalars()->GetComponent(pts[0], i) * this->AttributeScale[0];
+      x[1] = input->GetPointData()->GetScalars()->GetComponent(pts[1], i) * this->AttributeScale[0];
+      x[2] = input->GetPointData()->GetScalars()->GetComponent(pts[2], i) * this->AttributeScale[0];
+    }
+    else if (i < this->AttributeComponents[1])
+    {
+      x[0] = input->GetPointData()->GetVectors()->GetComponent(
+               pts[0], i - this->AttributeComponents[0]) *
+        this->AttributeScale[1];
+      x[1] = input->GetPointData()->GetVectors()->GetComponent(
+               pts[1], i - this->AttributeComponents[0]) *
+        this->AttributeScale[1];
+      x[2] = input->GetPointData()->GetVectors()->GetComponent(
+               pts[2], i - this->AttributeComponents[0]) *
+        this->AttributeScale[1];
+    }
+    else if (i < this->AttributeComponents[2])
+    {
+      x[0] = input->GetPointData()->GetNormals()->GetComponent(
+               pts[0], i - this->AttributeComponents[1]) *
+        this->AttributeScale[2];
+      x[1] = input->GetPointData()->GetNormals()->GetComponent(
+               pts[1], i - this->AttributeComponents[1]) *
+        this->AttributeScale[2];
+      x[2] = input->GetPointData()->GetNormals()->GetComponent(
+               pts[2], i - this->AttributeComponents[1]) *
+        this->AttributeScale[2];
+    }
+    else if (i < this->AttributeComponents[3])
+    {
+      x[0] = input->GetPointData()->GetTCoords()->GetComponent(
+               pts[0], i - this->AttributeComponents[2]) *
+        this->AttributeScale[3];
+      x[1] = input->GetPointData()->GetTCoords()->GetComponent(
+               pts[1], i - this->AttributeComponents[2]) *
+        this->AttributeScale[3];
+      x[2] = input->GetPointData()->GetTCoords()->GetComponent(
+               pts[2], i - this->AttributeComponents[2]) *
+        this->AttributeScale[3];
+    }
+    else if (i < this->AttributeComponents[4])
+    {
+      x[0] = input->GetPointData()->GetTensors()->GetComponent(
+               pts[0], i - this->AttributeComponents[3]) *
+        this->AttributeScale[4];
+      x[1] = input->GetPointData()->GetTensors()->GetComponent(
+               pts[1], i - this->AttributeComponents[3]) *
+        this->AttributeScale[4];
+      x[2] = input->GetPointData()->GetTensors()->GetComponent(
+               pts[2], i - this->AttributeComponents[3]) *
+        this->AttributeScale[4];
+    }
+    vtkMath::LUSolveLinearSystem(A, index, x, 4);
+
+    // add in the contribution of this element into the QEM
+    QEM[0] += x[0] * x[0];
+    QEM[1] += x[0] * x[1];
+    QEM[2] += x[0] * x[2];
+    QEM[3] += x[3] * x[0];
+
+    QEM[4] += x[1] * x[1];
+    QEM[5] += x[1] * x[2];
+    QEM[6] += x[3] * x[1];
+
+    QEM[7] += x[2] * x[2];
+    QEM[8] += x[3] * x[2];
+
+    QEM[9] += x[3] * x[3];
+
+    QEM[11 + i * 4] = -x[0];
+    QEM[12 + i * 4] = -x[1];
+    QEM[13 + i * 4] = -x[2];
+    QEM[14 + i * 4] = -x[3];
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
 void vtkQuadricDecimation::AddBoundaryConstraints()
 {
   vtkPolyData* input = this->Mesh;
@@ -688,8 +727,7 @@ void vtkQuadricDecimation::AddBoundaryConstraints()
   int i, j;
   vtkIdType npts;
   const vtkIdType* pts;
-  double t0[3], t1[3], t2[3];
-  double e0[3], e1[3], n[3], c, w;
+  double w;
   vtkIdList* cellIds = vtkIdList::New();
 
   // allocate local QEM space matrix
@@ -705,87 +743,174 @@ void vtkQuadricDecimation::AddBoundaryConstraints()
       if (cellIds->GetNumberOfIds() == 0)
       {
         // this is a boundary
-        input->GetPoint(pts[(i + 2) % 3], t0);
-        input->GetPoint(pts[i], t1);
-        input->GetPoint(pts[(i + 1) % 3], t2);
+        w = this->ComputeBoundaryQuadric(pts, i, QEM);
 
-        // computing a plane which is orthogonal to line t1, t2 and incident
-        // with it
-        for (j = 0; j < 3; j++)
-        {
-          e0[j] = t2[j] - t1[j];
-        }
-        for (j = 0; j < 3; j++)
+        // need to add orthogonal plane with the other Attributes, but this
+        // is not clear??
+        // check to interaction with attribute data
+        for (j = 0; j < 11; j++)
         {
-          e1[j] = t0[j] - t1[j];
+          this->ErrorQuadrics[pts[i]].Quadric[j] += QEM[j] * w;
+          this->ErrorQuadrics[pts[(i + 1) % 3]].Quadric[j] += QEM[j] * w;
         }
+      }
+    }
+  }
+  cellIds->Delete();
+  delete[] QEM;
+}
 
-        // compute n so that it is orthogonal to e0 and parallel to the
-        // triangle
-        c = vtkMath::Dot(e0, e1) / (e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2]);
-        for (j = 0; j < 3; j++)
-        {
-          n[j] = e1[j] - c * e0[j];
-        }
-        vtkMath::Normalize(n);
+//------------------------------------------------------------------------------
+double vtkQuadricDecimation::ComputeBoundaryQuadric(const vtkIdType* pts, int i, double* QEM)
+{
+  vtkPolyData* input = this->Mesh;
+  int j;
+  double t0[3], t1[3], t2[3];
+  double e0[3], e1[3], n[3], c, w;
+
+  input->GetPoint(pts[(i + 2) % 3], t0);
+  input->GetPoint(pts[i], t1);
+  input->GetPoint(pts[(i + 1) % 3], t2);
+
+  // computing a plane which is orthogonal to line t1, t2 and incident
+  // with it
+  for (j = 0; j < 3; j++)
+  {
+    e0[j] = t2[j] - t1[j];
+  }
+  for (j = 0; j < 3; j++)
+  {
+    e1[j] = t0[j] - t1[j];
+  }
+
+  // compute n so that it is orthogonal to e0 and parallel to the
+  // triangle
+  c = vtkMath::Dot(e0, e1) / (e0[0] * e0[0] + e0[1] * e0[1] + e0[2] * e0[2]);
+  for (j = 0; j < 3; j++)
+  {
+    n[j] = e1[j] - c * e0[j];
+  }
+  vtkMath::Normalize(n);
 
 #if defined(_MSC_VER) && _MSC_VER >= 1929
-        // Visual Studio toolset starting at toolset 14.29.30133, when building in Release mode
-        // incorrectly optimizes away the line
-        //    QEM[9] = d * d;
-        // By making volatile, we are telling the compiler not to optimize out
-        // or reorder operations regarding this variable.
-        volatile
+  // Visual Studio toolset starting at toolset 14.29.30133, when building in Release mode
+  // incorrectly optimizes away the line
+  //    QEM[9] = d * d;
+  // By making volatile, we are telling the compiler not to optimize out
+  // or reorder operations regarding this variable.
+  volatile
 #endif
-          double d = -vtkMath::Dot(n, t1);
-        // The above line might merit some review: The same quadric gets added to t1 and t2 and one
-        // might prefer adding a quadric calculated using t1 at t1 and using t2 at t2
-        w = vtkMath::Norm(e0);
+    double d = -vtkMath::Dot(n, t1);
+  // The above line might merit some review: The same quadric gets added to t1 and t2 and one
+  // might prefer adding a quadric calculated using t1 at t1 and using t2 at t2
+  w = vtkMath::Norm(e0);
 
-        if (!this->WeighBoundaryConstraintsByLength)
-        {
-          /*
-           * The argument for using area instead of length is based on homogeneity here: The quadric
-           * field is already weighted by triangle area. It makes sense weighting the boundary
-           * constraints by area instead of length. Length technically has zero measure in terms of
-           * units of area. The squared version also seems to give more coherent results at the
-           * boundary.
-           */
-          w *= w;
-        }
-        w *= this->BoundaryWeightFactor;
+  if (!this->WeighBoundaryConstraintsByLength)
+  {
+    /*
+     * The argument for using area instead of length is based on homogeneity here: The quadric
+     * field is already weighted by triangle area. It makes sense weighting the boundary
+     * constraints by area instead of length. Length technically has zero measure in terms of
+     * units of area. The squared version also seems to give more coherent results at the
+     * boundary.
+     */
+    w *= w;
+  }
+  w *= this->BoundaryWeightFactor;
 
-        // could possible add in
-        // angle weights??
-        QEM[0] = n[0] * n[0];
-        QEM[1] = n[0] * n[1];
-        QEM[2] = n[0] * n[2];
-        QEM[3] = d * n[0];
+  // could possible add in
+  // angle weights??
+  QEM[0] = n[0] * n[0];
+  QEM[1] = n[0] * n[1];
+  QEM[2] = n[0] * n[2];
+  QEM[3] = d * n[0];
 
-        QEM[4] = n[1] * n[1];
-        QEM[5] = n[1] * n[2];
-        QEM[6] = d * n[1];
+  QEM[4] = n[1] * n[1];
+  QEM[5] = n[1] * n[2];
+  QEM[6] = d * n[1];
 
-        QEM[7] = n[2] * n[2];
-        QEM[8] = d * n[2];
+  QEM[7] = n[2] * n[2];
+  QEM[8] = d * n[2];
 
-        QEM[9] = d * d;
+  QEM[9] = d * d;
 
-        QEM[10] = 1;
+  QEM[10] = 1;
 
-        // need to add orthogonal plane with the other Attributes, but this
-        // is not clear??
-        // check to interaction with attribute data
-        for (j = 0; j < 11; j++)
+  return w;
+}
+
+//------------------------------------------------------------------------------
+void vtkQuadricDecimation::InitializeQuadricsInParallel(vtkIdType numPts)
+{
+  // Each point gathers the quadrics of the triangles and boundary edges using
+  // it, visited through the links in increasing cell order: the sums are done
+  // in the same order, and give the same values, as InitializeQuadrics()
+  // followed by AddBoundaryConstraints().
+  const int numValues = 11 + 4 * this->NumberOfComponents;
+  std::atomic<vtkIdType> numFailures(0);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellIds;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    std::vector<double> QEM(numValues);
+    vtkIdList* cellIds = tlCellIds.Local();
+    double n[3], d, triArea2;
+    vtkIdType ncells, *cells, npts;
+    const vtkIdType* pts;
+    for (; ptId < endPtId; ++ptId)
+    {
+      double* quadric = new double[numValues];
+      std::fill_n(quadric, numValues, 0.0);
+      this->ErrorQuadrics[ptId].Quadric = quadric;
+      double* volume = this->VolumePreservation ? this->VolumeConstraints + 4 * ptId : nullptr;
+
+      this->Mesh->GetPointCells(ptId, ncells, cells);
+      for (vtkIdType i = 0; i < ncells; ++i)
+      {
+        this->Mesh->GetCellPoints(cells[i], npts, pts);
+        if (!this->ComputeTriangleQuadric(pts, QEM.data(), n, d, triArea2))
         {
-          this->ErrorQuadrics[pts[i]].Quadric[j] += QEM[j] * w;
-          this->ErrorQuadrics[pts[(i + 1) % 3]].Quadric[j] += QEM[j] * w;
+          ++numFailures;
+        }
+        for (int j = 0; j < numValues; ++j)
+        {
+          quadric[j] += QEM[j] * triArea2;
+        }
+        if (volume)
+        {
+          for (int j = 0; j < 3; ++j)
+          {
+            volume[j] += n[j] * triArea2 * 2.0;
+          }
+          volume[3] += -d * triArea2 * 2.0;
+        }
+      }
+
+      for (vtkIdType i = 0; i < ncells; ++i)
+      {
+        this->Mesh->GetCellPoints(cells[i], npts, pts);
+        for (int j = 0; j < 3; ++j)
+        {
+          if (pts[j] != ptId && pts[(j + 1) % 3] != ptId)
+          {
+            continue;
+          }
+          this->Mesh->GetCellEdgeNeighbors(cells[i], pts[j], pts[(j + 1) % 3], cellIds);
+          if (cellIds->GetNumberOfIds() == 0)
+          {
+            const double w = this->ComputeBoundaryQuadric(pts, j, QEM.data());
+            for (int k = 0; k < 11; ++k)
+            {
+              quadric[k] += QEM[k] * w;
+            }
+          }
         }
       }
     }
+  });
+
+  if (numFailures > 0)
+  {
+    vtkErrorMacro(<< "Unable to factor attribute matrix for " << numFailures / 3 << " triangles!");
   }
-  cellIds->Delete();
-  delete[] QEM;
 }
 
 //------------------------------------------------------------------------------
@@ -930,8 +1055,328 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
   changedEdges->Delete();
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Work arrays of the cost computations done by a thread.
+struct CostWorkspace
+{
+  std::vector<double> X;
+  std::vector<double> Quad;
+  std::vector<double> B;
+  std::vector<double> Data;
+  std::vector<double*> A;
+
+  void Initialize(int numValues, int quadSize)
+  {
+    if (!this->X.empty())
+    {
+      return;
+    }
+    this->X.resize(numValues);
+    this->Quad.resize(quadSize);
+    this->B.resize(numValues);
+    this->Data.resize(numValues * numValues);
+    this->A.resize(numValues);
+    for (int i = 0; i < numValues; ++i)
+    {
+      this->A[i] = this->Data.data() + i * numValues;
+    }
+  }
+};
+
+// Gather the points read or modified by the collapse of the edge (pt0Id,
+// pt1Id): its end points and the points of the triangles using them. Return
+// the number of triangles using the edge, i.e. deleted by its collapse.
+int GetCollapseNeighborhood(
+  vtkPolyData* mesh, vtkIdType pt0Id, vtkIdType pt1Id, std::vector<vtkIdType>& ptIds)
+{
+  vtkIdType ncells, *cells, npts;
+  const vtkIdType* pts;
+  int numEdgeTris = 0;
+
+  ptIds.clear();
+  ptIds.push_back(pt0Id);
+  ptIds.push_back(pt1Id);
+  mesh->GetPointCells(pt0Id, ncells, cells);
+  for (vtkIdType i = 0; i < ncells; ++i)
+  {
+    mesh->GetCellPoints(cells[i], npts, pts);
+    ptIds.insert(ptIds.end(), pts, pts + npts);
+    numEdgeTris += std::find(pts, pts + npts, pt1Id) != pts + npts;
+  }
+  mesh->GetPointCells(pt1Id, ncells, cells);
+  for (vtkIdType i = 0; i < ncells; ++i)
+  {
+    mesh->GetCellPoints(cells[i], npts, pts);
+    ptIds.insert(ptIds.end(), pts, pts + npts);
+  }
+  return numEdgeTris;
+}
+
+// Lower the claim on a point to the given rank.
+void ClaimPoint(std::atomic<vtkIdType>& claim, vtkIdType rank)
+{
+  vtkIdType current = claim.load();
+  while (rank < current && !claim.compare_exchange_weak(current, rank))
+  {
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkQuadricDecimation::CollapseEdgesInParallel(vtkIdType numTris)
+{
+  const int numValues = 3 + this->NumberOfComponents + this->VolumePreservation;
+  const int quadSize = 11 + 4 * this->NumberOfComponents + this->VolumePreservation;
+  const vtkIdType numPts = this->Mesh->GetNumberOfPoints();
+
+  // The cost of each edge, VTK_DOUBLE_MAX for the edges that cannot be
+  // collapsed: removed edges, and edges rejected by IsGoodPlacement() until
+  // their neighborhood changes. It replaces the priority queue.
+  std::vector<double> costs(this->Edges->GetNumberOfEdges());
+  this->TargetPoints->SetNumberOfTuples(static_cast<vtkIdType>(costs.size()));
+
+  vtkSMPThreadLocal<CostWorkspace> tlWorkspaces;
+  auto computeCosts = [&](const vtkIdType* edgeIds, vtkIdType numEdges) {
+    vtkSMPTools::For(0, numEdges, [&](vtkIdType i, vtkIdType end) {
+      CostWorkspace& ws = tlWorkspaces.Local();
+      ws.Initialize(numValues, quadSize);
+      for (; i < end; ++i)
+      {
+        const vtkIdType edgeId = edgeIds ? edgeIds[i] : i;
+        if (this->AttributeErrorMetric)
+        {
+          costs[edgeId] =
+            this->ComputeCost2(edgeId, ws.X.data(), ws.Quad.data(), ws.A.data(), ws.B.data());
+        }
+        else
+        {
+          costs[edgeId] = this->ComputeCost(edgeId, ws.X.data(), ws.Quad.data());
+        }
+        this->TargetPoints->SetTypedTuple(edgeId, ws.X.data());
+      }
+    });
+  };
+  computeCosts(nullptr, static_cast<vtkIdType>(costs.size()));
+  this->UpdateProgress(0.20);
+
+  // The bits of a vtkBitArray cannot be written concurrently: interpolate
+  // the point data serially if there is one.
+  bool concurrentCollapses = true;
+  if (this->MapPointData || this->AttributeErrorMetric)
+  {
+    vtkPointData* pd = this->Mesh->GetPointData();
+    for (int i = 0; i < pd->GetNumberOfArrays(); ++i)
+    {
+      if (vtkBitArray::SafeDownCast(pd->GetAbstractArray(i)))
+      {
+        concurrentCollapses = false;
+      }
+    }
+  }
+
+  std::vector<std::atomic<vtkIdType>> claims(numPts);
+  std::vector<vtkIdType> candidates;
+  std::vector<vtkIdType> collapses;
+  std::vector<vtkIdType> updatedEdges;
+  std::vector<double> x(numValues, 0.0);
+  vtkSMPThreadLocal<std::vector<vtkIdType>> tlNeighborhoods;
+  vtkSMPThreadLocalObject<vtkIdList> tlEdgeIds;
+  vtkSMPThreadLocalObject<vtkIdList> tlCellIds;
+  vtkIdType numDeletedTris = 0;
+
+  this->ActualReduction = 0.0;
+  this->NumberOfEdgeCollapses = 0;
+  while (this->ActualReduction < this->TargetReduction && !this->CheckAbort())
+  {
+    // The candidates are the cheapest collapsible edges, ranked by cost.
+    candidates.clear();
+    for (vtkIdType edgeId = 0; edgeId < static_cast<vtkIdType>(costs.size()); ++edgeId)
+    {
+      if (costs[edgeId] < VTK_DOUBLE_MAX)
+      {
+        candidates.push_back(edgeId);
+      }
+    }
+    if (candidates.empty())
+    {
+      break;
+    }
+    auto cheaper = [&costs](vtkIdType a, vtkIdType b) {
+      return costs[a] < costs[b] || (costs[a] == costs[b] && a < b);
+    };
+    const vtkIdType numCandidates = std::min(static_cast<vtkIdType>(candidates.size()),
+      std::max(static_cast<vtkIdType>(1),
+        static_cast<vtkIdType>(std::ceil(this->CandidateFraction * candidates.size()))));
+    if (numCandidates < static_cast<vtkIdType>(candidates.size()))
+    {
+      std::nth_element(
+        candidates.begin(), candidates.begin() + numCandidates, candidates.end(), cheaper);
+      candidates.resize(numCandidates);
+    }
+    vtkSMPTools::Sort(candidates.begin(), candidates.end(), cheaper);
+
+    // Each point is claimed by the cheapest candidate whose neighborhood
+    // contains it. The candidates holding the claims on their whole
+    // neighborhood are independent, and the cheapest one always is.
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        claims[ptId].store(numCandidates);
+      }
+    });
+    vtkSMPTools::For(0, numCandidates, [&](vtkIdType rank, vtkIdType endRank) {
+      std::vector<vtkIdType>& neighborhood = tlNeighborhoods.Local();
+      for (; rank < endRank; ++rank)
+      {
+        const vtkIdType edgeId = candidates[rank];
+        GetCollapseNeighborhood(this->Mesh, this->EndPoint1List->GetId(edgeId),
+          this->EndPoint2List->GetId(edgeId), neighborhood);
+        for (vtkIdType ptId : neighborhood)
+        {
+          ClaimPoint(claims[ptId], rank);
+        }
+      }
+    });
+    // Number of triangles deleted by each independent candidate, -1 for the
+    // others.
+    std::vector<int> numEdgeTris(numCandidates, -1);
+    vtkSMPTools::For(0, numCandidates, [&](vtkIdType rank, vtkIdType endRank) {
+      std::vector<vtkIdType>& neighborhood = tlNeighborhoods.Local();
+      for (; rank < endRank; ++rank)
+      {
+        const vtkIdType edgeId = candidates[rank];
+        const int numTrisOfEdge = GetCollapseNeighborhood(this->Mesh,
+          this->EndPoint1List->GetId(edgeId), this->EndPoint2List->GetId(edgeId), neighborhood);
+        bool independent = true;
+        for (vtkIdType ptId : neighborhood)
+        {
+          independent &= claims[ptId].load() == rank;
+        }
+        if (independent)
+        {
+          numEdgeTris[rank] = numTrisOfEdge;
+        }
+      }
+    });
+
+    // Keep the cheapest independent candidates until the target reduction is
+    // expected to be reached, so that the last round does not overshoot it.
+    collapses.clear();
+    vtkIdType numExpected = numDeletedTris;
+    for (vtkIdType rank = 0; rank < numCandidates &&
+         static_cast<double>(numExpected) / numTris < this->TargetReduction;
+         ++rank)
+    {
+      if (numEdgeTris[rank] >= 0)
+      {
+        collapses.push_back(candidates[rank]);
+        numExpected += numEdgeTris[rank];
+      }
+    }
+
+    // Collapse the selected edges. As their neighborhoods are disjoint, the
+    // collapses touch different points, cells and links of the mesh.
+    const vtkIdType numCollapses = static_cast<vtkIdType>(collapses.size());
+    std::vector<int> numDeleted(numCollapses, -1);
+    std::vector<std::vector<vtkIdType>> affectedEdges(numCollapses);
+    auto collapse = [&](vtkIdType i, vtkIdType end) {
+      vtkIdList* edgeIds = tlEdgeIds.Local();
+      vtkIdList* cellIds = tlCellIds.Local();
+      std::vector<double> target(numValues);
+      for (; i < end; ++i)
+      {
+        const vtkIdType edgeId = collapses[i];
+        vtkIdType endPtIds[2] = { this->EndPoint1List->GetId(edgeId),
+          this->EndPoint2List->GetId(edgeId) };
+        this->TargetPoints->GetTypedTuple(edgeId, target.data());
+        if (!this->IsGoodPlacement(endPtIds[0], endPtIds[1], target.data()))
+        {
+          continue;
+        }
+        this->SetPointAttributeArray(endPtIds, target.data());
+        this->AddQuadric(endPtIds[1], endPtIds[0]);
+        this->FindAffectedEdges(endPtIds[0], endPtIds[1], edgeIds);
+        affectedEdges[i].assign(edgeIds->begin(), edgeIds->end());
+        numDeleted[i] = this->CollapseEdge(endPtIds[0], endPtIds[1], cellIds);
+      }
+    };
+    if (concurrentCollapses)
+    {
+      vtkSMPTools::For(0, numCollapses, collapse);
+    }
+    else
+    {
+      collapse(0, numCollapses);
+    }
+
+    // Update the edges as UpdateEdgeData() does, serially since the edge
+    // table grows, then compute the new costs in parallel.
+    CollapseRound round = { 0, 0.0, 0.0 };
+    updatedEdges.clear();
+    for (vtkIdType i = 0; i < numCollapses; ++i)
+    {
+      const vtkIdType edgeId = collapses[i];
+      if (numDeleted[i] < 0)
+      {
+        // Poor placement: the edge is reconsidered when its cost is updated.
+        costs[edgeId] = VTK_DOUBLE_MAX;
+        continue;
+      }
+      ++round.NumberOfCollapses;
+      round.MaximumCost = std::max(round.MaximumCost, costs[edgeId]);
+      numDeletedTris += numDeleted[i];
+      costs[edgeId] = VTK_DOUBLE_MAX;
+
+      const vtkIdType pt0Id = this->EndPoint1List->GetId(edgeId);
+      const vtkIdType pt1Id = this->EndPoint2List->GetId(edgeId);
+      for (vtkIdType changedId : affectedEdges[i])
+      {
+        const vtkIdType edge[2] = { this->EndPoint1List->GetId(changedId),
+          this->EndPoint2List->GetId(changedId) };
+        costs[changedId] = VTK_DOUBLE_MAX;
+        if (edge[0] != pt1Id && edge[1] != pt1Id)
+        {
+          // This edge already has one point as the merged point.
+          updatedEdges.push_back(changedId);
+          continue;
+        }
+        const vtkIdType otherId = edge[0] == pt1Id ? edge[1] : edge[0];
+        if (this->Edges->IsEdge(otherId, pt0Id) == -1)
+        {
+          // The edge will be completely new, add it.
+          const vtkIdType newId = this->Edges->GetNumberOfEdges();
+          this->Edges->InsertEdge(otherId, pt0Id, newId);
+          this->EndPoint1List->InsertId(newId, otherId);
+          this->EndPoint2List->InsertId(newId, pt0Id);
+          this->TargetPoints->InsertTuple(newId, x.data());
+          costs.push_back(VTK_DOUBLE_MAX);
+          updatedEdges.push_back(newId);
+        }
+      }
+    }
+    computeCosts(updatedEdges.data(), static_cast<vtkIdType>(updatedEdges.size()));
+
+    this->NumberOfEdgeCollapses += round.NumberOfCollapses;
+    this->ActualReduction = static_cast<double>(numDeletedTris) / numTris;
+    round.Reduction = this->ActualReduction;
+    this->CollapseRounds.push_back(round);
+    vtkDebugMacro(<< "Round " << this->CollapseRounds.size() << ": " << round.NumberOfCollapses
+                  << " collapses of " << numCandidates << " candidates, maximum cost "
+                  << round.MaximumCost << ", reduction " << round.Reduction);
+    this->UpdateProgress(0.20 + 0.80 * this->ActualReduction / this->TargetReduction);
+  }
+}
+
 //------------------------------------------------------------------------------
 double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
+{
+  return this->ComputeCost(edgeId, x, this->TempQuad);
+}
+
+//------------------------------------------------------------------------------
+double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x, double* quad)
 {
   static const double errorNumber = 1e-10;
   double temp[3], A[3][3], b[3];
@@ -948,20 +1393,20 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
 
   for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
   {
-    this->TempQuad[i] =
+    quad[i] =
       this->ErrorQuadrics[pointIds[0]].Quadric[i] + this->ErrorQuadrics[pointIds[1]].Quadric[i];
   }
 
-  A[0][0] = this->TempQuad[0];
-  A[0][1] = A[1][0] = this->TempQuad[1];
-  A[0][2] = A[2][0] = this->TempQuad[2];
-  A[1][1] = this->TempQuad[4];
-  A[1][2] = A[2][1] = this->TempQuad[5];
-  A[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
-  b[0] = -this->TempQuad[3];
-  b[1] = -this->TempQuad[6];
-  b[2] = -this->TempQuad[8];
+  b[0] = -quad[3];
+  b[1] = -quad[6];
+  b[2] = -quad[8];
 
   norm = vtkMath::Norm(A[0]);
   normTemp = vtkMath::Norm(A[1]);
@@ -1013,7 +1458,7 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
 
   // Compute the cost
   // x'*quad*x
-  index = this->TempQuad;
+  index = quad;
   for (i = 0; i < 4; i++)
   {
     cost += (*index++) * newPoint[i] * newPoint[i];
@@ -1028,6 +1473,13 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double* x)
 
 //------------------------------------------------------------------------------
 double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
+{
+  return this->ComputeCost2(edgeId, x, this->TempQuad, this->TempA, this->TempB);
+}
+
+//------------------------------------------------------------------------------
+double vtkQuadricDecimation::ComputeCost2(
+  vtkIdType edgeId, double* x, double* quad, double** A, double* b)
 {
   // this function is so ugly because the functionality of converting an QEM
   // into a dense matrix was not extracted into a separate function and
@@ -1043,29 +1495,29 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
 
   for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
   {
-    this->TempQuad[i] =
+    quad[i] =
       this->ErrorQuadrics[pointIds[0]].Quadric[i] + this->ErrorQuadrics[pointIds[1]].Quadric[i];
   }
 
   // copy the temp quad into TempA
   // converting from the sparse matrix format into a dense
-  this->TempA[0][0] = this->TempQuad[0];
-  this->TempA[0][1] = this->TempA[1][0] = this->TempQuad[1];
-  this->TempA[0][2] = this->TempA[2][0] = this->TempQuad[2];
-  this->TempA[1][1] = this->TempQuad[4];
-  this->TempA[1][2] = this->TempA[2][1] = this->TempQuad[5];
-  this->TempA[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
-  this->TempB[0] = -this->TempQuad[3];
-  this->TempB[1] = -this->TempQuad[6];
-  this->TempB[2] = -this->TempQuad[8];
+  b[0] = -quad[3];
+  b[1] = -quad[6];
+  b[2] = -quad[8];
 
   for (i = 3; i < 3 + this->NumberOfComponents; i++)
   {
-    this->TempA[0][i] = this->TempA[i][0] = this->TempQuad[11 + 4 * (i - 3)];
-    this->TempA[1][i] = this->TempA[i][1] = this->TempQuad[11 + 4 * (i - 3) + 1];
-    this->TempA[2][i] = this->TempA[i][2] = this->TempQuad[11 + 4 * (i - 3) + 2];
-    this->TempB[i] = -this->TempQuad[11 + 4 * (i - 3) + 3];
+    A[0][i] = A[i][0] = quad[11 + 4 * (i - 3)];
+    A[1][i] = A[i][1] = quad[11 + 4 * (i - 3) + 1];
+    A[2][i] = A[i][2] = quad[11 + 4 * (i - 3) + 2];
+    b[i] = -quad[11 + 4 * (i - 3) + 3];
   }
 
   // Set zero to all components of the submatrix a[3:n;3:n] and al to its diagonal
@@ -1075,11 +1527,11 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i == j)
       {
-        this->TempA[i][j] = this->TempQuad[10];
+        A[i][j] = quad[10];
       }
       else
       {
-        this->TempA[i][j] = 0;
+        A[i][j] = 0;
       }
     }
   }
@@ -1090,48 +1542,48 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i >= 3)
       {
-        this->TempA[i][3 + this->NumberOfComponents] = 0;
-        this->TempA[3 + this->NumberOfComponents][i] = 0;
+        A[i][3 + this->NumberOfComponents] = 0;
+        A[3 + this->NumberOfComponents][i] = 0;
       }
       else
       {
-        this->TempA[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[i][3 + this->NumberOfComponents] +=
+        A[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[i][3 + this->NumberOfComponents] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] +=
+        A[3 + this->NumberOfComponents][i] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
       }
     }
     // Add constraint to b
-    this->TempB[3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + 3];
-    this->TempB[3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + 3];
+    b[3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + 3];
+    b[3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + 3];
   }
 
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    x[i] = this->TempB[i];
+    x[i] = b[i];
   }
 
   // solve A*x = b
   // this clobers A
   // need to develop a quality of the solution test??
   solveOk = vtkMath::SolveLinearSystem(
-    this->TempA, x, 3 + this->NumberOfComponents + this->VolumePreservation);
+    A, x, 3 + this->NumberOfComponents + this->VolumePreservation);
 
   // need to copy back into A
-  this->TempA[0][0] = this->TempQuad[0];
-  this->TempA[0][1] = this->TempA[1][0] = this->TempQuad[1];
-  this->TempA[0][2] = this->TempA[2][0] = this->TempQuad[2];
-  this->TempA[1][1] = this->TempQuad[4];
-  this->TempA[1][2] = this->TempA[2][1] = this->TempQuad[5];
-  this->TempA[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
   for (i = 3; i < 3 + this->NumberOfComponents; i++)
   {
-    this->TempA[0][i] = this->TempA[i][0] = this->TempQuad[11 + 4 * (i - 3)];
-    this->TempA[1][i] = this->TempA[i][1] = this->TempQuad[11 + 4 * (i - 3) + 1];
-    this->TempA[2][i] = this->TempA[i][2] = this->TempQuad[11 + 4 * (i - 3) + 2];
+    A[0][i] = A[i][0] = quad[11 + 4 * (i - 3)];
+    A[1][i] = A[i][1] = quad[11 + 4 * (i - 3) + 1];
+    A[2][i] = A[i][2] = quad[11 + 4 * (i - 3) + 2];
   }
 
   for (i = 3; i < 3 + this->NumberOfComponents; i++)
@@ -1140,11 +1592,11 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i == j)
       {
-        this->TempA[i][j] = this->TempQuad[10];
+        A[i][j] = quad[10];
       }
       else
       {
-        this->TempA[i][j] = 0;
+        A[i][j] = 0;
       }
     }
   }
@@ -1155,16 +1607,16 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
     {
       if (i >= 3)
       {
-        this->TempA[i][3 + this->NumberOfComponents] = 0;
-        this->TempA[3 + this->NumberOfComponents][i] = 0;
+        A[i][3 + this->NumberOfComponents] = 0;
+        A[3 + this->NumberOfComponents][i] = 0;
       }
       else
       {
-        this->TempA[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[i][3 + this->NumberOfComponents] +=
+        A[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
+        A[i][3 + this->NumberOfComponents] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] +=
+        A[3 + this->NumberOfComponents][i] +=
           this->VolumeConstraints[pointIds[1] * 4 + i];
       }
     }
@@ -1198,7 +1650,7 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
       temp2[i] = 0;
       for (j = 0; j < 3 + this->NumberOfComponents; ++j)
       {
-        temp2[i] += this->TempA[i][j] * v[j];
+        temp2[i] += A[i][j] * v[j];
       }
     }
 
@@ -1216,13 +1668,13 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
         temp[i] = 0;
         for (j = 0; j < 3 + this->NumberOfComponents; ++j)
         {
-          temp[i] += this->TempA[i][j] * pt1[j];
+          temp[i] += A[i][j] * pt1[j];
         }
       }
 
       for (i = 0; i < 3 + this->NumberOfComponents; i++)
       {
-        temp[i] = this->TempB[i] - temp[i];
+        temp[i] = b[i] - temp[i];
       }
 
       for (i = 0; i < 3 + this->NumberOfComponents; i++)
@@ -1256,33 +1708,39 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double* x)
   // x'*A*x - 2*b*x + d
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    cost += this->TempA[i][i] * x[i] * x[i];
+    cost += A[i][i] * x[i] * x[i];
     for (j = i + 1; j < 3 + this->NumberOfComponents + this->VolumePreservation; j++)
     {
-      cost += 2.0 * this->TempA[i][j] * x[i] * x[j];
+      cost += 2.0 * A[i][j] * x[i] * x[j];
     }
   }
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    cost -= 2.0 * this->TempB[i] * x[i];
+    cost -= 2.0 * b[i] * x[i];
   }
 
-  cost += this->TempQuad[9];
+  cost += quad[9];
 
   return cost;
 }
 
 int vtkQuadricDecimation::CollapseEdge(vtkIdType pt0Id, vtkIdType pt1Id)
+{
+  return this->CollapseEdge(pt0Id, pt1Id, this->CollapseCellIds);
+}
+
+//------------------------------------------------------------------------------
+int vtkQuadricDecimation::CollapseEdge(vtkIdType pt0Id, vtkIdType pt1Id, vtkIdList* cellIds)
 {
   int j, numDeleted = 0;
   vtkIdType i, cellId;
   vtkIdType npts;
   const vtkIdType* pts;
 
-  this->Mesh->GetPointCells(pt0Id, this->CollapseCellIds);
-  for (i = 0; i < this->CollapseCellIds->GetNumberOfIds(); i++)
+  this->Mesh->GetPointCells(pt0Id, cellIds);
+  for (i = 0; i < cellIds->GetNumberOfIds(); i++)
   {
-    cellId = this->CollapseCellIds->GetId(i);
+    cellId = cellIds->GetId(i);
     this->Mesh->GetCellPoints(cellId, npts, pts);
     for (j = 0; j < 3; j++)
     {
@@ -1295,11 +1753,11 @@ int vtkQuadricDecimation::CollapseEdge(vtkIdType pt0Id, vtkIdType pt1Id)
     }
   }
 
-  this->Mesh->GetPointCells(pt1Id, this->CollapseCellIds);
-  this->Mesh->ResizeCellList(pt0Id, this->CollapseCellIds->GetNumberOfIds());
-  for (i = 0; i < this->CollapseCellIds->GetNumberOfIds(); i++)
+  this->Mesh->GetPointCells(pt1Id, cellIds);
+  this->Mesh->ResizeCellList(pt0Id, cellIds->GetNumberOfIds());
+  for (i = 0; i < cellIds->GetNumberOfIds(); i++)
   {
-    cellId = this->CollapseCellIds->GetId(i);
+    cellId = cellIds->GetId(i);
     this->Mesh->GetCellPoints(cellId, npts, pts);
     // making sure we don't already have the triangle we're about to
     // change this one to
@@ -1548,5 +2006,8 @@ void vtkQuadricDecimation::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Normals Weight: " << this->NormalsWeight << "\n";
   os << indent << "TCoords Weight: " << this->TCoordsWeight << "\n";
   os << indent << "Tensors Weight: " << this->TensorsWeight << "\n";
+
+  os << indent << "Parallel Collapse: " << (this->ParallelCollapse ? "On\n" : "Off\n");
+  os << indent << "Candidate Fraction: " << this->CandidateFraction << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -36,6 +36,12 @@
  * Attributes" is also a good take on the subject especially as it pertains
  * to the error metric applied to attributes.
  *
+ * A parallel mode, enabled with ParallelCollapse, computes the quadrics and
+ * the edge costs with vtkSMPTools and collapses the edges by rounds of
+ * independent collapses instead of one at a time in a global priority queue.
+ * It is much faster on large meshes, at the price of a collapse order that
+ * only approximates the order of the costs.
+ *
  * @par Thanks:
  * Thanks to Bradley Lowekamp of the National Library of Medicine/NIH for
  * contributing this class.
@@ -48,6 +54,8 @@
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+#include <vector> // For std::vector
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkEdgeTable;
 class vtkIdList;
@@ -186,6 +194,54 @@ public:
   vtkGetMacro(TensorsWeight, double);
   ///@}
 
+  ///@{
+  /**
+   * Decimate in parallel with vtkSMPTools. The quadrics and the costs of the
+   * edges are computed in parallel, then the edges are collapsed by rounds.
+   * The candidates of a round are the cheapest edges, in the proportion
+   * given by CandidateFraction. A candidate is selected when it is the
+   * cheapest candidate around each point of the triangles using its end
+   * points: the selected edges have disjoint neighborhoods and are collapsed
+   * concurrently, then the costs of the edges around them are updated in
+   * parallel. The rounds stop at the same TargetReduction as the serial
+   * decimation, and the costs, including the attribute error metric, and
+   * the placement checks are the same, but the order of the collapses
+   * differs, so the output is not identical. Off by default.
+   */
+  vtkSetMacro(ParallelCollapse, bool);
+  vtkGetMacro(ParallelCollapse, bool);
+  vtkBooleanMacro(ParallelCollapse, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Fraction of the collapsible edges, the cheapest ones, that are
+   * candidates in each round of the parallel mode. Small fractions follow
+   * the order of the costs more closely, giving a result closer to the
+   * serial decimation, at the price of more rounds. At least one edge is a
+   * candidate. Default is 0.1.
+   */
+  vtkSetClampMacro(CandidateFraction, double, 0.0, 1.0);
+  vtkGetMacro(CandidateFraction, double);
+  ///@}
+
+  ///@{
+  /**
+   * Get the statistics of the rounds of the last parallel execution: their
+   * number, and for each round the number of edges collapsed, the maximum
+   * cost of these collapses and the actual reduction at the end of the
+   * round. These values are only valid after the filter has executed with
+   * ParallelCollapse on.
+   */
+  int GetNumberOfCollapseRounds() const { return static_cast<int>(this->CollapseRounds.size()); }
+  vtkIdType GetRoundNumberOfCollapses(int round) const
+  {
+    return this->CollapseRounds[round].NumberOfCollapses;
+  }
+  double GetRoundMaximumCost(int round) const { return this->CollapseRounds[round].MaximumCost; }
+  double GetRoundReduction(int round) const { return this->CollapseRounds[round].Reduction; }
+  ///@}
+
   ///@{
   /**
    * Get the actual reduction. This value is only valid after the
@@ -205,17 +261,42 @@ protected:
    * triangles deleted.
    */
   int CollapseEdge(vtkIdType pt0Id, vtkIdType pt1Id);
+  int CollapseEdge(vtkIdType pt0Id, vtkIdType pt1Id, vtkIdList* cellIds);
+
+  /**
+   * Collapse the edges by rounds of independent collapses, in parallel.
+   */
+  void CollapseEdgesInParallel(vtkIdType numTris);
 
   /**
    * Compute quadric for all vertices
    */
   void InitializeQuadrics(vtkIdType numPts);
 
+  /**
+   * Compute quadric for all vertices, including the boundary constraints, in
+   * parallel.
+   */
+  void InitializeQuadricsInParallel(vtkIdType numPts);
+
+  /**
+   * Compute the quadric of a triangle and its normal, plane offset and area.
+   * Return false if the attribute part cannot be computed.
+   */
+  bool ComputeTriangleQuadric(
+    const vtkIdType* pts, double* QEM, double n[3], double& d, double& triArea2);
+
   /**
    * Free boundary edges are weighted
    */
   void AddBoundaryConstraints();
 
+  /**
+   * Compute the quadric constraining the boundary edge (pts[i], pts[i+1]) of
+   * a triangle and return its weight.
+   */
+  double ComputeBoundaryQuadric(const vtkIdType* pts, int i, double* QEM);
+
   /**
    * Compute quadric for this vertex.
    */
@@ -236,6 +317,15 @@ protected:
   double ComputeCost2(vtkIdType edgeId, double* x);
   ///@}
 
+  ///@{
+  /**
+   * Same as above, using the given work arrays instead of the Temp members so
+   * that costs can be computed concurrently.
+   */
+  double ComputeCost(vtkIdType edgeId, double* x, double* quad);
+  double ComputeCost2(vtkIdType edgeId, double* x, double* quad, double** A, double* b);
+  ///@}
+
   /**
    * Find all edges that will have an endpoint change ids because of an edge
    * collapse.  p1Id and p2Id are the endpoints of the edge.  p2Id is the
@@ -280,6 +370,17 @@ protected:
 
   bool MapPointData = false;
 
+  bool ParallelCollapse = false;
+  double CandidateFraction = 0.1;
+
+  struct CollapseRound
+  {
+    vtkIdType NumberOfCollapses;
+    double MaximumCost;
+    double Reduction;
+  };
+  std::vector<CollapseRound> CollapseRounds;
+
   vtkTypeBool ScalarsAttribute;
   vtkTypeBool VectorsAttribute;
   vtkTypeBool NormalsAttribute;
@@ -0,0 +1,296 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSpaceFillingCurveInternal
+ * @brief   ordering of points along space-filling curves
+ *
+ * vtkSpaceFillingCurveInternal gathers the code shared by the filters that
+ * order points along a Morton (Z-order) or Hilbert curve: vtkSpatialReorderFilter
+ * renumbers points and cells with it, vtkDelaunay2D and vtkDelaunay3D use it
+ * to insert the points in a biased randomized insertion order (BRIO). The
+ * curve indices are computed and sorted with vtkSMPTools.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkSpatialReorderFilter vtkDelaunay2D vtkDelaunay3D
+ */
+
+#ifndef vtkSpaceFillingCurveInternal_h
+#define vtkSpaceFillingCurveInternal_h
+
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// Maps positions to their index along a space-filling curve. Positions are
+// quantized on a grid of 2^21 cells along each axis of the (cubic) bounding
+// box, so that the index of a grid cell fits in 63 bits. Planar encoders
+// ignore the z coordinate and order the points along a 2D curve.
+struct CurveEncoder
+{
+  static constexpr int Bits = 21;
+  static constexpr std::uint32_t MaxCoordinate = (1u << Bits) - 1;
+
+  double Origin[3];
+  double Scale;
+  bool Hilbert;
+  bool Planar;
+
+  CurveEncoder(const double bounds[6], bool hilbert, bool planar = false)
+    : Hilbert(hilbert)
+    , Planar(planar)
+  {
+    double length = 0.0;
+    const int numAxes = planar ? 2 : 3;
+    for (int i = 0; i < 3; ++i)
+    {
+      this->Origin[i] = bounds[2 * i];
+      if (i < numAxes)
+      {
+        length = std::max(length, bounds[2 * i + 1] - bounds[2 * i]);
+      }
+    }
+    this->Scale = length > 0.0 ? MaxCoordinate / length : 0.0;
+  }
+
+  std::uint64_t Encode(const double x[3]) const
+  {
+    const double maxCoordinate = MaxCoordinate;
+    std::uint32_t q[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      const double v = (x[i] - this->Origin[i]) * this->Scale;
+      q[i] = static_cast<std::uint32_t>(v > 0.0 ? std::min(v, maxCoordinate) : 0.0);
+    }
+    if (this->Planar)
+    {
+      return this->Hilbert ? HilbertIndex(q, 2) : MortonIndex2D(q);
+    }
+    return this->Hilbert ? HilbertIndex(q, 3) : MortonIndex(q);
+  }
+
+  // Spread the 21 low bits of v so that two zero bits separate them.
+  static std::uint64_t SpreadBits(std::uint64_t v)
+  {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffffULL;
+    v = (v | v << 16) & 0x1f0000ff0000ffULL;
+    v = (v | v << 8) & 0x100f00f00f00f00fULL;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v << 2) & 0x1249249249249249ULL;
+    return v;
+  }
+
+  // Spread the 21 low bits of v so that one zero bit separates them.
+  static std::uint64_t SpreadBits2D(std::uint64_t v)
+  {
+    v &= 0x1fffff;
+    v = (v | v << 16) & 0x0000ffff0000ffffULL;
+    v = (v | v << 8) & 0x00ff00ff00ff00ffULL;
+    v = (v | v << 4) & 0x0f0f0f0f0f0f0f0fULL;
+    v = (v | v << 2) & 0x3333333333333333ULL;
+    v = (v | v << 1) & 0x5555555555555555ULL;
+    return v;
+  }
+
+  static std::uint64_t MortonIndex(const std::uint32_t q[3])
+  {
+    return (SpreadBits(q[0]) << 2) | (SpreadBits(q[1]) << 1) | SpreadBits(q[2]);
+  }
+
+  static std::uint64_t MortonIndex2D(const std::uint32_t q[2])
+  {
+    return (SpreadBits2D(q[0]) << 1) | SpreadBits2D(q[1]);
+  }
+
+  // Skilling's algorithm ("Programming the Hilbert curve", AIP Conference
+  // Proceedings 707, 2004): the coordinates are transformed in place into the
+  // "transposed" Hilbert index, whose bits are then interleaved.
+  static std::uint64_t HilbertIndex(const std::uint32_t coords[3], int dim)
+  {
+    std::uint32_t x[3] = { coords[0], coords[1], coords[2] };
+    const std::uint32_t m = 1u << (Bits - 1);
+
+    // Inverse undo
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+      const std::uint32_t p = q - 1;
+      for (int i = 0; i < dim; ++i)
+      {
+        if (x[i] & q)
+        {
+          x[0] ^= p; // invert
+        }
+        else
+        { // exchange
+          const std::uint32_t t = (x[0] ^ x[i]) & p;
+          x[0] ^= t;
+          x[i] ^= t;
+        }
+      }
+    }
+
+    // Gray encode
+    for (int i = 1; i < dim; ++i)
+    {
+      x[i] ^= x[i - 1];
+    }
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+      if (x[dim - 1] & q)
+      {
+        t ^= q - 1;
+      }
+    }
+    for (int i = 0; i < dim; ++i)
+    {
+      x[i] ^= t;
+    }
+
+    return dim == 2 ? MortonIndex2D(x) : MortonIndex(x);
+  }
+};
+
+// The index along the curve of a point or cell, and its id. Sorting on both
+// makes the ordering deterministic.
+struct CurveEntry
+{
+  std::uint64_t Index;
+  vtkIdType Id;
+
+  bool operator<(const CurveEntry& other) const
+  {
+    return this->Index < other.Index || (this->Index == other.Index && this->Id < other.Id);
+  }
+};
+
+// Sort the entries along the curve and return the new-to-old permutation.
+inline std::vector<vtkIdType> SortEntries(std::vector<CurveEntry>& entries)
+{
+  vtkSMPTools::Sort(entries.begin(), entries.end());
+  std::vector<vtkIdType> newToOld(entries.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(entries.size()), [&](vtkIdType id, vtkIdType endId) {
+    for (; id < endId; ++id)
+    {
+      newToOld[id] = entries[id].Id;
+    }
+  });
+  return newToOld;
+}
+
+//------------------------------------------------------------------------------
+// Compute the curve index of each point.
+struct EncodePointsWorker
+{
+  template <typename PointsT>
+  void operator()(PointsT* pts, const CurveEncoder& encoder, std::vector<CurveEntry>& entries)
+  {
+    vtkSMPTools::For(0, pts->GetNumberOfTuples(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      const auto points = vtk::DataArrayTupleRange<3>(pts);
+      double x[3];
+      for (; ptId < endPtId; ++ptId)
+      {
+        const auto p = points[ptId];
+        x[0] = p[0];
+        x[1] = p[1];
+        x[2] = p[2];
+        entries[ptId] = CurveEntry{ encoder.Encode(x), ptId };
+      }
+    });
+  }
+};
+
+using CurveDispatcher = vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>;
+
+// Return the ids of the points sorted along the curve.
+inline std::vector<vtkIdType> SortPoints(vtkPoints* points, const CurveEncoder& encoder)
+{
+  std::vector<CurveEntry> entries(points->GetNumberOfPoints());
+  EncodePointsWorker worker;
+  if (!CurveDispatcher::Execute(points->GetData(), worker, encoder, entries))
+  { // Fallback to slow path for unusual types:
+    worker(points->GetData(), encoder, entries);
+  }
+  return SortEntries(entries);
+}
+
+//------------------------------------------------------------------------------
+// Return the ids of the points in biased randomized insertion order (Amenta,
+// Choi and Rote, "Incremental constructions con BRIO", SoCG 2003). The points
+// are dealt into rounds of doubling sizes by a hash of their ids, the first
+// round holding about 128 points, and each round is ordered along the Hilbert
+// curve. Incremental constructions then keep the benefits of a random
+// insertion order while successive points are close to each other.
+inline std::vector<vtkIdType> ComputeBRIOOrder(
+  vtkPoints* points, const double bounds[6], bool planar)
+{
+  const CurveEncoder encoder(bounds, true, planar);
+  const std::vector<vtkIdType> sorted = SortPoints(points, encoder);
+  const vtkIdType numPts = static_cast<vtkIdType>(sorted.size());
+
+  int numRounds = 1;
+  while ((numPts >> (numRounds + 7)) > 0)
+  {
+    ++numRounds;
+  }
+  if (numRounds == 1)
+  {
+    return sorted;
+  }
+
+  // A point lands in the last round with probability 1/2, in the previous
+  // one with probability 1/4, and so on.
+  std::vector<unsigned char> rounds(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType i, vtkIdType endI) {
+    for (; i < endI; ++i)
+    {
+      std::uint64_t h = static_cast<std::uint64_t>(sorted[i]) + 0x9e3779b97f4a7c15ULL;
+      h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+      h ^= h >> 31;
+      int level = 0;
+      while (level < numRounds - 1 && !(h & (1ULL << level)))
+      {
+        ++level;
+      }
+      rounds[i] = static_cast<unsigned char>(numRounds - 1 - level);
+    }
+  });
+
+  // Stable counting sort on the rounds keeps the curve order in each round.
+  std::vector<vtkIdType> offsets(numRounds + 1, 0);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    ++offsets[rounds[i] + 1];
+  }
+  for (int r = 0; r < numRounds; ++r)
+  {
+    offsets[r + 1] += offsets[r];
+  }
+  std::vector<vtkIdType> order(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    order[offsets[rounds[i]]++] = sorted[i];
+  }
+  return order;
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkSpaceFillingCurveInternal.h
@@ -0,0 +1,416 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSpatialReorderFilter.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellData.h"
+#include "vtkDataArrayRange.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSpaceFillingCurveInternal.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSpatialReorderFilter);
+
+namespace
+{ // anonymous
+
+//------------------------------------------------------------------------------
+// Compute the curve index of the centroid of each cell.
+struct EncodeCellsWorker
+{
+  template <typename PointsT>
+  void operator()(PointsT* pts, vtkCellArray* cells, const CurveEncoder& encoder,
+    std::vector<CurveEntry>& entries)
+  {
+    vtkSMPTools::For(0, cells->GetNumberOfCells(), [&](vtkIdType cellId, vtkIdType endCellId) {
+      const auto points = vtk::DataArrayTupleRange<3>(pts);
+      auto iter = vtk::TakeSmartPointer(cells->NewIterator());
+      vtkIdType npts;
+      const vtkIdType* ptIds;
+      for (; cellId < endCellId; ++cellId)
+      {
+        iter->GetCellAtId(cellId, npts, ptIds);
+        double x[3] = { 0.0, 0.0, 0.0 };
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          const auto p = points[ptIds[i]];
+          x[0] += p[0];
+          x[1] += p[1];
+          x[2] += p[2];
+        }
+        if (npts > 0)
+        {
+          x[0] /= npts;
+          x[1] /= npts;
+          x[2] /= npts;
+        }
+        entries[cellId] = CurveEntry{ encoder.Encode(x), cellId };
+      }
+    });
+  }
+};
+
+std::vector<vtkIdType> SortCells(
+  vtkPoints* points, vtkCellArray* cells, const CurveEncoder& encoder)
+{
+  std::vector<CurveEntry> entries(cells->GetNumberOfCells());
+  EncodeCellsWorker worker;
+  if (!CurveDispatcher::Execute(points->GetData(), worker, cells, encoder, entries))
+  {
+    worker(points->GetData(), cells, encoder, entries);
+  }
+  return SortEntries(entries);
+}
+
+std::vector<vtkIdType> InvertPermutation(const std::vector<vtkIdType>& newToOld)
+{
+  std::vector<vtkIdType> oldToNew(newToOld.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(newToOld.size()), [&](vtkIdType id, vtkIdType endId) {
+    for (; id < endId; ++id)
+    {
+      oldToNew[newToOld[id]] = id;
+    }
+  });
+  return oldToNew;
+}
+
+//------------------------------------------------------------------------------
+// Copy the point coordinates in their new order.
+struct PermutePointsWorker
+{
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT* inPts, OutArrayT* outPts, const vtkIdType* newToOld)
+  {
+    using OutValueT = vtk::GetAPIType<OutArrayT>;
+    vtkSMPTools::For(0, outPts->GetNumberOfTuples(), [&](vtkIdType ptId, vtkIdType endPtId) {
+      const auto inPoints = vtk::DataArrayTupleRange<3>(inPts);
+      auto outPoints = vtk::DataArrayTupleRange<3>(outPts);
+      for (; ptId < endPtId; ++ptId)
+      {
+        const auto inP = inPoints[newToOld[ptId]];
+        auto outP = outPoints[ptId];
+        outP[0] = static_cast<OutValueT>(inP[0]);
+        outP[1] = static_cast<OutValueT>(inP[1]);
+        outP[2] = static_cast<OutValueT>(inP[2]);
+      }
+    });
+  }
+};
+
+// Copy the attributes in their new order: threaded for the data arrays, in
+// serial for the other arrays (e.g., strings) which ArrayList does not handle.
+void PermuteAttributes(
+  vtkDataSetAttributes* in, vtkDataSetAttributes* out, const std::vector<vtkIdType>& newToOld)
+{
+  const vtkIdType num = static_cast<vtkIdType>(newToOld.size());
+  out->CopyAllocate(in, num);
+  ArrayList arrays;
+  arrays.AddArrays(num, in, out, 0.0, false);
+  vtkSMPTools::For(0, num, [&](vtkIdType id, vtkIdType endId) {
+    for (; id < endId; ++id)
+    {
+      arrays.Copy(newToOld[id], id);
+    }
+  });
+
+  for (int i = 0; i < out->GetNumberOfArrays(); ++i)
+  {
+    vtkAbstractArray* outArray = out->GetAbstractArray(i);
+    vtkAbstractArray* inArray =
+      outArray->GetName() ? in->GetAbstractArray(outArray->GetName()) : nullptr;
+    if (vtkArrayDownCast<vtkDataArray>(outArray) || !inArray)
+    {
+      continue;
+    }
+    outArray->SetNumberOfTuples(num);
+    for (vtkIdType id = 0; id < num; ++id)
+    {
+      outArray->SetTuple(id, newToOld[id], inArray);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Build a cell array with the cells of the input in a new order (if
+// newToOld is given), with the point ids remapped (if ptMap is given).
+struct PermuteCellsImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, const vtkIdType* newToOld, const vtkIdType* ptMap,
+    vtkCellArray* output) const
+  {
+    using ArrayType = typename CellStateT::ArrayType;
+    using ValueType = typename CellStateT::ValueType;
+
+    const vtkIdType numCells = state.GetNumberOfCells();
+    vtkNew<ArrayType> offsets;
+    vtkNew<ArrayType> conn;
+    offsets->SetNumberOfValues(numCells + 1);
+    conn->SetNumberOfValues(state.GetConnectivity()->GetNumberOfValues());
+    ValueType* outOffsets = offsets->GetPointer(0);
+    ValueType* outConn = conn->GetPointer(0);
+    const ValueType* inConn = state.GetConnectivity()->GetPointer(0);
+
+    // Sizes of the cells in their new order, then their offsets.
+    outOffsets[0] = 0;
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      for (; cellId < endCellId; ++cellId)
+      {
+        const vtkIdType inCellId = newToOld ? newToOld[cellId] : cellId;
+        outOffsets[cellId + 1] = static_cast<ValueType>(state.GetCellSize(inCellId));
+      }
+    });
+    std::partial_sum(outOffsets, outOffsets + numCells + 1, outOffsets);
+
+    vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+      for (; cellId < endCellId; ++cellId)
+      {
+        const vtkIdType inCellId = newToOld ? newToOld[cellId] : cellId;
+        const ValueType* inPts = inConn + state.GetBeginOffset(inCellId);
+        ValueType* outPts = outConn + outOffsets[cellId];
+        const vtkIdType npts = outOffsets[cellId + 1] - outOffsets[cellId];
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          outPts[i] = ptMap ? static_cast<ValueType>(ptMap[inPts[i]]) : inPts[i];
+        }
+      }
+    });
+
+    output->SetData(offsets, conn);
+  }
+};
+
+vtkSmartPointer<vtkCellArray> PermuteCells(
+  vtkCellArray* cells, const std::vector<vtkIdType>& newToOld, const std::vector<vtkIdType>& ptMap)
+{
+  auto output = vtkSmartPointer<vtkCellArray>::New();
+  cells->Visit(PermuteCellsImpl{}, newToOld.empty() ? nullptr : newToOld.data(),
+    ptMap.empty() ? nullptr : ptMap.data(), output.Get());
+  if (cells->IsStorageFixedSize())
+  {
+    output->ConvertToFixedSizeStorage();
+  }
+  return output;
+}
+
+void AddOriginalIds(vtkDataSetAttributes* attributes, const char* name,
+  const std::vector<vtkIdType>& newToOld, vtkIdType num)
+{
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName(name);
+  ids->SetNumberOfValues(num);
+  if (newToOld.empty())
+  {
+    std::iota(ids->GetPointer(0), ids->GetPointer(0) + num, 0);
+  }
+  else
+  {
+    std::copy(newToOld.begin(), newToOld.end(), ids->GetPointer(0));
+  }
+  attributes->AddArray(ids);
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkSpatialReorderFilter::vtkSpatialReorderFilter()
+{
+  this->CurveType = HILBERT_CURVE;
+  this->ReorderPoints = true;
+  this->ReorderCells = true;
+  this->PassThroughPointIds = false;
+  this->PassThroughCellIds = false;
+}
+
+//------------------------------------------------------------------------------
+int vtkSpatialReorderFilter::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPointSet* input = vtkPointSet::GetData(inputVector[0]);
+  vtkPointSet* output = vtkPointSet::GetData(outputVector);
+  vtkPolyData* inPoly = vtkPolyData::SafeDownCast(input);
+  vtkUnstructuredGrid* inGrid = vtkUnstructuredGrid::SafeDownCast(input);
+
+  // Only unstructured points and cells can be renumbered.
+  const bool canReorder = inPoly || inGrid || input->GetDataObjectType() == VTK_POINT_SET;
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  if (!canReorder || numPts == 0 || !input->GetPoints())
+  {
+    output->ShallowCopy(input);
+    return 1;
+  }
+  vtkDebugMacro(<< "Reordering " << numPts << " points and " << input->GetNumberOfCells()
+                << " cells");
+
+  vtkPoints* inPts = input->GetPoints();
+  const CurveEncoder encoder(input->GetBounds(), this->CurveType == HILBERT_CURVE);
+  output->GetFieldData()->PassData(input->GetFieldData());
+
+  // Points and point data, sorted along the curve.
+  std::vector<vtkIdType> newToOldPts, oldToNewPts;
+  if (this->ReorderPoints)
+  {
+    newToOldPts = SortPoints(inPts, encoder);
+    oldToNewPts = InvertPermutation(newToOldPts);
+
+    vtkNew<vtkPoints> newPts;
+    newPts->SetDataType(inPts->GetDataType());
+    newPts->SetNumberOfPoints(numPts);
+    PermutePointsWorker worker;
+    using PointsDispatcher = vtkArrayDispatch::Dispatch2BySameValueType<vtkArrayDispatch::Reals>;
+    if (!PointsDispatcher::Execute(inPts->GetData(), newPts->GetData(), worker, newToOldPts.data()))
+    { // Fallback to slow path for unusual types:
+      worker(inPts->GetData(), newPts->GetData(), newToOldPts.data());
+    }
+    output->SetPoints(newPts);
+    PermuteAttributes(input->GetPointData(), output->GetPointData(), newToOldPts);
+  }
+  else
+  {
+    output->SetPoints(inPts);
+    output->GetPointData()->PassData(input->GetPointData());
+  }
+  if (this->PassThroughPointIds)
+  {
+    AddOriginalIds(output->GetPointData(), "vtkOriginalPointIds", newToOldPts, numPts);
+  }
+  this->UpdateProgress(0.5);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Cells, sorted along the curve by their centroid, and cell data.
+  std::vector<vtkIdType> newToOldCells;
+  if (inGrid && inGrid->GetCells())
+  {
+    vtkUnstructuredGrid* outGrid = vtkUnstructuredGrid::SafeDownCast(output);
+    vtkCellArray* cells = inGrid->GetCells();
+    vtkUnsignedCharArray* types = inGrid->GetCellTypesArray();
+    vtkSmartPointer<vtkUnsignedCharArray> newTypes = types;
+    vtkCellArray* faceLocations = inGrid->GetPolyhedronFaceLocations();
+    vtkCellArray* faces = inGrid->GetPolyhedronFaces();
+    vtkSmartPointer<vtkCellArray> newFaceLocations = faceLocations;
+    vtkSmartPointer<vtkCellArray> newFaces = faces;
+    if (this->ReorderCells)
+    {
+      newToOldCells = SortCells(inPts, cells, encoder);
+      newTypes = vtkSmartPointer<vtkUnsignedCharArray>::New();
+      newTypes->SetNumberOfValues(types->GetNumberOfValues());
+      vtkSMPTools::For(0, newTypes->GetNumberOfValues(), [&](vtkIdType cellId, vtkIdType endId) {
+        for (; cellId < endId; ++cellId)
+        {
+          newTypes->SetValue(cellId, types->GetValue(newToOldCells[cellId]));
+        }
+      });
+      if (faceLocations)
+      {
+        // The faces keep their ids, only the list of faces of each cell moves.
+        newFaceLocations = PermuteCells(faceLocations, newToOldCells, std::vector<vtkIdType>());
+      }
+    }
+    vtkSmartPointer<vtkCellArray> newCells = cells;
+    if (this->ReorderCells || this->ReorderPoints)
+    {
+      newCells = PermuteCells(cells, newToOldCells, oldToNewPts);
+    }
+    if (faces && this->ReorderPoints)
+    {
+      newFaces = PermuteCells(faces, std::vector<vtkIdType>(), oldToNewPts);
+    }
+    if (faces)
+    {
+      outGrid->SetPolyhedralCells(newTypes, newCells, newFaceLocations, newFaces);
+    }
+    else
+    {
+      outGrid->SetCells(newTypes, newCells);
+    }
+  }
+  else if (inPoly)
+  {
+    // Cell ids of a vtkPolyData follow the verts, lines, polys and strips:
+    // each of them is sorted separately.
+    vtkPolyData* outPoly = vtkPolyData::SafeDownCast(output);
+    vtkCellArray* inCells[4] = { inPoly->GetVerts(), inPoly->GetLines(), inPoly->GetPolys(),
+      inPoly->GetStrips() };
+    vtkSmartPointer<vtkCellArray> outCells[4];
+    if (this->ReorderCells)
+    {
+      newToOldCells.reserve(inPoly->GetNumberOfCells());
+    }
+    vtkIdType cellIdOffset = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+      outCells[i] = inCells[i];
+      if (!inCells[i] || inCells[i]->GetNumberOfCells() == 0)
+      {
+        continue;
+      }
+      std::vector<vtkIdType> newToOld;
+      if (this->ReorderCells)
+      {
+        newToOld = SortCells(inPts, inCells[i], encoder);
+        for (const vtkIdType cellId : newToOld)
+        {
+          newToOldCells.push_back(cellIdOffset + cellId);
+        }
+      }
+      if (this->ReorderCells || this->ReorderPoints)
+      {
+        outCells[i] = PermuteCells(inCells[i], newToOld, oldToNewPts);
+      }
+      cellIdOffset += inCells[i]->GetNumberOfCells();
+    }
+    outPoly->SetVerts(outCells[0]);
+    outPoly->SetLines(outCells[1]);
+    outPoly->SetPolys(outCells[2]);
+    outPoly->SetStrips(outCells[3]);
+  }
+
+  const vtkIdType numCells = input->GetNumberOfCells();
+  if (newToOldCells.empty())
+  {
+    output->GetCellData()->PassData(input->GetCellData());
+  }
+  else
+  {
+    PermuteAttributes(input->GetCellData(), output->GetCellData(), newToOldCells);
+  }
+  if (this->PassThroughCellIds && numCells > 0)
+  {
+    AddOriginalIds(output->GetCellData(), "vtkOriginalCellIds", newToOldCells, numCells);
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkSpatialReorderFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Curve Type: " << (this->CurveType == HILBERT_CURVE ? "Hilbert" : "Morton")
+     << "\n";
+  os << indent << "Reorder Points: " << (this->ReorderPoints ? "On\n" : "Off\n");
+  os << indent << "Reorder Cells: " << (this->ReorderCells ? "On\n" : "Off\n");
+  os << indent << "Pass Through Point Ids: " << (this->PassThroughPointIds ? "On\n" : "Off\n");
+  os << indent << "Pass Through Cell Ids: " << (this->PassThroughCellIds ? "On\n" : "Off\n");
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSpatialReorderFilter
+ * @brief   renumber the points and cells of a dataset along a space-filling curve
+ *
+ * vtkSpatialReorderFilter renumbers the points and cells of a vtkPolyData,
+ * vtkUnstructuredGrid or point cloud (vtkPointSet) so that points and cells
+ * close to each other in space get close ids. The points are sorted along a
+ * Morton (Z-order) or Hilbert curve through the bounding box of the input,
+ * the cells along the same curve using their centroids. The geometry and the
+ * topology of the dataset are unchanged: the cell connectivity is remapped to
+ * the new point ids and the point and cell data are permuted accordingly.
+ *
+ * Data produced by solvers, by merging partitions or by appending datasets
+ * (e.g., with vtkAppendFilter) often has an arbitrary ordering. Algorithms
+ * that visit the points or cells in order and look up their neighbors (cell
+ * links, locators, probing, gradients, ...) then access memory randomly. After
+ * this filter, such accesses are mostly local, which improves the use of the
+ * caches by downstream filters. The Hilbert curve has better locality than
+ * the Morton curve, at a slightly higher cost to compute.
+ *
+ * The cells of a vtkPolyData are sorted within each of its cell arrays
+ * (verts, lines, polys and strips) since the cell ids of a vtkPolyData
+ * follow this order. Datasets whose point ordering is implied by their
+ * structure (e.g., vtkStructuredGrid) are passed through unchanged.
+ *
+ * Optionally, the filter produces the permutations as vtkIdTypeArrays named
+ * "vtkOriginalPointIds" and "vtkOriginalCellIds" in the output point and cell
+ * data, giving for each output point (cell) the id of the input point (cell).
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkStaticCleanUnstructuredGrid vtkStaticPointLocator vtkAppendFilter
+ */
+
+#ifndef vtkSpatialReorderFilter_h
+#define vtkSpatialReorderFilter_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkPointSetAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSCORE_EXPORT vtkSpatialReorderFilter : public vtkPointSetAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, obtaining type information, and
+   * printing the state of the object.
+   */
+  static vtkSpatialReorderFilter* New();
+  vtkTypeMacro(vtkSpatialReorderFilter, vtkPointSetAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * The space-filling curves along which points and cells can be sorted.
+   */
+  enum CurveTypes
+  {
+    MORTON_CURVE = 0,
+    HILBERT_CURVE
+  };
+
+  ///@{
+  /**
+   * Specify the space-filling curve used to sort the points and cells. By
+   * default, the Hilbert curve is used.
+   */
+  vtkSetClampMacro(CurveType, int, MORTON_CURVE, HILBERT_CURVE);
+  vtkGetMacro(CurveType, int);
+  void SetCurveTypeToMorton() { this->SetCurveType(MORTON_CURVE); }
+  void SetCurveTypeToHilbert() { this->SetCurveType(HILBERT_CURVE); }
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the points and the cells are reordered. Disabling one of
+   * them keeps the ordering of the input; the connectivity is still remapped
+   * if the points are reordered. By default both are reordered.
+   */
+  vtkSetMacro(ReorderPoints, bool);
+  vtkGetMacro(ReorderPoints, bool);
+  vtkBooleanMacro(ReorderPoints, bool);
+  vtkSetMacro(ReorderCells, bool);
+  vtkGetMacro(ReorderCells, bool);
+  vtkBooleanMacro(ReorderCells, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the permutations of the points and cells are added to
+   * the output as "vtkOriginalPointIds" and "vtkOriginalCellIds" point and
+   * cell data arrays. By default they are not.
+   */
+  vtkSetMacro(PassThroughPointIds, bool);
+  vtkGetMacro(PassThroughPointIds, bool);
+  vtkBooleanMacro(PassThroughPointIds, bool);
+  vtkSetMacro(PassThroughCellIds, bool);
+  vtkGetMacro(PassThroughCellIds, bool);
+  vtkBooleanMacro(PassThroughCellIds, bool);
+  ///@}
+
+protected:
+  vtkSpatialReorderFilter();
+  ~vtkSpatialReorderFilter() override = default;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int CurveType;
+  bool ReorderPoints;
+  bool ReorderCells;
+  bool PassThroughPointIds;
+  bool PassThroughCellIds;
+
+private:
+  vtkSpatialReorderFilter(const vtkSpatialReorderFilter&) = delete;
+  void operator=(const vtkSpatialReorderFilter&) = delete;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif
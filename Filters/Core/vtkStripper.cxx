@@ -12,12 +12,293 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkStripper);
 
+namespace
+{
+// Number of consecutive cells making a patch when stripping in parallel. It
+// does not depend on the number of threads, so that the output does not
+// either.
+const vtkIdType StripPatchSize = 16384;
+
+// The strips and polygons built from a patch of cells, in the layout of the
+// legacy cell arrays (number of points followed by the point ids), and the
+// ids of the cells they come from in the order of the output field data.
+struct StripPatch
+{
+  std::vector<vtkIdType> Strips;
+  std::vector<vtkIdType> StripCellIds;
+  std::vector<vtkIdType> Polys;
+  std::vector<vtkIdType> PolyCellIds;
+  vtkIdType NumberOfStrips = 0;
+  int LongestStrip = 0;
+};
+
+// Build the triangle strips on independent patches of consecutive cells. A
+// strip only grows through the cells of its patch, so that each patch is
+// processed by one thread with the greedy algorithm of the serial filter,
+// marking only its own cells as visited.
+struct BuildStripsOnPatches
+{
+  vtkPolyData* Mesh;
+  char* Visited;
+  vtkIdType FirstCellId;
+  vtkIdType NumberOfCells;
+  int MaximumLength;
+  std::vector<StripPatch>* Patches;
+
+  vtkSMPThreadLocalObject<vtkIdList> Neighbors;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Points;
+
+  BuildStripsOnPatches(vtkPolyData* mesh, char* visited, vtkIdType firstCellId,
+    vtkIdType numCells, int maxLength, std::vector<StripPatch>* patches)
+    : Mesh(mesh)
+    , Visited(visited)
+    , FirstCellId(firstCellId)
+    , NumberOfCells(numCells)
+    , MaximumLength(maxLength)
+    , Patches(patches)
+  {
+  }
+
+  void Initialize() { this->Points.Local().resize(this->MaximumLength + 2); }
+
+  void operator()(vtkIdType patchId, vtkIdType endPatchId)
+  {
+    for (; patchId < endPatchId; ++patchId)
+    {
+      const vtkIdType begin = this->FirstCellId + patchId * StripPatchSize;
+      const vtkIdType end = std::min(begin + StripPatchSize, this->NumberOfCells);
+      this->BuildPatch(begin, end, (*this->Patches)[patchId]);
+    }
+  }
+
+  void Reduce() {}
+
+  // Whether a cell can extend a strip of the patch [begin, end).
+  bool IsFree(vtkIdType cellId, vtkIdType begin, vtkIdType end) const
+  {
+    return cellId >= begin && cellId < end && !this->Visited[cellId] &&
+      this->Mesh->GetCellType(cellId) == VTK_TRIANGLE;
+  }
+
+  void BuildPatch(vtkIdType begin, vtkIdType end, StripPatch& patch)
+  {
+    vtkIdList* cellIds = this->Neighbors.Local();
+    vtkIdList* ptIds = this->CellPoints.Local();
+    vtkIdType* pts = this->Points.Local().data();
+    const vtkIdType* triPts;
+    vtkIdType numTriPts;
+    vtkIdType neighbor = 0;
+    int i;
+
+    for (vtkIdType cellId = begin; cellId < end; cellId++)
+    {
+      if (this->Visited[cellId])
+      {
+        continue;
+      }
+      this->Visited[cellId] = 1;
+      const int cellType = this->Mesh->GetCellType(cellId);
+      if (cellType == VTK_POLYGON || cellType == VTK_QUAD)
+      {
+        this->Mesh->GetCellPoints(cellId, numTriPts, triPts, ptIds);
+        patch.Polys.push_back(numTriPts);
+        patch.Polys.insert(patch.Polys.end(), triPts, triPts + numTriPts);
+        patch.PolyCellIds.push_back(cellId);
+        continue;
+      }
+      else if (cellType != VTK_TRIANGLE)
+      {
+        continue;
+      }
+
+      //  Got a starting point for the strip. Find a neighbor to extend it.
+      patch.NumberOfStrips++;
+      patch.StripCellIds.push_back(cellId);
+      int numPts = 3;
+      this->Mesh->GetCellPoints(cellId, numTriPts, triPts, ptIds);
+      for (i = 0; i < 3; i++)
+      {
+        pts[1] = triPts[i];
+        pts[2] = triPts[(i + 1) % 3];
+        this->Mesh->GetCellEdgeNeighbors(cellId, pts[1], pts[2], cellIds);
+        if (cellIds->GetNumberOfIds() > 0 && this->IsFree(neighbor = cellIds->GetId(0), begin, end))
+        {
+          pts[0] = triPts[(i + 2) % 3];
+          break;
+        }
+      }
+      if (i >= 3)
+      {
+        patch.Strips.push_back(3);
+        patch.Strips.insert(patch.Strips.end(), triPts, triPts + 3);
+        continue;
+      }
+
+      //  Have a neighbor. March along grabbing new points.
+      while (neighbor >= 0)
+      {
+        this->Visited[neighbor] = 1;
+        patch.StripCellIds.push_back(neighbor);
+        this->Mesh->GetCellPoints(neighbor, numTriPts, triPts, ptIds);
+        for (i = 0; i < 3; i++)
+        {
+          if (triPts[i] != pts[numPts - 2] && triPts[i] != pts[numPts - 1])
+          {
+            break;
+          }
+        }
+
+        // only add the triangle to the strip if it isn't degenerate.
+        if (i < 3)
+        {
+          pts[numPts] = triPts[i];
+          this->Mesh->GetCellEdgeNeighbors(neighbor, pts[numPts], pts[numPts - 1], cellIds);
+          numPts++;
+        }
+        patch.LongestStrip = std::max(patch.LongestStrip, numPts);
+
+        if (cellIds->GetNumberOfIds() <= 0 ||
+          !this->IsFree(neighbor = cellIds->GetId(0), begin, end) ||
+          numPts >= (this->MaximumLength + 2))
+        {
+          patch.Strips.push_back(numPts);
+          patch.Strips.insert(patch.Strips.end(), pts, pts + numPts);
+          neighbor = (-1);
+        }
+      }
+    }
+  }
+};
+
+// Order triangles for a vertex cache of the given size with the Tipsify
+// algorithm (Sander, Nehab and Barczak, "Fast triangle reordering for vertex
+// locality and reduced overdraw", SIGGRAPH 2007). The triangles are given by
+// their point ids, three per triangle; the new-to-old order is returned.
+std::vector<vtkIdType> OrderForVertexCache(
+  const std::vector<vtkIdType>& triPts, vtkIdType numPts, int cacheSize)
+{
+  const vtkIdType numTris = static_cast<vtkIdType>(triPts.size() / 3);
+  std::vector<vtkIdType> order;
+  order.reserve(numTris);
+  if (numTris == 0)
+  {
+    return order;
+  }
+
+  // The triangles using each point
+  std::vector<vtkIdType> offsets(numPts + 1, 0);
+  for (vtkIdType ptId : triPts)
+  {
+    ++offsets[ptId + 1];
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<vtkIdType> triangles(triPts.size());
+  std::vector<vtkIdType> fill(offsets.begin(), offsets.end() - 1);
+  for (vtkIdType i = 0; i < static_cast<vtkIdType>(triPts.size()); ++i)
+  {
+    triangles[fill[triPts[i]]++] = i / 3;
+  }
+
+  // Number of triangles not emitted yet using each point, and time stamps
+  // of the points entering the cache.
+  std::vector<vtkIdType> live(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    live[ptId] = offsets[ptId + 1] - offsets[ptId];
+  }
+  std::vector<vtkIdType> cacheTime(numPts, 0);
+  std::vector<char> emitted(numTris, 0);
+  std::vector<vtkIdType> deadEnd;
+  std::vector<vtkIdType> candidates;
+  vtkIdType time = cacheSize + 1;
+  vtkIdType cursor = 0;
+
+  vtkIdType fanning = triPts[0];
+  while (fanning >= 0)
+  {
+    // Emit the remaining triangles around the fanning point.
+    candidates.clear();
+    for (vtkIdType i = offsets[fanning]; i < offsets[fanning + 1]; ++i)
+    {
+      const vtkIdType triId = triangles[i];
+      if (emitted[triId])
+      {
+        continue;
+      }
+      emitted[triId] = 1;
+      order.push_back(triId);
+      for (int j = 0; j < 3; ++j)
+      {
+        const vtkIdType ptId = triPts[3 * triId + j];
+        deadEnd.push_back(ptId);
+        candidates.push_back(ptId);
+        --live[ptId];
+        if (time - cacheTime[ptId] > cacheSize)
+        {
+          cacheTime[ptId] = time++;
+        }
+      }
+    }
+
+    // Next fanning point: the candidate that stays in the cache the longest
+    // while its remaining triangles are emitted.
+    vtkIdType next = -1;
+    vtkIdType bestPriority = -1;
+    for (vtkIdType ptId : candidates)
+    {
+      if (live[ptId] > 0)
+      {
+        vtkIdType priority = 0;
+        if (time - cacheTime[ptId] + 2 * live[ptId] <= cacheSize)
+        {
+          priority = time - cacheTime[ptId];
+        }
+        if (priority > bestPriority)
+        {
+          bestPriority = priority;
+          next = ptId;
+        }
+      }
+    }
+
+    // Dead end: go back to a recently used point, else to the next point
+    // with remaining triangles.
+    while (next < 0 && !deadEnd.empty())
+    {
+      const vtkIdType ptId = deadEnd.back();
+      deadEnd.pop_back();
+      if (live[ptId] > 0)
+      {
+        next = ptId;
+      }
+    }
+    for (; next < 0 && cursor < numPts; ++cursor)
+    {
+      if (live[cursor] > 0)
+      {
+        next = cursor;
+      }
+    }
+    fanning = next;
+  }
+  return order;
+}
+}
+
 // Construct object with MaximumLength set to 1000.
 vtkStripper::vtkStripper()
 {
@@ -26,6 +307,9 @@ vtkStripper::vtkStripper()
   this->PassThroughCellIds = 0;
   this->PassThroughPointIds = 0;
   this->JoinContiguousSegments = 0;
+  this->ParallelStripping = 0;
+  this->OptimizeVertexCache = 0;
+  this->VertexCacheSize = 16;
 }
 
 int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
@@ -227,10 +511,17 @@ int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
   longestLine = 0;
   numLines = 0;
 
+  // In parallel mode the polygons are stripped by patches after the lines.
+  // When optimizing for the vertex cache, the triangles are gathered and
+  // output as triangles after the loop.
+  const bool stripPatches = this->ParallelStripping && !this->OptimizeVertexCache;
+  const vtkIdType endCellId = stripPatches ? inNumLines : numCells;
+  std::vector<vtkIdType> cacheCellIds, cacheTriPts;
+
   int cellType;
   bool abort = false;
   vtkIdType progressInterval = numCells / 20 + 1;
-  for (cellId = 0; cellId < numCells && !abort; cellId++)
+  for (cellId = 0; cellId < endCellId && !abort; cellId++)
   {
     if (ghostCells && ghostCells->GetValue(cellId))
     {
@@ -244,7 +535,14 @@ int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
     if (!visited[cellId])
     {
       visited[cellId] = 1;
-      if ((cellType = mesh->GetCellType(cellId)) == VTK_TRIANGLE)
+      if ((cellType = mesh->GetCellType(cellId)) == VTK_TRIANGLE && this->OptimizeVertexCache)
+      {
+        mesh->GetCellPoints(cellId, numTriPts, triPts);
+        cacheCellIds.push_back(cellId);
+        cacheTriPts.insert(cacheTriPts.end(), triPts, triPts + 3);
+      }
+
+      else if (cellType == VTK_TRIANGLE)
       {
         //  Got a starting point for the strip.  Initialize.  Find a neighbor
         //  to extend strip.
@@ -448,6 +746,75 @@ int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
     } // if not visited
   }   // for all elements
 
+  // Strip the polygons on independent patches, in parallel, then append the
+  // strips and polygons of the patches in order.
+  if (!abort && stripPatches && numCells > inNumLines)
+  {
+    const vtkIdType numPatches = (numCells - inNumLines + StripPatchSize - 1) / StripPatchSize;
+    std::vector<StripPatch> patches(numPatches);
+    BuildStripsOnPatches builder(
+      mesh, visited, inNumLines, numCells, this->MaximumLength, &patches);
+    vtkSMPTools::For(0, numPatches, 1, builder);
+
+    for (const StripPatch& patch : patches)
+    {
+      for (std::size_t k = 0; k < patch.Strips.size(); k += patch.Strips[k] + 1)
+      {
+        newStrips->InsertNextCell(patch.Strips[k], patch.Strips.data() + k + 1);
+      }
+      for (std::size_t k = 0; k < patch.Polys.size(); k += patch.Polys[k] + 1)
+      {
+        newPolys->InsertNextCell(patch.Polys[k], patch.Polys.data() + k + 1);
+      }
+      for (vtkIdType stripCellId : patch.StripCellIds)
+      {
+        if (this->PassCellDataAsFieldData)
+        {
+          newfdStrips->InsertNextTuple(stripCellId, cd);
+        }
+        if (this->PassThroughCellIds)
+        {
+          origStripIds->InsertNextValue(stripCellId);
+        }
+      }
+      for (vtkIdType polyCellId : patch.PolyCellIds)
+      {
+        if (this->PassCellDataAsFieldData)
+        {
+          newfdPolys->InsertNextTuple(polyCellId, cd);
+        }
+        if (this->PassThroughCellIds)
+        {
+          origPolyIds->InsertNextValue(polyCellId);
+        }
+      }
+      numStrips += patch.NumberOfStrips;
+      longestStrip = std::max(longestStrip, patch.LongestStrip);
+    }
+  }
+
+  // Output the triangles in the order optimizing the vertex cache, after the
+  // other polygons.
+  if (!abort && !cacheCellIds.empty())
+  {
+    const std::vector<vtkIdType> order =
+      OrderForVertexCache(cacheTriPts, input->GetNumberOfPoints(), this->VertexCacheSize);
+    for (vtkIdType triId : order)
+    {
+      newPolys->InsertNextCell(3, cacheTriPts.data() + 3 * triId);
+      if (this->PassCellDataAsFieldData)
+      {
+        newfdPolys->InsertNextTuple(cacheCellIds[triId], cd);
+      }
+      if (this->PassThroughCellIds)
+      {
+        origPolyIds->InsertNextValue(cacheCellIds[triId]);
+      }
+    }
+    vtkDebugMacro(<< "Ordered " << order.size() << " triangles for a vertex cache of size "
+                  << this->VertexCacheSize);
+  }
+
   // Update output and release memory
   //
   delete[] pts;
@@ -734,5 +1101,8 @@ void vtkStripper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PassThroughCellIds: " << this->PassThroughCellIds << endl;
   os << indent << "PassThroughPointIds: " << this->PassThroughPointIds << endl;
   os << indent << "JoinContiguousSegments: " << this->JoinContiguousSegments << endl;
+  os << indent << "ParallelStripping: " << this->ParallelStripping << endl;
+  os << indent << "OptimizeVertexCache: " << this->OptimizeVertexCache << endl;
+  os << indent << "VertexCacheSize: " << this->VertexCacheSize << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -117,6 +117,43 @@ public:
   vtkBooleanMacro(JoinContiguousSegments, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * If on, the triangle strips are built in parallel with vtkSMPTools, on
+   * independent patches of consecutive input cells: a strip does not extend
+   * beyond the patch of its first triangle. The strips are thus slightly
+   * shorter than those of the serial traversal, but the output does not
+   * depend on the number of threads. Poly-lines are still built serially.
+   * The default is off.
+   */
+  vtkSetMacro(ParallelStripping, vtkTypeBool);
+  vtkGetMacro(ParallelStripping, vtkTypeBool);
+  vtkBooleanMacro(ParallelStripping, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * If on, the input triangles are not assembled into strips. They are
+   * output as triangles (after the other polygons), reordered so that
+   * consecutive triangles reuse the same points, for consumers bound by a
+   * vertex cache of VertexCacheSize entries (Tipsify algorithm). The field
+   * data and original cell ids, when requested, follow the new order. This
+   * takes precedence over ParallelStripping. The default is off.
+   */
+  vtkSetMacro(OptimizeVertexCache, vtkTypeBool);
+  vtkGetMacro(OptimizeVertexCache, vtkTypeBool);
+  vtkBooleanMacro(OptimizeVertexCache, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * Specify the number of entries of the vertex cache targeted by
+   * OptimizeVertexCache. The default is 16.
+   */
+  vtkSetClampMacro(VertexCacheSize, int, 3, 1024);
+  vtkGetMacro(VertexCacheSize, int);
+  ///@}
+
 protected:
   vtkStripper();
   ~vtkStripper() override = default;
@@ -129,6 +166,9 @@ protected:
   vtkTypeBool PassThroughCellIds;
   vtkTypeBool PassThroughPointIds;
   vtkTypeBool JoinContiguousSegments;
+  vtkTypeBool ParallelStripping;
+  vtkTypeBool OptimizeVertexCache;
+  int VertexCacheSize;
 
 private:
   vtkStripper(const vtkStripper&) = delete;
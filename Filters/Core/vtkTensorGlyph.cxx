@@ -2,20 +2,25 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkTensorGlyph.h"
 
-#include "vtkCell.h"
-#include "vtkCellArray.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
+#include "vtkGlyphInternal.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 
+#include <cmath>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTensorGlyph);
 
@@ -77,188 +82,77 @@ int vtkTensorGlyph::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+namespace
+{
 //------------------------------------------------------------------------------
-int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
-  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+// Compute the glyph of each input point: one copy of the source per
+// eigenvector with ThreeGlyphs on, twice as many with Symmetric on. The
+// copies are the directions of the glyph, their points follow each other
+// and their cells are interleaved, as in the serial implementation.
+struct TensorGlyphWorker
 {
-  // get the info objects
-  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
-  vtkInformation* sourceInfo = inputVector[1]->GetInformationObject(0);
-  vtkInformation* outInfo = outputVector->GetInformationObject(0);
-
-  // get the input and output
-  vtkDataSet* input = vtkDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
-  vtkPolyData* source = vtkPolyData::SafeDownCast(sourceInfo->Get(vtkDataObject::DATA_OBJECT()));
-  vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
-
-  vtkDataArray* inTensors;
-  double tensor[9];
-  vtkDataArray* inScalars;
-  vtkIdType numPts, numSourcePts, numSourceCells, inPtId, i;
-  int j;
-  vtkPoints* sourcePts;
-  vtkDataArray* sourceNormals;
-  vtkCellArray *sourceCells, *cells;
-  vtkPoints* newPts;
-  vtkFloatArray* newScalars = nullptr;
-  vtkFloatArray* newNormals = nullptr;
-  double x[3], s;
-  vtkTransform* trans;
-  vtkCell* cell;
-  vtkIdList* cellPts;
-  int npts;
-  vtkIdType* pts;
-  vtkIdType ptIncr, cellId;
-  vtkIdType subIncr;
-  int numDirs, dir, eigen_dir, symmetric_dir;
-  vtkMatrix4x4* matrix;
-  double *m[3], w[3], *v[3];
-  double m0[3], m1[3], m2[3];
-  double v0[3], v1[3], v2[3];
-  double xv[3], yv[3], zv[3];
-  double maxScale;
-
-  numDirs = (this->ThreeGlyphs ? 3 : 1) * (this->Symmetric + 1);
-
-  // set up working matrices
-  m[0] = m0;
-  m[1] = m1;
-  m[2] = m2;
-  v[0] = v0;
-  v[1] = v1;
-  v[2] = v2;
-
-  vtkDebugMacro(<< "Generating tensor glyphs");
-
-  vtkPointData* outPD = output->GetPointData();
-  inTensors = this->GetInputArrayToProcess(0, inputVector);
-  inScalars = this->GetInputArrayToProcess(1, inputVector);
-  numPts = input->GetNumberOfPoints();
-
-  if (!inTensors || numPts < 1)
+  vtkDataSet* Input;
+  vtkDataArray* Tensors;
+  vtkDataArray* Scalars;
+  int NumberOfDirections;
+  bool ExtractEigenvalues;
+  bool ThreeGlyphs;
+  bool ClampScaling;
+  bool ColorByScalars;
+  bool ColorByEigenvalues;
+  double ScaleFactor;
+  double MaxScaleFactor;
+  double Length;
+
+  GlyphGenerator* Generator = nullptr;
+  const GlyphSource* Source = nullptr;
+  vtkFloatArray* NewScalars = nullptr;
+  ArrayList PointArrays;
+  vtkSMPThreadLocalObject<vtkTransform> Transform;
+
+  TensorGlyphWorker(vtkTensorGlyph* self, vtkDataSet* input, vtkDataArray* tensors,
+    vtkDataArray* scalars, int numDirs)
+    : Input(input)
+    , Tensors(tensors)
+    , Scalars(scalars)
+    , NumberOfDirections(numDirs)
+    , ExtractEigenvalues(self->GetExtractEigenvalues() != 0)
+    , ThreeGlyphs(self->GetThreeGlyphs() != 0)
+    , ClampScaling(self->GetClampScaling() != 0)
+    , ColorByScalars(self->GetColorGlyphs() && scalars &&
+        self->GetColorMode() == vtkTensorGlyph::COLOR_BY_SCALARS)
+    , ColorByEigenvalues(
+        self->GetColorGlyphs() && self->GetColorMode() == vtkTensorGlyph::COLOR_BY_EIGENVALUES)
+    , ScaleFactor(self->GetScaleFactor())
+    , MaxScaleFactor(self->GetMaxScaleFactor())
+    , Length(self->GetLength())
   {
-    vtkErrorMacro(<< "No data to glyph!");
-    return 1;
   }
 
-  pts = new vtkIdType[source->GetMaxCellSize()];
-  trans = vtkTransform::New();
-  matrix = vtkMatrix4x4::New();
-
-  //
-  // Allocate storage for output PolyData
-  //
-  sourcePts = source->GetPoints();
-  numSourcePts = sourcePts->GetNumberOfPoints();
-  numSourceCells = source->GetNumberOfCells();
-
-  newPts = vtkPoints::New();
-  newPts->Allocate(numDirs * numPts * numSourcePts);
-
-  // Setting up for calls to PolyData::InsertNextCell()
-  if ((sourceCells = source->GetVerts())->GetNumberOfCells() > 0)
-  {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetVerts(cells);
-    cells->Delete();
-  }
-  if ((sourceCells = this->GetSource()->GetLines())->GetNumberOfCells() > 0)
-  {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetLines(cells);
-    cells->Delete();
-  }
-  if ((sourceCells = this->GetSource()->GetPolys())->GetNumberOfCells() > 0)
+  // Compute orientation vectors and scale factors from the tensor of the
+  // point.
+  void ComputeEigenvectors(
+    vtkIdType inPtId, double xv[3], double yv[3], double zv[3], double w[3]) const
   {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetPolys(cells);
-    cells->Delete();
-  }
-  if ((sourceCells = this->GetSource()->GetStrips())->GetNumberOfCells() > 0)
-  {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetStrips(cells);
-    cells->Delete();
-  }
-
-  // only copy scalar data through
-  vtkPointData* pd = this->GetSource()->GetPointData();
-  // generate scalars if eigenvalues are chosen or if scalars exist.
-  if (this->ColorGlyphs &&
-    ((this->ColorMode == COLOR_BY_EIGENVALUES) ||
-      (inScalars && (this->ColorMode == COLOR_BY_SCALARS))))
-  {
-    newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numDirs * numPts * numSourcePts);
-    if (this->ColorMode == COLOR_BY_EIGENVALUES)
-    {
-      newScalars->SetName("MaxEigenvalue");
-    }
-    else
-    {
-      newScalars->SetName(inScalars->GetName());
-    }
-  }
-  else
-  {
-    outPD->CopyAllOff();
-    outPD->CopyScalarsOn();
-    outPD->CopyAllocate(pd, numDirs * numPts * numSourcePts);
-  }
-  if ((sourceNormals = pd->GetNormals()))
-  {
-    newNormals = vtkFloatArray::New();
-    newNormals->SetNumberOfComponents(3);
-    newNormals->SetName("Normals");
-    newNormals->Allocate(numDirs * 3 * numPts * numSourcePts);
-  }
-  //
-  // First copy all topology (transformation independent)
-  //
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    ptIncr = numDirs * inPtId * numSourcePts;
-    for (cellId = 0; cellId < numSourceCells; cellId++)
-    {
-      cell = this->GetSource()->GetCell(cellId);
-      cellPts = cell->GetPointIds();
-      npts = cellPts->GetNumberOfIds();
-      for (dir = 0; dir < numDirs; dir++)
-      {
-        // This variable may be removed, but that
-        // will not improve readability
-        subIncr = ptIncr + dir * numSourcePts;
-        for (i = 0; i < npts; i++)
-        {
-          pts[i] = cellPts->GetId(i) + subIncr;
-        }
-        output->InsertNextCell(cell->GetCellType(), npts, pts);
-      }
-    }
-  }
-  //
-  // Traverse all Input points, transforming glyph at Source points
-  //
-  trans->PreMultiply();
-
-  int checkAbortInterval = std::min(numPts / 10 + 1, (vtkIdType)1000);
-
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    if (inPtId % checkAbortInterval == 0 && this->CheckAbort())
-    {
-      break;
-    }
-    ptIncr = numDirs * inPtId * numSourcePts;
+    double tensor[9];
+    double *m[3], *v[3];
+    double m0[3], m1[3], m2[3];
+    double v0[3], v1[3], v2[3];
+    double maxScale;
+    int i, j;
+
+    // set up working matrices
+    m[0] = m0;
+    m[1] = m1;
+    m[2] = m2;
+    v[0] = v0;
+    v[1] = v1;
+    v[2] = v2;
 
     // Translation is postponed
     // Symmetric tensor support
-    inTensors->GetTuple(inPtId, tensor);
-    if (inTensors->GetNumberOfComponents() == 6)
+    this->Tensors->GetTuple(inPtId, tensor);
+    if (this->Tensors->GetNumberOfComponents() == 6)
     {
       vtkMath::TensorFromSymmetricTensor(tensor);
     }
@@ -346,121 +240,219 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
         w[i] = maxScale * 1.0e-06;
       }
     }
+  }
+
+  void operator()(const GlyphPlacement& glyph)
+  {
+    const vtkIdType inPtId = glyph.GlyphId;
+    double xv[3], yv[3], zv[3], w[3];
+    this->ComputeEigenvectors(inPtId, xv, yv, zv, w);
+    double x[3];
+    this->Input->GetPoint(inPtId, x);
+
+    // Each direction transforms its own copy of the source points.
+    GlyphPlacement copy = glyph;
+    copy.Source = this->Source;
+    copy.NumberOfPoints = this->Source->NumberOfPoints;
+    for (int dir = 0; dir < this->NumberOfDirections; dir++)
+    {
+      copy.FirstPoint = glyph.FirstPoint + dir * copy.NumberOfPoints;
+      this->GenerateDirection(copy, inPtId, dir, x, xv, yv, zv, w);
+    }
+  }
+
+  void GenerateDirection(const GlyphPlacement& glyph, vtkIdType inPtId, int dir, const double x[3],
+    const double xv[3], const double yv[3], const double zv[3], const double w[3])
+  {
+    const vtkIdType ptIncr = glyph.FirstPoint;
+    const int eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
+    const int symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
 
-    // Now do the real work for each "direction"
+    // Remove previous scales ...
+    vtkTransform* trans = this->Transform.Local();
+    trans->Identity();
 
-    for (dir = 0; dir < numDirs; dir++)
+    // translate Source to Input point
+    trans->Translate(x[0], x[1], x[2]);
+
+    // normalized eigenvectors rotate object for eigen direction 0
+    const double matrix[16] = { xv[0], yv[0], zv[0], 0.0, xv[1], yv[1], zv[1], 0.0, xv[2], yv[2],
+      zv[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
+    trans->Concatenate(matrix);
+
+    if (eigen_dir == 1)
     {
-      eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
-      symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
-
-      // Remove previous scales ...
-      trans->Identity();
-
-      // translate Source to Input point
-      input->GetPoint(inPtId, x);
-      trans->Translate(x[0], x[1], x[2]);
-
-      // normalized eigenvectors rotate object for eigen direction 0
-      matrix->Element[0][0] = xv[0];
-      matrix->Element[0][1] = yv[0];
-      matrix->Element[0][2] = zv[0];
-      matrix->Element[1][0] = xv[1];
-      matrix->Element[1][1] = yv[1];
-      matrix->Element[1][2] = zv[1];
-      matrix->Element[2][0] = xv[2];
-      matrix->Element[2][1] = yv[2];
-      matrix->Element[2][2] = zv[2];
-      trans->Concatenate(matrix);
-
-      if (eigen_dir == 1)
-      {
-        trans->RotateZ(90.0);
-      }
+      trans->RotateZ(90.0);
+    }
 
-      if (eigen_dir == 2)
-      {
-        trans->RotateY(-90.0);
-      }
+    if (eigen_dir == 2)
+    {
+      trans->RotateY(-90.0);
+    }
 
-      if (this->ThreeGlyphs)
-      {
-        trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
-      }
-      else
-      {
-        trans->Scale(w[0], w[1], w[2]);
-      }
+    if (this->ThreeGlyphs)
+    {
+      trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+    }
+    else
+    {
+      trans->Scale(w[0], w[1], w[2]);
+    }
 
-      // Mirror second set to the symmetric position
-      if (symmetric_dir == 1)
-      {
-        trans->Scale(-1., 1., 1.);
-      }
+    // Mirror second set to the symmetric position
+    if (symmetric_dir == 1)
+    {
+      trans->Scale(-1., 1., 1.);
+    }
 
-      // if the eigenvalue is negative, shift to reverse direction.
-      // The && is there to ensure that we do not change the
-      // old behaviour of vtkTensorGlyphs (which only used one dir),
-      // in case there is an oriented glyph, e.g. an arrow.
-      if (w[eigen_dir] < 0 && numDirs > 1)
-      {
-        trans->Translate(-this->Length, 0., 0.);
-      }
+    // if the eigenvalue is negative, shift to reverse direction.
+    // The && is there to ensure that we do not change the
+    // old behaviour of vtkTensorGlyphs (which only used one dir),
+    // in case there is an oriented glyph, e.g. an arrow.
+    if (w[eigen_dir] < 0 && this->NumberOfDirections > 1)
+    {
+      trans->Translate(-this->Length, 0., 0.);
+    }
 
-      // multiply points (and normals if available) by resulting
-      // matrix
-      trans->TransformPoints(sourcePts, newPts);
+    // multiply points (and normals if available) by resulting
+    // matrix
+    this->Generator->TransformPoints(glyph, trans->GetMatrix(), x);
 
-      // Apply the transformation to a series of points,
-      // and append the results to outPts.
-      if (newNormals)
+    // a negative determinant means the transform turns the
+    // glyph surface inside out, and its surface normals all
+    // point inward. The following scale corrects the surface
+    // normals to point outward.
+    if (!glyph.Source->Normals.empty())
+    {
+      if (trans->GetMatrix()->Determinant() < 0)
       {
-        // a negative determinant means the transform turns the
-        // glyph surface inside out, and its surface normals all
-        // point inward. The following scale corrects the surface
-        // normals to point outward.
-        if (trans->GetMatrix()->Determinant() < 0)
-        {
-          trans->Scale(-1.0, -1.0, -1.0);
-        }
-        trans->TransformNormals(sourceNormals, newNormals);
+        trans->Scale(-1.0, -1.0, -1.0);
       }
+      this->Generator->TransformNormals(glyph, trans->GetMatrix());
+    }
 
-      // Copy point data from source
-      if (this->ColorGlyphs && inScalars && (this->ColorMode == COLOR_BY_SCALARS))
+    // Copy point data from source
+    if (this->ColorByScalars || this->ColorByEigenvalues)
+    {
+      // If ThreeGlyphs is false we use the first (largest)
+      // eigenvalue as scalar.
+      const float s = static_cast<float>(
+        this->ColorByScalars ? this->Scalars->GetComponent(inPtId, 0) : w[eigen_dir]);
+      for (vtkIdType i = 0; i < glyph.NumberOfPoints; i++)
       {
-        s = inScalars->GetComponent(inPtId, 0);
-        for (i = 0; i < numSourcePts; i++)
-        {
-          newScalars->InsertTuple(ptIncr + i, &s);
-        }
+        this->NewScalars->SetValue(ptIncr + i, s);
       }
-      else if (this->ColorGlyphs && (this->ColorMode == COLOR_BY_EIGENVALUES))
-      {
-        // If ThreeGlyphs is false we use the first (largest)
-        // eigenvalue as scalar.
-        s = w[eigen_dir];
-        for (i = 0; i < numSourcePts; i++)
-        {
-          newScalars->InsertTuple(ptIncr + i, &s);
-        }
-      }
-      else
+    }
+    else
+    {
+      for (vtkIdType i = 0; i < glyph.NumberOfPoints; i++)
       {
-        for (i = 0; i < numSourcePts; i++)
-        {
-          outPD->CopyData(pd, i, ptIncr + i);
-        }
+        this->PointArrays.Copy(i, ptIncr + i);
       }
-      ptIncr += numSourcePts;
     }
   }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // get the info objects
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* sourceInfo = inputVector[1]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  // get the input and output
+  vtkDataSet* input = vtkDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkPolyData* source = vtkPolyData::SafeDownCast(sourceInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  vtkDataArray* inTensors;
+  vtkDataArray* inScalars;
+  vtkIdType numPts;
+  vtkPoints* newPts;
+  vtkFloatArray* newScalars = nullptr;
+  vtkFloatArray* newNormals = nullptr;
+  int numDirs;
+
+  numDirs = (this->ThreeGlyphs ? 3 : 1) * (this->Symmetric + 1);
+
+  vtkDebugMacro(<< "Generating tensor glyphs");
+
+  vtkPointData* outPD = output->GetPointData();
+  inTensors = this->GetInputArrayToProcess(0, inputVector);
+  inScalars = this->GetInputArrayToProcess(1, inputVector);
+  numPts = input->GetNumberOfPoints();
+
+  if (!inTensors || numPts < 1)
+  {
+    vtkErrorMacro(<< "No data to glyph!");
+    return 1;
+  }
+
+  //
+  // Allocate storage for output PolyData. The glyph of each input point is
+  // made of numDirs copies of the source.
+  //
+  GlyphSource directionSource;
+  directionSource.Initialize(source);
+  std::vector<GlyphSource> sources(1);
+  sources[0].Replicate(directionSource, numDirs);
+  GlyphGenerator generator(this, sources, numPts, std::vector<int>(), false);
+  const vtkIdType numOutPts = generator.GetNumberOfPoints();
+  TensorGlyphWorker worker(this, input, inTensors, inScalars, numDirs);
+
+  newPts = vtkPoints::New();
+  newPts->SetNumberOfPoints(numOutPts);
+
+  // only copy scalar data through
+  vtkPointData* pd = source->GetPointData();
+  // generate scalars if eigenvalues are chosen or if scalars exist.
+  if (worker.ColorByScalars || worker.ColorByEigenvalues)
+  {
+    newScalars = vtkFloatArray::New();
+    newScalars->SetNumberOfTuples(numOutPts);
+    if (this->ColorMode == COLOR_BY_EIGENVALUES)
+    {
+      newScalars->SetName("MaxEigenvalue");
+    }
+    else
+    {
+      newScalars->SetName(inScalars->GetName());
+    }
+  }
+  else
+  {
+    outPD->CopyAllOff();
+    outPD->CopyScalarsOn();
+    outPD->CopyAllocate(pd, numOutPts);
+    worker.PointArrays.AddArrays(numOutPts, pd, outPD, 0.0, false);
+  }
+  if (pd->GetNormals())
+  {
+    newNormals = vtkFloatArray::New();
+    newNormals->SetNumberOfComponents(3);
+    newNormals->SetName("Normals");
+    newNormals->SetNumberOfTuples(numOutPts);
+  }
+
+  // Make the following GetPoint() calls thread safe
+  double x[3];
+  input->GetPoint(0, x);
+
+  //
+  // Traverse all Input points, transforming glyph at Source points
+  //
+  generator.SetOutputArrays(newPts, newNormals);
+  worker.Generator = &generator;
+  worker.Source = &directionSource;
+  worker.NewScalars = newScalars;
+  const bool completed = generator.Generate(output, worker);
   vtkDebugMacro(<< "Generated " << numPts << " tensor glyphs");
   //
   // Update output and release memory
   //
-  delete[] pts;
-
   output->SetPoints(newPts);
   newPts->Delete();
 
@@ -477,9 +469,12 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
     newNormals->Delete();
   }
 
+  if (!completed)
+  {
+    // Do not output partially generated glyphs.
+    output->Initialize();
+  }
   output->Squeeze();
-  trans->Delete();
-  matrix->Delete();
 
   return 1;
 }
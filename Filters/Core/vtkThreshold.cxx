@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
@@ -219,14 +220,40 @@ struct vtkThreshold::EvaluateCellsFunctor
 
   void Reduce()
   {
-    this->KeptCellsList->Allocate(this->NumberOfCells);
-    for (vtkIdType cellId = 0; cellId < this->NumberOfCells; ++cellId)
-    {
-      if (this->InsidenessArray->GetValue(cellId))
+    // Compact the kept cells by blocks: the kept cells of each block are
+    // counted, and an in-place scan of the counts gives the position of the
+    // first kept cell of each block in the output list.
+    const vtkIdType numCells = this->NumberOfCells;
+    const unsigned char* insideness = this->InsidenessArray->GetPointer(0);
+    const vtkIdType blockSize = 4096;
+    const vtkIdType numBlocks = (numCells + blockSize - 1) / blockSize;
+    std::vector<vtkIdType> blockOffsets(numBlocks + 1, 0);
+    vtkSMPTools::For(0, numBlocks, [&](vtkIdType block, vtkIdType endBlock) {
+      for (; block < endBlock; ++block)
       {
-        this->KeptCellsList->InsertNextId(cellId);
+        const unsigned char* first = insideness + block * blockSize;
+        const unsigned char* last = insideness + std::min((block + 1) * blockSize, numCells);
+        blockOffsets[block + 1] = std::count_if(first, last, [](unsigned char v) { return v; });
       }
-    }
+    });
+    vtkSMPTools::InclusiveScan(blockOffsets.begin(), blockOffsets.end(), blockOffsets.begin());
+
+    this->KeptCellsList->SetNumberOfIds(blockOffsets[numBlocks]);
+    vtkIdType* keptCellIds = this->KeptCellsList->GetPointer(0);
+    vtkSMPTools::For(0, numBlocks, [&](vtkIdType block, vtkIdType endBlock) {
+      for (; block < endBlock; ++block)
+      {
+        vtkIdType* keptCellId = keptCellIds + blockOffsets[block];
+        const vtkIdType endCellId = std::min((block + 1) * blockSize, numCells);
+        for (vtkIdType cellId = block * blockSize; cellId < endCellId; ++cellId)
+        {
+          if (insideness[cellId])
+          {
+            *keptCellId++ = cellId;
+          }
+        }
+      }
+    });
   }
 };
 
@@ -2,20 +2,113 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkTriangleFilter.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCellArray.h"
 #include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangleStrip.h"
 
+#include <algorithm>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTriangleFilter);
 
+namespace
+{
+//-------------------------------------------------------------------------
+// Triangulate the polygons in parallel. Each polygon is triangulated once,
+// into a slot sized for its largest possible number of triangles (npts - 2);
+// the number of triangles actually produced is recorded so that the
+// triangles can then be compacted in the order of the polygons.
+struct TriangulatePolygons
+{
+  vtkCellArray* Polys;
+  vtkPoints* Points;
+  double Tolerance;
+  const vtkIdType* SlotOffsets;
+  vtkIdType* Slots;
+  vtkIdType* NumTriangles;
+
+  vtkSMPThreadLocal<vtkSmartPointer<vtkCellArrayIterator>> Iterator;
+  vtkSMPThreadLocalObject<vtkPolygon> Polygon;
+  vtkSMPThreadLocalObject<vtkIdList> LocalIds;
+
+  TriangulatePolygons(vtkCellArray* polys, vtkPoints* points, double tolerance,
+    const vtkIdType* slotOffsets, vtkIdType* slots, vtkIdType* numTriangles)
+    : Polys(polys)
+    , Points(points)
+    , Tolerance(tolerance)
+    , SlotOffsets(slotOffsets)
+    , Slots(slots)
+    , NumTriangles(numTriangles)
+  {
+  }
+
+  void Initialize()
+  {
+    this->Iterator.Local() = vtk::TakeSmartPointer(this->Polys->NewIterator());
+    // It may be necessary to specify a custom tessellation tolerance.
+    if (this->Tolerance > 0.0)
+    {
+      this->Polygon.Local()->SetTolerance(this->Tolerance);
+    }
+  }
+
+  void operator()(vtkIdType polyId, vtkIdType endPolyId)
+  {
+    vtkCellArrayIterator* iter = this->Iterator.Local();
+    vtkPolygon* poly = this->Polygon.Local();
+    vtkIdList* localIds = this->LocalIds.Local();
+    const vtkIdType* pts;
+    vtkIdType npts;
+    double x[3];
+    for (; polyId < endPolyId; ++polyId)
+    {
+      iter->GetCellAtId(polyId, npts, pts);
+      vtkIdType* slot = this->Slots + this->SlotOffsets[polyId];
+      if (npts == 3)
+      {
+        std::copy(pts, pts + 3, slot);
+        this->NumTriangles[polyId] = 1;
+        continue;
+      }
+
+      poly->PointIds->SetNumberOfIds(npts);
+      poly->Points->SetNumberOfPoints(npts);
+      for (vtkIdType i = 0; i < npts; i++)
+      {
+        poly->PointIds->SetId(i, pts[i]);
+        this->Points->GetPoint(pts[i], x);
+        poly->Points->SetPoint(i, x);
+      }
+      poly->TriangulateLocalIds(0, localIds);
+      const vtkIdType maxTriangles =
+        (this->SlotOffsets[polyId + 1] - this->SlotOffsets[polyId]) / 3;
+      const vtkIdType numTriangles = std::min(localIds->GetNumberOfIds() / 3, maxTriangles);
+      for (vtkIdType i = 0; i < 3 * numTriangles; i++)
+      {
+        slot[i] = pts[localIds->GetId(i)];
+      }
+      this->NumTriangles[polyId] = numTriangles;
+    }
+  }
+
+  void Reduce() {}
+};
+}
+
 //-------------------------------------------------------------------------
 int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -212,59 +305,58 @@ int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
     }
     else
     {
+      // Count-then-fill triangulation, threaded with vtkSMPTools. The output
+      // is the same as that of a serial traversal.
       outCellId = output->GetNumberOfCells();
-      newPolys->AllocateCopy(inPolys);
+      const vtkIdType firstPolyId = inCellId;
 
-      vtkNew<vtkIdList> ptIds;
-      ptIds->Allocate(VTK_CELL_SIZE);
-      vtkIdType triPts[3];
-      // It may be necessary to specify a custom tessellation
-      // tolerance.
-      vtkNew<vtkPolygon> poly;
-      if (this->Tolerance > 0.0)
-      {
-        poly->SetTolerance(this->Tolerance); // Tighten tessellation tolerance
-      }
-
-      auto iter = vtk::TakeSmartPointer(inPolys->NewIterator());
-      for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal() && !abort;
-           iter->GoToNextCell(), ++inCellId)
-      {
-        if (!(inCellId % updateInterval)) // manage progress reports / early abort
+      std::vector<vtkIdType> slotOffsets(numInPolys + 1, 0);
+      vtkSMPTools::For(0, numInPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+        for (; polyId < endPolyId; ++polyId)
         {
-          this->UpdateProgress((float)inCellId / numInCells);
-          abort = this->CheckAbort();
+          slotOffsets[polyId] = 3 * std::max<vtkIdType>(inPolys->GetCellSize(polyId) - 2, 0);
         }
-        iter->GetCurrentCell(npts, pts);
-        if (npts == 3)
-        {
-          newPolys->InsertNextCell(3, pts);
-          outCD->CopyData(inCD, inCellId, outCellId++);
-        }
-        else // triangulate polygon
+      });
+      vtkSMPTools::ExclusiveScan(
+        slotOffsets.begin(), slotOffsets.end(), slotOffsets.begin(), vtkIdType(0));
+
+      std::vector<vtkIdType> slots(slotOffsets.back());
+      std::vector<vtkIdType> triOffsets(numInPolys + 1, 0);
+      TriangulatePolygons triangulator(
+        inPolys, inPts, this->Tolerance, slotOffsets.data(), slots.data(), triOffsets.data());
+      vtkSMPTools::For(0, numInPolys, triangulator);
+      vtkSMPTools::ExclusiveScan(
+        triOffsets.begin(), triOffsets.end(), triOffsets.begin(), vtkIdType(0));
+      const vtkIdType numTriangles = triOffsets.back();
+
+      // Compact the triangles and copy their cell data.
+      vtkNew<vtkIdTypeArray> offsets;
+      offsets->SetNumberOfValues(numTriangles + 1);
+      vtkNew<vtkIdTypeArray> connectivity;
+      connectivity->SetNumberOfValues(3 * numTriangles);
+      vtkIdType* offsetsPtr = offsets->GetPointer(0);
+      vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+      ArrayList arrays;
+      arrays.AddArrays(outCellId + numTriangles, inCD, outCD, 0.0, false);
+      vtkSMPTools::For(0, numInPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+        for (; polyId < endPolyId; ++polyId)
         {
-          // initialize polygon
-          poly->PointIds->SetNumberOfIds(npts);
-          poly->Points->SetNumberOfPoints(npts);
-          for (vtkIdType i = 0; i < npts; i++)
+          const vtkIdType* slot = slots.data() + slotOffsets[polyId];
+          for (vtkIdType triId = triOffsets[polyId]; triId < triOffsets[polyId + 1]; ++triId)
           {
-            poly->PointIds->SetId(i, pts[i]);
-            poly->Points->SetPoint(i, inPts->GetPoint(pts[i]));
+            std::copy(slot, slot + 3, connectivityPtr + 3 * triId);
+            slot += 3;
+            offsetsPtr[triId] = 3 * triId;
+            arrays.Copy(firstPolyId + polyId, outCellId + triId);
           }
-          poly->TriangulateLocalIds(0, ptIds);
-          const int numSimplices = ptIds->GetNumberOfIds() / 3;
-          for (vtkIdType i = 0; i < numSimplices; i++)
-          {
-            for (vtkIdType j = 0; j < 3; j++)
-            {
-              triPts[j] = poly->PointIds->GetId(ptIds->GetId(3 * i + j));
-            }
-            newPolys->InsertNextCell(3, triPts);
-            outCD->CopyData(inCD, inCellId, outCellId++);
-          } // for each simplex
-        }   // triangulate polygon
-      }
+        }
+      });
+      offsetsPtr[numTriangles] = 3 * numTriangles;
+      newPolys->SetData(offsets, connectivity);
+      inCellId += numInPolys;
       output->SetPolys(newPolys);
+      this->UpdateProgress(static_cast<double>(inCellId) / numInCells);
+      abort = this->CheckAbort();
     }
   }
 
@@ -25,6 +25,7 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataToUnstructuredGrid.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalArena.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
@@ -34,7 +35,9 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cstring>
+#include <new>
 #include <unordered_set>
 #include <vector>
 
@@ -534,6 +537,77 @@ using TableBasedCellBatches = vtkBatches<TableBasedCellBatchData>;
 template <typename TInputIdType>
 using EdgeType = EdgeTuple<TInputIdType, double>;
 
+//-----------------------------------------------------------------------------
+// Thread local list of edges. Edges are appended to fixed size segments carved
+// from an arena, so that the list never reallocates and copies its content
+// while growing, and all its memory is released at once.
+template <typename TInputIdType>
+class EdgeListType
+{
+public:
+  using TEdge = EdgeType<TInputIdType>;
+
+  // Number of edges per segment, and number of segments per arena block.
+  static constexpr vtkIdType SegmentSize = 2048;
+  static constexpr std::size_t SegmentsPerBlock = 16;
+
+  EdgeListType()
+    : Memory(SegmentsPerBlock * SegmentSize * sizeof(TEdge))
+  {
+  }
+
+  // vtkSMPThreadLocal creates the thread local lists by copying an empty
+  // exemplar, the edges are never copied.
+  EdgeListType(const EdgeListType& other)
+    : Memory(other.Memory)
+  {
+  }
+
+  EdgeListType& operator=(const EdgeListType& other)
+  {
+    if (this != &other)
+    {
+      this->Memory = other.Memory;
+      this->Segments.clear();
+      this->NumberOfEdges = 0;
+    }
+    return *this;
+  }
+
+  void EmplaceBack(TInputIdType v0, TInputIdType v1, double data)
+  {
+    if (this->Segments.empty() || this->Segments.back().Size == SegmentSize)
+    {
+      this->Segments.push_back(Segment{ this->Memory.Allocate<TEdge>(SegmentSize), 0 });
+    }
+    Segment& segment = this->Segments.back();
+    new (segment.Edges + segment.Size++) TEdge(v0, v1, data);
+    ++this->NumberOfEdges;
+  }
+
+  vtkIdType GetNumberOfEdges() const { return this->NumberOfEdges; }
+
+  template <typename OutputIt>
+  void CopyTo(OutputIt output) const
+  {
+    for (const Segment& segment : this->Segments)
+    {
+      output = std::copy(segment.Edges, segment.Edges + segment.Size, output);
+    }
+  }
+
+private:
+  struct Segment
+  {
+    TEdge* Edges;
+    vtkIdType Size;
+  };
+
+  vtkSMPThreadLocalArena::Arena Memory;
+  std::vector<Segment> Segments;
+  vtkIdType NumberOfEdges = 0;
+};
+
 //-----------------------------------------------------------------------------
 // Edge Locator to store and search edges
 template <typename TInputIdType>
@@ -555,7 +629,7 @@ struct EvaluateCells
   vtkTableBasedClipDataSet* Filter;
 
   vtkSMPThreadLocalObject<vtkIdList> TLIdList;
-  vtkSMPThreadLocal<std::vector<TEdge>> TLEdges;
+  vtkSMPThreadLocal<EdgeListType<TInputIdType>> TLEdges;
   vtkSMPThreadLocal<std::unordered_set<int>> TLUnsupportedCellTypes;
 
   TableBasedCellBatches CellBatches;
@@ -593,8 +667,6 @@ struct EvaluateCells
   {
     // initialize list size
     this->TLIdList.Local()->Allocate(MAX_CELL_SIZE);
-    // initialize edges
-    this->TLEdges.Local().reserve(static_cast<size_t>(this->Input->GetNumberOfPoints() * 0.001));
   }
 
   void operator()(vtkIdType beginBatchId, vtkIdType endBatchId)
@@ -706,7 +778,7 @@ struct EvaluateCells
                 point1Weight = 1.0 - point1Weight;
               }
 
-              edges.emplace_back(pointIndex1, pointIndex2, point1Weight);
+              edges.EmplaceBack(pointIndex1, pointIndex2, point1Weight);
             }
           }
           if (shape != TBCCases::ST_PNT) // normal cell
@@ -746,14 +818,15 @@ struct EvaluateCells
     size_t totalSizeOfEdges = 0;
     for (auto& tlEdges : tlEdgesVector)
     {
-      totalSizeOfEdges += tlEdges->size();
+      totalSizeOfEdges += static_cast<size_t>(tlEdges->GetNumberOfEdges());
     }
 
     // compute begin indices
     std::vector<size_t> beginIndices(this->TLEdges.size(), 0);
     for (size_t i = 1; i < tlEdgesVector.size(); ++i)
     {
-      beginIndices[i] = beginIndices[i - 1] + tlEdgesVector[i - 1]->size();
+      beginIndices[i] =
+        beginIndices[i - 1] + static_cast<size_t>(tlEdgesVector[i - 1]->GetNumberOfEdges());
     }
 
     // merge thread local edges
@@ -762,8 +835,7 @@ struct EvaluateCells
       0, static_cast<vtkIdType>(tlEdgesVector.size()), [&](vtkIdType begin, vtkIdType end) {
         for (vtkIdType threadId = begin; threadId < end; ++threadId)
         {
-          auto& edges = *tlEdgesVector[threadId];
-          std::copy(edges.begin(), edges.end(), this->Edges.begin() + beginIndices[threadId]);
+          tlEdgesVector[threadId]->CopyTo(this->Edges.begin() + beginIndices[threadId]);
         }
       });
 
@@ -24,6 +24,7 @@
 #include "vtkPolyData.h"
 #include "vtkPyramid.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalArena.h"
 #include "vtkSMPTools.h"
 #include "vtkStaticCellLinksTemplate.h"
 #include "vtkStaticFaceHashLinksTemplate.h"
@@ -559,78 +560,39 @@ private:
   }
 
   static constexpr size_t ChunkSize = static_cast<size_t>(5000 * FaceMemoryPool::SizeOfFace(4));
-  size_t NextChunkIndex;
-  size_t NextFaceIndex;
-  std::vector<std::shared_ptr<unsigned char>> Chunks;
+  vtkSMPThreadLocalArena::Arena Memory;
 
 public:
   FaceMemoryPool()
-    : NextChunkIndex(0)
-    , NextFaceIndex(0)
+    : Memory(FaceMemoryPool::ChunkSize)
   {
   }
 
-  // Copy ctor.
+  // Copy ctor. The copy starts with its own, empty, memory.
   FaceMemoryPool(const FaceMemoryPool&) = default;
 
   // Copy assignment operator.
   FaceMemoryPool& operator=(const FaceMemoryPool&) = default;
 
+  FaceMemoryPool(FaceMemoryPool&&) = default;
+  FaceMemoryPool& operator=(FaceMemoryPool&&) = default;
+
   ~FaceMemoryPool() = default;
 
-  void Initialize()
-  {
-    this->Reset();
-    // size the chunks based on the size of a quadrilateral
-    static constexpr int numberOfInitialChunks = 100;
-    this->NextChunkIndex = 0;
-    this->NextFaceIndex = 0;
-    this->Chunks.resize(numberOfInitialChunks, nullptr);
-    // Initialize the first chunk
-    this->Chunks[0] = std::shared_ptr<unsigned char>(
-      new unsigned char[FaceMemoryPool::ChunkSize], std::default_delete<unsigned char[]>());
-  }
+  // Give the memory back to the system.
+  void Initialize() { this->Reset(); }
 
-  void ResetIndices()
-  {
-    this->NextChunkIndex = 0;
-    this->NextFaceIndex = 0;
-  }
+  // Reuse the memory for the next faces.
+  void ResetIndices() { this->Memory.Reset(); }
 
-  void Reset()
-  {
-    this->ResetIndices();
-    this->Chunks.clear();
-  }
+  void Reset() { this->Memory.Release(); }
 
   TFace* Allocate(const int& numberOfPoints)
   {
-    // see if there's room for this one
     const int polySize = FaceMemoryPool::SizeOfFace(numberOfPoints);
-    if (this->NextFaceIndex + polySize > FaceMemoryPool::ChunkSize)
-    {
-      ++this->NextChunkIndex;
-      this->NextFaceIndex = 0;
-
-      // Although this should not happen often, check first.
-      if (this->NextChunkIndex >= this->Chunks.size())
-      {
-        this->Chunks.resize(this->Chunks.size() * 2);
-      }
-
-      // Next: allocate a new array if necessary.
-      if (this->Chunks[this->NextChunkIndex] == nullptr)
-      {
-        this->Chunks[this->NextChunkIndex] = std::shared_ptr<unsigned char>(
-          new unsigned char[FaceMemoryPool::ChunkSize], std::default_delete<unsigned char[]>());
-      }
-    }
-
-    TFace* face =
-      reinterpret_cast<TFace*>(this->Chunks[this->NextChunkIndex].get() + this->NextFaceIndex);
+    TFace* face = static_cast<TFace*>(this->Memory.Allocate(polySize, alignof(TFace)));
     face->NumberOfPoints = numberOfPoints;
     face->PointIds = (TInputIdType*)face + FaceMemoryPool::FSizeDivSizeId;
-    this->NextFaceIndex += polySize;
 
     return face;
   }
@@ -18,6 +18,8 @@
 #include "vtkHyperTreeGridNonOrientedCursor.h"
 #include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
 #include "vtkHyperTreeGridNonOrientedMooreSuperCursor.h"
+#include "vtkHyperTreeGridSMPInternal.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkIndexedArray.h"
@@ -32,6 +34,8 @@
 #include "vtkPolyData.h"
 #include "vtkPolyhedron.h"
 #include "vtkPolyhedronUtilities.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVoxel.h"
@@ -304,11 +308,97 @@ void ReplaceWithIndexedArray(const std::string& contourArrayName, vtkContourValu
     vtkErrorWithObjectMacro(nullptr, "Unable to dispatch the contour array " << contourArrayName);
   }
 }
+
+//------------------------------------------------------------------------------
+// Pre-processing pass deciding whether a cell is intersected by a contour,
+// computed without cursors so that the trees can be processed in parallel.
+// The selection flags and the signs relative to each contour value are
+// written directly to bit arrays indexed by global index.
+struct PreProcessWorker
+{
+  vtkDataArray* Scalars;
+  vtkBitArray* InMask;
+  vtkUnsignedCharArray* InGhostArray;
+  unsigned int DepthLimiter;
+  unsigned int NumberOfChildren;
+  const double* Values;
+  int NumberOfContours;
+  std::atomic<unsigned char>* Selected;
+  std::vector<std::atomic<unsigned char>*> CellSigns;
+
+  // signs holds the signs of the last visited leaf, which are also those of
+  // the coarse cells above it.
+  bool ProcessNode(
+    const vtkHyperTree* tree, vtkIdType index, unsigned int level, std::vector<bool>& signs) const
+  {
+    const vtkIdType id = tree->GetGlobalIndexFromLocal(index);
+    if (this->InGhostArray && this->InGhostArray->GetValue(id))
+    {
+      return false;
+    }
+
+    bool selected = false;
+    const bool masked = this->InMask && this->InMask->GetValue(id);
+    if (level != this->DepthLimiter && !tree->IsLeaf(index) && !masked)
+    {
+      const vtkIdType elder = tree->GetElderChildIndex(index);
+      for (unsigned int child = 0; child < this->NumberOfChildren; ++child)
+      {
+        // Recurse and keep track of whether this branch is selected
+        selected |= this->ProcessNode(tree, elder + child, level + 1, signs);
+
+        // The sign of each child but the first is compared to a negative
+        // sign: a positive one selects the cell.
+        const vtkIdType childId = tree->GetGlobalIndexFromLocal(elder + child);
+        for (int c = 0; !selected && child && c < this->NumberOfContours; ++c)
+        {
+          selected = ::GetBit(this->CellSigns[c], childId);
+        }
+      }
+    }
+    else
+    {
+      // GetComponent rather than GetTuple1, which is not thread-safe
+      const double val = this->Scalars->GetComponent(id, 0);
+      for (int c = 0; c < this->NumberOfContours; ++c)
+      {
+        signs[c] = val > this->Values[c];
+      }
+    }
+
+    ::SetBit(this->Selected, id, selected);
+    for (int c = 0; c < this->NumberOfContours; ++c)
+    {
+      ::SetBit(this->CellSigns[c], id, signs[c]);
+    }
+    return selected;
+  }
+};
 }
 
 //------------------------------------------------------------------------------
-struct vtkHyperTreeGridContour::vtkInternals
+struct vtkHyperTreeGridContour::vtkTreeRange
 {
+  // Output of the range, with a locator merging its coincident points
+  vtkNew<vtkPoints> Points;
+  vtkNew<vtkMergePoints> Locator;
+  vtkNew<vtkCellArray> Verts;
+  vtkNew<vtkCellArray> Lines;
+  vtkNew<vtkCellArray> Polys;
+  vtkNew<vtkPointData> PointData;
+
+  // Point data of the dual mesh, shared by all ranges
+  vtkPointData* DualPointData = nullptr;
+
+  // Structures needed to perform isocontouring
+  std::unique_ptr<vtkContourHelper> Helper;
+  vtkSmartPointer<vtkDataArray> CellScalars;
+  vtkNew<vtkLine> Line;
+  vtkNew<vtkPixel> Pixel;
+  vtkNew<vtkVoxel> Voxel;
+  vtkNew<vtkIdList> Leaves;
+  vtkIdType CurrentId = 0;
+
   // Temporary data structures related to USE_DECOMPOSED_POLYHEDRA strategy
   vtkNew<vtkCellArray> Faces;
   vtkNew<vtkPolyhedron> Polyhedron;
@@ -321,7 +411,6 @@ vtkStandardNewMacro(vtkHyperTreeGridContour);
 
 //------------------------------------------------------------------------------
 vtkHyperTreeGridContour::vtkHyperTreeGridContour()
-  : Internals(new vtkHyperTreeGridContour::vtkInternals())
 {
   // Initialize storage for contour values
   this->ContourValues = vtkContourValues::New();
@@ -334,14 +423,6 @@ vtkHyperTreeGridContour::vtkHyperTreeGridContour()
 
   // Initialize per-cell quantities of interest
   this->CellSigns = nullptr;
-  this->CellScalars = nullptr;
-
-  // Initialize structures for isocontouring
-  this->Helper = nullptr;
-  this->Leaves = vtkIdList::New();
-  this->Line = vtkLine::New();
-  this->Pixel = vtkPixel::New();
-  this->Voxel = vtkVoxel::New();
 
   // Output indices begin at 0
   this->CurrentId = 0;
@@ -352,11 +433,6 @@ vtkHyperTreeGridContour::vtkHyperTreeGridContour()
 
   // Input scalars point to null by default
   this->InScalars = nullptr;
-
-  // Initialize temporal structures related to USE_DECOMPOSED_POLYHEDRA strategy
-  this->Internals->Polyhedron->GetPointIds()->SetNumberOfIds(::POLY_POINTS_NB);
-  this->Internals->Polyhedron->GetPoints()->SetNumberOfPoints(::POLY_POINTS_NB);
-  this->Internals->Faces->AllocateExact(::POLY_FACES_NB, ::POLY_FACES_POINTS_NB * ::POLY_FACES_NB);
 }
 
 //------------------------------------------------------------------------------
@@ -373,30 +449,6 @@ vtkHyperTreeGridContour::~vtkHyperTreeGridContour()
     this->Locator->Delete();
     this->Locator = nullptr;
   }
-
-  if (this->Line)
-  {
-    this->Line->Delete();
-    this->Line = nullptr;
-  }
-
-  if (this->Pixel)
-  {
-    this->Pixel->Delete();
-    this->Pixel = nullptr;
-  }
-
-  if (this->Voxel)
-  {
-    this->Voxel->Delete();
-    this->Voxel = nullptr;
-  }
-
-  if (this->Leaves)
-  {
-    this->Leaves->Delete();
-    this->Leaves = nullptr;
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -426,42 +478,6 @@ void vtkHyperTreeGridContour::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Locator: (none)\n";
   }
-
-  if (this->Line)
-  {
-    os << indent << ": " << this->Line << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Pixel)
-  {
-    os << indent << ": " << this->Pixel << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Voxel)
-  {
-    os << indent << ": " << this->Voxel << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Leaves)
-  {
-    os << indent << ": " << this->Leaves << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -590,11 +606,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   vtkNew<vtkCellArray> newPolys;
   newPolys->AllocateExact(estimatedSize, estimatedSize);
 
-  // Create storage for output scalar values
-  this->CellScalars = this->InScalars->NewInstance();
-  this->CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
-  this->CellScalars->Allocate(this->CellScalars->GetNumberOfComponents() * 8);
-
   // Initialize point locator
   if (!this->Locator)
   {
@@ -608,55 +619,133 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   vtkNew<vtkPointData> dualPointData;
   dualPointData->PassData(input->GetCellData());
 
-  // Instantiate a contour helper for convenience, with triangle generation on
-  this->Helper = new vtkContourHelper(this->Locator, newVerts, newLines, newPolys, dualPointData,
-    nullptr, output->GetPointData(), nullptr, estimatedSize, true);
-
-  // Create storage to keep track of selected cells
+  // Bit arrays storing the selected cells and the signs of the cells
+  // relative to each contour value
   this->SelectedCells = vtkBitArray::New();
-  this->SelectedCells->SetNumberOfTuples(numCells);
-
-  // Initialize storage for signs and values
+  ::InitializeBits(this->SelectedCells, numCells, false);
   // NOLINTNEXTLINE(bugprone-sizeof-expression)
   this->CellSigns = (vtkBitArray**)malloc(numContours * sizeof(*this->CellSigns));
-  this->Signs.resize(numContours, true);
+  std::vector<std::atomic<unsigned char>*> cellSigns(numContours);
   for (int c = 0; c < numContours; ++c)
   {
     this->CellSigns[c] = vtkBitArray::New();
-    this->CellSigns[c]->SetNumberOfTuples(numCells);
-  }
-
-  // First pass across tree roots to evince cells intersected by contours
-  vtkIdType index;
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-  input->InitializeTreeIterator(it);
-  vtkNew<vtkHyperTreeGridNonOrientedCursor> cursor;
-  while (it.GetNextTree(index))
-  {
-    if (this->CheckAbort())
+    ::InitializeBits(this->CellSigns[c], numCells, false);
+    cellSigns[c] = ::GetAtomicBytes(this->CellSigns[c]);
+  }
+
+  // First pass across tree roots to evince cells intersected by contours,
+  // in parallel over the trees
+  const std::vector<vtkHyperTree*> trees = ::GetHyperTrees(input);
+  ::PreProcessWorker worker{ this->InScalars, this->InMask, this->InGhostArray,
+    input->GetDepthLimiter(), input->GetNumberOfChildren(), this->ContourValues->GetValues(),
+    static_cast<int>(numContours), ::GetAtomicBytes(this->SelectedCells), cellSigns };
+  vtkSMPTools::For(0, static_cast<vtkIdType>(trees.size()), [&](vtkIdType t, vtkIdType endTree) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    std::vector<bool> signs(numContours);
+    for (; t < endTree; ++t)
     {
-      break;
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      std::fill(signs.begin(), signs.end(), true);
+      worker.ProcessNode(trees[t], 0, 0, signs);
+    }
+  });
+
+  // Second pass across tree roots: now compute isocontours recursively, in
+  // parallel over ranges of consecutive trees. A few ranges per thread
+  // balance trees of different sizes. The cursors visit the neighboring
+  // trees, whose scales are computed beforehand.
+  ::InitializeTreeScales(input, trees);
+  const vtkIdType numTrees = static_cast<vtkIdType>(trees.size());
+  const vtkIdType numRanges =
+    std::min<vtkIdType>(numTrees, 4 * vtkSMPTools::GetEstimatedNumberOfThreads());
+  const vtkIdType rangeEstimatedSize = estimatedSize / std::max<vtkIdType>(numRanges, 1);
+  std::vector<std::unique_ptr<vtkTreeRange>> ranges(numRanges);
+  for (std::unique_ptr<vtkTreeRange>& range : ranges)
+  {
+    range.reset(new vtkTreeRange);
+    range->Locator->InitPointInsertion(range->Points, input->GetBounds(), rangeEstimatedSize);
+    range->PointData->CopyAllocate(this->InData);
+    range->DualPointData = dualPointData;
+    // Instantiate a contour helper for convenience, with triangle generation on
+    range->Helper.reset(new vtkContourHelper(range->Locator, range->Verts, range->Lines,
+      range->Polys, dualPointData, nullptr, range->PointData, nullptr, rangeEstimatedSize, true));
+    range->CellScalars.TakeReference(this->InScalars->NewInstance());
+    range->CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
+    range->CellScalars->Allocate(range->CellScalars->GetNumberOfComponents() * 8);
+    range->Polyhedron->GetPointIds()->SetNumberOfIds(::POLY_POINTS_NB);
+    range->Polyhedron->GetPoints()->SetNumberOfPoints(::POLY_POINTS_NB);
+    range->Faces->AllocateExact(::POLY_FACES_NB, ::POLY_FACES_POINTS_NB * ::POLY_FACES_NB);
+  }
+  vtkSMPTools::For(0, numRanges, 1, [&](vtkIdType r, vtkIdType endRange) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkNew<vtkHyperTreeGridNonOrientedMooreSuperCursor> supercursor;
+    for (; r < endRange; ++r)
+    {
+      const vtkIdType endTree = numTrees * (r + 1) / numRanges;
+      for (vtkIdType t = numTrees * r / numRanges; t < endTree; ++t)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+        // Initialize new Moore cursor at root of current tree
+        input->InitializeNonOrientedMooreSuperCursor(supercursor, trees[t]->GetTreeIndex());
+        // Compute contours recursively
+        this->RecursivelyProcessTree(supercursor, *ranges[r]);
+      }
+    }
+  });
+
+  // Append the outputs of the ranges in the order of the trees. Their points
+  // go through the locator in the order of a serial traversal, so that the
+  // output does not depend on the number of threads.
+  std::vector<vtkIdType> pointIds;
+  vtkNew<vtkIdList> cellPts;
+  auto appendCells = [&](vtkCellArray* rangeCells, vtkCellArray* cells) {
+    for (vtkIdType cellId = 0; cellId < rangeCells->GetNumberOfCells(); ++cellId)
+    {
+      rangeCells->GetCellAtId(cellId, cellPts);
+      for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+      {
+        cellPts->SetId(i, pointIds[cellPts->GetId(i)]);
+      }
+      cells->InsertNextCell(cellPts);
     }
-    // Initialize new grid cursor at root of current input tree
-    input->InitializeNonOrientedCursor(cursor, index);
-    // Pre-process tree recursively
-    this->RecursivelyPreProcessTree(cursor);
-  } // it
-
-  // Second pass across tree roots: now compute isocontours recursively
-  input->InitializeTreeIterator(it);
-  vtkNew<vtkHyperTreeGridNonOrientedMooreSuperCursor> supercursor;
-  while (it.GetNextTree(index))
+  };
+  for (const std::unique_ptr<vtkTreeRange>& range : ranges)
   {
-    if (this->CheckAbort())
+    const vtkIdType numRangePts = range->Points->GetNumberOfPoints();
+    pointIds.resize(numRangePts);
+    for (vtkIdType ptId = 0; ptId < numRangePts; ++ptId)
     {
-      break;
+      double x[3];
+      range->Points->GetPoint(ptId, x);
+      if (this->Locator->InsertUniquePoint(x, pointIds[ptId]))
+      {
+        // Both point data were allocated from the input cell data
+        for (int i = 0; i < this->OutData->GetNumberOfArrays(); ++i)
+        {
+          this->OutData->GetAbstractArray(i)->InsertTuple(
+            pointIds[ptId], ptId, range->PointData->GetAbstractArray(i));
+        }
+      }
     }
-    // Initialize new Moore cursor at root of current tree
-    input->InitializeNonOrientedMooreSuperCursor(supercursor, index);
-    // Compute contours recursively
-    this->RecursivelyProcessTree(supercursor, newVerts, newLines, newPolys, dualPointData);
-  } // it
+    appendCells(range->Verts, newVerts);
+    appendCells(range->Lines, newLines);
+    appendCells(range->Polys, newPolys);
+    this->CurrentId += range->CurrentId;
+  }
 
   // Set output
   output->SetPoints(newPts);
@@ -690,8 +779,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
     }
   } // c
   free(this->CellSigns);
-  delete this->Helper;
-  this->CellScalars->Delete();
   newPts->Delete();
   this->Locator->Initialize();
 
@@ -701,106 +788,15 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   return 1;
 }
 
-//------------------------------------------------------------------------------
-bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedCursor* cursor)
-{
-  // Retrieve global index of input cursor
-  vtkIdType id = cursor->GetGlobalNodeIndex();
-
-  if (this->InGhostArray && this->InGhostArray->GetTuple1(id))
-  {
-    return false;
-  }
-
-  // Retrieve number of contours
-  vtkIdType numContours = this->ContourValues->GetNumberOfContours();
-
-  // Descend further into input trees only if cursor is not a leaf
-  bool selected = false;
-  if (!cursor->IsLeaf() && !cursor->IsMasked())
-  {
-    // Cursor is not at leaf, recurse to all all children
-    int numChildren = cursor->GetNumberOfChildren();
-    for (int child = 0; child < numChildren; ++child)
-    {
-      if (this->CheckAbort())
-      {
-        break;
-      }
-      // Create storage for signs relative to contour values
-      std::vector<bool> signs(numContours);
-
-      cursor->ToChild(child);
-
-      // Recurse and keep track of whether this branch is selected
-      selected |= this->RecursivelyPreProcessTree(cursor);
-
-      // Check if branch not completely selected
-      if (!selected)
-      {
-        // If not, update contour values
-        for (int c = 0; c < numContours; ++c)
-        {
-          // Retrieve global index of child
-          vtkIdType childId = cursor->GetGlobalNodeIndex();
-
-          // Compute and store selection flags for current contour
-          if (!child)
-          {
-            // Initialize sign array with sign of first child
-            signs[c] = (this->CellSigns[c]->GetTuple1(childId) != 0.0);
-          } // if ( ! child )
-          else
-          {
-            // For subsequent children compare their sign with stored value
-            if (signs[c] != (this->CellSigns[c]->GetTuple1(childId) != 0.0))
-            {
-              // A change of sign occurred, therefore cell must selected
-              selected = true;
-            }
-          } // else
-        }   // c
-      }     // if( ! selected )
-
-      cursor->ToParent();
-    } // child
-  }
-  else if (!this->InGhostArray || !this->InGhostArray->GetTuple1(id))
-  {
-    // Cursor is at leaf, retrieve its active scalar value
-    double val = this->InScalars->GetTuple1(id);
-
-    // Iterate over all contours
-    double* values = this->ContourValues->GetValues();
-    for (int c = 0; c < numContours; ++c)
-    {
-      this->Signs[c] = val > values[c];
-    }
-  } // else
-
-  // Update list of selected cells
-  this->SelectedCells->SetTuple1(id, selected);
-
-  // Set signs for all contours
-  for (int c = 0; c < numContours; ++c)
-  {
-    // Parent cell has that of one of its children
-    this->CellSigns[c]->SetTuple1(id, this->Signs[c]);
-  }
-
-  // Return whether current node was fully selected
-  return selected;
-}
-
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridContour::RecursivelyProcessTree(
-  vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkCellArray* newVerts,
-  vtkCellArray* newLines, vtkCellArray* newPolys, vtkPointData* inPd)
+  vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkTreeRange& range)
 {
   // Retrieve global index of input cursor
   vtkIdType id = supercursor->GetGlobalNodeIndex();
 
-  if (this->InGhostArray && this->InGhostArray->GetTuple1(id))
+  // GetValue rather than GetTuple1, which is not thread-safe
+  if (this->InGhostArray && this->InGhostArray->GetValue(id))
   {
     return;
   }
@@ -811,13 +807,13 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
   if (!supercursor->IsLeaf())
   {
     // Selected cells are determined in RecursivelyPreProcessTree
-    bool selected = (this->SelectedCells->GetTuple1(id) == 1.0);
+    bool selected = this->SelectedCells->GetValue(id) != 0;
 
     // Iterate over contours
     for (vtkIdType c = 0; c < this->ContourValues->GetNumberOfContours() && !selected; ++c)
     {
       // Retrieve sign with respect to contour value at current cursor
-      bool sign = (this->CellSigns[c]->GetTuple1(id) != 0.0);
+      bool sign = this->CellSigns[c]->GetValue(id) != 0;
 
       // Iterate over all cursors of Moore neighborhood around center
       unsigned int nn = supercursor->GetNumberOfCursors() - 1;
@@ -830,9 +826,9 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           vtkIdType idN = supercursor->GetGlobalNodeIndex(icursorN);
 
           // Decide whether neighbor was selected or must be retained because of a sign change
-          selected = this->SelectedCells->GetTuple1(idN) == 1 ||
-            ((this->CellSigns[c]->GetTuple1(idN) != 0.0) != sign) ||
-            (this->InGhostArray && this->InGhostArray->GetTuple1(idN));
+          selected = this->SelectedCells->GetValue(idN) != 0 ||
+            ((this->CellSigns[c]->GetValue(idN) != 0) != sign) ||
+            (this->InGhostArray && this->InGhostArray->GetValue(idN));
         }
         else
         {
@@ -849,24 +845,24 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         // Create child cursor from parent in input grid
         supercursor->ToChild(child);
         // Recurse
-        this->RecursivelyProcessTree(supercursor, newVerts, newLines, newPolys, inPd);
+        this->RecursivelyProcessTree(supercursor, range);
         supercursor->ToParent();
       }
     }
   }
-  else if ((!this->InMask || !this->InMask->GetTuple1(id)))
+  else if ((!this->InMask || !this->InMask->GetValue(id)))
   {
     // Cell is not masked, iterate over its corners
     unsigned int numLeavesCorners = 1 << dim;
     for (unsigned int cornerIdx = 0; cornerIdx < numLeavesCorners; ++cornerIdx)
     {
       bool owner = true;
-      this->Leaves->SetNumberOfIds(numLeavesCorners);
+      range.Leaves->SetNumberOfIds(numLeavesCorners);
 
       // Iterate over every leaf touching the corner and check ownership
       for (unsigned int leafIdx = 0; leafIdx < numLeavesCorners && owner; ++leafIdx)
       {
-        owner = supercursor->GetCornerCursors(cornerIdx, leafIdx, this->Leaves);
+        owner = supercursor->GetCornerCursors(cornerIdx, leafIdx, range.Leaves);
       } // leafIdx
 
       // If cell owns dual cell, compute contours thereof
@@ -884,13 +880,13 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         switch (dim)
         {
           case 1:
-            cell = this->Line;
+            cell = range.Line;
             break;
           case 2:
-            cell = this->Pixel;
+            cell = range.Pixel;
             break;
           case 3:
-            cell = this->Voxel;
+            cell = range.Voxel;
             break;
           default:
             vtkErrorMacro("Unsupported cell dimension had been encountered (must be 1, 2 or 3).");
@@ -904,7 +900,7 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         for (unsigned int _cornerIdx = 0; _cornerIdx < numLeavesCorners; ++_cornerIdx)
         {
           // Get cursor corresponding to this corner
-          vtkIdType cursorId = this->Leaves->GetId(_cornerIdx);
+          vtkIdType cursorId = range.Leaves->GetId(_cornerIdx);
 
           // Retrieve neighbor coordinates and store them
           supercursor->GetPoint(cursorId, x);
@@ -915,7 +911,7 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           cell->PointIds->SetId(_cornerIdx, idN);
 
           // Assign scalar value attached to this contour item
-          this->CellScalars->SetTuple(_cornerIdx, this->InScalars->GetTuple(idN));
+          range.CellScalars->SetTuple(_cornerIdx, idN, this->InScalars);
         } // cornerIdx
 
         /* If we are in 3D and the contour strategy is set to USE_DECOMPOSED_POLYHEDRA,
@@ -932,35 +928,28 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           // Insert points and global point IDs
           for (int i = 0; i < ::POLY_POINTS_NB; ++i)
           {
-            this->Internals->Polyhedron->GetPointIds()->SetId(i, cell->GetPointId(i));
-            this->Internals->Polyhedron->GetPoints()->SetPoint(i, cell->GetPoints()->GetPoint(i));
+            range.Polyhedron->GetPointIds()->SetId(i, cell->GetPointId(i));
+            range.Polyhedron->GetPoints()->SetPoint(i, cell->GetPoints()->GetPoint(i));
           }
 
           // Construct faces from voxel point ids (global ids)
-          this->Internals->Faces->Reset();
+          range.Faces->Reset();
           for (int faceId = 0, canonicalId = 0; faceId < ::POLY_FACES_NB; faceId++)
           {
-            this->Internals->Faces->InsertNextCell(::POLY_FACES_POINTS_NB);
+            range.Faces->InsertNextCell(::POLY_FACES_POINTS_NB);
             for (int i = 0; i < ::POLY_FACES_POINTS_NB; i++, canonicalId++)
             {
-              this->Internals->Faces->InsertCellPoint(
+              range.Faces->InsertCellPoint(
                 cell->GetPointId(::CANONICAL_FACES[canonicalId]));
             }
           }
 
-          this->Internals->Polyhedron->SetCellFaces(this->Internals->Faces);
-          this->Internals->Polyhedron->Initialize();
+          range.Polyhedron->SetCellFaces(range.Faces);
+          range.Polyhedron->Initialize();
 
-          // Decompose the this->Internals->Polyhedron
+          // Decompose the range.Polyhedron
           auto resultUG = vtkPolyhedronUtilities::Decompose(
-            this->Internals->Polyhedron, inPd, this->CurrentId, nullptr);
-
-          auto outPointData = vtkPointData::SafeDownCast(this->OutData);
-          if (!outPointData)
-          {
-            vtkErrorMacro("Unable to retrieve the output point data.");
-            return;
-          }
+            range.Polyhedron, range.DualPointData, range.CurrentId, nullptr);
 
           /* Estimated size: estimated number of generated triangles (before merging them).
            * Only used in that case. Unused here because we choose to output triangles.
@@ -971,8 +960,8 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
            * Needed because we have to change the input point data (now indexed on resultUG point
            * ids)
            */
-          vtkContourHelper helper(this->Locator, newVerts, newLines, newPolys,
-            resultUG->GetPointData(), nullptr, outPointData, nullptr, estimatedSize, true);
+          vtkContourHelper helper(range.Locator, range.Verts, range.Lines, range.Polys,
+            resultUG->GetPointData(), nullptr, range.PointData, nullptr, estimatedSize, true);
 
           // Retrieve the contouring array in the resultUG
           auto contourScalars = resultUG->GetPointData()->GetArray(this->InScalars->GetName());
@@ -991,18 +980,18 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
             iter.TakeReference(resultUG->NewCellIterator());
             for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
             {
-              iter->GetCell(this->Internals->Tetra);
+              iter->GetCell(range.Tetra);
 
               // Scalars used for contouring need to be indexed on tetrahedron local ids
-              this->Internals->TetraScalars->Reset();
-              this->Internals->TetraScalars->SetNumberOfComponents(
+              range.TetraScalars->Reset();
+              range.TetraScalars->SetNumberOfComponents(
                 contourScalars->GetNumberOfComponents());
-              this->Internals->TetraScalars->SetNumberOfTuples(iter->GetNumberOfPoints());
-              contourScalars->GetTuples(iter->GetPointIds(), this->Internals->TetraScalars);
+              range.TetraScalars->SetNumberOfTuples(iter->GetNumberOfPoints());
+              contourScalars->GetTuples(iter->GetPointIds(), range.TetraScalars);
 
               vtkIdType cellId = iter->GetCellId();
               helper.Contour(
-                this->Internals->Tetra, values[c], this->Internals->TetraScalars, cellId);
+                range.Tetra, values[c], range.TetraScalars, cellId);
             }
           }
         }
@@ -1011,12 +1000,12 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           // Compute cell isocontour for each isovalue
           for (int c = 0; c < numContours; ++c)
           {
-            this->Helper->Contour(cell, values[c], this->CellScalars, this->CurrentId);
+            range.Helper->Contour(cell, values[c], range.CellScalars, range.CurrentId);
           }
         }
 
         // Increment output cell counter
-        ++this->CurrentId;
+        ++range.CurrentId;
       } // if ( owner )
     }   // cornerIdx
   }     // else if ( ! this->InMask || this->InMask->GetTuple1( id ) )
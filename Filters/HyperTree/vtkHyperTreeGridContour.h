@@ -11,6 +11,12 @@
  * value for the active scalar is within a specified range (inclusive).
  * The output remains a hyper tree grid.
  *
+ * @warning
+ * This filter is threaded over the trees with vtkSMPTools. The contouring pass
+ * processes ranges of consecutive trees in parallel, each with its own output,
+ * whose points then go through the locator in the order of the trees. The
+ * output does not depend on the number of threads.
+ *
  * @sa
  * vtkHyperTreeGrid vtkHyperTreeGridAlgorithm vtkContourFilter
  *
@@ -37,15 +43,10 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkBitArray;
 class vtkCellData;
-class vtkContourHelper;
 class vtkDataArray;
 class vtkHyperTreeGrid;
-class vtkIdList;
 class vtkIncrementalPointLocator;
-class vtkLine;
-class vtkPixel;
 class vtkUnsignedCharArray;
-class vtkVoxel;
 class vtkHyperTreeGridNonOrientedCursor;
 class vtkHyperTreeGridNonOrientedMooreSuperCursor;
 
@@ -135,17 +136,17 @@ protected:
   int ProcessTrees(vtkHyperTreeGrid*, vtkDataObject*) override;
 
   /**
-   * Recursively decide whether a cell is intersected by a contour
+   * Output and temporary structures of the contouring of a range of trees.
+   * The ranges are processed in parallel.
    */
-  bool RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedCursor*);
+  struct vtkTreeRange;
 
   /**
    * Recursively descend into the tree down to the leaves to construct the contour (verts, lines,
-   * polys). dualPointData represents the point data of the dual mesh, i.e. HTG cell data used for
-   * contouring.
+   * polys) in the output of the range. The range also holds the point data of the dual mesh, i.e.
+   * HTG cell data used for contouring.
    */
-  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkCellArray* verts,
-    vtkCellArray* lines, vtkCellArray* polys, vtkPointData* dualPointData);
+  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkTreeRange& range);
 
   /**
    * Storage for contour values.
@@ -167,25 +168,8 @@ protected:
    */
   vtkIncrementalPointLocator* Locator;
 
-  ///@{
-  /**
-   * Pointers needed to perform isocontouring
-   */
-  vtkContourHelper* Helper;
-  vtkDataArray* CellScalars;
-  vtkLine* Line;
-  vtkPixel* Pixel;
-  vtkVoxel* Voxel;
-  vtkIdList* Leaves;
-  ///@}
-
   /**
-   * Storage for signs relative to current contour value
-   */
-  std::vector<bool> Signs;
-
-  /**
-   * Keep track of current index in output polydata
+   * Number of dual cells contoured
    */
   vtkIdType CurrentId;
 
@@ -206,9 +190,6 @@ private:
 
   // Use implicit arrays to store contour values
   bool UseImplicitArrays = false;
-
-  struct vtkInternals;
-  std::unique_ptr<vtkInternals> Internals;
 };
 
 /**
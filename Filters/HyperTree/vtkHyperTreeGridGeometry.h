@@ -15,6 +15,12 @@
  * This filters also take account of interfaces, that will generate "cuts"
  * over the generated segments/surfaces.
  *
+ * @warning
+ * For 1D and 2D HTGs without interface, the leaves are processed in parallel
+ * with vtkSMPTools from a vtkHyperTreeGridLeafList. For 3D HTGs, ranges of
+ * trees are processed in parallel with one super cursor per thread. 1D and
+ * 2D HTGs with interfaces are processed serially.
+ *
  * @sa
  * vtkHyperTreeGrid vtkHyperTreeGridAlgorithm
  *
@@ -149,16 +149,22 @@ void vtkHyperTreeGridGeometry1DImpl::BuildCellPoints(
   vtkHyperTreeGridNonOrientedGeometryCursor* cursor)
 {
   // Case of a cell whose interface is not defined, we copy the entire surface
-  // First endpoint is at origin of cursor
-  double* cellOrigin = cursor->GetOrigin();
-  this->CellPoints->SetPoint(0, cellOrigin);
-
-  // Second endpoint is at origin of cursor plus its length
-  double* cellSize = cursor->GetSize();
-  double cellEnd[3];
-  memcpy(cellEnd, cellOrigin, 3 * sizeof(double));
-  cellEnd[this->Axis] += cellSize[this->Axis];
-  this->CellPoints->SetPoint(1, cellEnd);
+  double points[6];
+  this->ComputeCellPoints(cursor->GetOrigin(), cursor->GetSize(), points);
+  this->CellPoints->SetPoint(0, points);
+  this->CellPoints->SetPoint(1, points + 3);
+}
+
+//----------------------------------------------------------------------------------------------
+void vtkHyperTreeGridGeometry1DImpl::ComputeCellPoints(
+  const double* cellOrigin, const double* cellSize, double* points) const
+{
+  // First endpoint is at origin of cell
+  memcpy(points, cellOrigin, 3 * sizeof(double));
+
+  // Second endpoint is at origin of cell plus its length
+  memcpy(points + 3, cellOrigin, 3 * sizeof(double));
+  points[3 + this->Axis] += cellSize[this->Axis];
 }
 
 VTK_ABI_NAMESPACE_END
@@ -236,18 +236,26 @@ void vtkHyperTreeGridGeometry2DImpl::ProcessLeafCellWithDoubleInterface(
 void vtkHyperTreeGridGeometry2DImpl::BuildCellPoints(
   vtkHyperTreeGridNonOrientedGeometryCursor* cursor)
 {
-  // Retrieve intercept tuple and type
-  double* cellOrigin = cursor->GetOrigin();
-  double* cellSize = cursor->GetSize();
-  std::vector<double> xyz(3);
-  memcpy(xyz.data(), cellOrigin, 3 * sizeof(double));
-  this->CellPoints->SetPoint(0, xyz.data());
-  xyz[this->Axis1] += cellSize[this->Axis1];
-  this->CellPoints->SetPoint(1, xyz.data());
-  xyz[this->Axis2] += cellSize[this->Axis2];
-  this->CellPoints->SetPoint(2, xyz.data());
-  xyz[this->Axis1] = cellOrigin[this->Axis1];
-  this->CellPoints->SetPoint(3, xyz.data());
+  double points[12];
+  this->ComputeCellPoints(cursor->GetOrigin(), cursor->GetSize(), points);
+  for (int ptId = 0; ptId < 4; ++ptId)
+  {
+    this->CellPoints->SetPoint(ptId, points + 3 * ptId);
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+void vtkHyperTreeGridGeometry2DImpl::ComputeCellPoints(
+  const double* cellOrigin, const double* cellSize, double* points) const
+{
+  // Each point is the previous one moved along one edge of the cell
+  memcpy(points, cellOrigin, 3 * sizeof(double));
+  memcpy(points + 3, points, 3 * sizeof(double));
+  points[3 + this->Axis1] += cellSize[this->Axis1];
+  memcpy(points + 6, points + 3, 3 * sizeof(double));
+  points[6 + this->Axis2] += cellSize[this->Axis2];
+  memcpy(points + 9, points + 6, 3 * sizeof(double));
+  points[9 + this->Axis1] = cellOrigin[this->Axis1];
 }
 
 VTK_ABI_NAMESPACE_END
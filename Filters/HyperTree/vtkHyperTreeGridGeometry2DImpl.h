@@ -53,6 +53,13 @@ protected:
    */
   void BuildCellPoints(vtkHyperTreeGridNonOrientedGeometryCursor* cursor) override;
 
+  /**
+   * Compute the point coordinates of the surface of a cell given its origin
+   * and size.
+   */
+  void ComputeCellPoints(
+    const double* cellOrigin, const double* cellSize, double* points) const override;
+
 private:
   /**
    * Denotes the oriention of the 2D HTG
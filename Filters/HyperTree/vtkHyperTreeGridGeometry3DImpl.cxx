@@ -6,13 +6,18 @@
 #include "vtkDataSetAttributes.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.h"
+#include "vtkHyperTreeGridSMPInternal.h"
+#include "vtkIdList.h"
 #include "vtkMathUtilities.h"
 #include "vtkMergePoints.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -89,24 +94,102 @@ vtkHyperTreeGridGeometry3DImpl::vtkHyperTreeGridGeometry3DImpl(bool mergePoints,
   this->InPureMaskArray = this->Input->GetPureMask();
 }
 
+//------------------------------------------------------------------------------
+vtkHyperTreeGridGeometry3DImpl::vtkHyperTreeGridGeometry3DImpl(
+  const vtkHyperTreeGridGeometry3DImpl& other, vtkPoints* outPoints, vtkCellArray* outCells,
+  std::vector<vtkIdType>* outCellIds)
+  : vtkHyperTreeGridGeometryImpl(other)
+  , BranchFactor(other.BranchFactor)
+  , InPureMaskArray(other.InPureMaskArray)
+{
+  this->OutPoints = outPoints;
+  this->OutCells = outCells;
+  this->OutCellIds = outCellIds;
+  if (other.Locator)
+  {
+    this->Locator = vtkSmartPointer<vtkMergePoints>::New();
+    this->Locator->InitPointInsertion(outPoints, this->Input->GetBounds());
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 vtkHyperTreeGridGeometry3DImpl::~vtkHyperTreeGridGeometry3DImpl() = default;
 
 //----------------------------------------------------------------------------------------------
 void vtkHyperTreeGridGeometry3DImpl::GenerateGeometry()
 {
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-  this->Input->InitializeTreeIterator(it);
-
-  vtkIdType hyperTreeId;
-  vtkNew<vtkHyperTreeGridNonOrientedVonNeumannSuperCursor> cursor;
+  struct TreeRange
+  {
+    vtkNew<vtkPoints> Points;
+    vtkNew<vtkCellArray> Cells;
+    std::vector<vtkIdType> CellIds;
+    std::unique_ptr<vtkHyperTreeGridGeometry3DImpl> Impl;
+  };
+
+  // The cursors visit the neighboring trees, whose scales are computed
+  // beforehand. A few ranges per thread balance trees of different sizes.
+  const std::vector<vtkHyperTree*> trees = ::GetHyperTrees(this->Input);
+  ::InitializeTreeScales(this->Input, trees);
+  const vtkIdType numTrees = static_cast<vtkIdType>(trees.size());
+  const vtkIdType numRanges =
+    std::min<vtkIdType>(numTrees, 4 * vtkSMPTools::GetEstimatedNumberOfThreads());
+  std::vector<TreeRange> ranges(numRanges);
+  for (TreeRange& range : ranges)
+  {
+    range.Points->SetDataType(this->OutPoints->GetDataType());
+    range.Impl.reset(
+      new vtkHyperTreeGridGeometry3DImpl(*this, range.Points, range.Cells, &range.CellIds));
+  }
 
   // Recursively process all HyperTrees
-  while (it.GetNextTree(hyperTreeId))
+  vtkSMPTools::For(0, numRanges, 1, [&](vtkIdType r, vtkIdType endRange) {
+    vtkNew<vtkHyperTreeGridNonOrientedVonNeumannSuperCursor> cursor;
+    for (; r < endRange; ++r)
+    {
+      const vtkIdType endTree = numTrees * (r + 1) / numRanges;
+      for (vtkIdType t = numTrees * r / numRanges; t < endTree; ++t)
+      {
+        this->Input->InitializeNonOrientedVonNeumannSuperCursor(cursor, trees[t]->GetTreeIndex());
+        ranges[r].Impl->RecursivelyProcessTree(cursor, ::TREAT_ALL_FACES);
+      }
+    }
+  });
+
+  // Append the ranges in the order of the trees. Their points go through the
+  // locator, if any, in the order of a serial traversal, so that the output
+  // does not depend on the number of threads.
+  std::vector<vtkIdType> cellIds;
+  std::vector<vtkIdType> pointIds;
+  vtkNew<vtkIdList> cellPts;
+  for (const TreeRange& range : ranges)
   {
-    this->Input->InitializeNonOrientedVonNeumannSuperCursor(cursor, hyperTreeId);
-    this->RecursivelyProcessTree(cursor, ::TREAT_ALL_FACES);
+    const vtkIdType numPts = range.Points->GetNumberOfPoints();
+    pointIds.resize(numPts);
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      double pt[3];
+      range.Points->GetPoint(ptId, pt);
+      if (this->Locator)
+      {
+        this->Locator->InsertUniquePoint(pt, pointIds[ptId]);
+      }
+      else
+      {
+        pointIds[ptId] = this->OutPoints->InsertNextPoint(pt);
+      }
+    }
+    for (vtkIdType cellId = 0; cellId < range.Cells->GetNumberOfCells(); ++cellId)
+    {
+      range.Cells->GetCellAtId(cellId, cellPts);
+      for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+      {
+        cellPts->SetId(i, pointIds[cellPts->GetId(i)]);
+      }
+      this->OutCells->InsertNextCell(cellPts);
+    }
+    cellIds.insert(cellIds.end(), range.CellIds.begin(), range.CellIds.end());
   }
+  this->CopyCellData(cellIds);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -943,11 +1026,13 @@ bool vtkHyperTreeGridGeometry3DImpl::GetHasInterface(vtkIdType cellId) const
     return false;
   }
 
-  bool ret =
-    (this->InIntercepts && ((this->InIntercepts->GetTuple(cellId))[2] < 2) && this->InNormals);
+  // GetComponent and GetTuple with a buffer, which are thread-safe
+  bool ret = (this->InIntercepts && this->InIntercepts->GetComponent(cellId, 2) < 2 &&
+    this->InNormals);
   if (ret)
   {
-    double* normal = this->InNormals->GetTuple(cellId);
+    double normal[3];
+    this->InNormals->GetTuple(cellId, normal);
     ret = !(normal[0] == 0. && normal[1] == 0. && normal[2] == 0.);
   }
   return ret;
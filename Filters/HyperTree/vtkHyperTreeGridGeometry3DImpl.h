@@ -32,6 +32,9 @@ public:
 
   /**
    * Generate the external surface of the input vtkHyperTreeGrid.
+   * Ranges of consecutive trees are processed in parallel, each with its own
+   * output points and cells, which are then appended to the output in the
+   * order of the trees.
    */
   void GenerateGeometry() override;
 
@@ -49,6 +52,14 @@ protected:
 private:
   struct HTG3DPoint;
 
+  /**
+   * Copy the parameters of other to process a range of trees, generating
+   * the surface in outPoints and outCells and storing the input cell of each
+   * output cell in outCellIds.
+   */
+  vtkHyperTreeGridGeometry3DImpl(const vtkHyperTreeGridGeometry3DImpl& other,
+    vtkPoints* outPoints, vtkCellArray* outCells, std::vector<vtkIdType>* outCellIds);
+
   /**
    * Generate the surface for a leaf cell if needed, taking account of the
    * presence of interface(s) in the cell.
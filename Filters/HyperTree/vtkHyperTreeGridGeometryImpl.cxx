@@ -1,11 +1,13 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkHyperTreeGridGeometryImpl.h"
+#include "vtkArrayListTemplate.h"
 #include "vtkBitArray.h"
 #include "vtkCellArray.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <limits>
@@ -68,6 +70,11 @@ void vtkHyperTreeGridGeometryImpl::CreateNewCellAndCopyData(
   // Insert new cell
   vtkIdType outputCellIndex =
     this->OutCells->InsertNextCell(outPointIds.size(), outPointIds.data());
+  if (this->OutCellIds)
+  {
+    this->OutCellIds->push_back(cellId);
+    return;
+  }
 
   // Copy the data from the cell this face comes from
   this->OutCellDataAttributes->CopyData(this->InCellDataAttributes, cellId, outputCellIndex);
@@ -88,9 +95,66 @@ void vtkHyperTreeGridGeometryImpl::CreateNewCellAndCopyData(
 bool vtkHyperTreeGridGeometryImpl::IsMaskedOrGhost(vtkIdType globalNodeId) const
 {
   // This method determines if the globalNodeId offset cell is masked or ghosted.
-  return ((this->InMaskArray && this->InMaskArray->GetTuple1(globalNodeId))
+  return ((this->InMaskArray && this->InMaskArray->GetValue(globalNodeId))
       ? true
-      : (this->InGhostArray && this->InGhostArray->GetTuple1(globalNodeId)));
+      : (this->InGhostArray && this->InGhostArray->GetValue(globalNodeId)));
+}
+
+//----------------------------------------------------------------------------------------------
+bool vtkHyperTreeGridGeometryImpl::IsGhost(vtkIdType globalNodeId) const
+{
+  return this->InGhostArray && this->InGhostArray->GetValue(globalNodeId);
+}
+
+//----------------------------------------------------------------------------------------------
+void vtkHyperTreeGridGeometryImpl::CopyCellData(const std::vector<vtkIdType>& cellIds)
+{
+  const vtkIdType numCells = static_cast<vtkIdType>(cellIds.size());
+  vtkIdTypeArray* originalCellIds = nullptr;
+  if (this->PassThroughCellIds && !this->OriginalCellIdArrayName.empty())
+  {
+    originalCellIds = vtkIdTypeArray::SafeDownCast(
+      this->OutCellDataAttributes->GetArray(this->OriginalCellIdArrayName.c_str()));
+    if (!originalCellIds)
+    {
+      vtkErrorWithObjectMacro(nullptr, "Pass cell ids array has wrong type.");
+    }
+    else
+    {
+      originalCellIds->SetNumberOfValues(numCells);
+    }
+  }
+
+  // ArrayList copies the data arrays in parallel, the other ones (e.g.,
+  // strings) are copied serially.
+  ArrayList arrays;
+  arrays.AddArrays(numCells, this->InCellDataAttributes, this->OutCellDataAttributes, 0.0, false);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      arrays.Copy(cellIds[cellId], cellId);
+      if (originalCellIds)
+      {
+        originalCellIds->SetValue(cellId, cellIds[cellId]);
+      }
+    }
+  });
+  for (int i = 0; i < this->OutCellDataAttributes->GetNumberOfArrays(); ++i)
+  {
+    vtkAbstractArray* outArray = this->OutCellDataAttributes->GetAbstractArray(i);
+    vtkAbstractArray* inArray = outArray->GetName()
+      ? this->InCellDataAttributes->GetAbstractArray(outArray->GetName())
+      : nullptr;
+    if (vtkArrayDownCast<vtkDataArray>(outArray) || !inArray)
+    {
+      continue;
+    }
+    outArray->SetNumberOfTuples(numCells);
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      outArray->SetTuple(cellId, cellIds[cellId], inArray);
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------------
@@ -115,13 +179,9 @@ bool vtkHyperTreeGridGeometryImpl::ProbeForCellInterface(vtkIdType cellId, bool
     this->CellInterfaceType = 2; // we consider pure cell
     return false;
   }
-  double* intercepts = this->InIntercepts->GetTuple(cellId);
-  if (intercepts == nullptr)
-  {
-    this->HasInterfaceOnThisCell = false;
-    this->CellInterfaceType = 2; // we consider pure cell
-    return false;
-  }
+  // GetTuple with a buffer, which is thread-safe unlike GetTuple(cellId)
+  double intercepts[3];
+  this->InIntercepts->GetTuple(cellId, intercepts);
   this->CellIntercepts[0] = intercepts[0];
   this->CellIntercepts[1] = intercepts[1];
   this->CellIntercepts[2] = intercepts[2];
@@ -132,13 +192,8 @@ bool vtkHyperTreeGridGeometryImpl::ProbeForCellInterface(vtkIdType cellId, bool
     this->CellInterfaceType = 2; // we consider pure cell
     return false;
   }
-  double* normal = this->InNormals->GetTuple(cellId);
-  if (normal == nullptr)
-  {
-    this->HasInterfaceOnThisCell = false;
-    this->CellInterfaceType = 2; // we consider pure cell
-    return false;
-  }
+  double normal[3];
+  this->InNormals->GetTuple(cellId, normal);
   if (normal[0] == 0. && normal[1] == 0. && normal[2] == 0.)
   {
     this->HasInterfaceOnThisCell = false;
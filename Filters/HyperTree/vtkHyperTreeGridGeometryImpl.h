@@ -62,15 +62,30 @@ protected:
   /**
    * Insert a new output cell from a list of point ids in the output polydata
    * and copy the data from the input HTG cell at cellId to the newly created
-   * surface cell.
+   * surface cell. When OutCellIds is set, cellId is appended to it instead,
+   * the data being copied later by CopyCellData.
    */
   void CreateNewCellAndCopyData(const std::vector<vtkIdType>& outPointIds, vtkIdType cellId);
 
   /**
    * Returns true if the input HTG cell is masked or ghosted.
+   * This method can be called from several threads.
    */
   bool IsMaskedOrGhost(vtkIdType globalNodeId) const;
 
+  /**
+   * Returns true if the input HTG cell is ghosted.
+   * This method can be called from several threads.
+   */
+  bool IsGhost(vtkIdType globalNodeId) const;
+
+  /**
+   * Copy the data from the input HTG cells at cellIds[i] to the output
+   * cells i, for all i, in parallel. This is the equivalent of
+   * CreateNewCellAndCopyData for output cells built all at once.
+   */
+  void CopyCellData(const std::vector<vtkIdType>& cellIds);
+
   /**
    * Determine if the input HTG at cellId contains an valid interface and
    * if yes, determine its characteristics, stored in the variables below.
@@ -94,6 +109,12 @@ protected:
   vtkDataSetAttributes* InCellDataAttributes;
   vtkDataSetAttributes* OutCellDataAttributes;
 
+  /**
+   * Input HTG cell of each output cell, filled by CreateNewCellAndCopyData
+   * instead of the output cell data when not null.
+   */
+  std::vector<vtkIdType>* OutCellIds = nullptr;
+
   /**
    * Retrieved from input for quick access
    */
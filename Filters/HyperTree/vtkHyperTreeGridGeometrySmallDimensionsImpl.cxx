@@ -4,9 +4,14 @@
 #include "vtkCellArray.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridLeafList.h"
 #include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
+#include "vtkIdTypeArray.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -24,6 +29,13 @@ vtkHyperTreeGridGeometrySmallDimensionsImpl::vtkHyperTreeGridGeometrySmallDimens
 //----------------------------------------------------------------------------------------------
 void vtkHyperTreeGridGeometrySmallDimensionsImpl::GenerateGeometry()
 {
+  // Without interface, leaf cells are independent: process them in parallel
+  if (!this->HasInterface)
+  {
+    this->GenerateLeafCells();
+    return;
+  }
+
   // initialize iterator on HypterTrees (HT) of an HyperTreeGrid (HTG)
   vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
   this->Input->InitializeTreeIterator(it);
@@ -73,6 +85,82 @@ void vtkHyperTreeGridGeometrySmallDimensionsImpl::RecursivelyProcessTree(
   }
 }
 
+//----------------------------------------------------------------------------------------------
+void vtkHyperTreeGridGeometrySmallDimensionsImpl::GenerateLeafCells()
+{
+  vtkNew<vtkHyperTreeGridLeafList> leaves;
+  leaves->Build(this->Input);
+  const vtkIdType numLeaves = leaves->GetNumberOfLeaves();
+
+  // Masked cells are not in the list. Ghost cells are skipped as in
+  // RecursivelyProcessTree: ghost flags are set on all the cells of ghost
+  // trees, so checking the leaves is enough. Output cells are numbered in
+  // the order of the leaves, batch by batch.
+  const vtkIdType batchSize = 10000;
+  const vtkIdType numBatches = (numLeaves + batchSize - 1) / batchSize;
+  std::vector<vtkIdType> batchOffsets(numBatches + 1, 0);
+  vtkSMPTools::For(0, numBatches, [&](vtkIdType batch, vtkIdType endBatch) {
+    for (; batch < endBatch; ++batch)
+    {
+      const vtkIdType endLeaf = std::min((batch + 1) * batchSize, numLeaves);
+      vtkIdType numCells = 0;
+      for (vtkIdType leaf = batch * batchSize; leaf < endLeaf; ++leaf)
+      {
+        numCells += !this->IsGhost(leaves->GetGlobalIndex(leaf));
+      }
+      batchOffsets[batch + 1] = numCells;
+    }
+  });
+  std::partial_sum(batchOffsets.begin(), batchOffsets.end(), batchOffsets.begin());
+  const vtkIdType numCells = batchOffsets.back();
+
+  // Each cell has its own points, numbered consecutively.
+  const vtkIdType numCellPts = this->CellPoints->GetNumberOfPoints();
+  this->OutPoints->SetNumberOfPoints(numCells * numCellPts);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(numCells * numCellPts);
+  vtkIdType* conn = connectivity->GetPointer(0);
+  std::vector<vtkIdType> cellIds(numCells);
+  vtkSMPTools::For(0, numBatches, [&](vtkIdType batch, vtkIdType endBatch) {
+    const vtkIdType beginLeaf = batch * batchSize;
+    const vtkIdType endLeaf = std::min(endBatch * batchSize, numLeaves);
+    vtkIdType tree = leaves->FindTree(beginLeaf);
+    unsigned int level = 0;
+    double size[3];
+    leaves->GetSize(tree, level, size);
+    std::vector<double> points(3 * numCellPts);
+    vtkIdType cellId = batchOffsets[batch];
+    for (vtkIdType leaf = beginLeaf; leaf < endLeaf; ++leaf)
+    {
+      const vtkIdType globalIndex = leaves->GetGlobalIndex(leaf);
+      if (this->IsGhost(globalIndex))
+      {
+        continue;
+      }
+      if (leaf >= leaves->GetTreeEnd(tree) || leaves->GetLevel(leaf) != level)
+      {
+        while (leaf >= leaves->GetTreeEnd(tree))
+        {
+          ++tree;
+        }
+        level = leaves->GetLevel(leaf);
+        leaves->GetSize(tree, level, size);
+      }
+      this->ComputeCellPoints(leaves->GetOrigin(leaf), size, points.data());
+      for (vtkIdType i = 0; i < numCellPts; ++i)
+      {
+        const vtkIdType ptId = cellId * numCellPts + i;
+        this->OutPoints->SetPoint(ptId, points.data() + 3 * i);
+        conn[ptId] = ptId;
+      }
+      cellIds[cellId++] = globalIndex;
+    }
+  });
+  this->OutCells->SetData(numCellPts, connectivity);
+
+  this->CopyCellData(cellIds);
+}
+
 //----------------------------------------------------------------------------------------------
 void vtkHyperTreeGridGeometrySmallDimensionsImpl::ProcessLeafCellWithoutInterface(
   vtkHyperTreeGridNonOrientedGeometryCursor* cursor)
@@ -48,6 +48,15 @@ protected:
    */
   void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedGeometryCursor* cursor);
 
+  /**
+   * Generate the surface of an input HTG without interface: each leaf cell
+   * is added as-is to the output surface, independently of the others, so
+   * the leaves are processed in parallel from a vtkHyperTreeGridLeafList.
+   * The output is the same as the one of RecursivelyProcessTree.
+   * This method is called by GenerateGeometry.
+   */
+  void GenerateLeafCells();
+
   /**
    * Generate the surface for a leaf cell with a defined interface.
    */
@@ -83,6 +92,14 @@ protected:
    */
   virtual void BuildCellPoints(vtkHyperTreeGridNonOrientedGeometryCursor* cursor) = 0;
 
+  /**
+   * Compute the point coordinates of the surface of a cell given its origin
+   * and size, stored contiguously in points (3 values per point).
+   * Used by BuildCellPoints and GenerateLeafCells; must be thread-safe.
+   */
+  virtual void ComputeCellPoints(
+    const double* cellOrigin, const double* cellSize, double* points) const = 0;
+
   /**
    * Contains the point coordinates of the current cell surface,
    * without considering eventual cuts made by interfaces.
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkHyperTreeGridSMPInternal
+ * @brief   helpers for the threaded processing of hyper tree grids
+ *
+ * vtkHyperTreeGridSMPInternal gathers the code shared by the hyper tree grid
+ * filters that process the trees in parallel with vtkSMPTools: listing the
+ * trees of a grid, preparing the trees for cursors used from several threads,
+ * and filling the bit arrays indexed by global node index (masks, selections)
+ * from several threads. Neighboring bits share a byte, so the bits are set
+ * and cleared with atomic operations on the bytes of the array.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkHyperTreeGridLeafList vtkHyperTreeGridThreshold vtkHyperTreeGridContour
+ */
+
+#ifndef vtkHyperTreeGridSMPInternal_h
+#define vtkHyperTreeGridSMPInternal_h
+
+#include "vtkBitArray.h"
+#include "vtkHyperTree.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridScales.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+// Return the trees of the grid in the order of its tree iterator.
+inline std::vector<vtkHyperTree*> GetHyperTrees(vtkHyperTreeGrid* grid)
+{
+  std::vector<vtkHyperTree*> trees;
+  vtkHyperTree* tree;
+  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
+  grid->InitializeTreeIterator(it);
+  while ((tree = it.GetNextTree()))
+  {
+    trees.push_back(tree);
+  }
+  return trees;
+}
+
+// Compute the cell sizes of all the levels of the trees, which the geometry
+// cursors otherwise compute on demand, so that the cursors can then be used
+// from several threads.
+inline void InitializeTreeScales(vtkHyperTreeGrid* grid, const std::vector<vtkHyperTree*>& trees)
+{
+  const unsigned int numLevels = grid->GetNumberOfLevels();
+  for (vtkHyperTree* tree : trees)
+  {
+    if (tree->HasScales())
+    {
+      tree->GetScales()->GetScale(numLevels);
+    }
+  }
+}
+
+// The bytes of a bit array, accessed atomically.
+static_assert(sizeof(std::atomic<unsigned char>) == sizeof(unsigned char),
+  "atomic bytes must have the layout of the bytes of vtkBitArray");
+inline std::atomic<unsigned char>* GetAtomicBytes(vtkBitArray* bits)
+{
+  return reinterpret_cast<std::atomic<unsigned char>*>(bits->GetPointer(0));
+}
+
+// Resize the array to the given number of values, all set to value.
+inline void InitializeBits(vtkBitArray* bits, vtkIdType numValues, bool value)
+{
+  bits->SetNumberOfValues(numValues);
+  std::memset(bits->GetPointer(0), value ? 0xff : 0, (numValues + 7) / 8);
+  bits->DataChanged();
+}
+
+// Set or clear the bit of a value. Several threads may write bits of the same
+// array concurrently, as long as each value is written by a single thread.
+inline void SetBit(std::atomic<unsigned char>* bytes, vtkIdType id, bool value)
+{
+  const unsigned char mask = static_cast<unsigned char>(0x80 >> (id % 8));
+  if (value)
+  {
+    bytes[id / 8].fetch_or(mask, std::memory_order_relaxed);
+  }
+  else
+  {
+    bytes[id / 8].fetch_and(static_cast<unsigned char>(~mask), std::memory_order_relaxed);
+  }
+}
+
+// Read the bit of a value while other threads may be writing to its byte.
+inline bool GetBit(const std::atomic<unsigned char>* bytes, vtkIdType id)
+{
+  return (bytes[id / 8].load(std::memory_order_relaxed) & (0x80 >> (id % 8))) != 0;
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkHyperTreeGridSMPInternal.h
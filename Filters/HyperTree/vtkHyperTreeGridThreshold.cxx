@@ -17,6 +17,7 @@
 #include "vtkUniformHyperTreeGrid.h"
 
 #include "vtkHyperTreeGridNonOrientedCursor.h"
+#include "vtkHyperTreeGridSMPInternal.h"
 
 #include <cmath>
 #include <limits>
@@ -156,6 +157,50 @@ private:
   vtkSmartPointer<vtkIdTypeArray> IndirectionMap;
 };
 
+/*
+ * Output mask of the MaskInput strategy, computed without cursors so that
+ * the trees can be processed in parallel: a leaf is discarded when its value
+ * is out of range, a coarse cell when all its children are discarded.
+ * The flags are written directly to the bits of the mask.
+ */
+struct MaskInputWorker
+{
+  vtkDataArray* Scalars;
+  vtkBitArray* InMask;
+  unsigned int DepthLimiter;
+  unsigned int NumberOfChildren;
+  double LowerThreshold;
+  double UpperThreshold;
+  std::atomic<unsigned char>* Discard;
+
+  bool ProcessNode(const vtkHyperTree* tree, vtkIdType index, unsigned int level) const
+  {
+    const vtkIdType id = tree->GetGlobalIndexFromLocal(index);
+    bool discard = true;
+    if (this->InMask && this->InMask->GetValue(id))
+    {
+      ::SetBit(this->Discard, id, discard);
+      return discard;
+    }
+    if (level != this->DepthLimiter && !tree->IsLeaf(index))
+    {
+      const vtkIdType elder = tree->GetElderChildIndex(index);
+      for (unsigned int ichild = 0; ichild < this->NumberOfChildren; ++ichild)
+      {
+        discard &= this->ProcessNode(tree, elder + ichild, level + 1);
+      }
+    }
+    else
+    {
+      // GetComponent rather than GetTuple1, which is not thread-safe
+      const double value = this->Scalars->GetComponent(id, 0);
+      discard = value < this->LowerThreshold || value > this->UpperThreshold;
+    }
+    ::SetBit(this->Discard, id, discard);
+    return discard;
+  }
+};
+
 }
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -265,24 +310,29 @@ int vtkHyperTreeGridThreshold::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObje
   {
     output->ShallowCopy(input);
 
-    this->OutMask->SetNumberOfTuples(output->GetNumberOfCells());
-
-    // Iterate over all input and output hyper trees
-    vtkIdType outIndex;
-    vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-    output->InitializeTreeIterator(it);
-    vtkNew<vtkHyperTreeGridNonOrientedCursor> outCursor;
-    while (it.GetNextTree(outIndex))
-    {
-      if (this->CheckAbort())
+    // Process the trees in parallel, writing to the mask directly. The
+    // cells that are not visited remain discarded.
+    const std::vector<vtkHyperTree*> trees = ::GetHyperTrees(output);
+    ::InitializeBits(this->OutMask, output->GetNumberOfCells(), true);
+    ::MaskInputWorker worker{ this->InScalars, this->InMask, output->GetDepthLimiter(),
+      output->GetNumberOfChildren(), this->LowerThreshold, this->UpperThreshold,
+      ::GetAtomicBytes(this->OutMask) };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(trees.size()), [&](vtkIdType t, vtkIdType endTree) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (; t < endTree; ++t)
       {
-        break;
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+        worker.ProcessNode(trees[t], 0, 0);
       }
-      // Initialize new grid cursor at root of current input tree
-      output->InitializeNonOrientedCursor(outCursor, outIndex);
-      // Limit depth recursively
-      this->RecursivelyProcessTreeWithCreateNewMask(outCursor);
-    } // it
+    });
+    this->OutMask->DataChanged();
   }
   else if (this->MemoryStrategy == CopyStructureAndIndexArrays ||
     this->MemoryStrategy == DeepThreshold)
@@ -434,56 +484,4 @@ bool vtkHyperTreeGridThreshold::RecursivelyProcessTree(
   // Return whether current node is within range
   return discard;
 }
-
-//------------------------------------------------------------------------------
-bool vtkHyperTreeGridThreshold::RecursivelyProcessTreeWithCreateNewMask(
-  vtkHyperTreeGridNonOrientedCursor* outCursor)
-{
-  // Retrieve global index of input cursor
-  vtkIdType outId = outCursor->GetGlobalNodeIndex();
-
-  // Flag to recursively decide whether a tree node should discarded
-  bool discard = true;
-
-  if (this->InMask && this->InMask->GetValue(outId))
-  {
-    // Mask output cell if necessary
-    this->OutMask->InsertTuple1(outId, discard);
-
-    // Return whether current node is within range
-    return discard;
-  }
-
-  // Descend further into input trees only if cursor is not at leaf
-  if (!outCursor->IsLeaf())
-  {
-    // If input cursor is neither at leaf nor at maximum depth, recurse to all children
-    int numChildren = outCursor->GetNumberOfChildren();
-    for (int ichild = 0; ichild < numChildren; ++ichild)
-    {
-      if (this->CheckAbort())
-      {
-        break;
-      }
-      // Descend into child in output grid as well
-      outCursor->ToChild(ichild);
-      // Recurse and keep track of whether some children are kept
-      discard &= this->RecursivelyProcessTreeWithCreateNewMask(outCursor);
-      // Return to parent in output grid
-      outCursor->ToParent();
-    } // child
-  }   // if (! inCursor->IsLeaf() && inCursor->GetCurrentDepth() < this->Depth)
-  else
-  {
-    // Input cursor is at leaf, check whether it is within range
-    double value = this->InScalars->GetTuple1(outId);
-    discard = value < this->LowerThreshold || value > this->UpperThreshold;
-  } // else
-
-  // Mask output cell if necessary
-  this->OutMask->InsertTuple1(outId, discard);
-
-  // Return whether current node is within range
-  return discard;
-}
 VTK_ABI_NAMESPACE_END
@@ -13,6 +13,10 @@
  * A parameter (JustCreateNewMask) allows to only redefine the mask
  * and not create a new HTG.
  *
+ * @warning
+ * With the MaskInput memory strategy, the trees are processed in parallel
+ * with vtkSMPTools. The other strategies build a new HTG serially.
+ *
  * @sa
  * vtkHyperTreeGrid vtkHyperTreeGridAlgorithm vtkThreshold
  *
@@ -123,7 +127,6 @@ protected:
    */
   bool RecursivelyProcessTree(
     vtkHyperTreeGridNonOrientedCursor*, vtkHyperTreeGridNonOrientedCursor*);
-  bool RecursivelyProcessTreeWithCreateNewMask(vtkHyperTreeGridNonOrientedCursor*);
 
   /**
    * LowerThreshold scalar value to be accepted
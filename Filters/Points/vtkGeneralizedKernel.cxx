@@ -37,6 +37,22 @@ vtkIdType vtkGeneralizedKernel::ComputeBasis(double x[3], vtkIdList* pIds, vtkId
   return pIds->GetNumberOfIds();
 }
 
+//------------------------------------------------------------------------------
+bool vtkGeneralizedKernel::ComputeBases(
+  vtkPoints* pts, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  if (this->KernelFootprint == vtkGeneralizedKernel::RADIUS)
+  {
+    this->Locator->FindPointsWithinRadius(this->Radius, pts, offsets, ids);
+  }
+  else
+  {
+    this->Locator->FindClosestNPoints(this->NumberOfPoints, pts, offsets, ids);
+  }
+
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkGeneralizedKernel::PrintSelf(ostream& os, vtkIndent indent)
 {
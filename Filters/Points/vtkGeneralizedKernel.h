@@ -78,6 +78,13 @@ public:
    */
   vtkIdType ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptId = 0) override;
 
+  /**
+   * Based on the kernel style, invoke the appropriate batched locator method
+   * to obtain the bases of all the points pts at once. See
+   * vtkInterpolationKernel::ComputeBases().
+   */
+  bool ComputeBases(vtkPoints* pts, vtkIdTypeArray* offsets, vtkIdTypeArray* ids) override;
+
   /**
    * Given a point x, a list of basis points pIds, and a probability
    * weighting function prob, compute interpolation weights associated with
@@ -69,6 +69,12 @@ void vtkInterpolationKernel::Initialize(
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkInterpolationKernel::ComputeBases(vtkPoints*, vtkIdTypeArray*, vtkIdTypeArray*)
+{
+  return false;
+}
+
 //------------------------------------------------------------------------------
 void vtkInterpolationKernel::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -45,9 +45,11 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkAbstractPointLocator;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkDoubleArray;
 class vtkDataSet;
 class vtkPointData;
+class vtkPoints;
 
 class VTKFILTERSPOINTS_EXPORT vtkInterpolationKernel : public vtkObject
 {
@@ -94,6 +96,18 @@ public:
    */
   virtual vtkIdType ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptId = 0) = 0;
 
+  /**
+   * Determine the interpolation basis of all the points pts at once, using
+   * the batched queries of the locator. The bases are returned as compressed
+   * sparse rows: the basis of the i-th point is ids[offsets[i]] to
+   * ids[offsets[i + 1] - 1] (see
+   * vtkAbstractPointLocator::FindPointsWithinRadius()). Returns false if the
+   * kernel cannot compute its bases this way, in which case ComputeBasis()
+   * must be invoked for each point instead. The default implementation
+   * returns false.
+   */
+  virtual bool ComputeBases(vtkPoints* pts, vtkIdTypeArray* offsets, vtkIdTypeArray* ids);
+
   /**
    * Given a point x, and a list of basis points pIds, compute interpolation
    * weights associated with these basis points.  Note that both the nearby
@@ -4,17 +4,23 @@
 #include "vtkPCANormalEstimation.h"
 
 #include "vtkAbstractPointLocator.h"
+#include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPCANormalEstimation);
@@ -36,46 +42,77 @@ namespace Utils
  * selected inside the radius, if SampleSize is also set to a value, the
  * code checks if at least SampleSize (K) points have been selected.
  * Otherwise, SampleSize (K) points are reselected.
+ *
+ * ReselectPoints() only performs the reselection, when the first selection
+ * is done for a whole block of points by the batched queries of the locator
+ * (see GenerateNormals::Execute()): it returns true and fills ids if the
+ * numFound points, the farthest of them at squared distance farthestDist2,
+ * must be reselected.
  */
-template <typename T>
-void FindPoints(vtkAbstractPointLocator* locator, T* inPts, double x[3], int searchMode,
-  int sampleSize, double radius, vtkIdList* ids)
+bool ReselectPoints(vtkAbstractPointLocator* locator, double x[3], int searchMode,
+  int sampleSize, double radius, vtkIdType numFound, double farthestDist2, vtkIdList* ids)
 {
   switch (searchMode)
   {
     case vtkPCANormalEstimation::RADIUS:
     {
-      locator->FindPointsWithinRadius(radius, x, ids);
       // If not enough points are found, then use K nearest neighbors
-      if (ids->GetNumberOfIds() < sampleSize)
+      if (numFound < sampleSize)
       {
         locator->FindClosestNPoints(sampleSize, x, ids);
+        return true;
       }
       break;
     }
     case vtkPCANormalEstimation::KNN:
     {
-      locator->FindClosestNPoints(sampleSize, x, ids);
-      // Retrieve the farthest point found
+      // If the points found are too densely packed, then use radius search
+      if (numFound > 0 && farthestDist2 < radius * radius)
+      {
+        locator->FindPointsWithinRadius(radius, x, ids);
+        return true;
+      }
+      break;
+    }
+  }
+  return false;
+}
+
+template <typename T>
+void FindPoints(vtkAbstractPointLocator* locator, T* inPts, double x[3], int searchMode,
+  int sampleSize, double radius, vtkIdList* ids)
+{
+  double farthestDist2 = 0.0;
+  if (searchMode == vtkPCANormalEstimation::RADIUS)
+  {
+    locator->FindPointsWithinRadius(radius, x, ids);
+  }
+  else
+  {
+    locator->FindClosestNPoints(sampleSize, x, ids);
+    // Retrieve the farthest point found
+    if (ids->GetNumberOfIds() > 0)
+    {
       double farthestPoint[3];
       const T* point = inPts + 3 * ids->GetId(ids->GetNumberOfIds() - 1);
       for (int i = 0; i < 3; ++i)
       {
         farthestPoint[i] = static_cast<double>(*point++);
       }
-
-      double squaredDistance = vtkMath::Distance2BetweenPoints(x, farthestPoint);
-      // If the points found are too densely packed, then use radius search
-      if (squaredDistance < radius * radius)
-      {
-        locator->FindPointsWithinRadius(radius, x, ids);
-      }
-      break;
+      farthestDist2 = vtkMath::Distance2BetweenPoints(x, farthestPoint);
     }
   }
+  ReselectPoints(
+    locator, x, searchMode, sampleSize, radius, ids->GetNumberOfIds(), farthestDist2, ids);
 }
+///@}
 } // Utils namespace
 
+//------------------------------------------------------------------------------
+// The neighborhoods are found by blocks of points with the batched queries of
+// the locator, to bound the memory used by the neighbor lists.
+const vtkIdType BlockSize = 262144;
+
 //------------------------------------------------------------------------------
 // The threaded core of the algorithm.
 template <typename T>
@@ -91,6 +128,12 @@ struct GenerateNormals
   double OPoint[3];
   bool Flip;
 
+  // The neighborhoods of the current block of points.
+  vtkIdType BlockStart;
+  const vtkIdType* Offsets;
+  const vtkIdType* Neighbors;
+  const double* Dist2;
+
   // Don't want to allocate working arrays on every thread invocation. Thread local
   // storage lots of new/delete.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
@@ -105,6 +148,10 @@ struct GenerateNormals
     , SearchMode(searchMode)
     , Orient(orient)
     , Flip(flip)
+    , BlockStart(0)
+    , Offsets(nullptr)
+    , Neighbors(nullptr)
+    , Dist2(nullptr)
   {
     this->OPoint[0] = opoint[0];
     this->OPoint[1] = opoint[1];
@@ -118,15 +165,17 @@ struct GenerateNormals
     pIds->Allocate(128); // allocate some memory
   }
 
-  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  void operator()(vtkIdType i, vtkIdType endI)
   {
+    vtkIdType ptId = this->BlockStart + i;
     const T* px = this->Points + 3 * ptId;
     const T* py;
     float* n = this->Normals + 3 * ptId;
-    double x[3], mean[3], o[3];
+    double x[3], mean[3], o[3], farthestDist2;
     vtkIdList*& pIds = this->PIds.Local();
+    const vtkIdType* neighbors;
     vtkIdType numPts, nei;
-    int sample, i;
+    int sample;
     double *a[3], a0[3], a1[3], a2[3], xp[3];
     a[0] = a0;
     a[1] = a1;
@@ -138,23 +187,28 @@ struct GenerateNormals
     double eVecMin[3], eVal[3];
     float flipVal = (this->Flip ? -1.0 : 1.0);
 
-    for (; ptId < endPtId; ++ptId)
+    for (; i < endI; ++i)
     {
       x[0] = static_cast<double>(*px++);
       x[1] = static_cast<double>(*px++);
       x[2] = static_cast<double>(*px++);
 
       // Retrieve the local neighborhood
-      Utils::FindPoints(
-        this->Locator, this->Points, x, this->SearchMode, this->SampleSize, this->Radius, pIds);
-
-      numPts = pIds->GetNumberOfIds();
+      neighbors = this->Neighbors + this->Offsets[i];
+      numPts = this->Offsets[i + 1] - this->Offsets[i];
+      farthestDist2 = (this->Dist2 && numPts > 0 ? this->Dist2[this->Offsets[i + 1] - 1] : 0.0);
+      if (Utils::ReselectPoints(this->Locator, x, this->SearchMode, this->SampleSize,
+            this->Radius, numPts, farthestDist2, pIds))
+      {
+        neighbors = pIds->GetPointer(0);
+        numPts = pIds->GetNumberOfIds();
+      }
 
       // First step: compute the mean position of the neighborhood.
       mean[0] = mean[1] = mean[2] = 0.0;
       for (sample = 0; sample < numPts; ++sample)
       {
-        nei = pIds->GetId(sample);
+        nei = neighbors[sample];
         py = this->Points + 3 * nei;
         mean[0] += static_cast<double>(*py++);
         mean[1] += static_cast<double>(*py++);
@@ -170,23 +224,23 @@ struct GenerateNormals
       a0[2] = a1[2] = a2[2] = 0.0;
       for (sample = 0; sample < numPts; ++sample)
       {
-        nei = pIds->GetId(sample);
+        nei = neighbors[sample];
         py = this->Points + 3 * nei;
         xp[0] = static_cast<double>(*py++) - mean[0];
         xp[1] = static_cast<double>(*py++) - mean[1];
         xp[2] = static_cast<double>(*py) - mean[2];
-        for (i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
         {
-          a0[i] += xp[0] * xp[i];
-          a1[i] += xp[1] * xp[i];
-          a2[i] += xp[2] * xp[i];
+          a0[j] += xp[0] * xp[j];
+          a1[j] += xp[1] * xp[j];
+          a2[j] += xp[2] * xp[j];
         }
       }
-      for (i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++)
       {
-        a0[i] /= static_cast<double>(numPts);
-        a1[i] /= static_cast<double>(numPts);
-        a2[i] /= static_cast<double>(numPts);
+        a0[j] /= static_cast<double>(numPts);
+        a1[j] /= static_cast<double>(numPts);
+        a2[j] /= static_cast<double>(numPts);
       }
 
       // Next extract the eigenvectors and values
@@ -221,12 +275,50 @@ struct GenerateNormals
 
   void Reduce() {}
 
-  static void Execute(vtkPCANormalEstimation* self, vtkIdType numPts, T* points, float* normals,
+  static void Execute(vtkPCANormalEstimation* self, vtkPoints* inPts, T* points, float* normals,
     int searchMode, int orient, double opoint[3], bool flip)
   {
-    GenerateNormals gen(points, self->GetLocator(), self->GetSampleSize(), self->GetRadius(),
-      normals, searchMode, orient, opoint, flip);
-    vtkSMPTools::For(0, numPts, gen);
+    vtkIdType numPts = inPts->GetNumberOfPoints();
+    vtkAbstractPointLocator* locator = self->GetLocator();
+    vtkNew<vtkIdTypeArray> offsets;
+    vtkNew<vtkIdTypeArray> neighbors;
+    vtkNew<vtkDoubleArray> dist2;
+    vtkSmartPointer<vtkPoints> block;
+    GenerateNormals gen(points, locator, self->GetSampleSize(), self->GetRadius(), normals,
+      searchMode, orient, opoint, flip);
+
+    for (vtkIdType blockStart = 0; blockStart < numPts; blockStart += BlockSize)
+    {
+      vtkIdType blockSize = std::min(BlockSize, numPts - blockStart);
+      vtkPoints* queries = inPts;
+      if (blockSize < numPts)
+      {
+        if (!block)
+        {
+          block = vtkSmartPointer<vtkPoints>::New();
+          block->SetDataType(inPts->GetDataType());
+        }
+        block->SetNumberOfPoints(blockSize);
+        block->GetData()->InsertTuples(0, blockSize, blockStart, inPts->GetData());
+        queries = block;
+      }
+
+      // First selection of the neighborhoods, see Utils::ReselectPoints()
+      if (searchMode == vtkPCANormalEstimation::RADIUS)
+      {
+        locator->FindPointsWithinRadius(gen.Radius, queries, offsets, neighbors);
+        gen.Dist2 = nullptr;
+      }
+      else
+      {
+        locator->FindClosestNPoints(gen.SampleSize, queries, offsets, neighbors, dist2);
+        gen.Dist2 = dist2->GetPointer(0);
+      }
+      gen.BlockStart = blockStart;
+      gen.Offsets = offsets->GetPointer(0);
+      gen.Neighbors = neighbors->GetPointer(0);
+      vtkSMPTools::For(0, blockSize, gen);
+    }
   }
 }; // GenerateNormals
 } // anonymous namespace
@@ -281,8 +373,8 @@ int vtkPCANormalEstimation::RequestData(vtkInformation* vtkNotUsed(request),
   void* inPtr = input->GetPoints()->GetVoidPointer(0);
   switch (input->GetPoints()->GetDataType())
   {
-    vtkTemplateMacro(GenerateNormals<VTK_TT>::Execute(this, numPts, (VTK_TT*)inPtr, n,
-      this->SearchMode, this->NormalOrientation, this->OrientationPoint, this->FlipNormals));
+    vtkTemplateMacro(GenerateNormals<VTK_TT>::Execute(this, input->GetPoints(), (VTK_TT*)inPtr,
+      n, this->SearchMode, this->NormalOrientation, this->OrientationPoint, this->FlipNormals));
   }
 
   // Orient the normals in a consistent fashion (if requested). This requires a traversal
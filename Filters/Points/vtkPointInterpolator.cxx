@@ -11,11 +11,13 @@
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLinearKernel.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
@@ -24,6 +26,7 @@
 #include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
@@ -36,6 +39,10 @@ vtkCxxSetObjectMacro(vtkPointInterpolator, Kernel, vtkInterpolationKernel);
 // Helper classes to support efficient computing, and threaded execution.
 namespace
 {
+// When the kernel computes the bases of many points at once, the points are
+// interpolated by blocks of this size to bound the memory used by the bases.
+const vtkIdType BlockSize = 262144;
+
 // The threaded core of the algorithm
 struct ProbePoints
 {
@@ -50,6 +57,12 @@ struct ProbePoints
   int Strategy;
   bool Promote;
 
+  // The bases of the current block of points, if computed by the kernel all
+  // at once (see ComputeBases()).
+  vtkIdType BlockStart;
+  const vtkIdType* Offsets;
+  const vtkIdType* Bases;
+
   // Don't want to allocate these working arrays on every thread invocation,
   // so make them thread local.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
@@ -62,6 +75,9 @@ struct ProbePoints
     , InPD(inPD)
     , OutPD(outPD)
     , Valid(valid)
+    , BlockStart(0)
+    , Offsets(nullptr)
+    , Bases(nullptr)
   {
     // Gather information from the interpolator
     this->Kernel = ptInt->GetKernel();
@@ -116,6 +132,55 @@ struct ProbePoints
     }
   }
 
+  // Retrieve the basis of a point, unless it must be computed now
+  vtkIdType ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptId)
+  {
+    if (!this->Offsets)
+    {
+      return this->Kernel->ComputeBasis(x, pIds);
+    }
+    const vtkIdType* offsets = this->Offsets + (ptId - this->BlockStart);
+    vtkIdType numIds = offsets[1] - offsets[0];
+    pIds->SetNumberOfIds(numIds);
+    std::copy_n(this->Bases + offsets[0], numIds, pIds->GetPointer(0));
+    return numIds;
+  }
+
+  // Compute the bases of a block of points with the kernel, then interpolate
+  // them. Returns false if the kernel cannot compute its bases this way.
+  bool ProbeBlocks(vtkIdType numPts)
+  {
+    vtkNew<vtkPoints> queries;
+    queries->SetDataTypeToDouble();
+    vtkNew<vtkIdTypeArray> offsets;
+    vtkNew<vtkIdTypeArray> bases;
+
+    for (vtkIdType blockStart = 0; blockStart < numPts; blockStart += BlockSize)
+    {
+      vtkIdType blockEnd = std::min(blockStart + BlockSize, numPts);
+      queries->SetNumberOfPoints(blockEnd - blockStart);
+      double* q = static_cast<double*>(queries->GetVoidPointer(0));
+      vtkSMPTools::For(blockStart, blockEnd, [&](vtkIdType ptId, vtkIdType endPtId) {
+        for (; ptId < endPtId; ++ptId)
+        {
+          this->Input->GetPoint(ptId, q + 3 * (ptId - blockStart));
+        }
+      });
+
+      if (!this->Kernel->ComputeBases(queries, offsets, bases))
+      {
+        return false;
+      }
+      this->BlockStart = blockStart;
+      this->Offsets = offsets->GetPointer(0);
+      this->Bases = bases->GetPointer(0);
+      vtkSMPTools::For(blockStart, blockEnd, *this);
+    }
+    this->Offsets = nullptr;
+    this->Bases = nullptr;
+    return true;
+  }
+
   // Threaded interpolation method
   void operator()(vtkIdType ptId, vtkIdType endPtId)
   {
@@ -128,7 +193,7 @@ struct ProbePoints
     {
       this->Input->GetPoint(ptId, x);
 
-      if (this->Kernel->ComputeBasis(x, pIds) > 0)
+      if (this->ComputeBasis(x, pIds, ptId) > 0)
       {
         numWeights = this->Kernel->ComputeWeights(x, pIds, weights);
         this->Arrays.Interpolate(numWeights, pIds->GetPointer(0), weights->GetPointer(0), ptId);
@@ -317,7 +382,9 @@ void vtkPointInterpolator::Probe(vtkDataSet* input, vtkDataSet* source, vtkDataS
     this->Kernel->Initialize(this->Locator, source, inPD);
   }
 
-  // If the input is image data then there is a faster path
+  // The kernel may compute the bases of many points at once, which is faster
+  // than computing them one by one. Otherwise if the input is image data then
+  // there is a faster path.
   vtkImageData* imgInput = vtkImageData::SafeDownCast(input);
   if (imgInput)
   {
@@ -325,12 +392,18 @@ void vtkPointInterpolator::Probe(vtkDataSet* input, vtkDataSet* source, vtkDataS
     double origin[3], spacing[3];
     this->ExtractImageDescription(imgInput, dims, origin, spacing);
     ImageProbePoints imageProbe(this, imgInput, dims, origin, spacing, inPD, outPD, mask);
-    vtkSMPTools::For(0, dims[2], imageProbe); // over slices
+    if (!imageProbe.ProbeBlocks(numPts))
+    {
+      vtkSMPTools::For(0, dims[2], imageProbe); // over slices
+    }
   }
   else
   {
     ProbePoints probe(this, input, inPD, outPD, mask);
-    vtkSMPTools::For(0, numPts, probe);
+    if (!probe.ProbeBlocks(numPts))
+    {
+      vtkSMPTools::For(0, numPts, probe);
+    }
   }
 
   // Clean up
@@ -11,10 +11,12 @@
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
@@ -26,6 +28,7 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkVoronoiKernel.h"
 
+#include <algorithm>
 #include <cassert>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -37,6 +40,10 @@ vtkCxxSetObjectMacro(vtkSPHInterpolator, Kernel, vtkSPHKernel);
 // Helper classes to support efficient computing, and threaded execution.
 namespace
 {
+// When the kernel computes the bases of many points at once, the points are
+// interpolated by blocks of this size to bound the memory used by the bases.
+const vtkIdType BlockSize = 262144;
+
 // The threaded core of the algorithm
 struct ProbePoints
 {
@@ -54,6 +61,12 @@ struct ProbePoints
   float* Shepard;
   vtkTypeBool Promote;
 
+  // The bases of the current block of points, if computed by the kernel all
+  // at once (see ComputeBases()).
+  vtkIdType BlockStart;
+  const vtkIdType* Offsets;
+  const vtkIdType* Bases;
+
   // Don't want to allocate these working arrays on every thread invocation,
   // so make them thread local.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
@@ -68,6 +81,9 @@ struct ProbePoints
     , OutPD(outPD)
     , Valid(valid)
     , Shepard(shepCoef)
+    , BlockStart(0)
+    , Offsets(nullptr)
+    , Bases(nullptr)
   {
     // Gather information from the interpolator
     this->Kernel = sphInt->GetKernel();
@@ -120,6 +136,55 @@ struct ProbePoints
     gradWeights->Allocate(128);
   }
 
+  // Retrieve the basis of a point, unless it must be computed now
+  vtkIdType ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptId)
+  {
+    if (!this->Offsets)
+    {
+      return this->Kernel->ComputeBasis(x, pIds, ptId);
+    }
+    const vtkIdType* offsets = this->Offsets + (ptId - this->BlockStart);
+    vtkIdType numIds = offsets[1] - offsets[0];
+    pIds->SetNumberOfIds(numIds);
+    std::copy_n(this->Bases + offsets[0], numIds, pIds->GetPointer(0));
+    return numIds;
+  }
+
+  // Compute the bases of a block of points with the kernel, then interpolate
+  // them. Returns false if the kernel cannot compute its bases this way.
+  bool ProbeBlocks(vtkIdType numPts)
+  {
+    vtkNew<vtkPoints> queries;
+    queries->SetDataTypeToDouble();
+    vtkNew<vtkIdTypeArray> offsets;
+    vtkNew<vtkIdTypeArray> bases;
+
+    for (vtkIdType blockStart = 0; blockStart < numPts; blockStart += BlockSize)
+    {
+      vtkIdType blockEnd = std::min(blockStart + BlockSize, numPts);
+      queries->SetNumberOfPoints(blockEnd - blockStart);
+      double* q = static_cast<double*>(queries->GetVoidPointer(0));
+      vtkSMPTools::For(blockStart, blockEnd, [&](vtkIdType ptId, vtkIdType endPtId) {
+        for (; ptId < endPtId; ++ptId)
+        {
+          this->Input->GetPoint(ptId, q + 3 * (ptId - blockStart));
+        }
+      });
+
+      if (!this->Kernel->ComputeBases(queries, offsets, bases))
+      {
+        return false;
+      }
+      this->BlockStart = blockStart;
+      this->Offsets = offsets->GetPointer(0);
+      this->Bases = bases->GetPointer(0);
+      vtkSMPTools::For(blockStart, blockEnd, *this);
+    }
+    this->Offsets = nullptr;
+    this->Bases = nullptr;
+    return true;
+  }
+
   // Threaded interpolation method
   void operator()(vtkIdType ptId, vtkIdType endPtId)
   {
@@ -133,7 +198,7 @@ struct ProbePoints
     {
       this->Input->GetPoint(ptId, x);
 
-      if ((numWeights = this->Kernel->ComputeBasis(x, pIds, ptId)) > 0)
+      if ((numWeights = this->ComputeBasis(x, pIds, ptId)) > 0)
       {
         if (!this->ComputeDerivArrays)
         {
@@ -356,8 +421,12 @@ void vtkSPHInterpolator::Probe(vtkDataSet* input, vtkDataSet* source, vtkDataSet
   }
 
   // Now loop over input points, finding closest points and invoking kernel.
+  // The kernel computes the bases of blocks of points at once if it can.
   ProbePoints probe(this, input, sourcePD, outPD, mask, shepardArray);
-  vtkSMPTools::For(0, numPts, probe);
+  if (!probe.ProbeBlocks(numPts))
+  {
+    vtkSMPTools::For(0, numPts, probe);
+  }
 
   // If Shepard normalization requested, normalize all arrays except density
   // array.
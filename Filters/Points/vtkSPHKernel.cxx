@@ -75,6 +75,18 @@ vtkIdType vtkSPHKernel::ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptI
   return pIds->GetNumberOfIds();
 }
 
+//------------------------------------------------------------------------------
+bool vtkSPHKernel::ComputeBases(vtkPoints* pts, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  if (this->UseCutoffArray)
+  {
+    return false;
+  }
+
+  this->Locator->FindPointsWithinRadius(this->Cutoff, pts, offsets, ids);
+  return true;
+}
+
 //------------------------------------------------------------------------------
 vtkIdType vtkSPHKernel::ComputeWeights(double x[3], vtkIdList* pIds, vtkDoubleArray* weights)
 {
@@ -133,6 +133,13 @@ public:
    */
   vtkIdType ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptId = 0) override;
 
+  /**
+   * Determine the bases of all the points pts at once with the batched
+   * queries of the locator. Returns false if a cutoff array is used, since
+   * the cutoff then varies from point to point.
+   */
+  bool ComputeBases(vtkPoints* pts, vtkIdTypeArray* offsets, vtkIdTypeArray* ids) override;
+
   /**
    * Given a point x, and a list of basis points pIds, compute interpolation
    * weights associated with these basis points.
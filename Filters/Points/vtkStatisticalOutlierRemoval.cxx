@@ -3,15 +3,19 @@
 #include "vtkStatisticalOutlierRemoval.h"
 
 #include "vtkAbstractPointLocator.h"
-#include "vtkIdList.h"
-#include "vtkMath.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
-#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStaticPointLocator.h"
 
+#include <algorithm>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkStatisticalOutlierRemoval);
 vtkCxxSetObjectMacro(vtkStatisticalOutlierRemoval, Locator, vtkAbstractPointLocator);
@@ -21,79 +25,58 @@ vtkCxxSetObjectMacro(vtkStatisticalOutlierRemoval, Locator, vtkAbstractPointLoca
 namespace
 {
 
+//------------------------------------------------------------------------------
+// The neighbors of the points are found by blocks with the batched queries of
+// the locator, to bound the memory used by the neighbor lists.
+const vtkIdType BlockSize = 262144;
+
 //------------------------------------------------------------------------------
 // The threaded core of the algorithm (first pass)
-template <typename T>
 struct ComputeMeanDistance
 {
-  const T* Points;
-  vtkAbstractPointLocator* Locator;
-  int SampleSize;
+  vtkIdType BlockStart;
+  const vtkIdType* Offsets;
+  const vtkIdType* Neighbors;
+  const double* Dist2;
   float* Distance;
   double Mean;
 
-  // Don't want to allocate working arrays on every thread invocation. Thread local
-  // storage lots of new/delete.
-  vtkSMPThreadLocalObject<vtkIdList> PIds;
   vtkSMPThreadLocal<double> ThreadMean;
   vtkSMPThreadLocal<vtkIdType> ThreadCount;
 
-  ComputeMeanDistance(T* points, vtkAbstractPointLocator* loc, int size, float* d)
-    : Points(points)
-    , Locator(loc)
-    , SampleSize(size)
+  // The thread local sums are accumulated over all the blocks, so they are
+  // initialized at construction rather than in an Initialize() method.
+  ComputeMeanDistance(float* d)
+    : BlockStart(0)
+    , Offsets(nullptr)
+    , Neighbors(nullptr)
+    , Dist2(nullptr)
     , Distance(d)
     , Mean(0.0)
+    , ThreadMean(0.0)
+    , ThreadCount(0)
   {
   }
 
-  // Just allocate a little bit of memory to get started.
-  void Initialize()
+  // Compute average distance for each point of the block, plus accumulate
+  // summation of mean distances and count (for averaging in the Reduce()
+  // method).
+  void operator()(vtkIdType i, vtkIdType endI)
   {
-    vtkIdList*& pIds = this->PIds.Local();
-    pIds->Allocate(128); // allocate some memory
-
     double& threadMean = this->ThreadMean.Local();
-    threadMean = 0.0;
-
     vtkIdType& threadCount = this->ThreadCount.Local();
-    threadCount = 0;
-  }
 
-  // Compute average distance for each point, plus accumulate summation of
-  // mean distances and count (for averaging in the Reduce() method).
-  void operator()(vtkIdType ptId, vtkIdType endPtId)
-  {
-    const T* px = this->Points + 3 * ptId;
-    const T* py;
-    double x[3], y[3];
-    vtkIdList*& pIds = this->PIds.Local();
-    double& threadMean = this->ThreadMean.Local();
-    vtkIdType& threadCount = this->ThreadCount.Local();
-
-    for (; ptId < endPtId; ++ptId)
+    for (; i < endI; ++i)
     {
-      x[0] = static_cast<double>(*px++);
-      x[1] = static_cast<double>(*px++);
-      x[2] = static_cast<double>(*px++);
-
-      // The method FindClosestNPoints will include the current point, so
-      // we increase the sample size by one.
-      this->Locator->FindClosestNPoints(this->SampleSize + 1, x, pIds);
-      vtkIdType numPts = pIds->GetNumberOfIds();
+      vtkIdType ptId = this->BlockStart + i;
+      vtkIdType numPts = this->Offsets[i + 1] - this->Offsets[i];
 
       double sum = 0.0;
-      vtkIdType nei;
-      for (int sample = 0; sample < numPts; ++sample)
+      for (vtkIdType j = this->Offsets[i]; j < this->Offsets[i + 1]; ++j)
       {
-        nei = pIds->GetId(sample);
-        if (nei != ptId) // exclude ourselves
+        if (this->Neighbors[j] != ptId) // exclude ourselves
         {
-          py = this->Points + 3 * nei;
-          y[0] = static_cast<double>(*py++);
-          y[1] = static_cast<double>(*py++);
-          y[2] = static_cast<double>(*py);
-          sum += sqrt(vtkMath::Distance2BetweenPoints(x, y));
+          sum += sqrt(this->Dist2[j]);
         }
       } // sum the lengths of all samples exclusing current point
 
@@ -111,7 +94,7 @@ struct ComputeMeanDistance
     }
   }
 
-  // Compute the mean by compositing all threads
+  // Compute the mean by compositing all threads, once all blocks are done
   void Reduce()
   {
     double mean = 0.0;
@@ -136,10 +119,43 @@ struct ComputeMeanDistance
   }
 
   static void Execute(
-    vtkStatisticalOutlierRemoval* self, vtkIdType numPts, T* points, float* distances, double& mean)
+    vtkStatisticalOutlierRemoval* self, vtkPoints* points, float* distances, double& mean)
   {
-    ComputeMeanDistance compute(points, self->GetLocator(), self->GetSampleSize(), distances);
-    vtkSMPTools::For(0, numPts, compute);
+    vtkIdType numPts = points->GetNumberOfPoints();
+    vtkAbstractPointLocator* locator = self->GetLocator();
+    vtkNew<vtkIdTypeArray> offsets;
+    vtkNew<vtkIdTypeArray> neighbors;
+    vtkNew<vtkDoubleArray> dist2;
+    vtkSmartPointer<vtkPoints> block;
+    ComputeMeanDistance compute(distances);
+
+    for (vtkIdType blockStart = 0; blockStart < numPts; blockStart += BlockSize)
+    {
+      vtkIdType blockSize = std::min(BlockSize, numPts - blockStart);
+      vtkPoints* queries = points;
+      if (blockSize < numPts)
+      {
+        if (!block)
+        {
+          block = vtkSmartPointer<vtkPoints>::New();
+          block->SetDataType(points->GetDataType());
+        }
+        block->SetNumberOfPoints(blockSize);
+        block->GetData()->InsertTuples(0, blockSize, blockStart, points->GetData());
+        queries = block;
+      }
+
+      // The method FindClosestNPoints will include the current point, so
+      // we increase the sample size by one.
+      locator->FindClosestNPoints(self->GetSampleSize() + 1, queries, offsets, neighbors, dist2);
+      compute.BlockStart = blockStart;
+      compute.Offsets = offsets->GetPointer(0);
+      compute.Neighbors = neighbors->GetPointer(0);
+      compute.Dist2 = dist2->GetPointer(0);
+      vtkSMPTools::For(0, blockSize, compute);
+    }
+
+    compute.Reduce();
     mean = compute.Mean;
   }
 
@@ -300,13 +316,8 @@ int vtkStatisticalOutlierRemoval::FilterPoints(vtkPointSet* input)
   // mean distance to N closest neighbors.
   vtkIdType numPts = input->GetNumberOfPoints();
   float* dist = new float[numPts];
-  void* inPtr = input->GetPoints()->GetVoidPointer(0);
   double mean = 0.0, sigma = 0.0;
-  switch (input->GetPoints()->GetDataType())
-  {
-    vtkTemplateMacro(
-      ComputeMeanDistance<VTK_TT>::Execute(this, numPts, (VTK_TT*)inPtr, dist, mean));
-  }
+  ComputeMeanDistance::Execute(this, input->GetPoints(), dist, mean);
 
   // At this point the mean distance for each point, and across the point
   // cloud is known. Now compute global standard deviation.
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkToCompressedArrayStrategy.h"
+
+#include "vtkCompressedArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cstdlib>
+
+int TestToCompressedArrayStrategy(int, char*[])
+{
+  vtkNew<vtkDoubleArray> base;
+  base->SetNumberOfComponents(3);
+  base->SetNumberOfTuples(100000);
+  auto range = vtk::DataArrayValueRange<3>(base);
+  vtkIdType idx = 0;
+  for (auto& value : range)
+  {
+    value = static_cast<double>((idx++ / 7) % 100);
+  }
+
+  vtkNew<vtkToCompressedArrayStrategy> strat;
+  strat->SetTuplesPerChunk(1000);
+  strat->SetMaximumNumberOfCachedChunks(4);
+  auto opt = strat->EstimateReduction(base);
+
+  if (!opt.IsSome)
+  {
+    std::cout << "Could not compress array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (opt.Value <= 0 || opt.Value >= 0.5)
+  {
+    std::cout << "Did not evaluate reduction factor correctly: " << opt.Value << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkDataArray> result = strat->Reduce(base);
+
+  if (!result)
+  {
+    std::cout << "Result of reduction is nullptr" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkCompressedArray<double>> compressed =
+    vtkArrayDownCast<vtkCompressedArray<double>>(result);
+
+  if (!compressed)
+  {
+    std::cout << "Could not cast result to compressed array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (compressed->GetNumberOfComponents() != base->GetNumberOfComponents() ||
+    compressed->GetNumberOfTuples() != base->GetNumberOfTuples())
+  {
+    std::cout << "Dimensions not agreeing with base array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (compressed->GetBackend()->GetNumberOfChunks() != 100)
+  {
+    std::cout << "Unexpected number of chunks" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Sequential access
+  auto compRange = vtk::DataArrayValueRange<3>(compressed);
+  auto itComp = compRange.begin();
+  for (auto itBase = range.begin(); itBase != range.end(); ++itBase, ++itComp)
+  {
+    if (*itBase != *itComp)
+    {
+      std::cout << "Base and compressed values don't match up" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Concurrent strided access, evicting chunks from the cache
+  std::atomic<bool> match(true);
+  vtkSMPTools::For(0, base->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+    double tuple[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType tupleId = (i * 7919) % base->GetNumberOfTuples();
+      compressed->GetTypedTuple(tupleId, tuple);
+      for (int c = 0; c < 3; ++c)
+      {
+        if (tuple[c] != base->GetTypedComponent(tupleId, c))
+        {
+          match = false;
+        }
+      }
+    }
+  });
+  if (!match)
+  {
+    std::cout << "Concurrent access returned wrong values" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (compressed->GetActualMemorySize() >= base->GetActualMemorySize())
+  {
+    std::cout << "Compressed array is not smaller than the base array" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkToCompressedArrayStrategy.h"
+
+#include "vtkCompressedArray.h"
+#include "vtkLZ4DataCompressor.h"
+#include "vtkLZMADataCompressor.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkZLibDataCompressor.h"
+
+namespace
+{
+template <typename ValueType>
+vtkSmartPointer<vtkDataArray> Compress(vtkDataArray* arr, vtkDataCompressor* compressor,
+  vtkIdType tuplesPerChunk, int maximumNumberOfCachedChunks, std::size_t& compressedSize)
+{
+  auto backend = std::make_shared<vtkCompressedImplicitBackend<ValueType>>(
+    arr, compressor, tuplesPerChunk, static_cast<std::size_t>(maximumNumberOfCachedChunks));
+  compressedSize = backend->GetCompressedSize();
+  vtkNew<vtkCompressedArray<ValueType>> compressed;
+  compressed->SetBackend(backend);
+  compressed->SetNumberOfComponents(arr->GetNumberOfComponents());
+  compressed->SetNumberOfTuples(arr->GetNumberOfTuples());
+  compressed->SetName(arr->GetName());
+  return compressed;
+}
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//-------------------------------------------------------------------------
+struct vtkToCompressedArrayStrategy::vtkInternals
+{
+  vtkSmartPointer<vtkDataArray> CachedArray;
+  vtkMTimeType ArrayMTimeAtCaching = 0;
+  vtkSmartPointer<vtkDataArray> Compressed;
+  std::size_t CompressedSize = 0;
+
+  void ClearCache()
+  {
+    this->CachedArray = nullptr;
+    this->ArrayMTimeAtCaching = 0;
+    this->Compressed = nullptr;
+    this->CompressedSize = 0;
+  }
+};
+
+//-------------------------------------------------------------------------
+vtkObjectFactoryNewMacro(vtkToCompressedArrayStrategy);
+
+//-------------------------------------------------------------------------
+vtkToCompressedArrayStrategy::vtkToCompressedArrayStrategy()
+  : Internals(new vtkInternals())
+{
+}
+
+//-------------------------------------------------------------------------
+vtkToCompressedArrayStrategy::~vtkToCompressedArrayStrategy() = default;
+
+//-------------------------------------------------------------------------
+void vtkToCompressedArrayStrategy::PrintSelf(std::ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CompressorType: " << this->CompressorType << std::endl;
+  os << indent << "CompressionLevel: " << this->CompressionLevel << std::endl;
+  os << indent << "TuplesPerChunk: " << this->TuplesPerChunk << std::endl;
+  os << indent << "MaximumNumberOfCachedChunks: " << this->MaximumNumberOfCachedChunks
+     << std::endl;
+}
+
+//-------------------------------------------------------------------------
+void vtkToCompressedArrayStrategy::ClearCache()
+{
+  this->Internals->ClearCache();
+}
+
+//-------------------------------------------------------------------------
+vtkToImplicitStrategy::Optional vtkToCompressedArrayStrategy::EstimateReduction(
+  vtkDataArray* arr)
+{
+  this->ClearCache();
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to compressed array.");
+    return vtkToImplicitStrategy::Optional();
+  }
+  vtkIdType nVals = arr->GetNumberOfValues();
+  if (!nVals)
+  {
+    return vtkToImplicitStrategy::Optional();
+  }
+
+  vtkSmartPointer<vtkDataCompressor> compressor;
+  switch (this->CompressorType)
+  {
+    case ZLIB:
+      compressor = vtkSmartPointer<vtkZLibDataCompressor>::New();
+      break;
+    case LZMA:
+      compressor = vtkSmartPointer<vtkLZMADataCompressor>::New();
+      break;
+    case LZ4:
+    default:
+      compressor = vtkSmartPointer<vtkLZ4DataCompressor>::New();
+      break;
+  }
+  compressor->SetCompressionLevel(this->CompressionLevel);
+
+  vtkSmartPointer<vtkDataArray> compressed;
+  std::size_t compressedSize = 0;
+  switch (arr->GetDataType())
+  {
+    vtkTemplateMacro(compressed = ::Compress<VTK_TT>(arr, compressor, this->TuplesPerChunk,
+                       this->MaximumNumberOfCachedChunks, compressedSize));
+    default:
+      return vtkToImplicitStrategy::Optional();
+  }
+
+  this->Internals->CachedArray = arr;
+  this->Internals->ArrayMTimeAtCaching = arr->GetMTime();
+  this->Internals->Compressed = compressed;
+  this->Internals->CompressedSize = compressedSize;
+  return vtkToImplicitStrategy::Optional(
+    static_cast<double>(compressedSize) / (nVals * arr->GetDataTypeSize()));
+}
+
+//-------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkToCompressedArrayStrategy::Reduce(vtkDataArray* arr)
+{
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to compressed array.");
+    return nullptr;
+  }
+  if (!this->Internals->Compressed || arr != this->Internals->CachedArray ||
+    this->Internals->ArrayMTimeAtCaching < arr->GetMTime())
+  {
+    if (!this->EstimateReduction(arr).IsSome)
+    {
+      return nullptr;
+    }
+  }
+  vtkSmartPointer<vtkDataArray> res = this->Internals->Compressed;
+  this->ClearCache();
+  return res;
+}
+VTK_ABI_NAMESPACE_END
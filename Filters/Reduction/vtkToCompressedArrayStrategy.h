@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkToCompressedArrayStrategy_h
+#define vtkToCompressedArrayStrategy_h
+
+#include "vtkFiltersReductionModule.h" // for export
+#include "vtkToImplicitStrategy.h"
+
+#include <memory>
+
+VTK_ABI_NAMESPACE_BEGIN
+/**
+ * @class vtkToCompressedArrayStrategy
+ *
+ * Strategy to transform an explicit array into a `vtkCompressedArray`, whose values are stored as
+ * chunks of tuples compressed independently and decompressed on access. Unlike the other
+ * strategies it applies to any array and is lossless: the reduction is the ratio between the
+ * compressed size and the size of the explicit array, so the Tolerance is not used.
+ *
+ * Estimating the reduction compresses the array, the result is kept until `ClearCache` is called
+ * so that `Reduce` does not compress it again.
+ *
+ * @sa
+ * vtkToImplicitStrategy vtkToImplicitArrayFilter vtkCompressedArray vtkCompressedImplicitBackend
+ */
+class VTKFILTERSREDUCTION_EXPORT vtkToCompressedArrayStrategy final : public vtkToImplicitStrategy
+{
+public:
+  static vtkToCompressedArrayStrategy* New();
+  vtkTypeMacro(vtkToCompressedArrayStrategy, vtkToImplicitStrategy);
+  void PrintSelf(std::ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Implements parent API
+   */
+  vtkToImplicitStrategy::Optional EstimateReduction(vtkDataArray*) override;
+  vtkSmartPointer<vtkDataArray> Reduce(vtkDataArray*) override;
+  ///@}
+
+  /**
+   * Destroys the compressed version of the last array passed to `EstimateReduction`
+   */
+  void ClearCache() override;
+
+  enum CompressorType
+  {
+    ZLIB,
+    LZ4,
+    LZMA
+  };
+
+  ///@{
+  /**
+   * Getter/Setter for the compressor used for the chunks (LZ4 by default).
+   */
+  vtkSetClampMacro(CompressorType, int, ZLIB, LZMA);
+  vtkGetMacro(CompressorType, int);
+  void SetCompressorTypeToLZ4() { this->SetCompressorType(LZ4); }
+  void SetCompressorTypeToZLib() { this->SetCompressorType(ZLIB); }
+  void SetCompressorTypeToLZMA() { this->SetCompressorType(LZMA); }
+  ///@}
+
+  ///@{
+  /**
+   * Getter/Setter for the compression level, from 1 (fastest) to 9 (best compression).
+   *
+   * Default value: 5
+   */
+  vtkSetClampMacro(CompressionLevel, int, 1, 9);
+  vtkGetMacro(CompressionLevel, int);
+  ///@}
+
+  ///@{
+  /**
+   * Getter/Setter for the number of tuples of each compressed chunk. Larger chunks compress
+   * better but random accesses decompress more values.
+   *
+   * Default value: 16384
+   */
+  vtkSetClampMacro(TuplesPerChunk, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(TuplesPerChunk, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Getter/Setter for the maximum number of chunks a compressed array keeps decompressed.
+   *
+   * Default value: 16
+   */
+  vtkSetClampMacro(MaximumNumberOfCachedChunks, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfCachedChunks, int);
+  ///@}
+
+protected:
+  vtkToCompressedArrayStrategy();
+  ~vtkToCompressedArrayStrategy() override;
+
+  int CompressorType = LZ4;
+  int CompressionLevel = 5;
+  vtkIdType TuplesPerChunk = 16384;
+  int MaximumNumberOfCachedChunks = 16;
+
+private:
+  vtkToCompressedArrayStrategy(const vtkToCompressedArrayStrategy&) = delete;
+  void operator=(const vtkToCompressedArrayStrategy&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkToCompressedArrayStrategy_h
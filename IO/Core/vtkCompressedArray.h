@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedArray_h
+#define vtkCompressedArray_h
+
+#include "vtkCompressedImplicitBackend.h" // for the array backend
+#include "vtkImplicitArray.h"
+
+/**
+ * \var vtkCompressedArray
+ * \brief A utility alias for an array storing its values as compressed chunks
+ *
+ * The values are decompressed on access, a chunk at a time, into a cache of recently used chunks.
+ * This allows filters to process arrays whose explicit form would not fit in memory.
+ *
+ * An example of potential usage:
+ * ```
+ * vtkNew<vtkLZ4DataCompressor> compressor;
+ * vtkNew<vtkCompressedArray<double>> compressed;
+ * compressed->SetBackend(std::make_shared<vtkCompressedImplicitBackend<double>>(
+ *   explicitArray, compressor, 4096, 32));
+ * compressed->SetNumberOfComponents(explicitArray->GetNumberOfComponents());
+ * compressed->SetNumberOfTuples(explicitArray->GetNumberOfTuples());
+ * ```
+ *
+ * @sa
+ * vtkImplicitArray vtkCompressedImplicitBackend
+ */
+VTK_ABI_NAMESPACE_BEGIN
+template <typename T>
+using vtkCompressedArray = vtkImplicitArray<vtkCompressedImplicitBackend<T>>;
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedArray_h
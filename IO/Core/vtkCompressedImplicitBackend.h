@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedImplicitBackend_h
+#define vtkCompressedImplicitBackend_h
+
+/**
+ * \class vtkCompressedImplicitBackend
+ *
+ * A backend for the `vtkImplicitArray` framework storing the values of an array as chunks of
+ * tuples compressed independently with a `vtkDataCompressor` (LZ4, zlib or LZMA).
+ *
+ * Accessing a value decompresses the chunk holding it into a cache of the most recently used
+ * chunks, so that walking through the array decompresses each chunk once. The number of tuples
+ * per chunk and the number of cached chunks set the trade-off between memory and CPU usage: the
+ * memory used by the array is the compressed size plus the size of the cached chunks. Chunks
+ * that do not compress are stored as is.
+ *
+ * The values can be accessed concurrently from several threads, e.g. from a `vtkSMPTools::For`:
+ * the cache is split in independently locked shards and chunks are decompressed outside of the
+ * locks. The chunks are compressed in parallel at construction. The compressor must then support
+ * concurrent calls, which is the case of the compressors of VTK, and must not be modified while
+ * the backend uses it.
+ *
+ * An example of potential usage in a `vtkImplicitArray`:
+ * ```
+ * vtkNew<vtkLZ4DataCompressor> compressor;
+ * vtkNew<vtkImplicitArray<vtkCompressedImplicitBackend<float>>> compressed; // More compact with
+ *                                                                           // `vtkCompressedArray`
+ * compressed->SetBackend(
+ *   std::make_shared<vtkCompressedImplicitBackend<float>>(explicitArray, compressor));
+ * compressed->SetNumberOfComponents(explicitArray->GetNumberOfComponents());
+ * compressed->SetNumberOfTuples(explicitArray->GetNumberOfTuples());
+ * CHECK(compressed->GetValue(42) == explicitArray->GetValue(42));
+ * ```
+ *
+ * @sa
+ * vtkImplicitArray, vtkCompressedArray, vtkDataCompressor
+ */
+
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDataCompressor.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename ValueType>
+class vtkCompressedImplicitBackend final
+{
+public:
+  /**
+   * Compress the values of @a array in chunks of @a tuplesPerChunk tuples with @a compressor.
+   * At most @a maximumNumberOfCachedChunks chunks are kept decompressed at a time.
+   */
+  vtkCompressedImplicitBackend(vtkDataArray* array, vtkDataCompressor* compressor,
+    vtkIdType tuplesPerChunk = 16384, std::size_t maximumNumberOfCachedChunks = 16);
+
+  /**
+   * Indexing operation for the compressed array respecting the backend expectations of
+   * `vtkImplicitArray`
+   */
+  ValueType operator()(vtkIdType idx) const
+  {
+    const vtkIdType chunkId = idx / this->ValuesPerChunk;
+    ChunkPointer chunk = this->GetChunk(chunkId);
+    return (*chunk)[idx - chunkId * this->ValuesPerChunk];
+  }
+
+  /**
+   * Copy the tuple at @a tupleId, decompressing at most one chunk.
+   */
+  void mapTuple(vtkIdType tupleId, ValueType* tuple) const
+  {
+    const vtkIdType chunkId = tupleId / this->TuplesPerChunk;
+    ChunkPointer chunk = this->GetChunk(chunkId);
+    const ValueType* values =
+      chunk->data() + (tupleId - chunkId * this->TuplesPerChunk) * this->NumberOfComponents;
+    std::copy(values, values + this->NumberOfComponents, tuple);
+  }
+
+  /**
+   * Returns the smallest integer memory size in KiB needed to store the compressed chunks and
+   * the cached ones.
+   */
+  unsigned long getMemorySize() const
+  {
+    std::size_t cached = 0;
+    for (const Shard& shard : this->Shards)
+    {
+      std::lock_guard<std::mutex> lock(shard.Mutex);
+      cached += shard.Chunks.size();
+    }
+    std::size_t bytes = this->GetCompressedSize() +
+      cached * static_cast<std::size_t>(this->ValuesPerChunk) * sizeof(ValueType);
+    return static_cast<unsigned long>((bytes + 1023) / 1024);
+  }
+
+  ///@{
+  /**
+   * Information about the chunks.
+   */
+  vtkIdType GetTuplesPerChunk() const { return this->TuplesPerChunk; }
+  vtkIdType GetNumberOfChunks() const { return static_cast<vtkIdType>(this->Compressed.size()); }
+  std::size_t GetMaximumNumberOfCachedChunks() const { return this->MaximumNumberOfCachedChunks; }
+  ///@}
+
+  /**
+   * Return the size in bytes of the compressed chunks.
+   */
+  std::size_t GetCompressedSize() const
+  {
+    std::size_t size = 0;
+    for (const CompressedChunk& chunk : this->Compressed)
+    {
+      size += chunk.Data.size();
+    }
+    return size;
+  }
+
+private:
+  using ChunkPointer = std::shared_ptr<const std::vector<ValueType>>;
+
+  struct CompressedChunk
+  {
+    std::vector<unsigned char> Data;
+    // Number of values, the last chunk may be shorter.
+    vtkIdType NumberOfValues = 0;
+    bool IsCompressed = false;
+  };
+
+  struct Shard
+  {
+    mutable std::mutex Mutex;
+    // Most recently used first.
+    std::list<std::pair<vtkIdType, ChunkPointer>> Chunks;
+  };
+
+  struct CopyValues
+  {
+    template <typename ArrayT>
+    void operator()(ArrayT* array, vtkIdType begin, vtkIdType end, ValueType* values) const
+    {
+      auto range = vtk::DataArrayValueRange(array, begin, end);
+      for (auto value : range)
+      {
+        *values++ = static_cast<ValueType>(value);
+      }
+    }
+  };
+
+  ChunkPointer GetChunk(vtkIdType chunkId) const;
+  ChunkPointer Decompress(vtkIdType chunkId) const;
+
+  vtkSmartPointer<vtkDataCompressor> Compressor;
+  std::vector<CompressedChunk> Compressed;
+  vtkIdType NumberOfComponents = 1;
+  vtkIdType TuplesPerChunk = 1;
+  vtkIdType ValuesPerChunk = 1;
+  std::size_t MaximumNumberOfCachedChunks = 1;
+  std::size_t ChunksPerShard = 1;
+  mutable std::vector<Shard> Shards;
+};
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::vtkCompressedImplicitBackend(vtkDataArray* array,
+  vtkDataCompressor* compressor, vtkIdType tuplesPerChunk, std::size_t maximumNumberOfCachedChunks)
+  : Compressor(compressor)
+  , NumberOfComponents(std::max(array->GetNumberOfComponents(), 1))
+  , TuplesPerChunk(std::max<vtkIdType>(tuplesPerChunk, 1))
+  , MaximumNumberOfCachedChunks(std::max<std::size_t>(maximumNumberOfCachedChunks, 1))
+{
+  this->ValuesPerChunk = this->TuplesPerChunk * this->NumberOfComponents;
+
+  // Chunks are spread over the shards by index, so that neighbor chunks do not contend.
+  const std::size_t numberOfShards = std::min<std::size_t>(this->MaximumNumberOfCachedChunks, 8);
+  this->ChunksPerShard = (this->MaximumNumberOfCachedChunks + numberOfShards - 1) / numberOfShards;
+  this->Shards = std::vector<Shard>(numberOfShards);
+
+  const vtkIdType numberOfValues = array->GetNumberOfValues();
+  const vtkIdType numberOfChunks =
+    (numberOfValues + this->ValuesPerChunk - 1) / this->ValuesPerChunk;
+  this->Compressed.resize(static_cast<std::size_t>(numberOfChunks));
+
+  vtkSMPTools::For(0, numberOfChunks, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<ValueType> values;
+    for (vtkIdType chunkId = begin; chunkId < end; ++chunkId)
+    {
+      const vtkIdType first = chunkId * this->ValuesPerChunk;
+      const vtkIdType last = std::min(first + this->ValuesPerChunk, numberOfValues);
+      values.resize(static_cast<std::size_t>(last - first));
+      CopyValues worker;
+      if (!vtkArrayDispatch::Dispatch::Execute(array, worker, first, last, values.data()))
+      {
+        worker(array, first, last, values.data());
+      }
+
+      CompressedChunk& chunk = this->Compressed[chunkId];
+      chunk.NumberOfValues = last - first;
+      const auto data = reinterpret_cast<const unsigned char*>(values.data());
+      const std::size_t size = values.size() * sizeof(ValueType);
+      if (this->Compressor)
+      {
+        chunk.Data.resize(this->Compressor->GetMaximumCompressionSpace(size));
+        const std::size_t compressedSize =
+          this->Compressor->Compress(data, size, chunk.Data.data(), chunk.Data.size());
+        if (compressedSize > 0 && compressedSize < size)
+        {
+          chunk.Data.resize(compressedSize);
+          chunk.Data.shrink_to_fit();
+          chunk.IsCompressed = true;
+          continue;
+        }
+      }
+      // Store the chunk as is when it does not compress.
+      chunk.Data.assign(data, data + size);
+      chunk.IsCompressed = false;
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+typename vtkCompressedImplicitBackend<ValueType>::ChunkPointer
+vtkCompressedImplicitBackend<ValueType>::GetChunk(vtkIdType chunkId) const
+{
+  Shard& shard = this->Shards[static_cast<std::size_t>(chunkId) % this->Shards.size()];
+  {
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = std::find_if(shard.Chunks.begin(), shard.Chunks.end(),
+      [chunkId](const std::pair<vtkIdType, ChunkPointer>& cached) {
+        return cached.first == chunkId;
+      });
+    if (it != shard.Chunks.end())
+    {
+      if (it != shard.Chunks.begin())
+      {
+        shard.Chunks.splice(shard.Chunks.begin(), shard.Chunks, it);
+      }
+      return shard.Chunks.front().second;
+    }
+  }
+
+  // Decompress without holding the lock so that other threads can use the shard meanwhile.
+  ChunkPointer chunk = this->Decompress(chunkId);
+
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto it = std::find_if(shard.Chunks.begin(), shard.Chunks.end(),
+    [chunkId](const std::pair<vtkIdType, ChunkPointer>& cached) {
+      return cached.first == chunkId;
+    });
+  if (it != shard.Chunks.end())
+  {
+    // Another thread decompressed it first.
+    return it->second;
+  }
+  shard.Chunks.emplace_front(chunkId, chunk);
+  if (shard.Chunks.size() > this->ChunksPerShard)
+  {
+    shard.Chunks.pop_back();
+  }
+  return chunk;
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+typename vtkCompressedImplicitBackend<ValueType>::ChunkPointer
+vtkCompressedImplicitBackend<ValueType>::Decompress(vtkIdType chunkId) const
+{
+  const CompressedChunk& compressed = this->Compressed[chunkId];
+  auto chunk = std::make_shared<std::vector<ValueType>>(
+    static_cast<std::size_t>(compressed.NumberOfValues));
+  auto data = reinterpret_cast<unsigned char*>(chunk->data());
+  const std::size_t size = chunk->size() * sizeof(ValueType);
+  if (!compressed.IsCompressed)
+  {
+    std::copy(compressed.Data.begin(), compressed.Data.end(), data);
+  }
+  else if (this->Compressor->Uncompress(
+             compressed.Data.data(), compressed.Data.size(), data, size) != size)
+  {
+    vtkErrorWithObjectMacro(this->Compressor, "Cannot decompress chunk " << chunkId << ".");
+  }
+  return chunk;
+}
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedImplicitBackend_h
@@ -378,6 +378,7 @@ void vtkHDFReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Step: " << this->Step << "\n";
   os << indent << "TimeValue: " << this->TimeValue << "\n";
   os << indent << "TimeRange: " << this->TimeRange[0] << " - " << this->TimeRange[1] << "\n";
+  os << indent << "MemoryMapArrays: " << (this->MemoryMapArrays ? "true" : "false") << "\n";
 }
 
 //----------------------------------------------------------------------------
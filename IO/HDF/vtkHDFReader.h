@@ -168,6 +168,21 @@ public:
   vtkBooleanMacro(MergeParts, bool);
   ///@}
 
+  ///@{
+  /**
+   * Boolean property determining whether arrays use the file content in place instead of a copy
+   * when possible (default is false).
+   *
+   * When true, the file is mapped in memory copy-on-write and the arrays stored contiguously,
+   * without filters (e.g. compression) and in the native type of this machine share the mapping
+   * (see vtkMemoryMappedFile). Their pages are then only read when accessed. Other arrays are read
+   * as usual.
+   */
+  vtkGetMacro(MemoryMapArrays, bool);
+  vtkSetMacro(MemoryMapArrays, bool);
+  vtkBooleanMacro(MemoryMapArrays, bool);
+  ///@}
+
   vtkSetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
   vtkGetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
 
@@ -300,6 +315,7 @@ protected:
   Implementation* Impl;
 
   bool UseCache = false;
+  bool MemoryMapArrays = false;
   struct DataCache;
   std::shared_ptr<DataCache> Cache;
 
@@ -457,6 +457,9 @@ void vtkHDFReader::Implementation::Close()
     H5Fclose(this->File);
     this->File = -1;
   }
+  // The mapped arrays keep their own reference to the mapping.
+  this->MappedFile = nullptr;
+  this->MappedFileFailed = false;
 }
 
 //------------------------------------------------------------------------------
@@ -1047,6 +1050,13 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
     size_t j = i << 1;
     numberOfTuples *= (fileExtent[j + 1] - fileExtent[j]);
   }
+  if (this->Reader->GetMemoryMapArrays())
+  {
+    if (vtkDataArray* mapped = this->NewMappedArray<T>(dataset, fileExtent, numberOfComponents))
+    {
+      return mapped;
+    }
+  }
   auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(NewVtkDataArray<T>());
   array->SetNumberOfComponents(numberOfComponents);
   array->SetNumberOfTuples(numberOfTuples);
@@ -1059,6 +1069,96 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
   return array;
 }
 
+//------------------------------------------------------------------------------
+template <typename T>
+vtkDataArray* vtkHDFReader::Implementation::NewMappedArray(
+  hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents)
+{
+  // The values must be stored contiguously, without filters, in the native type and the file must
+  // be accessed through the default driver, so that the address of the dataset is a file offset.
+  haddr_t address = H5Dget_offset(dataset);
+  if (address == HADDR_UNDEF)
+  {
+    return nullptr;
+  }
+  {
+    vtkHDF::ScopedH5PHandle fileAccess = H5Fget_access_plist(this->File);
+    if (fileAccess < 0 || H5Pget_driver(fileAccess) != H5FD_SEC2)
+    {
+      return nullptr;
+    }
+  }
+  {
+    vtkHDF::ScopedH5THandle fileType = H5Dget_type(dataset);
+    if (fileType < 0 || H5Tequal(fileType, TemplateTypeToHdfNativeType<T>()) <= 0)
+    {
+      return nullptr;
+    }
+  }
+
+  // The extent must select a contiguous range of values: all the dimensions but the first one
+  // are complete.
+  vtkHDF::ScopedH5SHandle filespace = H5Dget_space(dataset);
+  if (filespace < 0)
+  {
+    return nullptr;
+  }
+  int ndims = H5Sget_simple_extent_ndims(filespace);
+  size_t extentDims = fileExtent.size() >> 1;
+  if (ndims <= 0 || extentDims == 0 || extentDims > static_cast<size_t>(ndims))
+  {
+    return nullptr;
+  }
+  std::vector<hsize_t> dims(ndims);
+  H5Sget_simple_extent_dims(filespace, dims.data(), nullptr);
+  hsize_t valuesPerRow = 1;
+  for (size_t i = 1; i < dims.size(); ++i)
+  {
+    if (i < extentDims && (fileExtent[i * 2] != 0 || fileExtent[i * 2 + 1] != dims[i]))
+    {
+      return nullptr;
+    }
+    valuesPerRow *= dims[i];
+  }
+  hsize_t numberOfValues = (fileExtent[1] - fileExtent[0]) * valuesPerRow;
+  if (fileExtent[1] > dims[0] || numberOfValues == 0 || numberOfValues % numberOfComponents != 0)
+  {
+    return nullptr;
+  }
+  vtkTypeInt64 offset =
+    static_cast<vtkTypeInt64>(address + fileExtent[0] * valuesPerRow * sizeof(T));
+  if (offset % static_cast<vtkTypeInt64>(alignof(T)) != 0)
+  {
+    return nullptr;
+  }
+
+  if (!this->MappedFile)
+  {
+    if (this->MappedFileFailed)
+    {
+      return nullptr;
+    }
+    auto file = vtkSmartPointer<vtkMemoryMappedFile>::New();
+    if (!file->Map(this->FileName.c_str(), 0, -1, vtkMemoryMappedFile::COPY_ON_WRITE))
+    {
+      // Do not try again for the other arrays of this file.
+      this->MappedFileFailed = true;
+      return nullptr;
+    }
+    this->MappedFile = file;
+  }
+
+  auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(NewVtkDataArray<T>());
+  array->SetNumberOfComponents(static_cast<int>(numberOfComponents));
+  if (!array->SetMemoryMappedArray(
+        this->MappedFile, offset, static_cast<vtkIdType>(numberOfValues)))
+  {
+    array->Delete();
+    return nullptr;
+  }
+  return array;
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 bool vtkHDFReader::Implementation::NewArray(
@@ -11,6 +11,8 @@
 
 #include "vtkHDFReader.h"
 #include "vtkHDFUtilities.h"
+#include "vtkMemoryMappedFile.h" // For vtkMemoryMappedFile
+#include "vtkSmartPointer.h"     // For vtkSmartPointer
 #include "vtk_hdf5.h"
 #include <array>
 #include <map>
@@ -254,6 +256,9 @@ protected:
   template <typename T>
   bool NewArray(
     hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents, T* data);
+  template <typename T>
+  vtkDataArray* NewMappedArray(
+    hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents);
   vtkStringArray* NewStringArray(hid_t dataset, hsize_t size);
   ///@}
   /**
@@ -269,6 +274,9 @@ protected:
 private:
   std::string FileName;
   hid_t File;
+  // The file mapped in memory when the reader maps arrays, shared by the mapped arrays.
+  vtkSmartPointer<vtkMemoryMappedFile> MappedFile;
+  bool MappedFileFailed = false;
   hid_t VTKGroup;
   // in the same order as vtkDataObject::AttributeTypes: POINT, CELL, FIELD
   std::array<hid_t, 3> AttributeDataGroup;
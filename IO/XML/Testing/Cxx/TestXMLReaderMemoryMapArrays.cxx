@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Reads raw appended arrays with vtkXMLReader::MemoryMapArrays and checks
+// that the arrays use the mapped file, hold the written values and that
+// modifying them does not modify the file.
+
+#include "vtkMemoryMappedFile.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointSource.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <string>
+
+namespace
+{
+bool SameValues(vtkDataArray* a, vtkDataArray* b)
+{
+  if (a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetVariantValue(i) != b->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestXMLReaderMemoryMapArrays(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  std::string fileName = std::string(tempDir) + "/XMLReaderMemoryMapArrays.vtp";
+  delete[] tempDir;
+
+  vtkNew<vtkPointSource> source;
+  source->SetNumberOfPoints(10000);
+  source->SetOutputPointsPrecision(vtkAlgorithm::SINGLE_PRECISION);
+  source->Update();
+  vtkPolyData* input = source->GetOutput();
+  vtkNew<vtkUnsignedCharArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfValues(input->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < input->GetNumberOfPoints(); ++i)
+  {
+    scalars->SetValue(i, static_cast<unsigned char>(i % 256));
+  }
+  input->GetPointData()->SetScalars(scalars);
+
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetInputData(input);
+  writer->SetFileName(fileName.c_str());
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+  writer->SetCompressorTypeToNone();
+  writer->Write();
+
+  vtkNew<vtkXMLPolyDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->MemoryMapArraysOn();
+  reader->Update();
+
+  vtkDataArray* points = reader->GetOutput()->GetPoints()->GetData();
+  auto readScalars =
+    vtkUnsignedCharArray::SafeDownCast(reader->GetOutput()->GetPointData()->GetArray("Scalars"));
+  if (!points || !readScalars)
+  {
+    std::cerr << "Missing arrays." << std::endl;
+    return EXIT_FAILURE;
+  }
+  // The writer uses the byte order of this machine and bytes are always
+  // aligned, so the scalars are mapped. The points are mapped only when their
+  // position in the file is aligned for float.
+  if (!readScalars->GetMemoryMappedFile())
+  {
+    std::cerr << "The scalars were not mapped." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameValues(points, input->GetPoints()->GetData()) || !SameValues(readScalars, scalars))
+  {
+    std::cerr << "The mapped values differ from the written ones." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The mapping is copy-on-write: the file is not modified.
+  readScalars->SetValue(0, 255);
+  vtkNew<vtkXMLPolyDataReader> otherReader;
+  otherReader->SetFileName(fileName.c_str());
+  otherReader->Update();
+  vtkDataArray* otherScalars = otherReader->GetOutput()->GetPointData()->GetArray("Scalars");
+  if (!otherScalars || otherScalars->GetTuple1(0) != 0.0 || readScalars->GetValue(0) != 255)
+  {
+    std::cerr << "Modifying a mapped array modified the file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Growing the array copies it out of the mapping.
+  const vtkIdType last = readScalars->InsertNextValue(7);
+  if (readScalars->GetMemoryMappedFile() || readScalars->GetValue(1) != 1 ||
+    readScalars->GetValue(last) != 7)
+  {
+    std::cerr << "Growing a mapped array failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkXMLReader.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkBitArray.h"
 #include "vtkCallbackCommand.h"
@@ -25,6 +26,7 @@
 #include "vtkInformationVector.h"
 #include "vtkLZ4DataCompressor.h"
 #include "vtkLZMADataCompressor.h"
+#include "vtkMemoryMappedFile.h"
 #include "vtkObjectFactory.h"
 #include "vtkQuadratureSchemeDefinition.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -132,6 +134,9 @@ vtkXMLReader::vtkXMLReader()
   this->FileStream = nullptr;
   this->StringStream = nullptr;
   this->ReadFromInputString = 0;
+  this->MemoryMapArrays = 0;
+  this->MappedFile = nullptr;
+  this->MappedFileFailed = false;
   this->InputString = "";
   this->InputArray = nullptr;
   this->XMLParser = nullptr;
@@ -192,6 +197,10 @@ vtkXMLReader::~vtkXMLReader()
     this->DestroyXMLParser();
   }
   this->CloseStream();
+  if (this->MappedFile)
+  {
+    this->MappedFile->Delete();
+  }
   this->CellDataArraySelection->RemoveObserver(this->SelectionObserver);
   this->PointDataArraySelection->RemoveObserver(this->SelectionObserver);
   this->ColumnArraySelection->RemoveObserver(this->SelectionObserver);
@@ -222,6 +231,7 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PointDataArraySelection: " << this->PointDataArraySelection << "\n";
   os << indent << "ColumnArraySelection: " << this->PointDataArraySelection << "\n";
   os << indent << "TimeDataStringArray: " << this->TimeDataStringArray << "\n";
+  os << indent << "MemoryMapArrays: " << this->MemoryMapArrays << "\n";
   if (this->Stream)
   {
     os << indent << "Stream: " << this->Stream << "\n";
@@ -448,6 +458,13 @@ void vtkXMLReader::CloseVTKFile()
     delete this->FileStream;
     this->FileStream = nullptr;
   }
+  // The mapped arrays keep their own reference to the mapping.
+  if (this->MappedFile)
+  {
+    this->MappedFile->Delete();
+    this->MappedFile = nullptr;
+  }
+  this->MappedFileFailed = false;
 }
 
 //------------------------------------------------------------------------------
@@ -816,6 +833,18 @@ int vtkXMLDataReaderReadArrayValues(vtkXMLDataElement* da, vtkXMLDataParser* xml
   return result;
 }
 
+//------------------------------------------------------------------------------
+template <class T>
+int vtkXMLReaderMapArrayValues(vtkAOSDataArrayTemplate<T>* array, vtkMemoryMappedFile* file,
+  vtkTypeInt64 position, vtkIdType numValues)
+{
+  if (!array || position % static_cast<vtkTypeInt64>(alignof(T)) != 0)
+  {
+    return 0;
+  }
+  return array->SetMemoryMappedArray(file, position, numValues) ? 1 : 0;
+}
+
 //------------------------------------------------------------------------------
 template <>
 int vtkXMLDataReaderReadArrayValues(vtkXMLDataElement* da, vtkXMLDataParser* xmlparser,
@@ -977,12 +1006,19 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
                                << arrayIndex + numValues << " were requested to be read");
     return 0;
   }
-  switch (array->GetDataType())
+  if (this->MemoryMapArrays && this->MapArrayValues(da, arrayIndex, array, startIndex, numValues))
   {
-    vtkArrayIteratorTemplateMacro(result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
-                                    arrayIndex, static_cast<VTK_TT*>(iter), startIndex, numValues));
-    default:
-      result = 0;
+    result = 1;
+  }
+  else
+  {
+    switch (array->GetDataType())
+    {
+      vtkArrayIteratorTemplateMacro(result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
+                                      arrayIndex, static_cast<VTK_TT*>(iter), startIndex, numValues));
+      default:
+        result = 0;
+    }
   }
   if (iter)
   {
@@ -1002,6 +1038,54 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
   return result;
 }
 
+//------------------------------------------------------------------------------
+int vtkXMLReader::MapArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
+  vtkAbstractArray* array, vtkIdType startIndex, vtkIdType numValues)
+{
+  // The mapped values replace the storage of the array, they must fill it.
+  if (arrayIndex != 0 || numValues <= 0 || numValues != array->GetNumberOfValues() ||
+    this->ReadFromInputString || !this->FileName || !this->FileStream ||
+    this->Stream != this->FileStream || !da->GetAttribute("offset"))
+  {
+    return 0;
+  }
+  vtkTypeInt64 offset = 0;
+  da->GetScalarAttribute("offset", offset);
+  const vtkTypeInt64 position = this->XMLParser->GetRawAppendedDataPosition(
+    offset, static_cast<vtkTypeUInt64>(startIndex), static_cast<size_t>(numValues),
+    array->GetDataType());
+  if (position < 0)
+  {
+    return 0;
+  }
+
+  if (!this->MappedFile)
+  {
+    if (this->MappedFileFailed)
+    {
+      return 0;
+    }
+    this->MappedFile = vtkMemoryMappedFile::New();
+    if (!this->MappedFile->Map(this->FileName, 0, -1, vtkMemoryMappedFile::COPY_ON_WRITE))
+    {
+      // Do not try again for the other arrays of this file.
+      this->MappedFile->Delete();
+      this->MappedFile = nullptr;
+      this->MappedFileFailed = true;
+      return 0;
+    }
+  }
+
+  switch (array->GetDataType())
+  {
+    vtkTemplateMacro(return vtkXMLReaderMapArrayValues(
+      vtkArrayDownCast<vtkAOSDataArrayTemplate<VTK_TT>>(array), this->MappedFile, position,
+      numValues));
+    default:
+      return 0;
+  }
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLReader::ReadArrayTuples(vtkXMLDataElement* da, vtkIdType arrayTupleIndex,
   vtkAbstractArray* array, vtkIdType startTupleIndex, vtkIdType numTuples, FieldType fieldType)
@@ -31,6 +31,7 @@ class vtkXMLDataElement;
 class vtkXMLDataParser;
 class vtkInformationVector;
 class vtkInformation;
+class vtkMemoryMappedFile;
 class vtkStringArray;
 
 class VTKIOXML_EXPORT vtkXMLReader : public vtkAlgorithm
@@ -54,6 +55,20 @@ public:
   vtkGetFilePathMacro(FileName);
   ///@}
 
+  ///@{
+  /**
+   * When on, arrays stored in the appended section of the file with the raw
+   * encoding, without compression and in the byte order of this machine use
+   * the file content in place instead of a copy: the file is mapped in memory
+   * copy-on-write and the arrays share the mapping (see vtkMemoryMappedFile).
+   * Other arrays are read as usual. Only applies when reading from a file.
+   * Default is off.
+   */
+  vtkSetMacro(MemoryMapArrays, vtkTypeBool);
+  vtkGetMacro(MemoryMapArrays, vtkTypeBool);
+  vtkBooleanMacro(MemoryMapArrays, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Enable reading from an InputString instead of the default, a file.
@@ -351,6 +366,15 @@ protected:
   virtual int ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
     vtkIdType startIndex, vtkIdType numValues, FieldType type = OTHER);
 
+  /**
+   * Make the array use the mapped file content for its numValues values
+   * starting at startIndex instead of reading them. Only possible when they
+   * fill the whole array and can be used in place (see MemoryMapArrays).
+   * Returns 1 on success, 0 when the values must be read.
+   */
+  int MapArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
+    vtkIdType startIndex, vtkIdType numValues);
+
   /**
    * Read an Array values starting at the given tuple index and up to numTuples
    * taking into account the number of components declared in array.
@@ -418,6 +442,13 @@ protected:
   // Default is 0: read from file.
   vtkTypeBool ReadFromInputString;
 
+  // Whether raw appended arrays use the mapped file content in place.
+  vtkTypeBool MemoryMapArrays;
+
+  // The input file mapped in memory, shared by the mapped arrays.
+  vtkMemoryMappedFile* MappedFile;
+  bool MappedFileFailed;
+
   // The input string.
   std::string InputString;
 
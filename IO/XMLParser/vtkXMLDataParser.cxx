@@ -37,6 +37,7 @@ vtkXMLDataParser::vtkXMLDataParser()
   this->AppendedDataPosition = 0;
   this->AppendedDataMatched = 0;
   this->AppendedDataFound = false;
+  this->AppendedDataIsRaw = false;
   this->DataStream = nullptr;
   this->InlineDataStream = vtkBase64InputStream::New();
   this->AppendedDataStream = vtkBase64InputStream::New();
@@ -165,6 +166,7 @@ void vtkXMLDataParser::StartElement(const char* name, const char** atts)
     {
       this->AppendedDataStream->Delete();
       this->AppendedDataStream = vtkInputStream::New();
+      this->AppendedDataIsRaw = true;
     }
   }
 }
@@ -889,6 +891,39 @@ size_t vtkXMLDataParser::ReadBinaryData(
   return this->Abort ? 0 : actualWords;
 }
 
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkXMLDataParser::GetRawAppendedDataPosition(
+  vtkTypeInt64 offset, vtkTypeUInt64 startWord, size_t numWords, int wordType)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  const int hostByteOrder = vtkXMLDataParser::BigEndian;
+#else
+  const int hostByteOrder = vtkXMLDataParser::LittleEndian;
+#endif
+  if (!this->AppendedDataIsRaw || this->Compressor || this->ByteOrder != hostByteOrder ||
+    !this->Stream)
+  {
+    return -1;
+  }
+
+  // Read the length of the data.
+  std::unique_ptr<vtkXMLDataHeader> uh(vtkXMLDataHeader::New(this->HeaderType, 1));
+  const vtkTypeInt64 position = this->AppendedDataPosition + offset;
+  this->Stream->clear(this->Stream->rdstate() & ~ios::failbit);
+  this->Stream->clear(this->Stream->rdstate() & ~ios::eofbit);
+  this->SeekG(position);
+  if (!this->Stream->read(reinterpret_cast<char*>(uh->Data()), uh->DataSize()))
+  {
+    return -1;
+  }
+  const size_t wordSize = this->GetWordTypeSize(wordType);
+  if ((startWord + numWords) * wordSize > uh->Get(0))
+  {
+    return -1;
+  }
+  return position + static_cast<vtkTypeInt64>(uh->DataSize() + startWord * wordSize);
+}
+
 //------------------------------------------------------------------------------
 size_t vtkXMLDataParser::ReadAsciiData(
   void* buffer, vtkTypeUInt64 startWord, size_t numWords, int wordType)
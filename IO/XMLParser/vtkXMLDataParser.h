@@ -82,6 +82,16 @@ public:
    */
   size_t ReadBinaryData(void* buffer, vtkTypeUInt64 startWord, size_t maxWords, int wordType);
 
+  /**
+   * Return the position in the input stream of word @a startWord of the
+   * appended data starting at the given appended data offset, if the words
+   * can be used in place: the appended data must be raw encoded,
+   * uncompressed, in the byte order of this machine and hold at least
+   * @a numWords words from @a startWord. Returns -1 otherwise.
+   */
+  vtkTypeInt64 GetRawAppendedDataPosition(
+    vtkTypeInt64 offset, vtkTypeUInt64 startWord, size_t numWords, int wordType);
+
   ///@{
   /**
    * Get/Set the compressor used to decompress binary and appended data
@@ -207,6 +217,9 @@ protected:
   // Whether AppendedData has been dealt with or not.
   bool AppendedDataFound;
 
+  // Whether the appended data is stored raw rather than base64 encoded.
+  bool AppendedDataIsRaw;
+
   // The byte order of the binary input.
   int ByteOrder;
 